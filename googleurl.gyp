@@ -5,6 +5,17 @@
 {
   'variables': {
     'chromium_code': 1,
+    # Set to 1 to convert IDN host names with ICU's uidna_IDNToASCII instead
+    # of the built-in engine in url_canon_idna.cc.
+    'googleurl_use_icu_idna%': 0,
+    # Set to 0 to leave out ICUCharsetConverter and the pooled converters in
+    # url_canon_icu_pool.h. Without them, and with the built-in IDNA engine,
+    # the library doesn't link ICU at all. The tests use the converters, so
+    # they need this.
+    'googleurl_use_icu_converters%': 1,
+    # Set to 1 to build in the per-thread slow path counters declared in
+    # url_canon_stats.h.
+    'googleurl_enable_canon_stats%': 0,
   },
   'targets': [
     {
@@ -12,20 +23,53 @@
       'type': '<(component)',
       'dependencies': [
         '../base/base.gyp:base',
-        '../third_party/icu/icu.gyp:icudata',
-        '../third_party/icu/icu.gyp:icui18n',
-        '../third_party/icu/icu.gyp:icuuc',
       ],
       'sources': [
         'src/gurl.cc',
         'src/gurl.h',
+        'src/gurl_arena.cc',
+        'src/gurl_arena.h',
+        'src/gurl_compact.cc',
+        'src/gurl_compact.h',
+        'src/gurl_domain_matcher.cc',
+        'src/gurl_domain_matcher.h',
+        'src/gurl_hash.cc',
+        'src/gurl_hash.h',
+        'src/gurl_host_address.cc',
+        'src/gurl_host_address.h',
+        'src/gurl_lazy.cc',
+        'src/gurl_lazy.h',
+        'src/gurl_origin.cc',
+        'src/gurl_origin.h',
+        'src/gurl_pattern_matcher.cc',
+        'src/gurl_pattern_matcher.h',
+        'src/gurl_query_iterator.cc',
+        'src/gurl_query_iterator.h',
+        'src/gurl_resolver.cc',
+        'src/gurl_resolver.h',
+        'src/gurl_store.cc',
+        'src/gurl_store.h',
+        'src/gurl_table.cc',
+        'src/gurl_table.h',
+        'src/gurl_trusted.h',
+        'src/gurl_view.cc',
+        'src/gurl_view.h',
         'src/url_canon.h',
+        'src/url_canon_arena.cc',
+        'src/url_canon_arena.h',
+        'src/url_canon_char_class.h',
+        'src/url_canon_char_class_tables.h',
         'src/url_canon_etc.cc',
         'src/url_canon_fileurl.cc',
         'src/url_canon_filesystemurl.cc',
+        'src/url_canon_fused.cc',
+        'src/url_canon_fused.h',
         'src/url_canon_host.cc',
-        'src/url_canon_icu.cc',
-        'src/url_canon_icu.h',
+        'src/url_canon_host_cache.h',
+        'src/url_canon_host_classify.h',
+        'src/url_canon_idna.cc',
+        'src/url_canon_idna.h',
+        'src/url_canon_idna_tables.h',
         'src/url_canon_internal.cc',
         'src/url_canon_internal.h',
         'src/url_canon_internal_file.h',
@@ -35,16 +79,37 @@
         'src/url_canon_path.cc',
         'src/url_canon_pathurl.cc',
         'src/url_canon_query.cc',
+        'src/url_canon_query_converter.h',
+        'src/url_canon_query_policy.h',
         'src/url_canon_relative.cc',
+        'src/url_canon_simd.cc',
+        'src/url_canon_simd.h',
+        'src/url_canon_stats.cc',
+        'src/url_canon_stats.h',
         'src/url_canon_stdstring.h',
         'src/url_canon_stdurl.cc',
         'src/url_file.h',
         'src/url_parse.cc',
         'src/url_parse.h',
+        'src/url_parse_component.h',
+        'src/url_parse_data.cc',
+        'src/url_parse_data.h',
         'src/url_parse_file.cc',
         'src/url_parse_internal.h',
+        'src/url_parse_packed.cc',
+        'src/url_parse_packed.h',
+        'src/url_scheme_registry.h',
+        'src/url_string_piece.h',
         'src/url_util.cc',
         'src/url_util.h',
+        'src/url_util_batch.cc',
+        'src/url_util_batch.h',
+        'src/url_util_canonical.h',
+        'src/url_util_decode.h',
+        'src/url_util_extract.cc',
+        'src/url_util_extract.h',
+        'src/url_util_sort_key.cc',
+        'src/url_util_sort_key.h',
       ],
       'direct_dependent_settings': {
         'include_dirs': [
@@ -66,6 +131,34 @@
             ],
           },
         }],
+        ['googleurl_use_icu_converters==1 or googleurl_use_icu_idna==1', {
+          'dependencies': [
+            '../third_party/icu/icu.gyp:icudata',
+            '../third_party/icu/icu.gyp:icui18n',
+            '../third_party/icu/icu.gyp:icuuc',
+          ],
+          'sources': [
+            'src/url_canon_icu.cc',
+            'src/url_canon_icu.h',
+            'src/url_canon_icu_pool.h',
+          ],
+        }],
+        ['googleurl_use_icu_idna==1', {
+          'defines': [
+            'GURL_USE_ICU_IDNA=1',
+          ],
+        }],
+        ['googleurl_enable_canon_stats==1', {
+          'defines': [
+            'GURL_ENABLE_CANON_STATS=1',
+          ],
+        }],
+        ['os_posix==1', {
+          'sources': [
+            'src/url_util_bulk.cc',
+            'src/url_util_bulk.h',
+          ],
+        }],
       ],
       # TODO(jschuh): crbug.com/167187 fix size_t to int truncations.
       'msvs_disabled_warnings': [4267, ],
@@ -104,5 +197,44 @@
       # TODO(jschuh): crbug.com/167187 fix size_t to int truncations.
       'msvs_disabled_warnings': [4267, ],
     },
+    {
+      'target_name': 'googleurl_perftests',
+      'type': 'executable',
+      'dependencies': [
+        'googleurl',
+        '../base/base.gyp:test_support_perf',
+        '../testing/gtest.gyp:gtest',
+        '../third_party/icu/icu.gyp:icuuc',
+      ],
+      'sources': [
+        'src/url_perftest.cc',
+      ],
+      'defines': [
+        'FULL_FILESYSTEM_URL_SUPPORT=1',
+      ],
+      # TODO(jschuh): crbug.com/167187 fix size_t to int truncations.
+      'msvs_disabled_warnings': [4267, ],
+    },
+  ],
+  'conditions': [
+    ['os_posix==1', {
+      'targets': [
+        {
+          'target_name': 'googleurl_bulk',
+          'type': 'executable',
+          'dependencies': [
+            'googleurl',
+          ],
+          'sources': [
+            'src/url_util_bulk_main.cc',
+          ],
+          'link_settings': {
+            'libraries': [
+              '-lpthread',
+            ],
+          },
+        },
+      ],
+    }],
   ],
 }
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# Copyright 2013 The Chromium Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Generates url_canon_char_class_tables.h, the fused character class table.
+
+Every byte gets one 32-bit entry: the low byte is its canonical (ASCII
+lower-cased) form and the bits above say which classes it's in, so a loop
+that needs to know several things about a character makes one load. The
+class bits must match the CharClass enum in url_canon_char_class.h, and the
+shared ones must match kSharedCharTypeTable in url_canon_internal.cc (the
+unit tests check both). The output is checked in; rerun this script after
+changing a class:
+
+  python3 gen_url_canon_char_class_tables.py > url_canon_char_class_tables.h
+"""
+
+import string
+import sys
+
+DIGITS = string.digits
+LETTERS = string.ascii_letters
+ALNUM = DIGITS + LETTERS
+
+# In the same order as the CharClass enum, starting at bit 8.
+CLASSES = [
+    # The SharedCharTypes of url_canon_internal.h, shifted up a byte.
+    ('QUERY', set(chr(c) for c in range(0x21, 0x7f)) - set('"#<>')),
+    ('USERINFO', set(ALNUM + "!$%&'()*+,-._~")),
+    ('IPV4', set(DIGITS + 'abcdefABCDEF.xX')),
+    ('HEX', set(string.hexdigits)),
+    ('DEC', set(DIGITS)),
+    ('OCT', set(string.octdigits)),
+    ('COMPONENT', set(ALNUM + "!'()*-._~")),
+    # Host characters that are kept as they are, apart from lower-casing,
+    # and ones that are valid but escaped. Anything in neither is invalid.
+    ('HOST', set(ALNUM + '+-.:[]_')),
+    ('HOST_ESCAPE', set(' !"#$&\'()*,<=>@`{|}')),
+    ('SCHEME', set(ALNUM + '+-.')),
+    ('SCHEME_FIRST', set(LETTERS)),
+    ('WHITESPACE', set('\t\n\r')),
+    ('AUTHORITY_TERMINATOR', set('/\\?#')),
+    ('NON_ASCII', set(chr(c) for c in range(0x80, 0x100))),
+]
+
+
+def canonical(c):
+  if c < 0x80:
+    return ord(chr(c).lower())
+  return c
+
+
+def char_name(c):
+  if c < 0x21 or c >= 0x7f:
+    return ''
+  # Quoted, so that a backslash doesn't continue the comment to the next line.
+  return " '%s'" % chr(c)
+
+
+def main():
+  out = sys.stdout
+  out.write('// Generated by gen_url_canon_char_class_tables.py. Do not edit.\n\n')
+  out.write('#ifndef GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__\n')
+  out.write('#define GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__\n\n')
+  out.write('namespace url_canon {\n\n')
+  out.write('const uint32 kCharClassTable[0x100] = {\n')
+  for c in range(0x100):
+    value = canonical(c)
+    for bit, (_, members) in enumerate(CLASSES):
+      if chr(c) in members:
+        value |= 1 << (bit + 8)
+    out.write('  0x%08X,  // 0x%02x%s\n' % (value, c, char_name(c)))
+  out.write('};\n\n')
+  out.write('}  // namespace url_canon\n\n')
+  out.write('#endif  // GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__\n')
+
+
+if __name__ == '__main__':
+  sys.exit(main())
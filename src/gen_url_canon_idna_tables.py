@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+# Copyright 2013 The Chromium Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Generates url_canon_idna_tables.h, the data for the built-in IDNA engine.
+
+IDNA 2003 host names are prepared with the "nameprep" profile of stringprep
+(RFC 3491), which is defined against Unicode 3.2. Python ships exactly that
+data as unicodedata.ucd_3_2_0 and the stringprep module, so the tables come
+from there rather than from whatever Unicode version the host happens to
+have. The output is checked in so that building the library doesn't need
+Python; rerun this script only to change the table format:
+
+  python3 gen_url_canon_idna_tables.py > url_canon_idna_tables.h
+"""
+
+import stringprep
+import sys
+import unicodedata
+
+ucd = unicodedata.ucd_3_2_0
+
+MAX_CODE_POINT = 0x10FFFF
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def code_points():
+  for cp in range(MAX_CODE_POINT + 1):
+    if 0xD800 <= cp <= 0xDFFF:
+      continue  # Surrogates never make it to the engine.
+    yield cp
+
+
+def is_assigned(ch):
+  return ucd.category(ch) != 'Cn'
+
+
+def nameprep_map(ch):
+  """Step 1 of nameprep: table B.1 maps to nothing, B.2 case folds."""
+  if stringprep.in_table_b1(ch):
+    return u''
+  # map_table_b2 lower-cases with the current Unicode data, which has gained
+  # case pairs (Cherokee, Georgian, ...) since 3.2. Table B.2 only has
+  # mappings between characters that 3.2 assigns; anything else is
+  # unassigned and passes through.
+  mapped = stringprep.map_table_b2(ch)
+  if not is_assigned(ch) or not all(is_assigned(c) for c in mapped):
+    return ch
+  return mapped
+
+
+def build_mappings():
+  """Returns (entries, pool) for the per-character decompositions.
+
+  Each code point that maps or decomposes to something other than itself
+  gets the full compatibility decomposition of its nameprep mapping. Hangul
+  syllables are left out; they're decomposed algorithmically.
+  """
+  entries = []
+  pool = []
+  offsets = {}
+  for cp in code_points():
+    if HANGUL_FIRST <= cp <= HANGUL_LAST:
+      continue
+    ch = chr(cp)
+    decomposed = ucd.normalize('NFKD', nameprep_map(ch))
+    if decomposed == ch:
+      continue
+    values = tuple(ord(c) for c in decomposed)
+    if values not in offsets:
+      offsets[values] = len(pool)
+      pool.extend(values)
+    entries.append((cp, offsets[values], len(values)))
+  return entries, pool
+
+
+def build_ranges(predicate):
+  """Returns the [first, last] ranges of code points matching |predicate|."""
+  ranges = []
+  for cp in code_points():
+    if not predicate(cp):
+      continue
+    if ranges and ranges[-1][1] == cp - 1:
+      ranges[-1][1] = cp
+    elif ranges and ranges[-1][1] == 0xD7FF and cp == 0xE000:
+      ranges[-1][1] = cp  # Bridge the surrogate gap.
+    else:
+      ranges.append([cp, cp])
+  return ranges
+
+
+def build_combining_classes():
+  ranges = []
+  for cp in code_points():
+    ccc = ucd.combining(chr(cp))
+    if not ccc:
+      continue
+    if ranges and ranges[-1][1] == cp - 1 and ranges[-1][2] == ccc:
+      ranges[-1][1] = cp
+    else:
+      ranges.append([cp, cp, ccc])
+  return ranges
+
+
+def build_compositions():
+  """Returns (first, second, composite) for the primary composites."""
+  compositions = []
+  for cp in code_points():
+    if HANGUL_FIRST <= cp <= HANGUL_LAST:
+      continue
+    decomposition = ucd.decomposition(chr(cp))
+    if not decomposition or decomposition.startswith('<'):
+      continue
+    parts = [int(part, 16) for part in decomposition.split()]
+    if len(parts) != 2:
+      continue
+    pair = chr(parts[0]) + chr(parts[1])
+    if ucd.normalize('NFC', pair) != chr(cp):
+      continue  # Composition exclusion.
+    compositions.append((parts[0], parts[1], cp))
+  compositions.sort()
+  return compositions
+
+
+def is_prohibited(cp):
+  ch = chr(cp)
+  return (stringprep.in_table_c12(ch) or stringprep.in_table_c22(ch) or
+          stringprep.in_table_c3(ch) or stringprep.in_table_c4(ch) or
+          stringprep.in_table_c5(ch) or stringprep.in_table_c6(ch) or
+          stringprep.in_table_c7(ch) or stringprep.in_table_c8(ch) or
+          stringprep.in_table_c9(ch))
+
+
+# Blocks whose unassigned code points default to a right-to-left bidi class.
+DEFAULT_RTL_BLOCKS = [
+    (0x0590, 0x08FF), (0xFB1D, 0xFDCF), (0xFDF0, 0xFDFF), (0xFE70, 0xFEFF),
+    (0x10800, 0x10FFF), (0x1E800, 0x1EFFF),
+]
+
+# Unassigned code points that default to something other than L: currency
+# symbols (ET) and default ignorables (BN). Noncharacters are BN as well.
+DEFAULT_NEUTRAL_BLOCKS = [
+    (0x20A0, 0x20CF), (0x2060, 0x206F), (0xFDD0, 0xFDEF), (0xFFF0, 0xFFF8),
+    (0xE0000, 0xE0FFF),
+]
+
+
+def default_bidi_class(cp):
+  if any(first <= cp <= last for first, last in DEFAULT_RTL_BLOCKS):
+    return 'R'
+  if (cp & 0xFFFE) == 0xFFFE:
+    return None
+  if any(first <= cp <= last for first, last in DEFAULT_NEUTRAL_BLOCKS):
+    return None
+  return 'L'
+
+
+def bidi_class(ch):
+  """Like stringprep's D.1/D.2 split, but extended past Unicode 3.2.
+
+  Tables D.1 and D.2 only list characters 3.2 assigns, while ICU checks
+  unassigned ones against its current bidi data. To give the same answers,
+  characters that 3.2 leaves unassigned take their current class, and ones
+  that are still unassigned take the default for where they are.
+  """
+  if is_assigned(ch):
+    if stringprep.in_table_d1(ch):
+      return 'R'
+    return 'L' if stringprep.in_table_d2(ch) else None
+  current = unicodedata.bidirectional(ch)
+  if not current:
+    return default_bidi_class(ord(ch))
+  if current in ('R', 'AL'):
+    return 'R'
+  return 'L' if current == 'L' else None
+
+
+def write_ranges(out, name, ranges):
+  out.write('const IDNARange %s[] = {\n' % name)
+  for first, last in ranges:
+    out.write('  { 0x%04X, 0x%04X },\n' % (first, last))
+  out.write('};\n\n')
+
+
+def main():
+  out = sys.stdout
+  out.write('// Generated by gen_url_canon_idna_tables.py from Unicode %s.\n'
+            % ucd.unidata_version)
+  out.write('// Do not edit.\n\n')
+  out.write('#ifndef GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__\n')
+  out.write('#define GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__\n\n')
+  out.write('namespace url_canon {\n\n')
+
+  entries, pool = build_mappings()
+  out.write('// Nameprep mapping followed by compatibility decomposition, for\n')
+  out.write('// every code point where that changes anything.\n')
+  out.write('const uint32 kIDNAMappingPool[] = {\n')
+  for i in range(0, len(pool), 8):
+    out.write('  ' + ' '.join('0x%04X,' % v for v in pool[i:i + 8]) + '\n')
+  out.write('};\n\n')
+  out.write('const IDNAMapping kIDNAMappings[] = {\n')
+  for cp, offset, length in entries:
+    out.write('  { 0x%04X, %d, %d },\n' % (cp, offset, length))
+  out.write('};\n\n')
+
+  out.write('// Canonical combining classes other than 0.\n')
+  out.write('const IDNACombiningClass kIDNACombiningClasses[] = {\n')
+  for first, last, ccc in build_combining_classes():
+    out.write('  { 0x%04X, 0x%04X, %d },\n' % (first, last, ccc))
+  out.write('};\n\n')
+
+  compositions = build_compositions()
+  out.write('// Canonical compositions, sorted by the pair they compose.\n')
+  out.write('const IDNAComposition kIDNACompositions[] = {\n')
+  for first, second, composite in compositions:
+    out.write('  { 0x%04X, 0x%04X, 0x%04X },\n' % (first, second, composite))
+  out.write('};\n\n')
+
+  # Almost everything that composes with the character before it is a
+  # combining mark. The few starters that do are listed so the engine can
+  # skip the composition lookup for every other starter.
+  starters = sorted(set(second for _, second, _ in compositions
+                        if not ucd.combining(chr(second))))
+  out.write('// Characters of combining class 0 that compose with the one\n')
+  out.write('// before them, apart from Hangul jamo.\n')
+  out.write('const uint32 kIDNAComposingStarters[] = {\n')
+  for i in range(0, len(starters), 8):
+    out.write('  ' + ' '.join('0x%04X,' % v for v in starters[i:i + 8]) + '\n')
+  out.write('};\n\n')
+
+  out.write('// Nameprep prohibited output: tables C.1.2, C.2.2 and C.3-C.9.\n')
+  write_ranges(out, 'kIDNAProhibited', build_ranges(is_prohibited))
+  out.write('// Bidi tables D.1 (RandALCat) and D.2 (LCat), extended to code\n')
+  out.write('// points that Unicode 3.2 leaves unassigned.\n')
+  write_ranges(out, 'kIDNARandAL',
+               build_ranges(lambda cp: bidi_class(chr(cp)) == 'R'))
+  write_ranges(out, 'kIDNAL',
+               build_ranges(lambda cp: bidi_class(chr(cp)) == 'L'))
+
+  out.write('}  // namespace url_canon\n\n')
+  out.write('#endif  // GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__\n')
+
+
+if __name__ == '__main__':
+  sys.exit(main())
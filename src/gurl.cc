@@ -29,8 +29,6 @@
 
 #ifdef WIN32
 #include <windows.h>
-#else
-#include <pthread.h>
 #endif
 
 #include <algorithm>
@@ -39,7 +37,12 @@
 #include "googleurl/src/gurl.h"
 
 #include "base/logging.h"
+#include "googleurl/src/gurl_trusted.h"
+#include "googleurl/src/gurl_view.h"
+#include "googleurl/src/url_canon_host_classify.h"
+#include "googleurl/src/url_canon_internal.h"
 #include "googleurl/src/url_canon_stdstring.h"
+#include "googleurl/src/url_scheme_registry.h"
 #include "googleurl/src/url_util.h"
 
 namespace {
@@ -63,46 +66,234 @@ bool InitCanonical(const STR& input_spec,
   return success;
 }
 
+// Size of the stack buffer InitCanonical canonicalizes 8-bit input into.
+// Input that doesn't fit with room for a few escapes goes straight into the
+// std::string as above.
+const int kInitCanonicalStackSize = 1024;
+
+// Canonicalizes 8-bit input into a stack buffer and then copies it into an
+// exactly-sized string, so the spec doesn't keep the 32 bytes of slack the
+// generic path reserves for escapes.
+bool InitCanonical(const std::string& input_spec,
+                   std::string* canonical,
+                   url_parse::Parsed* parsed) {
+  if (input_spec.size() + 32 > static_cast<size_t>(kInitCanonicalStackSize))
+    return InitCanonical<std::string>(input_spec, canonical, parsed);
+
+  url_canon::RawCanonOutput<kInitCanonicalStackSize> output;
+  bool success = url_util::Canonicalize(
+      input_spec.data(), static_cast<int>(input_spec.length()),
+      NULL, &output, parsed);
+  canonical->assign(output.data(), output.length());
+  return success;
+}
+
+// Sets up the sources of a replacement's components, converting 16-bit ones
+// to UTF-8 first just like ReplaceStandardURL does.
+void SetupReplacedComponents(const char* base,
+                             const url_canon::Replacements<char>& repl,
+                             url_canon::CanonOutput* /* utf8_buffer */,
+                             url_canon::URLComponentSource<char>* source,
+                             url_parse::Parsed* parsed) {
+  url_canon::SetupOverrideComponents(base, repl, source, parsed);
+}
+
+void SetupReplacedComponents(const char* base,
+                             const url_canon::Replacements<char16>& repl,
+                             url_canon::CanonOutput* utf8_buffer,
+                             url_canon::URLComponentSource<char>* source,
+                             url_parse::Parsed* parsed) {
+  url_canon::SetupUTF16OverrideComponents(base, repl, utf8_buffer, source,
+                                          parsed);
+}
+
+// Fast path for GURL::ReplaceComponents when nothing but the query and ref
+// of a standard or file URL change, like stripping the ref. The spec is
+// valid and so canonical, and each component of those URLs is canonicalized
+// on its own, so everything up to the first replaced component is copied as
+// it is and only the replaced ones are canonicalized. Returns false, having
+// written nothing, for any other replacement.
+template<typename CHAR>
+bool ReplaceQueryAndRef(const std::string& spec,
+                        const url_parse::Parsed& parsed,
+                        const url_canon::Replacements<CHAR>& replacements,
+                        url_canon::CanonOutput* output,
+                        url_parse::Parsed* new_parsed) {
+  if (replacements.IsSchemeOverridden() ||
+      replacements.IsUsernameOverridden() ||
+      replacements.IsPasswordOverridden() ||
+      replacements.IsHostOverridden() ||
+      replacements.IsPortOverridden() ||
+      replacements.IsPathOverridden())
+    return false;
+  bool query_overridden = replacements.IsQueryOverridden();
+  if (!query_overridden && !replacements.IsRefOverridden())
+    return false;
+  const url_util::SchemeInfo* scheme_info =
+      url_util::FindSchemeInfo(spec.data(), parsed.scheme);
+  if (!scheme_info || (scheme_info->type != url_util::SCHEME_STANDARD &&
+                       scheme_info->type != url_util::SCHEME_FILE))
+    return false;
+
+  url_canon::RawCanonOutput<256> utf8;
+  url_canon::URLComponentSource<char> source(spec.data());
+  url_parse::Parsed replaced(parsed);
+  SetupReplacedComponents(spec.data(), replacements, &utf8, &source,
+                          &replaced);
+
+  int copy_end = parsed.CountCharactersBefore(
+      query_overridden ? url_parse::Parsed::QUERY : url_parse::Parsed::REF,
+      true);
+  output->Append(spec.data(), copy_end);
+  *new_parsed = parsed;
+  if (query_overridden) {
+    url_canon::CanonicalizeQuery(source.query, replaced.query, NULL, output,
+                                 &new_parsed->query);
+  }
+  url_canon::CanonicalizeRef(source.ref, replaced.ref, output,
+                             &new_parsed->ref);
+  return true;
+}
+
+// The empty string and GURL that references are returned to when there's
+// nothing else. Only the pointers are static, and they're constant
+// initialized, so there's no construction on startup and no destruction on
+// shutdown. The objects are made on first use and published with a
+// compare-and-swap; after that, getting one is a single load.
 static std::string* empty_string = NULL;
 static GURL* empty_gurl = NULL;
 
 #ifdef WIN32
+template<typename T>
+inline T* LoadEmptyObject(T** slot) {
+  // Reads of volatile variables have acquire semantics on Windows.
+  return *static_cast<T* volatile*>(slot);
+}
+template<typename T>
+inline T* PublishEmptyObject(T** slot, T* object) {
+  return static_cast<T*>(InterlockedCompareExchangePointer(
+      reinterpret_cast<PVOID*>(slot), object, NULL));
+}
+#else
+template<typename T>
+inline T* LoadEmptyObject(T** slot) {
+  return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+}
+template<typename T>
+inline T* PublishEmptyObject(T** slot, T* object) {
+  return __sync_val_compare_and_swap(slot, static_cast<T*>(NULL), object);
+}
+#endif  // WIN32
+
+// Returns the object |*slot| points to, making it first if there is none.
+// Threads can race to make it; the loser deletes its copy.
+template<typename T>
+const T& GetEmptyObject(T** slot) {
+  T* object = LoadEmptyObject(slot);
+  if (object)
+    return *object;
+  object = new T;
+  T* existing = PublishEmptyObject(slot, object);
+  if (!existing)
+    return *object;
+  delete object;
+  return *existing;
+}
 
 // Returns a static reference to an empty string for returning a reference
 // when there is no underlying string.
 const std::string& EmptyStringForGURL() {
-  // Avoid static object construction/destruction on startup/shutdown.
-  if (!empty_string) {
-    // Create the string. Be careful that we don't break in the case that this
-    // is being called from multiple threads. Statics are not threadsafe.
-    std::string* new_empty_string = new std::string;
-    if (InterlockedCompareExchangePointer(
-        reinterpret_cast<PVOID*>(&empty_string), new_empty_string, NULL)) {
-      // The old value was non-NULL, so no replacement was done. Another
-      // thread did the initialization out from under us.
-      delete new_empty_string;
-    }
-  }
-  return *empty_string;
+  return GetEmptyObject(&empty_string);
 }
 
+// One in this many valid GURLs from the trusted constructor is checked by
+// canonicalizing its spec again, see gurl_trusted.h. The tick counts the
+// constructions so that the checks are spread evenly.
+#ifdef NDEBUG
+volatile int trusted_validation_rate = 0;
 #else
+volatile int trusted_validation_rate = 1;
+#endif
+volatile int32 trusted_validation_tick = 0;
+volatile int64 trusted_validation_checked = 0;
+volatile int64 trusted_validation_mismatches = 0;
 
-static pthread_once_t empty_string_once = PTHREAD_ONCE_INIT;
-static pthread_once_t empty_gurl_once = PTHREAD_ONCE_INIT;
+// Set while MakeUncheckedGURL constructs its GURL, which is never checked.
+#if defined(_MSC_VER)
+__declspec(thread) bool making_unchecked_gurl = false;
+#else
+__thread bool making_unchecked_gurl = false;
+#endif
 
-void EmptyStringForGURLOnce(void) {
-  empty_string = new std::string;
+#ifdef WIN32
+inline int32 AtomicIncrement(volatile int32* value) {
+  return InterlockedIncrement(reinterpret_cast<volatile LONG*>(value));
 }
-
-const std::string& EmptyStringForGURL() {
-  // Avoid static object construction/destruction on startup/shutdown.
-  pthread_once(&empty_string_once, EmptyStringForGURLOnce);
-  return *empty_string;
+inline void AtomicIncrement64(volatile int64* value) {
+  InterlockedIncrement64(reinterpret_cast<volatile LONGLONG*>(value));
+}
+// A plain 64-bit read can tear on 32-bit targets.
+inline int64 AtomicLoad64(volatile int64* value) {
+  return InterlockedCompareExchange64(
+      reinterpret_cast<volatile LONGLONG*>(value), 0, 0);
+}
+inline int AtomicExchange(volatile int* value, int new_value) {
+  return InterlockedExchange(reinterpret_cast<volatile LONG*>(value),
+                             new_value);
+}
+#else
+inline int32 AtomicIncrement(volatile int32* value) {
+  return __sync_add_and_fetch(value, 1);
+}
+inline void AtomicIncrement64(volatile int64* value) {
+  __sync_add_and_fetch(value, 1);
+}
+// A plain 64-bit read can tear on 32-bit targets.
+inline int64 AtomicLoad64(volatile int64* value) {
+  return __sync_fetch_and_add(value, 0);
+}
+inline int AtomicExchange(volatile int* value, int new_value) {
+  return __sync_lock_test_and_set(value, new_value);
 }
-
 #endif  // WIN32
 
+// Returns true if this trusted construction is one of the sampled ones.
+bool ShouldValidateTrustedGURL() {
+  if (making_unchecked_gurl)
+    return false;
+  int rate = trusted_validation_rate;
+  if (rate <= 0)
+    return false;
+  if (rate == 1)
+    return true;
+  uint32 tick = static_cast<uint32>(AtomicIncrement(&trusted_validation_tick));
+  return tick % static_cast<uint32>(rate) == 0;
+}
+
+// Checks that |url|, from the trusted constructor, is what canonicalizing its
+// spec again gives, and counts the result.
+void ValidateTrustedGURL(const GURL& url) {
+  GURL test_url(url.possibly_invalid_spec());
+  const url_parse::Parsed& parsed = url.parsed_for_possibly_invalid_spec();
+  const url_parse::Parsed& test_parsed =
+      test_url.parsed_for_possibly_invalid_spec();
+  bool matches = test_url.is_valid() == url.is_valid() &&
+      test_url.possibly_invalid_spec() == url.possibly_invalid_spec() &&
+      test_parsed.scheme == parsed.scheme &&
+      test_parsed.username == parsed.username &&
+      test_parsed.password == parsed.password &&
+      test_parsed.host == parsed.host &&
+      test_parsed.port == parsed.port &&
+      test_parsed.path == parsed.path &&
+      test_parsed.query == parsed.query &&
+      test_parsed.ref == parsed.ref;
+
+  AtomicIncrement64(&trusted_validation_checked);
+  if (!matches)
+    AtomicIncrement64(&trusted_validation_mismatches);
+  DCHECK(matches) << "trusted GURL isn't canonical: " << url;
+}
+
 } // namespace
 
 GURL::GURL() : is_valid_(false), inner_url_(NULL) {
@@ -146,11 +337,11 @@ GURL::GURL(const char* canonical_spec, size_t canonical_spec_len,
         new GURL(spec_.data(), parsed_.Length(), *parsed_.inner_parsed(), true);
   }
 
-#ifndef NDEBUG
-  // For testing purposes, check that the parsed canonical URL is identical to
-  // what we would have produced. Skip checking for invalid URLs have no meaning
-  // and we can't always canonicalize then reproducabely.
-  if (is_valid_) {
+  // Check a sample of the parsed canonical URLs against what we would have
+  // produced (every one in debug builds, by default). Skip checking for
+  // invalid URLs have no meaning and we can't always canonicalize then
+  // reproducabely.
+  if (is_valid_ && ShouldValidateTrustedGURL()) {
     url_parse::Component scheme;
     if (!url_util::FindAndCompareScheme(canonical_spec, canonical_spec_len,
                                         "filesystem", &scheme) ||
@@ -158,22 +349,9 @@ GURL::GURL(const char* canonical_spec, size_t canonical_spec_len,
       // We can't do this check on the inner_url of a filesystem URL, as
       // canonical_spec actually points to the start of the outer URL, so we'd
       // end up with infinite recursion in this constructor.
-      GURL test_url(spec_);
-
-      DCHECK(test_url.is_valid_ == is_valid_);
-      DCHECK(test_url.spec_ == spec_);
-
-      DCHECK(test_url.parsed_.scheme == parsed_.scheme);
-      DCHECK(test_url.parsed_.username == parsed_.username);
-      DCHECK(test_url.parsed_.password == parsed_.password);
-      DCHECK(test_url.parsed_.host == parsed_.host);
-      DCHECK(test_url.parsed_.port == parsed_.port);
-      DCHECK(test_url.parsed_.path == parsed_.path);
-      DCHECK(test_url.parsed_.query == parsed_.query);
-      DCHECK(test_url.parsed_.ref == parsed_.ref);
+      ValidateTrustedGURL(*this);
     }
   }
-#endif
 }
 
 GURL::~GURL() {
@@ -181,13 +359,21 @@ GURL::~GURL() {
 }
 
 GURL& GURL::operator=(const GURL& other) {
+  if (&other == this)
+    return *this;
+
   spec_ = other.spec_;
   is_valid_ = other.is_valid_;
   parsed_ = other.parsed_;
-  delete inner_url_;
-  inner_url_ = NULL;
-  if (other.inner_url_)
+  if (!other.inner_url_) {
+    delete inner_url_;
+    inner_url_ = NULL;
+  } else if (inner_url_) {
+    // Reuse the inner URL we already have rather than reallocating it.
+    *inner_url_ = *other.inner_url_;
+  } else {
     inner_url_ = new GURL(*other.inner_url_);
+  }
   // Valid filesystem urls should always have an inner_url_.
   DCHECK(!is_valid_ || !SchemeIsFileSystem() || inner_url_);
   return *this;
@@ -286,13 +472,18 @@ GURL GURL::ReplaceComponents(
   result.spec_.reserve(spec_.size() + 32);
   url_canon::StdStringCanonOutput output(&result.spec_);
 
-  result.is_valid_ = url_util::ReplaceComponents(
-      spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
-      NULL, &output, &result.parsed_);
+  if (ReplaceQueryAndRef(spec_, parsed_, replacements, &output,
+                         &result.parsed_)) {
+    result.is_valid_ = true;
+  } else {
+    result.is_valid_ = url_util::ReplaceComponents(
+        spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
+        NULL, &output, &result.parsed_);
+  }
 
   output.Complete();
   if (result.is_valid_ && result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(spec_.data(), result.parsed_.Length(),
+    result.inner_url_ = new GURL(result.spec_.data(), result.parsed_.Length(),
                                  *result.parsed_.inner_parsed(), true);
   }
   return result;
@@ -312,13 +503,18 @@ GURL GURL::ReplaceComponents(
   result.spec_.reserve(spec_.size() + 32);
   url_canon::StdStringCanonOutput output(&result.spec_);
 
-  result.is_valid_ = url_util::ReplaceComponents(
-      spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
-      NULL, &output, &result.parsed_);
+  if (ReplaceQueryAndRef(spec_, parsed_, replacements, &output,
+                         &result.parsed_)) {
+    result.is_valid_ = true;
+  } else {
+    result.is_valid_ = url_util::ReplaceComponents(
+        spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
+        NULL, &output, &result.parsed_);
+  }
 
   output.Complete();
   if (result.is_valid_ && result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(spec_.data(), result.parsed_.Length(),
+    result.inner_url_ = new GURL(result.spec_.data(), result.parsed_.Length(),
                                  *result.parsed_.inner_parsed(), true);
   }
   return result;
@@ -385,138 +581,67 @@ int GURL::IntPort() const {
   return url_parse::PORT_UNSPECIFIED;
 }
 
+// These share GURLView's implementation, which finds the slice of the spec
+// without copying it.
 int GURL::EffectiveIntPort() const {
-  int int_port = IntPort();
-  if (int_port == url_parse::PORT_UNSPECIFIED && IsStandard())
-    return url_canon::DefaultPortForScheme(spec_.data() + parsed_.scheme.begin,
-                                           parsed_.scheme.len);
-  return int_port;
+  return GURLView(*this).EffectiveIntPort();
 }
 
 std::string GURL::ExtractFileName() const {
-  url_parse::Component file_component;
-  url_parse::ExtractFileName(spec_.data(), parsed_.path, &file_component);
-  return ComponentString(file_component);
+  return GURLView(*this).ExtractFileName().as_string();
 }
 
 std::string GURL::PathForRequest() const {
-  DCHECK(parsed_.path.len > 0) << "Canonical path for requests should be non-empty";
-  if (parsed_.ref.len >= 0) {
-    // Clip off the reference when it exists. The reference starts after the #
-    // sign, so we have to subtract one to also remove it.
-    return std::string(spec_, parsed_.path.begin,
-                       parsed_.ref.begin - parsed_.path.begin - 1);
-  }
-  // Compute the actual path length, rather than depending on the spec's
-  // terminator.  If we're an inner_url, our spec continues on into our outer
-  // url's path/query/ref.
-  int path_len = parsed_.path.len;
-  if (parsed_.query.is_valid())
-    path_len = parsed_.query.end() - parsed_.path.begin;
-
-  return std::string(spec_, parsed_.path.begin, path_len);
+  return GURLView(*this).PathForRequest().as_string();
 }
 
 std::string GURL::HostNoBrackets() const {
-  // If host looks like an IPv6 literal, strip the square brackets.
-  url_parse::Component h(parsed_.host);
-  if (h.len >= 2 && spec_[h.begin] == '[' && spec_[h.end() - 1] == ']') {
-    h.begin++;
-    h.len -= 2;
-  }
-  return ComponentString(h);
+  return GURLView(*this).HostNoBrackets().as_string();
 }
 
 bool GURL::HostIsIPAddress() const {
   if (!is_valid_ || spec_.empty())
      return false;
 
-  url_canon::RawCanonOutputT<char, 128> ignored_output;
+  // The host is canonical, so an IP address is recognized without producing
+  // any output.
   url_canon::CanonHostInfo host_info;
-  url_canon::CanonicalizeIPAddress(spec_.c_str(), parsed_.host,
-                                   &ignored_output, &host_info);
-  return host_info.IsIPAddress();
+  return url_canon::ClassifyHost(spec_.data(), parsed_.host, &host_info) &&
+         host_info.IsIPAddress();
 }
 
-#ifdef WIN32
-
 const GURL& GURL::EmptyGURL() {
-  // Avoid static object construction/destruction on startup/shutdown.
-  if (!empty_gurl) {
-    // Create the string. Be careful that we don't break in the case that this
-    // is being called from multiple threads.
-    GURL* new_empty_gurl = new GURL;
-    if (InterlockedCompareExchangePointer(
-        reinterpret_cast<PVOID*>(&empty_gurl), new_empty_gurl, NULL)) {
-      // The old value was non-NULL, so no replacement was done. Another
-      // thread did the initialization out from under us.
-      delete new_empty_gurl;
-    }
-  }
-  return *empty_gurl;
+  return GetEmptyObject(&empty_gurl);
 }
 
-#else
-
-void EmptyGURLOnce(void) {
-  empty_gurl = new GURL;
-}
-
-const GURL& GURL::EmptyGURL() {
-  // Avoid static object construction/destruction on startup/shutdown.
-  pthread_once(&empty_gurl_once, EmptyGURLOnce);
-  return *empty_gurl;
-}
-
-#endif  // WIN32
-
 bool GURL::DomainIs(const char* lower_ascii_domain,
                     int domain_len) const {
-  // Return false if this URL is not valid or domain is empty.
-  if (!is_valid_ || !domain_len)
-    return false;
-
-  // FileSystem URLs have empty parsed_.host, so check this first.
-  if (SchemeIsFileSystem() && inner_url_)
-    return inner_url_->DomainIs(lower_ascii_domain, domain_len);
-
-  if (!parsed_.host.is_nonempty())
-    return false;
-
-  // Check whether the host name is end with a dot. If yes, treat it
-  // the same as no-dot unless the input comparison domain is end
-  // with dot.
-  const char* last_pos = spec_.data() + parsed_.host.end() - 1;
-  int host_len = parsed_.host.len;
-  if ('.' == *last_pos && '.' != lower_ascii_domain[domain_len - 1]) {
-    last_pos--;
-    host_len--;
-  }
-
-  // Return false if host's length is less than domain's length.
-  if (host_len < domain_len)
-    return false;
-
-  // Compare this url whether belong specific domain.
-  const char* start_pos = spec_.data() + parsed_.host.begin +
-                          host_len - domain_len;
+  // GURLView checks a FileSystem URL's inner URL the same way inner_url_
+  // would, since both slice the same spec.
+  return GURLView(*this).DomainIs(lower_ascii_domain, domain_len);
+}
 
-  if (!url_util::LowerCaseEqualsASCII(start_pos,
-                                      last_pos + 1,
-                                      lower_ascii_domain,
-                                      lower_ascii_domain + domain_len))
-    return false;
+int SetTrustedGURLValidationRate(int one_in_n) {
+  return AtomicExchange(&trusted_validation_rate, one_in_n > 0 ? one_in_n : 0);
+}
 
-  // Check whether host has right domain start with dot, make sure we got
-  // right domain range. For example www.google.com has domain
-  // "google.com" but www.iamnotgoogle.com does not.
-  if ('.' != lower_ascii_domain[0] && host_len > domain_len &&
-      '.' != *(start_pos - 1))
-    return false;
+void GetTrustedGURLValidationStats(TrustedGURLValidationStats* stats) {
+  stats->checked = AtomicLoad64(&trusted_validation_checked);
+  stats->mismatches = AtomicLoad64(&trusted_validation_mismatches);
+}
 
-  return true;
+GURL MakeUncheckedGURL(const std::string& canonical_spec,
+                       const url_parse::Parsed& parsed,
+                       bool is_valid) {
+  making_unchecked_gurl = true;
+  GURL url(canonical_spec.data(), canonical_spec.length(), parsed, is_valid);
+  making_unchecked_gurl = false;
+  return url;
 }
 
+// Exchanges the two URLs without copying either spec or inner URL. There is
+// no std::swap overload for GURL, since one can't be added here without
+// changing gurl.h, so code that shuffles many GURLs should call this.
 void GURL::Swap(GURL* other) {
   spec_.swap(other->spec_);
   std::swap(is_valid_, other->is_valid_);
@@ -0,0 +1,159 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_arena.h"
+
+#include <new>
+
+#include "googleurl/src/url_util.h"
+
+ArenaGURL::ArenaGURL()
+    : spec_(""),
+      spec_len_(0),
+      is_valid_(false),
+      inner_url_(NULL) {
+}
+
+ArenaGURL::ArenaGURL(const char* url, int url_len,
+                     url_canon::URLArena* arena)
+    : spec_(""),
+      spec_len_(0),
+      is_valid_(false),
+      inner_url_(NULL) {
+  // Like GURL, leave room for a few escapes. Finish() gives back whatever
+  // isn't used.
+  url_canon::ArenaCanonOutput output(arena);
+  output.Resize(url_len + 32);
+  url_parse::Parsed parsed;
+  bool is_valid = url_util::Canonicalize(url, url_len, NULL, &output,
+                                         &parsed);
+  InitFromOutput(&output, parsed, is_valid);
+}
+
+ArenaGURL::ArenaGURL(const char16* url, int url_len,
+                     url_canon::URLArena* arena)
+    : spec_(""),
+      spec_len_(0),
+      is_valid_(false),
+      inner_url_(NULL) {
+  // Like GURL, leave room for a few escapes. Finish() gives back whatever
+  // isn't used.
+  url_canon::ArenaCanonOutput output(arena);
+  output.Resize(url_len + 32);
+  url_parse::Parsed parsed;
+  bool is_valid = url_util::Canonicalize(url, url_len, NULL, &output,
+                                         &parsed);
+  InitFromOutput(&output, parsed, is_valid);
+}
+
+ArenaGURL::ArenaGURL(const char* spec, int spec_len,
+                     const url_parse::Parsed& parsed, bool is_valid)
+    : spec_(spec),
+      spec_len_(spec_len),
+      is_valid_(is_valid),
+      parsed_(parsed),
+      inner_url_(NULL) {
+  // Only ever used for inner URLs, which can't be filesystem: URLs again.
+  parsed_.clear_inner_parsed();
+}
+
+ArenaGURL::~ArenaGURL() {
+}
+
+void ArenaGURL::InitFromOutput(url_canon::ArenaCanonOutput* output,
+                               const url_parse::Parsed& parsed,
+                               bool is_valid) {
+  spec_len_ = output->length();
+  const char* spec = output->Finish();
+  spec_ = spec ? spec : "";
+  is_valid_ = is_valid;
+  parsed_ = parsed;
+  parsed_.clear_inner_parsed();
+
+  // Like GURL, the inner URL shares the outer URL's spec.
+  if (is_valid_ && parsed.inner_parsed() && SchemeIs("filesystem")) {
+    url_canon::URLArena* arena = output->arena();
+    inner_url_ = new(arena->Allocate(sizeof(ArenaGURL)))
+        ArenaGURL(spec_, spec_len_, *parsed.inner_parsed(), true);
+  }
+}
+
+ArenaGURL ArenaGURL::Resolve(const char* relative, int relative_len,
+                             url_canon::URLArena* arena) const {
+  ArenaGURL result;
+  if (!is_valid_)
+    return result;
+
+  url_parse::Parsed base_parsed;
+  GetFullParsed(&base_parsed);
+  url_canon::ArenaCanonOutput output(arena);
+  url_parse::Parsed parsed;
+  bool is_valid = url_util::ResolveRelative(spec_, spec_len_, base_parsed,
+                                            relative, relative_len, NULL,
+                                            &output, &parsed);
+  result.InitFromOutput(&output, parsed, is_valid);
+  return result;
+}
+
+ArenaGURL ArenaGURL::Resolve(const char16* relative, int relative_len,
+                             url_canon::URLArena* arena) const {
+  ArenaGURL result;
+  if (!is_valid_)
+    return result;
+
+  url_parse::Parsed base_parsed;
+  GetFullParsed(&base_parsed);
+  url_canon::ArenaCanonOutput output(arena);
+  url_parse::Parsed parsed;
+  bool is_valid = url_util::ResolveRelative(spec_, spec_len_, base_parsed,
+                                            relative, relative_len, NULL,
+                                            &output, &parsed);
+  result.InitFromOutput(&output, parsed, is_valid);
+  return result;
+}
+
+bool ArenaGURL::SchemeIs(const char* lower_ascii_scheme) const {
+  if (parsed_.scheme.len <= 0)
+    return lower_ascii_scheme == NULL;
+  return url_util::LowerCaseEqualsASCII(spec_ + parsed_.scheme.begin,
+                                        spec_ + parsed_.scheme.end(),
+                                        lower_ascii_scheme);
+}
+
+GURL ArenaGURL::ToGURL() const {
+  url_parse::Parsed parsed;
+  GetFullParsed(&parsed);
+  return GURL(spec_, spec_len_, parsed, is_valid_);
+}
+
+void ArenaGURL::GetFullParsed(url_parse::Parsed* parsed) const {
+  *parsed = parsed_;
+  if (inner_url_)
+    parsed->set_inner_parsed(inner_url_->parsed_);
+}
@@ -0,0 +1,122 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A canonical URL whose spec lives in a url_canon::URLArena. It has the
+// parts of GURL that code handling large batches of URLs needs, like the
+// links of a page, without a heap allocation per URL: the spec, and the
+// inner URL of a filesystem: URL, are allocated from the arena and go away
+// together when it is reset. An ArenaGURL must not be used after that.
+// Copying one only copies pointers into the arena.
+
+#ifndef GOOGLEURL_SRC_GURL_ARENA_H__
+#define GOOGLEURL_SRC_GURL_ARENA_H__
+
+#include <string.h>
+
+#include "base/string16.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_canon_arena.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+class GURL_API ArenaGURL {
+ public:
+  // An empty, invalid URL.
+  ArenaGURL();
+
+  // Canonicalizes |url| like the GURL constructors do, into |arena|.
+  ArenaGURL(const char* url, int url_len, url_canon::URLArena* arena);
+  ArenaGURL(const char16* url, int url_len, url_canon::URLArena* arena);
+
+  ~ArenaGURL();
+
+  // Resolves |relative| against this URL like GURL::Resolve, putting the
+  // result in |arena|, which doesn't have to be the one this URL is in.
+  ArenaGURL Resolve(const char* relative, int relative_len,
+                    url_canon::URLArena* arena) const;
+  ArenaGURL Resolve(const char16* relative, int relative_len,
+                    url_canon::URLArena* arena) const;
+
+  bool is_valid() const { return is_valid_; }
+  bool is_empty() const { return spec_len_ == 0; }
+
+  // The canonical spec, which is not NUL-terminated. For invalid URLs this
+  // is whatever the canonicalizer produced, like
+  // GURL::possibly_invalid_spec().
+  const char* spec_data() const { return spec_; }
+  int spec_length() const { return spec_len_; }
+  std::string spec() const { return std::string(spec_, spec_len_); }
+
+  const url_parse::Parsed& parsed_for_possibly_invalid_spec() const {
+    return parsed_;
+  }
+
+  bool SchemeIs(const char* lower_ascii_scheme) const;
+
+  // The inner URL of a valid filesystem: URL, also in the arena. NULL for
+  // everything else.
+  const ArenaGURL* inner_url() const { return inner_url_; }
+
+  // A GURL with a heap copy of the spec, for handing the URL to code that
+  // outlives the arena.
+  GURL ToGURL() const;
+
+  bool operator==(const ArenaGURL& other) const {
+    return spec_len_ == other.spec_len_ &&
+        memcmp(spec_, other.spec_, spec_len_) == 0;
+  }
+  bool operator!=(const ArenaGURL& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  // Wraps output that is already in the arena.
+  ArenaGURL(const char* spec, int spec_len, const url_parse::Parsed& parsed,
+            bool is_valid);
+
+  // Gives |*parsed| the inner Parsed that |parsed_| leaves out, as the rest
+  // of the library expects for filesystem: URLs.
+  void GetFullParsed(url_parse::Parsed* parsed) const;
+
+  // Finishes |output| and takes it as the spec.
+  void InitFromOutput(url_canon::ArenaCanonOutput* output,
+                      const url_parse::Parsed& parsed, bool is_valid);
+
+  const char* spec_;
+  int spec_len_;
+  bool is_valid_;
+
+  // Never has an inner Parsed, which would be on the heap; the inner URL
+  // has its own instead.
+  url_parse::Parsed parsed_;
+
+  const ArenaGURL* inner_url_;
+};
+
+#endif  // GOOGLEURL_SRC_GURL_ARENA_H__
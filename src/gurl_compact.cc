@@ -0,0 +1,55 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_compact.h"
+
+#include "googleurl/src/gurl_hash.h"
+
+CompactGURL::CompactGURL()
+    : hash_(url_util::HashURLBytes("", 0, 0)),
+      is_valid_(false),
+      is_packed_(true) {
+}
+
+CompactGURL::CompactGURL(const GURL& url)
+    : spec_(url.possibly_invalid_spec()),
+      hash_(HashGURL(url)),
+      is_valid_(url.is_valid()) {
+  is_packed_ = url_parse::PackedParsed::Pack(
+      url.parsed_for_possibly_invalid_spec(), &parsed_);
+}
+
+GURL CompactGURL::ToGURL() const {
+  if (!is_packed_)
+    return GURL(spec_);
+
+  url_parse::Parsed parsed;
+  parsed_.Unpack(&parsed);
+  return GURL(spec_.data(), spec_.length(), parsed, is_valid_);
+}
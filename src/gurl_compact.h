@@ -0,0 +1,98 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A GURL for long-lived storage. Code that keeps millions of URLs resident
+// mostly needs the spec and, now and then, a real GURL back. CompactGURL
+// keeps the spec with a url_parse::PackedParsed instead of a Parsed, so it
+// is smaller than a GURL, owns no inner GURL or inner Parsed on the heap,
+// and copying it is a string copy plus a memcpy.
+
+#ifndef GOOGLEURL_SRC_GURL_COMPACT_H__
+#define GOOGLEURL_SRC_GURL_COMPACT_H__
+
+#include <stddef.h>
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+#include "googleurl/src/url_parse_packed.h"
+
+class GURL_API CompactGURL {
+ public:
+  // The empty, invalid URL.
+  CompactGURL();
+
+  // Stores |url|. URLs too long for a PackedParsed, which are 64K and up,
+  // keep only their spec and are parsed again by ToGURL().
+  explicit CompactGURL(const GURL& url);
+
+  bool is_valid() const { return is_valid_; }
+  bool is_empty() const { return spec_.empty(); }
+  const std::string& possibly_invalid_spec() const { return spec_; }
+
+  // Whether packed_parsed() describes the spec. False only for URLs that
+  // were too long to pack.
+  bool is_packed() const { return is_packed_; }
+  const url_parse::PackedParsed& packed_parsed() const { return parsed_; }
+
+  // The GURL this was made from. This copies the spec, and for URLs that
+  // aren't packed canonicalizes it again.
+  GURL ToGURL() const;
+
+  // HashGURL() of the URL, computed once when it's stored. Hash tables of
+  // CompactGURLs can use CompactGURL::Hash to avoid hashing specs again.
+  uint64 hash() const { return hash_; }
+  struct Hash {
+    size_t operator()(const CompactGURL& url) const {
+      return static_cast<size_t>(url.hash());
+    }
+  };
+
+  bool operator==(const CompactGURL& other) const {
+    return hash_ == other.hash_ && spec_ == other.spec_;
+  }
+  bool operator!=(const CompactGURL& other) const {
+    return !(*this == other);
+  }
+  bool operator<(const CompactGURL& other) const {
+    return spec_ < other.spec_;
+  }
+
+ private:
+  std::string spec_;
+  url_parse::PackedParsed parsed_;
+  uint64 hash_;
+  bool is_valid_;
+  bool is_packed_;
+};
+
+#endif  // GOOGLEURL_SRC_GURL_COMPACT_H__
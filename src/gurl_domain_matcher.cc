@@ -0,0 +1,198 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_domain_matcher.h"
+
+#include "base/logging.h"
+#include "googleurl/src/url_util.h"
+
+namespace {
+
+inline unsigned char ToLowerASCII(char c) {
+  return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : static_cast<unsigned char>(c);
+}
+
+// FNV-1a over the lower-cased characters, last to first, so the hash of
+// each suffix of a host extends the hash of the one after it.
+const uint32 kHashBasis = 2166136261u;
+inline uint32 ExtendHash(uint32 hash, char c) {
+  return (hash ^ ToLowerASCII(c)) * 16777619u;
+}
+
+uint32 HashDomain(const char* domain, int domain_len) {
+  uint32 hash = kHashBasis;
+  for (int i = domain_len - 1; i >= 0; i--)
+    hash = ExtendHash(hash, domain[i]);
+  return hash;
+}
+
+}  // namespace
+
+GURLDomainMatcher::GURLDomainMatcher() {
+}
+
+GURLDomainMatcher::~GURLDomainMatcher() {
+}
+
+int GURLDomainMatcher::Add(const char* lower_ascii_domain, int domain_len) {
+  if (domain_len <= 0)
+    return -1;
+  uint32 hash = HashDomain(lower_ascii_domain, domain_len);
+  int id = Find(lower_ascii_domain, domain_len, hash);
+  if (id >= 0)
+    return id;
+
+  if (entries_.size() >= buckets_.size())
+    Rehash(static_cast<int>(entries_.size()) + 1);
+  Entry entry;
+  entry.offset = static_cast<int>(domains_.length());
+  entry.len = domain_len;
+  entry.hash = hash;
+  int bucket = static_cast<int>(hash & (buckets_.size() - 1));
+  entry.next_in_bucket = buckets_[bucket];
+  id = static_cast<int>(entries_.size());
+  buckets_[bucket] = id;
+  entries_.push_back(entry);
+  domains_.append(lower_ascii_domain, domain_len);
+  return id;
+}
+
+void GURLDomainMatcher::AddDomains(const std::vector<std::string>& domains) {
+  size_t total_len = domains_.length();
+  for (size_t i = 0; i < domains.size(); i++)
+    total_len += domains[i].length();
+  domains_.reserve(total_len);
+  entries_.reserve(entries_.size() + domains.size());
+  Rehash(static_cast<int>(entries_.size() + domains.size()));
+
+  for (size_t i = 0; i < domains.size(); i++)
+    Add(domains[i].data(), static_cast<int>(domains[i].length()));
+}
+
+std::string GURLDomainMatcher::domain(int id) const {
+  DCHECK(id >= 0 && id < size());
+  return domains_.substr(entries_[id].offset, entries_[id].len);
+}
+
+int GURLDomainMatcher::Find(const char* domain, int domain_len,
+                            uint32 hash) const {
+  if (buckets_.empty())
+    return -1;
+  for (int i = buckets_[hash & (buckets_.size() - 1)]; i >= 0;
+       i = entries_[i].next_in_bucket) {
+    const Entry& entry = entries_[i];
+    if (entry.hash == hash && entry.len == domain_len &&
+        url_util::LowerCaseEqualsASCII(domain, domain + domain_len,
+                                       &domains_[entry.offset],
+                                       &domains_[entry.offset] + entry.len))
+      return i;
+  }
+  return -1;
+}
+
+void GURLDomainMatcher::Rehash(int num_domains) {
+  size_t num_buckets = buckets_.empty() ? 16 : buckets_.size();
+  while (num_buckets < static_cast<size_t>(num_domains))
+    num_buckets *= 2;
+  if (num_buckets == buckets_.size())
+    return;
+
+  buckets_.assign(num_buckets, -1);
+  for (size_t i = 0; i < entries_.size(); i++) {
+    int bucket = static_cast<int>(entries_[i].hash & (num_buckets - 1));
+    entries_[i].next_in_bucket = buckets_[bucket];
+    buckets_[bucket] = static_cast<int>(i);
+  }
+}
+
+int GURLDomainMatcher::Match(const GURLView& url) const {
+  if (!url.is_valid())
+    return -1;
+
+  // FileSystem URLs have an empty host; match their inner URL's.
+  GURLView inner;
+  if (url.SchemeIsFileSystem() && url.GetInnerView(&inner))
+    return Match(inner);
+
+  url_parse::StringPiece host = url.host();
+  return MatchHost(host.data(), host.length());
+}
+
+int GURLDomainMatcher::MatchHost(const char* host, int host_len) const {
+  if (host_len <= 0 || entries_.empty())
+    return -1;
+
+  // DomainIs ignores a trailing dot on the host unless the domain has one
+  // too. So for a host with a trailing dot, the suffixes that keep it are
+  // compared to domains ending with a dot, and the ones from the host
+  // without it to the domains that don't. The second set can't include
+  // suffixes ending with a dot, so it's skipped if the host ends with two.
+  int passes = 1;
+  if (host[host_len - 1] == '.') {
+    if (host_len >= 2 && host[host_len - 2] != '.')
+      passes = 2;
+  }
+
+  int best = -1;
+  int best_len = 0;
+  for (int pass = 0; pass < passes; pass++) {
+    int end = host_len - pass;
+    uint32 hash = kHashBasis;
+    // |hash| covers host[i + 1, end). DomainIs matches domains that are
+    // the whole host, that follow a dot in it, or that start with one.
+    for (int i = end - 1; i >= -1; i--) {
+      int candidate = -1;
+      if (i < 0 || host[i] == '.') {
+        if (i + 1 < end)
+          candidate = Find(&host[i + 1], end - i - 1, hash);
+        if (candidate >= 0 && entries_[candidate].len > best_len) {
+          best = candidate;
+          best_len = entries_[candidate].len;
+        }
+      }
+      if (i < 0)
+        break;
+      hash = ExtendHash(hash, host[i]);
+      if (host[i] == '.') {
+        candidate = Find(&host[i], end - i, hash);
+        if (candidate >= 0 && entries_[candidate].len > best_len) {
+          best = candidate;
+          best_len = entries_[candidate].len;
+        }
+      }
+    }
+  }
+  return best;
+}
+
+void GURLDomainMatcher::MatchAll(const GURL* urls, size_t count,
+                                 int* results) const {
+  for (size_t i = 0; i < count; i++)
+    results[i] = Match(urls[i]);
+}
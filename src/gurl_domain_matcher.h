@@ -0,0 +1,105 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Checks URLs against a large set of domains at once. Asking whether a URL
+// is in any of N domains with GURL::DomainIs costs N suffix compares.
+// GURLDomainMatcher keeps the domains in a hash table instead, and looks up
+// each suffix of the host that DomainIs could match, right to left, so a
+// lookup costs one probe per label of the host however many domains there
+// are.
+
+#ifndef GOOGLEURL_SRC_GURL_DOMAIN_MATCHER_H__
+#define GOOGLEURL_SRC_GURL_DOMAIN_MATCHER_H__
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/gurl_view.h"
+#include "googleurl/src/url_common.h"
+
+class GURL_API GURLDomainMatcher {
+ public:
+  GURLDomainMatcher();
+  ~GURLDomainMatcher();
+
+  // Adds a lower-case ASCII domain, in the form DomainIs takes, and returns
+  // its id. Ids count up from 0 in the order domains are first added;
+  // adding one again returns its existing id. Empty domains, which DomainIs
+  // never matches, aren't added and return -1.
+  int Add(const char* lower_ascii_domain, int domain_len);
+  int Add(const char* lower_ascii_domain) {
+    return Add(lower_ascii_domain,
+               static_cast<int>(strlen(lower_ascii_domain)));
+  }
+
+  // Adds every domain in |domains|, sizing the table for all of them first.
+  void AddDomains(const std::vector<std::string>& domains);
+
+  // The number of distinct domains, and the domain with id |id|.
+  int size() const { return static_cast<int>(entries_.size()); }
+  std::string domain(int id) const;
+
+  // Returns the id of the longest domain for which url.DomainIs() would
+  // return true, or -1 if there is none.
+  int Match(const GURLView& url) const;
+  bool Matches(const GURLView& url) const { return Match(url) >= 0; }
+
+  // Match() for a host on its own, as it would appear in a canonical URL.
+  int MatchHost(const char* host, int host_len) const;
+
+  // Sets results[i] to Match(urls[i]) for each of the |count| URLs.
+  void MatchAll(const GURL* urls, size_t count, int* results) const;
+
+ private:
+  struct Entry {
+    int offset;  // In |domains_|.
+    int len;
+    uint32 hash;
+    int next_in_bucket;  // -1 at the end of the chain.
+  };
+
+  // Returns the id of |domain|, or -1.
+  int Find(const char* domain, int domain_len, uint32 hash) const;
+
+  // Rebuilds the bucket chains for at least |num_domains| domains.
+  void Rehash(int num_domains);
+
+  // The domains one after another.
+  std::string domains_;
+  std::vector<Entry> entries_;
+  std::vector<int> buckets_;  // Heads of the bucket chains, -1 when empty.
+
+  DISALLOW_COPY_AND_ASSIGN(GURLDomainMatcher);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_DOMAIN_MATCHER_H__
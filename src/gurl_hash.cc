@@ -0,0 +1,148 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_hash.h"
+
+#include "googleurl/src/url_parse_component.h"
+
+namespace {
+
+// The wyhash secret and mixing functions, from the public domain wyhash
+// (final version 4) by Wang Yi.
+const uint64 kSecret[4] = {
+  0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL,
+  0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL,
+};
+
+// Sets |*a| and |*b| to the low and high halves of their 128-bit product.
+inline void Multiply(uint64* a, uint64* b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = static_cast<__uint128_t>(*a) * *b;
+  *a = static_cast<uint64>(product);
+  *b = static_cast<uint64>(product >> 64);
+#else
+  uint64 a_high = *a >> 32, a_low = static_cast<uint32>(*a);
+  uint64 b_high = *b >> 32, b_low = static_cast<uint32>(*b);
+  uint64 high = a_high * b_high, middle0 = a_high * b_low;
+  uint64 middle1 = a_low * b_high, low = a_low * b_low;
+  uint64 t = low + (middle0 << 32);
+  uint64 carry = t < low;
+  uint64 lo = t + (middle1 << 32);
+  carry += lo < t;
+  *a = lo;
+  *b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+}
+
+inline uint64 Mix(uint64 a, uint64 b) {
+  Multiply(&a, &b);
+  return a ^ b;
+}
+
+// Little-endian loads, so hashes don't depend on the platform.
+inline uint64 Read8(const unsigned char* p) {
+  return static_cast<uint64>(p[0]) | (static_cast<uint64>(p[1]) << 8) |
+      (static_cast<uint64>(p[2]) << 16) | (static_cast<uint64>(p[3]) << 24) |
+      (static_cast<uint64>(p[4]) << 32) | (static_cast<uint64>(p[5]) << 40) |
+      (static_cast<uint64>(p[6]) << 48) | (static_cast<uint64>(p[7]) << 56);
+}
+
+inline uint64 Read4(const unsigned char* p) {
+  return static_cast<uint64>(p[0]) | (static_cast<uint64>(p[1]) << 8) |
+      (static_cast<uint64>(p[2]) << 16) | (static_cast<uint64>(p[3]) << 24);
+}
+
+inline uint64 Read3(const unsigned char* p, size_t len) {
+  return (static_cast<uint64>(p[0]) << 16) |
+      (static_cast<uint64>(p[len >> 1]) << 8) | p[len - 1];
+}
+
+}  // namespace
+
+namespace url_util {
+
+uint64 HashURLBytes(const char* data, size_t len, uint64 seed) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+  seed ^= Mix(seed ^ kSecret[0], kSecret[1]);
+  uint64 a, b;
+  if (len <= 16) {
+    if (len >= 4) {
+      size_t middle = (len >> 3) << 2;
+      a = (Read4(p) << 32) | Read4(p + middle);
+      b = (Read4(p + len - 4) << 32) | Read4(p + len - 4 - middle);
+    } else if (len > 0) {
+      a = Read3(p, len);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t i = len;
+    if (i > 48) {
+      uint64 see1 = seed, see2 = seed;
+      do {
+        seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+        see1 = Mix(Read8(p + 16) ^ kSecret[2], Read8(p + 24) ^ see1);
+        see2 = Mix(Read8(p + 32) ^ kSecret[3], Read8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Read8(p + i - 16);
+    b = Read8(p + i - 8);
+  }
+  a ^= kSecret[1];
+  b ^= seed;
+  Multiply(&a, &b);
+  return Mix(a ^ kSecret[0] ^ len, b ^ kSecret[1]);
+}
+
+}  // namespace url_util
+
+uint64 HashGURL(const GURL& url) {
+  const std::string& spec = url.possibly_invalid_spec();
+  return url_util::HashURLBytes(spec.data(), spec.length(), 0);
+}
+
+uint64 HashGURLComponent(const GURL& url,
+                         url_parse::Parsed::ComponentType type) {
+  const url_parse::Parsed& parsed = url.parsed_for_possibly_invalid_spec();
+  const url_parse::Component& component =
+      url_parse::ComponentOfType(parsed, type);
+  if (component.len <= 0)
+    return url_util::HashURLBytes("", 0, 0);
+  return url_util::HashURLBytes(
+      url.possibly_invalid_spec().data() + component.begin, component.len, 0);
+}
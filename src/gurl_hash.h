@@ -0,0 +1,85 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Fast 64-bit hashes of URLs, for hash tables keyed by URL. These read
+// eight bytes at a time with the wyhash mixing functions. Unlike the
+// standard library's string hash, they depend only on the bytes and the
+// seed, so they're the same in every process and on every platform and can
+// be saved.
+
+#ifndef GOOGLEURL_SRC_GURL_HASH_H__
+#define GOOGLEURL_SRC_GURL_HASH_H__
+
+#include <stddef.h>
+
+#include <functional>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+// Hashes the |len| bytes at |data|. Different seeds give unrelated hashes,
+// for callers that want them to be unpredictable from outside.
+GURL_API uint64 HashURLBytes(const char* data, size_t len, uint64 seed);
+
+}  // namespace url_util
+
+// The hash of |url|'s spec, valid or not, with seed 0. URLs with equal
+// specs, which is what GURL::operator== compares, have equal hashes.
+GURL_API uint64 HashGURL(const GURL& url);
+
+// The hash of one component of |url|, like the host for maps keyed by host.
+// Components that are invalid or empty hash the same as the empty string.
+GURL_API uint64 HashGURLComponent(const GURL& url,
+                                  url_parse::Parsed::ComponentType type);
+
+// For hash tables that take a hash functor.
+struct GURLHash {
+  size_t operator()(const GURL& url) const {
+    return static_cast<size_t>(HashGURL(url));
+  }
+};
+
+#if __cplusplus >= 201103L
+namespace std {
+
+template<>
+struct hash<GURL> {
+  size_t operator()(const GURL& url) const {
+    return static_cast<size_t>(HashGURL(url));
+  }
+};
+
+}  // namespace std
+#endif
+
+#endif  // GOOGLEURL_SRC_GURL_HASH_H__
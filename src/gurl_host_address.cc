@@ -0,0 +1,80 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_host_address.h"
+
+#include <string.h>
+
+#include "googleurl/src/url_canon_host_classify.h"
+
+GURLHostAddress::GURLHostAddress()
+    : family_(url_canon::CanonHostInfo::NEUTRAL) {
+  memset(address_, 0, sizeof(address_));
+}
+
+GURLHostAddress::GURLHostAddress(const GURL& url)
+    : family_(url_canon::CanonHostInfo::NEUTRAL) {
+  memset(address_, 0, sizeof(address_));
+  if (!url.is_valid())
+    return;
+
+  // The host of a valid GURL is canonical, so IP addresses are always in a
+  // form that ClassifyHost recognizes.
+  url_canon::CanonHostInfo host_info;
+  if (!url_canon::ClassifyHost(url.possibly_invalid_spec().data(),
+                               url.parsed_for_possibly_invalid_spec().host,
+                               &host_info) ||
+      !host_info.IsIPAddress())
+    return;
+
+  family_ = host_info.family;
+  memcpy(address_, host_info.address, host_info.AddressLength());
+}
+
+int GURLHostAddress::AddressLength() const {
+  switch (family_) {
+    case url_canon::CanonHostInfo::IPV4:
+      return 4;
+    case url_canon::CanonHostInfo::IPV6:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+bool GURLHostAddress::operator==(const GURLHostAddress& other) const {
+  return family_ == other.family_ &&
+      memcmp(address_, other.address_, sizeof(address_)) == 0;
+}
+
+bool GURLHostAddress::operator<(const GURLHostAddress& other) const {
+  if (family_ != other.family_)
+    return family_ < other.family_;
+  return memcmp(address_, other.address_, sizeof(address_)) < 0;
+}
@@ -0,0 +1,79 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The binary IP address of a GURL's host. GURL::HostIsIPAddress has to look
+// at the host text every time it's called. GURLHostAddress does it once, so
+// code that keys on addresses, like rate limiting or access lists, can keep
+// one next to the GURL and compare or sort addresses directly.
+
+#ifndef GOOGLEURL_SRC_GURL_HOST_ADDRESS_H__
+#define GOOGLEURL_SRC_GURL_HOST_ADDRESS_H__
+
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+class GURL_API GURLHostAddress {
+ public:
+  // Not an IP address.
+  GURLHostAddress();
+
+  // The address of |url|'s host. If the URL is invalid or its host isn't an
+  // IP address, this is the same as the default constructor.
+  explicit GURLHostAddress(const GURL& url);
+
+  // IPV4, IPV6 or NEUTRAL when there is no address.
+  url_canon::CanonHostInfo::Family family() const { return family_; }
+
+  bool IsIPAddress() const {
+    return family_ == url_canon::CanonHostInfo::IPV4 ||
+           family_ == url_canon::CanonHostInfo::IPV6;
+  }
+
+  // The address in network byte order. Only the first AddressLength() bytes
+  // are used: 4 for IPv4, 16 for IPv6 and 0 when there is no address.
+  const unsigned char* address() const { return address_; }
+  int AddressLength() const;
+
+  // Two addresses are equal if they have the same family and bytes. The
+  // ordering sorts by family, then by address, so this can key a std::map.
+  bool operator==(const GURLHostAddress& other) const;
+  bool operator!=(const GURLHostAddress& other) const {
+    return !(*this == other);
+  }
+  bool operator<(const GURLHostAddress& other) const;
+
+ private:
+  url_canon::CanonHostInfo::Family family_;
+
+  // Unused bytes are zero, so whole arrays can be compared.
+  unsigned char address_[16];
+};
+
+#endif  // GOOGLEURL_SRC_GURL_HOST_ADDRESS_H__
@@ -0,0 +1,253 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_lazy.h"
+
+#include "base/logging.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_scheme_registry.h"
+
+namespace {
+
+// The path characters that url_canon::CanonicalizePath leaves alone
+// wherever they are. Dots are too, except at the start of a segment.
+const url_canon::CopyableCharSet kLazyPathCopyableChars =
+    { 0x21, 0x7e, "\"#%.<>?\\^`{|}" };
+
+// When |host| in |spec| is a plain ASCII host name, sets |*value| to its
+// lower-cased form and returns true. Those are what the fused canonicalizer
+// takes too; anything that could be an IPv4 address is left to
+// CanonicalizeHost.
+bool CopyPlainHost(const char* spec,
+                   const url_parse::Component& host,
+                   std::string* value) {
+  value->resize(host.len);
+  bool maybe_ipv4 = true;
+  for (int i = 0; i < host.len; i++) {
+    unsigned char ch = static_cast<unsigned char>(spec[host.begin + i]);
+    if (ch >= 'A' && ch <= 'Z') {
+      ch += 'a' - 'A';
+    } else if (!(ch >= 'a' && ch <= 'z') && !(ch >= '0' && ch <= '9') &&
+               ch != '-' && ch != '.' && ch != '_') {
+      return false;
+    }
+    if (!url_canon::IsIPv4Char(ch))
+      maybe_ipv4 = false;
+    (*value)[i] = static_cast<char>(ch);
+  }
+  return !maybe_ipv4;
+}
+
+// When |path| in |spec| is already canonical, with nothing to escape or
+// unescape and no "." or ".." segments, sets |*value| to it and returns
+// true.
+bool CopyCanonicalPath(const char* spec,
+                       const url_parse::Component& path,
+                       std::string* value) {
+  int end = path.end();
+  if (path.len == 0 || spec[path.begin] != '/')
+    return false;
+  int i = path.begin + 1;
+  while (true) {
+    i += url_canon::CountCopyableChars(&spec[i], end - i,
+                                       kLazyPathCopyableChars);
+    if (i == end)
+      break;
+    if (spec[i] != '.' || spec[i - 1] == '/')
+      return false;
+    i++;
+  }
+  value->assign(&spec[path.begin], path.len);
+  return true;
+}
+
+// Copies the part of |output| that |comp| covers to |*value|.
+void AssignComponent(const url_canon::CanonOutput& output,
+                     const url_parse::Component& comp,
+                     std::string* value) {
+  if (comp.is_nonempty())
+    value->assign(&output.data()[comp.begin], comp.len);
+  else
+    value->clear();
+}
+
+}  // namespace
+
+LazyGURL::LazyGURL()
+    : is_lazy_(false),
+      done_(0),
+      url_(NULL),
+      url_done_(false) {
+}
+
+LazyGURL::LazyGURL(const std::string& url_string)
+    : is_lazy_(false),
+      done_(0),
+      url_(NULL),
+      url_done_(false) {
+  Reset(url_string.data(), static_cast<int>(url_string.length()));
+}
+
+LazyGURL::LazyGURL(const char* spec, int spec_len)
+    : is_lazy_(false),
+      done_(0),
+      url_(NULL),
+      url_done_(false) {
+  Reset(spec, spec_len);
+}
+
+LazyGURL::~LazyGURL() {
+  delete url_;
+}
+
+void LazyGURL::Reset(const char* spec, int spec_len) {
+  url_canon::RawCanonOutputT<char> whitespace_buffer;
+  int input_len;
+  const char* input = url_canon::RemoveURLWhitespace(spec, spec_len,
+                                                     &whitespace_buffer,
+                                                     &input_len);
+  input_.assign(input, input_len);
+  done_ = 0;
+  url_done_ = false;
+
+  // Only standard URLs canonicalize one component at a time the same way
+  // they do as a whole. The rest wait for the GURL.
+  url_parse::Component scheme;
+  const url_util::SchemeInfo* info = NULL;
+  if (url_parse::ExtractScheme(input_.data(), input_len, &scheme))
+    info = url_util::FindSchemeInfo(input_.data(), scheme);
+  is_lazy_ = info && info->type == url_util::SCHEME_STANDARD;
+  if (is_lazy_)
+    url_parse::ParseStandardURL(input_.data(), input_len, &parsed_);
+}
+
+bool LazyGURL::has_host() const {
+  if (is_lazy_)
+    return parsed_.host.is_nonempty();
+  return url().has_host();
+}
+
+const GURL& LazyGURL::url() const {
+  if (!url_done_) {
+    if (url_)
+      *url_ = GURL(input_);
+    else
+      url_ = new GURL(input_);
+    url_done_ = true;
+  }
+  return *url_;
+}
+
+void LazyGURL::Compute(Component component) const {
+  std::string* value = &values_[component];
+  done_ |= 1 << component;
+
+  if (!is_lazy_) {
+    const GURL& full = url();
+    switch (component) {
+      case SCHEME:
+        *value = full.scheme();
+        break;
+      case HOST:
+        *value = full.host();
+        break;
+      case PORT:
+        *value = full.port();
+        break;
+      case PATH:
+        *value = full.path();
+        break;
+      case QUERY:
+        *value = full.query();
+        break;
+      case REF:
+        *value = full.ref();
+        break;
+      default:
+        NOTREACHED();
+        break;
+    }
+    return;
+  }
+
+  // These follow the steps of url_canon::CanonicalizeStandardURL for the
+  // one component.
+  const char* spec = input_.data();
+  url_canon::RawCanonOutput<256> output;
+  url_parse::Component out_comp;
+  switch (component) {
+    case SCHEME:
+      url_canon::CanonicalizeScheme(spec, parsed_.scheme, &output,
+                                    &out_comp);
+      break;
+    case HOST:
+      if (!parsed_.host.is_nonempty())
+        break;
+      if (CopyPlainHost(spec, parsed_.host, value))
+        return;
+      url_canon::CanonicalizeHost(spec, parsed_.host, &output, &out_comp);
+      break;
+    case PORT: {
+      // The default port depends on the canonical scheme.
+      const std::string& canon_scheme = scheme();
+      int default_port = url_canon::DefaultPortForScheme(
+          canon_scheme.data(), static_cast<int>(canon_scheme.length()));
+      url_canon::CanonicalizePort(spec, parsed_.port, default_port, &output,
+                                  &out_comp);
+      break;
+    }
+    case PATH:
+      if (parsed_.path.is_valid()) {
+        if (CopyCanonicalPath(spec, parsed_.path, value))
+          return;
+        url_canon::CanonicalizePath(spec, parsed_.path, &output, &out_comp);
+      } else if (parsed_.username.is_valid() || parsed_.password.is_valid() ||
+                 parsed_.host.is_nonempty() || parsed_.port.is_valid() ||
+                 parsed_.query.is_valid() || parsed_.ref.is_valid()) {
+        // Made up, like the canonicalizer does when there's an authority or
+        // something after the path.
+        value->assign(1, '/');
+        return;
+      }
+      break;
+    case QUERY:
+      url_canon::CanonicalizeQuery(spec, parsed_.query, NULL, &output,
+                                   &out_comp);
+      break;
+    case REF:
+      url_canon::CanonicalizeRef(spec, parsed_.ref, &output, &out_comp);
+      break;
+    default:
+      NOTREACHED();
+      break;
+  }
+  AssignComponent(output, out_comp, value);
+}
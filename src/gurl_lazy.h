@@ -0,0 +1,135 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A URL that is parsed when it's made but canonicalized only as far as it's
+// used. Code that reads one or two components of many URLs, like a log
+// job that only wants each host and path, pays for canonicalizing those
+// components and not for building the whole spec the way a GURL would.
+//
+// For standard URLs like http: and ftp:, each component is canonicalized
+// the first time it's asked for and then kept. Other URLs (file:,
+// filesystem:, mailto:, and non-standard schemes), and any question about
+// the whole URL like is_valid() or spec(), go through a full GURL, which is
+// made once. Either way the results are what the GURL would give.
+//
+// The accessors are const but fill in the cache, so a LazyGURL can't be
+// used from several threads at once without locking.
+
+#ifndef GOOGLEURL_SRC_GURL_LAZY_H__
+#define GOOGLEURL_SRC_GURL_LAZY_H__
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+class GURL_API LazyGURL {
+ public:
+  // The empty, invalid URL.
+  LazyGURL();
+
+  // Parses |url_string|, which is taken as an absolute URL like GURL's
+  // constructor does.
+  explicit LazyGURL(const std::string& url_string);
+  LazyGURL(const char* spec, int spec_len);
+
+  ~LazyGURL();
+
+  // Replaces the URL with the |spec_len| characters at |spec|. The buffers
+  // of the old one are kept, so going through many URLs with one LazyGURL
+  // doesn't allocate once they're big enough.
+  void Reset(const char* spec, int spec_len);
+
+  // True when the components are canonicalized one at a time, false when
+  // the first access canonicalizes the whole URL.
+  bool is_lazy() const { return is_lazy_; }
+
+  // These are what the GURL would return. Each is canonicalized on first
+  // use. The references stay good until the next Reset().
+  const std::string& scheme() const { return Get(SCHEME); }
+  const std::string& host() const { return Get(HOST); }
+  const std::string& port() const { return Get(PORT); }
+  const std::string& path() const { return Get(PATH); }
+  const std::string& query() const { return Get(QUERY); }
+  const std::string& ref() const { return Get(REF); }
+
+  // Whether there's a host. For lazy URLs this looks at the parse and
+  // doesn't canonicalize anything.
+  bool has_host() const;
+
+  // These need the whole canonical URL, so they make the GURL.
+  bool is_valid() const { return url().is_valid(); }
+  const std::string& spec() const { return url().spec(); }
+  const std::string& possibly_invalid_spec() const {
+    return url().possibly_invalid_spec();
+  }
+  const GURL& url() const;
+
+ private:
+  enum Component {
+    SCHEME,
+    HOST,
+    PORT,
+    PATH,
+    QUERY,
+    REF,
+    COMPONENT_COUNT
+  };
+
+  const std::string& Get(Component component) const {
+    if (!(done_ & (1 << component)))
+      Compute(component);
+    return values_[component];
+  }
+
+  // Fills in values_[component] and marks it done.
+  void Compute(Component component) const;
+
+  // The input, with whitespace removed the way the canonicalizer would.
+  std::string input_;
+
+  // What url_parse::ParseStandardURL found in |input_|. Only used when
+  // |is_lazy_|.
+  url_parse::Parsed parsed_;
+  bool is_lazy_;
+
+  // Bit n is set once values_[n] has been filled in.
+  mutable int done_;
+  mutable std::string values_[COMPONENT_COUNT];
+
+  // Made on first use.
+  mutable GURL* url_;
+  mutable bool url_done_;
+
+  DISALLOW_COPY_AND_ASSIGN(LazyGURL);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_LAZY_H__
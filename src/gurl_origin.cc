@@ -0,0 +1,133 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_origin.h"
+
+#include <string.h>
+
+#include "googleurl/src/gurl_hash.h"
+#include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_parse.h"
+
+GURLOrigin::GURLOrigin()
+    : scheme_info_(NULL),
+      port_(url_parse::PORT_UNSPECIFIED),
+      hash_(0) {
+}
+
+GURLOrigin::GURLOrigin(const GURLView& url)
+    : scheme_info_(NULL),
+      port_(url_parse::PORT_UNSPECIFIED),
+      hash_(0) {
+  if (!url.is_valid())
+    return;
+  const url_parse::Parsed& parsed = url.parsed_for_possibly_invalid_spec();
+  const url_util::SchemeInfo* info = url_util::FindSchemeInfo(
+      url.possibly_invalid_spec().data(), parsed.scheme);
+  if (!info || !url_util::IsStandardSchemeType(info->type))
+    return;
+
+  // Like GetOrigin(), a filesystem: URL has the origin of its inner URL.
+  if (info->type == url_util::SCHEME_FILESYSTEM) {
+    GURLView inner;
+    if (url.GetInnerView(&inner))
+      *this = GURLOrigin(inner);
+    return;
+  }
+
+  // The URL is canonical, so the host needs no more work and the port is
+  // only there when it isn't the scheme's default.
+  scheme_info_ = info;
+  host_ = url.host().as_string();
+  port_ = url.has_port() ? url.IntPort() : info->default_port;
+
+  // The scheme's hash seeds the host's, so moving bytes between the two
+  // changes the result.
+  hash_ = url_util::HashURLBytes(info->scheme, info->scheme_len,
+                                 static_cast<uint32>(port_));
+  hash_ = url_util::HashURLBytes(host_.data(), host_.length(), hash_);
+}
+
+url_parse::StringPiece GURLOrigin::scheme() const {
+  if (!scheme_info_)
+    return url_parse::StringPiece();
+  return url_parse::StringPiece(scheme_info_->scheme,
+                                scheme_info_->scheme_len);
+}
+
+std::string GURLOrigin::Serialize() const {
+  if (!scheme_info_)
+    return std::string();
+
+  std::string spec;
+  spec.reserve(scheme_info_->scheme_len + host_.length() + 10);
+  spec.append(scheme_info_->scheme, scheme_info_->scheme_len);
+  spec.append("://");
+  spec.append(host_);
+  if (port_ != url_parse::PORT_UNSPECIFIED &&
+      port_ != scheme_info_->default_port) {
+    char port[8];
+    url_canon::_itoa_s(port_, port, 10);
+    spec.push_back(':');
+    spec.append(port);
+  }
+  spec.push_back('/');
+  return spec;
+}
+
+GURL GURLOrigin::ToGURL() const {
+  return GURL(Serialize());
+}
+
+bool GURLOrigin::operator==(const GURLOrigin& other) const {
+  if (hash_ != other.hash_ || port_ != other.port_ || host_ != other.host_)
+    return false;
+  if (!scheme_info_ || !other.scheme_info_)
+    return scheme_info_ == other.scheme_info_;
+  // Adding a scheme rebuilds the registry, so the same scheme isn't always
+  // at the same address.
+  return scheme() == other.scheme();
+}
+
+bool GURLOrigin::operator<(const GURLOrigin& other) const {
+  if (hash_ != other.hash_)
+    return hash_ < other.hash_;
+  if (port_ != other.port_)
+    return port_ < other.port_;
+  int host_order = host_.compare(other.host_);
+  if (host_order != 0)
+    return host_order < 0;
+  url_parse::StringPiece a = scheme();
+  url_parse::StringPiece b = other.scheme();
+  int common = a.length() < b.length() ? a.length() : b.length();
+  int scheme_order = common ? memcmp(a.data(), b.data(), common) : 0;
+  if (scheme_order != 0)
+    return scheme_order < 0;
+  return a.length() < b.length();
+}
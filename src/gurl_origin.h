@@ -0,0 +1,104 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The origin of a URL, for grouping URLs by scheme, host and port.
+// GURL::GetOrigin() answers the same question by building a new GURL
+// through ReplaceComponents, which canonicalizes it all over again.
+// GURLOrigin is read straight out of the canonical URL's Parsed instead. It
+// keeps the scheme's entry in the scheme registry, the host and the
+// effective port, and hashes them once up front, so it's cheap to compare
+// and to use as the key of a hash table.
+
+#ifndef GOOGLEURL_SRC_GURL_ORIGIN_H__
+#define GOOGLEURL_SRC_GURL_ORIGIN_H__
+
+#include <stddef.h>
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/gurl_view.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_scheme_registry.h"
+#include "googleurl/src/url_string_piece.h"
+
+class GURL_API GURLOrigin {
+ public:
+  // The empty origin of invalid and non-standard URLs.
+  GURLOrigin();
+
+  // The origin of |url|, the same one that url.GetOrigin() has. URLs that
+  // GetOrigin() gives the empty GURL for get the empty origin.
+  explicit GURLOrigin(const GURLView& url);
+
+  bool is_empty() const { return scheme_info_ == NULL; }
+
+  // The lower-case scheme and the canonical host. IP address hosts are in
+  // their canonical form, which is unique to the address.
+  url_parse::StringPiece scheme() const;
+  const std::string& host() const { return host_; }
+
+  // The port, spelled out even when the URL leaves it to the scheme's
+  // default. PORT_UNSPECIFIED for schemes without ports, like file:.
+  int port() const { return port_; }
+
+  // Hashes the scheme, host and port. The same origin always has the same
+  // hash, in any process.
+  uint64 hash() const { return hash_; }
+
+  // The origin's canonical spec, like "http://www.google.com/". The default
+  // port is left out, as in a GURL. Empty for the empty origin.
+  std::string Serialize() const;
+  GURL ToGURL() const;
+
+  bool operator==(const GURLOrigin& other) const;
+  bool operator!=(const GURLOrigin& other) const {
+    return !(*this == other);
+  }
+
+  // An arbitrary but consistent order, for std::map and sorting.
+  bool operator<(const GURLOrigin& other) const;
+
+  // For hash tables that take a hash functor.
+  struct Hash {
+    size_t operator()(const GURLOrigin& origin) const {
+      return static_cast<size_t>(origin.hash());
+    }
+  };
+
+ private:
+  // Points into the scheme registry, and is good until url_util::Shutdown().
+  const url_util::SchemeInfo* scheme_info_;
+  std::string host_;
+  int port_;
+  uint64 hash_;
+};
+
+#endif  // GOOGLEURL_SRC_GURL_ORIGIN_H__
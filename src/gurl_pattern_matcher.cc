@@ -0,0 +1,342 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_pattern_matcher.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace {
+
+inline char ToLowerASCII(char c) {
+  return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+// FNV-1a over the parent and the label, so that the same label under
+// different parents lands in different buckets.
+uint32 HashEdge(int parent, const char* label, int label_len) {
+  uint32 hash = (2166136261u ^ static_cast<uint32>(parent)) * 16777619u;
+  for (int i = 0; i < label_len; i++)
+    hash = (hash ^ static_cast<unsigned char>(label[i])) * 16777619u;
+  return hash;
+}
+
+// Trims the dots at either end of a host, and the one at the end of a
+// URL's host that DomainIs ignores.
+void TrimDots(const char** begin, const char** end) {
+  while (*begin < *end && **begin == '.')
+    ++*begin;
+  while (*end > *begin && (*end)[-1] == '.')
+    --*end;
+}
+
+// Returns true if |query| has a key equal to |key|.
+bool QueryHasKey(const url_parse::StringPiece& query,
+                 const char* key, int key_len) {
+  const char* cur = query.data();
+  const char* end = cur + query.length();
+  while (cur < end) {
+    const char* amp = static_cast<const char*>(memchr(cur, '&', end - cur));
+    const char* piece_end = amp ? amp : end;
+    const char* eq = static_cast<const char*>(
+        memchr(cur, '=', piece_end - cur));
+    const char* key_end = eq ? eq : piece_end;
+    if (key_end - cur == key_len && memcmp(cur, key, key_len) == 0)
+      return true;
+    cur = piece_end + 1;
+  }
+  return false;
+}
+
+}  // namespace
+
+GURLPatternMatcher::GURLPatternMatcher()
+    : num_patterns_(0),
+      any_scheme_root_(-1) {
+}
+
+GURLPatternMatcher::~GURLPatternMatcher() {
+}
+
+int GURLPatternMatcher::Add(const GURLPattern& pattern) {
+  int id = num_patterns_++;
+
+  std::string scheme(pattern.scheme);
+  std::transform(scheme.begin(), scheme.end(), scheme.begin(), ToLowerASCII);
+  int node = AddSchemeRoot(scheme);
+
+  // Host labels go in from right to left.
+  std::string host(pattern.host);
+  std::transform(host.begin(), host.end(), host.begin(), ToLowerASCII);
+  const char* host_begin = host.data();
+  const char* host_end = host_begin + host.length();
+  TrimDots(&host_begin, &host_end);
+  const char* label_end = host_end;
+  while (label_end > host_begin) {
+    const char* label_begin = label_end;
+    while (label_begin > host_begin && label_begin[-1] != '.')
+      label_begin--;
+    node = AddChild(node, label_begin,
+                    static_cast<int>(label_end - label_begin));
+    if (label_begin == host_begin)
+      break;
+    label_end = label_begin - 1;
+  }
+
+  bool exact = host_begin < host_end && !pattern.include_subdomains;
+  int path_node = exact ? nodes_[node].exact_path_root
+                        : nodes_[node].path_root;
+  if (path_node < 0) {
+    path_node = NewNode();
+    if (exact)
+      nodes_[node].exact_path_root = path_node;
+    else
+      nodes_[node].path_root = path_node;
+  }
+
+  // Path segments, without the slashes at either end.
+  const char* path_begin = pattern.path_prefix.data();
+  const char* path_end = path_begin + pattern.path_prefix.length();
+  if (path_begin < path_end && *path_begin == '/')
+    path_begin++;
+  if (path_end > path_begin && path_end[-1] == '/')
+    path_end--;
+  const char* segment_begin = path_begin;
+  while (segment_begin < path_end) {
+    const char* segment_end = static_cast<const char*>(
+        memchr(segment_begin, '/', path_end - segment_begin));
+    if (!segment_end)
+      segment_end = path_end;
+    path_node = AddChild(path_node, segment_begin,
+                         static_cast<int>(segment_end - segment_begin));
+    segment_begin = segment_end + 1;
+  }
+
+  Rule rule;
+  rule.id = id;
+  rule.query_key_offset = static_cast<int>(labels_.length());
+  rule.query_key_len = -1;
+  if (!pattern.query_key.empty()) {
+    rule.query_key_len = static_cast<int>(pattern.query_key.length());
+    labels_.append(pattern.query_key);
+  }
+  nodes_[path_node].rules.push_back(rule);
+  return id;
+}
+
+bool GURLPatternMatcher::Match(const GURLView& url,
+                               std::vector<int>* ids) const {
+  if (!url.is_valid())
+    return false;
+
+  // FileSystem URLs have an empty host; match their inner URL.
+  GURLView inner;
+  if (url.SchemeIsFileSystem() && url.GetInnerView(&inner))
+    return Match(inner, ids);
+
+  size_t first = ids->size();
+  url_parse::StringPiece host = url.host();
+  url_parse::StringPiece path = url.path();
+  url_parse::StringPiece query = url.query();
+  if (any_scheme_root_ >= 0)
+    MatchHost(any_scheme_root_, host, path, query, ids);
+  url_parse::StringPiece scheme = url.scheme();
+  if (scheme.length() > 0) {
+    int root = FindSchemeRoot(scheme.data(), scheme.length());
+    if (root >= 0)
+      MatchHost(root, host, path, query, ids);
+  }
+
+  // Each pattern ends at one node, and no node is visited twice, so there
+  // are no duplicates to remove.
+  std::sort(ids->begin() + first, ids->end());
+  return ids->size() > first;
+}
+
+int GURLPatternMatcher::FindSchemeRoot(const char* scheme,
+                                       int scheme_len) const {
+  if (scheme_len == 0)
+    return any_scheme_root_;
+  for (size_t i = 0; i < scheme_roots_.size(); i++) {
+    const std::string& root_scheme = scheme_roots_[i].scheme;
+    if (static_cast<int>(root_scheme.length()) == scheme_len &&
+        memcmp(root_scheme.data(), scheme, scheme_len) == 0)
+      return scheme_roots_[i].root;
+  }
+  return -1;
+}
+
+int GURLPatternMatcher::AddSchemeRoot(const std::string& scheme) {
+  int root = FindSchemeRoot(scheme.data(), static_cast<int>(scheme.length()));
+  if (root >= 0)
+    return root;
+  root = NewNode();
+  if (scheme.empty()) {
+    any_scheme_root_ = root;
+  } else {
+    SchemeRoot scheme_root;
+    scheme_root.scheme = scheme;
+    scheme_root.root = root;
+    scheme_roots_.push_back(scheme_root);
+  }
+  return root;
+}
+
+int GURLPatternMatcher::FindChild(int parent, const char* label,
+                                  int label_len, uint32 hash) const {
+  if (buckets_.empty())
+    return -1;
+  for (int i = buckets_[hash & (buckets_.size() - 1)]; i >= 0;
+       i = edges_[i].next_in_bucket) {
+    const Edge& edge = edges_[i];
+    if (edge.hash == hash && edge.parent == parent &&
+        edge.label_len == label_len &&
+        memcmp(&labels_[edge.label_offset], label, label_len) == 0)
+      return edge.child;
+  }
+  return -1;
+}
+
+int GURLPatternMatcher::AddChild(int parent, const char* label,
+                                 int label_len) {
+  uint32 hash = HashEdge(parent, label, label_len);
+  int child = FindChild(parent, label, label_len, hash);
+  if (child >= 0)
+    return child;
+
+  if (edges_.size() >= buckets_.size())
+    Rehash(static_cast<int>(edges_.size()) + 1);
+  Edge edge;
+  edge.parent = parent;
+  edge.label_offset = static_cast<int>(labels_.length());
+  edge.label_len = label_len;
+  edge.hash = hash;
+  edge.child = NewNode();
+  int bucket = static_cast<int>(hash & (buckets_.size() - 1));
+  edge.next_in_bucket = buckets_[bucket];
+  buckets_[bucket] = static_cast<int>(edges_.size());
+  edges_.push_back(edge);
+  labels_.append(label, label_len);
+  return edge.child;
+}
+
+int GURLPatternMatcher::NewNode() {
+  nodes_.push_back(Node());
+  return static_cast<int>(nodes_.size()) - 1;
+}
+
+void GURLPatternMatcher::Rehash(int num_edges) {
+  size_t num_buckets = buckets_.empty() ? 16 : buckets_.size();
+  while (num_buckets < static_cast<size_t>(num_edges))
+    num_buckets *= 2;
+  if (num_buckets == buckets_.size())
+    return;
+
+  buckets_.assign(num_buckets, -1);
+  for (size_t i = 0; i < edges_.size(); i++) {
+    int bucket = static_cast<int>(edges_[i].hash & (num_buckets - 1));
+    edges_[i].next_in_bucket = buckets_[bucket];
+    buckets_[bucket] = static_cast<int>(i);
+  }
+}
+
+void GURLPatternMatcher::CollectRules(int node,
+                                      const url_parse::StringPiece& query,
+                                      std::vector<int>* ids) const {
+  const std::vector<Rule>& rules = nodes_[node].rules;
+  for (size_t i = 0; i < rules.size(); i++) {
+    const Rule& rule = rules[i];
+    if (rule.query_key_len < 0 ||
+        QueryHasKey(query, &labels_[rule.query_key_offset],
+                    rule.query_key_len))
+      ids->push_back(rule.id);
+  }
+}
+
+void GURLPatternMatcher::MatchPath(int root,
+                                   const url_parse::StringPiece& path,
+                                   const url_parse::StringPiece& query,
+                                   std::vector<int>* ids) const {
+  int node = root;
+  CollectRules(node, query, ids);
+
+  const char* segment_begin = path.data();
+  const char* path_end = segment_begin + path.length();
+  if (segment_begin < path_end && *segment_begin == '/')
+    segment_begin++;
+  while (segment_begin < path_end) {
+    const char* segment_end = static_cast<const char*>(
+        memchr(segment_begin, '/', path_end - segment_begin));
+    if (!segment_end)
+      segment_end = path_end;
+    int segment_len = static_cast<int>(segment_end - segment_begin);
+    node = FindChild(node, segment_begin, segment_len,
+                     HashEdge(node, segment_begin, segment_len));
+    if (node < 0)
+      return;
+    CollectRules(node, query, ids);
+    segment_begin = segment_end + 1;
+  }
+}
+
+void GURLPatternMatcher::MatchHost(int root,
+                                   const url_parse::StringPiece& host,
+                                   const url_parse::StringPiece& path,
+                                   const url_parse::StringPiece& query,
+                                   std::vector<int>* ids) const {
+  const char* host_begin = host.data();
+  const char* host_end = host_begin + host.length();
+  if (host_end > host_begin && host_end[-1] == '.')
+    host_end--;
+
+  int node = root;
+  if (nodes_[node].path_root >= 0)
+    MatchPath(nodes_[node].path_root, path, query, ids);
+  const char* label_end = host_end;
+  while (label_end > host_begin) {
+    const char* label_begin = label_end;
+    while (label_begin > host_begin && label_begin[-1] != '.')
+      label_begin--;
+    int label_len = static_cast<int>(label_end - label_begin);
+    node = FindChild(node, label_begin, label_len,
+                     HashEdge(node, label_begin, label_len));
+    if (node < 0)
+      return;
+    const Node& host_node = nodes_[node];
+    if (host_node.path_root >= 0)
+      MatchPath(host_node.path_root, path, query, ids);
+    if (label_begin == host_begin) {
+      if (host_node.exact_path_root >= 0)
+        MatchPath(host_node.exact_path_root, path, query, ids);
+      break;
+    }
+    label_end = label_begin - 1;
+  }
+}
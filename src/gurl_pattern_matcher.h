@@ -0,0 +1,173 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Matches URLs against many patterns at once, like the rules of a router or
+// an access list: "https: URLs on any subdomain of example.com whose path
+// starts with /api and whose query has a key". Checking a URL against each
+// pattern with SchemeIs, DomainIs and path compares costs time for every
+// pattern. GURLPatternMatcher compiles the patterns into a trie instead:
+// host labels from right to left, then path segments. Matching walks the
+// URL's labels and segments once and collects every pattern that ends on
+// the way, so it costs about the same for ten patterns as for ten thousand.
+
+#ifndef GOOGLEURL_SRC_GURL_PATTERN_MATCHER_H__
+#define GOOGLEURL_SRC_GURL_PATTERN_MATCHER_H__
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/gurl_view.h"
+#include "googleurl/src/url_common.h"
+
+// One pattern. Each part is matched against a URL's canonical component, so
+// it should be written the way it appears in a canonical URL; an empty part
+// matches anything.
+struct GURLPattern {
+  GURLPattern() : include_subdomains(true) {}
+
+  // The scheme, lower-case and without the colon.
+  std::string scheme;
+
+  // The host, which matches hosts that are the same or, with
+  // |include_subdomains|, end with a dot and the same, like DomainIs. It
+  // is lower-cased, and dots at either end are ignored, as they are at the
+  // end of the URL's host.
+  std::string host;
+  bool include_subdomains;
+
+  // The path matches paths that start with the same segments: "/a/b"
+  // matches "/a/b", "/a/b/" and "/a/b/c" but not "/a/bc". A slash at the
+  // end makes no difference.
+  std::string path_prefix;
+
+  // A key that must be in the query, as it appears there (escaped), with or
+  // without a value.
+  std::string query_key;
+};
+
+class GURL_API GURLPatternMatcher {
+ public:
+  GURLPatternMatcher();
+  ~GURLPatternMatcher();
+
+  // Adds |pattern| and returns its id. Ids count up from 0 in the order
+  // patterns are added; adding the same pattern twice gives it two ids.
+  int Add(const GURLPattern& pattern);
+
+  // The number of patterns added.
+  int size() const { return num_patterns_; }
+
+  // Appends the ids of all patterns that |url| matches to |*ids|, in
+  // increasing order, and returns true if there were any. Invalid URLs
+  // match nothing, and filesystem: URLs are matched by their inner URL.
+  bool Match(const GURLView& url, std::vector<int>* ids) const;
+
+ private:
+  // A pattern that ends at a path node, and the query key it needs, if any.
+  struct Rule {
+    int id;
+    int query_key_offset;  // In |labels_|.
+    int query_key_len;     // -1 when there is no key to check.
+  };
+
+  // Host nodes lead to the path tries of the patterns whose host ends
+  // there; path nodes hold the patterns whose path ends there.
+  struct Node {
+    Node() : path_root(-1), exact_path_root(-1) {}
+
+    int path_root;        // Patterns that include subdomains.
+    int exact_path_root;  // Patterns for exactly this host.
+    std::vector<Rule> rules;
+  };
+
+  // The child of |parent| for one host label or path segment.
+  struct Edge {
+    int parent;
+    int label_offset;  // In |labels_|.
+    int label_len;
+    uint32 hash;
+    int child;
+    int next_in_bucket;  // -1 at the end of the chain.
+  };
+
+  struct SchemeRoot {
+    std::string scheme;
+    int root;
+  };
+
+  // Returns the root of the host trie for |scheme|, or for any scheme if it
+  // is empty. FindSchemeRoot returns -1 if there's none.
+  int FindSchemeRoot(const char* scheme, int scheme_len) const;
+  int AddSchemeRoot(const std::string& scheme);
+
+  // Returns the child of |parent| for |label|, or -1.
+  int FindChild(int parent, const char* label, int label_len,
+                uint32 hash) const;
+  int AddChild(int parent, const char* label, int label_len);
+  int NewNode();
+
+  // Rebuilds the bucket chains for at least |num_edges| edges.
+  void Rehash(int num_edges);
+
+  // Adds the patterns ending at path node |node| to |*ids|, checking their
+  // query keys against |query|.
+  void CollectRules(int node, const url_parse::StringPiece& query,
+                    std::vector<int>* ids) const;
+
+  // Walks the path trie rooted at |root| along |path|.
+  void MatchPath(int root, const url_parse::StringPiece& path,
+                 const url_parse::StringPiece& query,
+                 std::vector<int>* ids) const;
+
+  // Walks the host trie rooted at |root| along |host|, and the path tries
+  // of every host node on the way.
+  void MatchHost(int root, const url_parse::StringPiece& host,
+                 const url_parse::StringPiece& path,
+                 const url_parse::StringPiece& query,
+                 std::vector<int>* ids) const;
+
+  int num_patterns_;
+
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+  std::vector<int> buckets_;  // Heads of the bucket chains, -1 when empty.
+
+  // Host labels, path segments and query keys, one after another.
+  std::string labels_;
+
+  // The host trie roots for particular schemes, and for any scheme.
+  std::vector<SchemeRoot> scheme_roots_;
+  int any_scheme_root_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLPatternMatcher);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_PATTERN_MATCHER_H__
@@ -0,0 +1,127 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_query_iterator.h"
+
+#include "googleurl/src/url_canon_internal.h"
+
+GURLQueryIterator::GURLQueryIterator(const GURL& url)
+    : spec_(url.possibly_invalid_spec().data()),
+      key_needs_decoding_(false),
+      value_needs_decoding_(false) {
+  if (url.is_valid())
+    remaining_ = url.parsed_for_possibly_invalid_spec().query;
+}
+
+GURLQueryIterator::GURLQueryIterator(const char* spec,
+                                     const url_parse::Component& query)
+    : spec_(spec),
+      remaining_(query),
+      key_needs_decoding_(false),
+      value_needs_decoding_(false) {
+}
+
+bool GURLQueryIterator::Next() {
+  // This is ExtractQueryKeyValue, noting on the way whether each part has
+  // anything to decode so that the getters don't have to look again.
+  if (!remaining_.is_nonempty())
+    return false;
+
+  int cur = remaining_.begin;
+  int end = remaining_.end();
+
+  key_.begin = cur;
+  bool special = false;
+  while (cur < end && spec_[cur] != '&' && spec_[cur] != '=') {
+    special |= spec_[cur] == '%' || spec_[cur] == '+';
+    cur++;
+  }
+  key_.len = cur - key_.begin;
+  key_needs_decoding_ = special;
+
+  if (cur < end && spec_[cur] == '=')
+    cur++;
+
+  value_.begin = cur;
+  special = false;
+  while (cur < end && spec_[cur] != '&') {
+    special |= spec_[cur] == '%' || spec_[cur] == '+';
+    cur++;
+  }
+  value_.len = cur - value_.begin;
+  value_needs_decoding_ = special;
+
+  if (cur < end)
+    cur++;  // The '&'.
+  remaining_ = url_parse::MakeRange(cur, end);
+  return true;
+}
+
+const char* GURLQueryIterator::GetDecodedKey(url_canon::CanonOutput* buffer,
+                                             int* len) const {
+  return Decode(key_, key_needs_decoding_, buffer, len);
+}
+
+const char* GURLQueryIterator::GetDecodedValue(url_canon::CanonOutput* buffer,
+                                               int* len) const {
+  return Decode(value_, value_needs_decoding_, buffer, len);
+}
+
+const char* GURLQueryIterator::Decode(const url_parse::Component& component,
+                                      bool needs_decoding,
+                                      url_canon::CanonOutput* buffer,
+                                      int* len) const {
+  if (!needs_decoding) {
+    *len = component.len;
+    return &spec_[component.begin];
+  }
+
+  // Decoding never makes the text longer, so after one resize the bytes
+  // can be written straight into the buffer.
+  int start = buffer->length();
+  if (buffer->capacity() < start + component.len)
+    buffer->Resize(start + component.len);
+  char* out = buffer->data() + start;
+  int out_len = 0;
+  int end = component.end();
+  for (int i = component.begin; i < end; i++) {
+    char ch = spec_[i];
+    if (ch == '+') {
+      ch = ' ';
+    } else if (ch == '%') {
+      unsigned char unescaped;
+      if (url_canon::DecodeEscaped(spec_, &i, end, &unescaped))
+        ch = static_cast<char>(unescaped);
+    }
+    out[out_len++] = ch;
+  }
+  buffer->set_length(start + out_len);
+  *len = out_len;
+  return out;
+}
@@ -0,0 +1,98 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Walks the key/value pairs of a query string. url_parse::ExtractQueryKeyValue
+// gives the raw components, and decoding each one with
+// url_util::DecodeURLEscapeSequences goes through two temporary buffers and
+// produces UTF-16. GURLQueryIterator hands out the raw components as pointers
+// into the spec and only decodes on request, into a buffer the caller
+// supplies and reuses, as UTF-8. A component with no '%' or '+' is never
+// copied at all.
+
+#ifndef GOOGLEURL_SRC_GURL_QUERY_ITERATOR_H__
+#define GOOGLEURL_SRC_GURL_QUERY_ITERATOR_H__
+
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+class GURL_API GURLQueryIterator {
+ public:
+  // Iterates over the query of |url|, which must outlive the iterator. An
+  // invalid URL has no pairs.
+  explicit GURLQueryIterator(const GURL& url);
+
+  // Iterates over the |query| component of |spec|, which must outlive the
+  // iterator. This doesn't require the spec to be canonical.
+  GURLQueryIterator(const char* spec, const url_parse::Component& query);
+
+  // Moves to the next pair, returning false when there are no more. It has
+  // to be called once before the first pair can be read. Pairs are split
+  // like ExtractQueryKeyValue does: "a&&b=" has the pairs ("a", ""),
+  // ("", "") and ("b", "").
+  bool Next();
+
+  // The raw key and value of the current pair, as offsets into spec().
+  const char* spec() const { return spec_; }
+  const url_parse::Component& key() const { return key_; }
+  const url_parse::Component& value() const { return value_; }
+
+  // Whether the key or value contains a '%' or '+', so that decoding it
+  // gives something other than the raw text.
+  bool KeyNeedsDecoding() const { return key_needs_decoding_; }
+  bool ValueNeedsDecoding() const { return value_needs_decoding_; }
+
+  // Returns the decoded key or value and its length in |*len|. '+' becomes a
+  // space and valid escape sequences become the byte they encode; invalid
+  // ones are kept as they are. The result is not checked for being valid
+  // UTF-8. When nothing needs decoding the returned pointer is into the spec
+  // and |buffer| is left alone. Otherwise the decoded text is appended to
+  // |buffer| and the pointer is into it, valid until |buffer| next changes.
+  const char* GetDecodedKey(url_canon::CanonOutput* buffer, int* len) const;
+  const char* GetDecodedValue(url_canon::CanonOutput* buffer, int* len) const;
+
+ private:
+  const char* Decode(const url_parse::Component& component,
+                     bool needs_decoding,
+                     url_canon::CanonOutput* buffer,
+                     int* len) const;
+
+  const char* spec_;
+
+  // What's left of the query after the current pair.
+  url_parse::Component remaining_;
+
+  url_parse::Component key_;
+  url_parse::Component value_;
+  bool key_needs_decoding_;
+  bool value_needs_decoding_;
+};
+
+#endif  // GOOGLEURL_SRC_GURL_QUERY_ITERATOR_H__
@@ -0,0 +1,267 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_resolver.h"
+
+#include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_file.h"
+#include "googleurl/src/url_parse_internal.h"
+#include "googleurl/src/url_util.h"
+
+namespace {
+
+// Output that appends to the end of another output while looking like an
+// empty one to whatever writes to it. The resolvers assume they write to the
+// start of their output, so this lets a batch resolve each URL in place
+// instead of resolving it somewhere else and copying it over.
+class AppendingCanonOutput : public url_canon::CanonOutput {
+ public:
+  explicit AppendingCanonOutput(url_canon::CanonOutput* output)
+      : output_(output),
+        begin_(output->length()) {
+    buffer_ = output_->data() + begin_;
+    buffer_len_ = output_->capacity() - begin_;
+  }
+  virtual ~AppendingCanonOutput() {
+    Complete();
+  }
+
+  // Sets the length of the underlying output to include what was written.
+  void Complete() {
+    output_->set_length(begin_ + cur_len_);
+  }
+
+  virtual void Resize(int sz) {
+    // Outputs only keep their length when they grow.
+    Complete();
+    output_->Resize(begin_ + sz);
+    buffer_ = output_->data() + begin_;
+    buffer_len_ = output_->capacity() - begin_;
+  }
+
+ private:
+  url_canon::CanonOutput* output_;
+  int begin_;
+
+  DISALLOW_COPY_AND_ASSIGN(AppendingCanonOutput);
+};
+
+}  // namespace
+
+GURLResolver::GURLResolver(const GURL& base)
+    : base_(base),
+      charset_converter_(NULL),
+      base_is_standard_(false),
+      base_is_file_(false),
+      path_prefix_len_(0) {
+  Init();
+}
+
+GURLResolver::GURLResolver(const GURL& base,
+                           url_canon::CharsetConverter* charset_converter)
+    : base_(base),
+      charset_converter_(charset_converter),
+      base_is_standard_(false),
+      base_is_file_(false),
+      path_prefix_len_(0) {
+  Init();
+}
+
+GURLResolver::~GURLResolver() {
+}
+
+void GURLResolver::Init() {
+  if (!base_.is_valid())
+    return;
+
+  const std::string& spec = base_.spec();
+  const url_parse::Parsed& parsed = base_.parsed_for_possibly_invalid_spec();
+  base_is_standard_ = url_util::IsStandard(spec.data(), parsed.scheme);
+  base_is_file_ = base_.SchemeIsFile();
+
+  // Relative paths on file and filesystem URLs need more care than just
+  // replacing everything after the last slash (drive letters, inner URLs),
+  // so those always take the general route.
+  if (!base_is_standard_ || base_is_file_ || base_.SchemeIsFileSystem())
+    return;
+  for (int i = parsed.path.end() - 1; i >= parsed.path.begin; i--) {
+    if (spec[i] == '/') {
+      path_prefix_len_ = i + 1;
+      break;
+    }
+  }
+}
+
+template<typename CHAR>
+bool GURLResolver::DoResolve(const CHAR* in_relative, int in_relative_len,
+                             url_canon::CanonOutput* output,
+                             url_parse::Parsed* out_parsed) const {
+  const std::string& base_spec = base_.spec();
+  const url_parse::Parsed& base_parsed =
+      base_.parsed_for_possibly_invalid_spec();
+
+  // Non-standard bases may still be resolved as if they had an authority,
+  // which url_util handles. They're rare, so there's nothing cached for them.
+  if (!base_is_standard_) {
+    return url_util::ResolveRelative(
+        base_spec.data(), static_cast<int>(base_spec.length()), base_parsed,
+        in_relative, in_relative_len, charset_converter_, output, out_parsed);
+  }
+
+  // From here on this is url_util::ResolveRelative for a standard base.
+  url_canon::RawCanonOutputT<CHAR> whitespace_buffer;
+  int relative_len;
+  const CHAR* relative = url_canon::RemoveURLWhitespace(
+      in_relative, in_relative_len, &whitespace_buffer, &relative_len);
+
+  bool is_relative;
+  url_parse::Component relative_component;
+  if (!url_canon::IsRelativeURL(base_spec.data(), base_parsed,
+                                relative, relative_len, true,
+                                &is_relative, &relative_component))
+    return false;  // Error resolving.
+
+  if (!is_relative) {
+    return url_util::Canonicalize(relative, relative_len, charset_converter_,
+                                  output, out_parsed);
+  }
+
+  // The common case for links is a relative path like "foo/bar.html". The
+  // base is kept up to the last slash of its path and the path of the
+  // relative URL is appended, which is what ResolveRelativeURL would do,
+  // without finding that slash again.
+  if (path_prefix_len_ && relative_component.len > 0 &&
+      !url_parse::IsURLSlash(relative[relative_component.begin])
+#ifdef WIN32
+      && !url_parse::DoesBeginWindowsDriveSpec(relative,
+                                               relative_component.begin,
+                                               relative_component.end())
+#endif
+      ) {
+    url_parse::Component path, query, ref;
+    url_parse::ParsePathInternal(relative, relative_component,
+                                 &path, &query, &ref);
+    if (path.len > 0) {
+      *out_parsed = base_parsed;
+      output->Append(base_spec.data(), path_prefix_len_);
+      bool success = url_canon::CanonicalizePartialPath(
+          relative, path, base_parsed.path.begin, output);
+      out_parsed->path = url_parse::MakeRange(base_parsed.path.begin,
+                                              output->length());
+      url_canon::CanonicalizeQuery(relative, query, charset_converter_,
+                                   output, &out_parsed->query);
+      url_canon::CanonicalizeRef(relative, ref, output, &out_parsed->ref);
+      return success;
+    }
+  }
+
+  return url_canon::ResolveRelativeURL(base_spec.data(), base_parsed,
+                                       base_is_file_, relative,
+                                       relative_component, charset_converter_,
+                                       output, out_parsed);
+}
+
+template<typename STR>
+GURL GURLResolver::DoResolveToGURL(const STR& relative) const {
+  // Not allowed for invalid URLs.
+  if (!base_.is_valid())
+    return GURL();
+
+  // The result needs an inner URL, which only GURL knows how to set up.
+  if (base_.SchemeIsFileSystem())
+    return base_.ResolveWithCharsetConverter(relative, charset_converter_);
+
+  url_canon::RawCanonOutput<1024> output;
+  url_parse::Parsed parsed;
+  if (!DoResolve(relative.data(), static_cast<int>(relative.length()),
+                 &output, &parsed)) {
+    // Error resolving, return an empty URL.
+    return GURL();
+  }
+  return GURL(output.data(), output.length(), parsed, true);
+}
+
+template<typename CHAR>
+int GURLResolver::DoResolveBatch(const CHAR* const* relatives,
+                                 const int* relative_lens,
+                                 int count,
+                                 url_canon::CanonOutput* output,
+                                 url_parse::Component* out_specs,
+                                 url_parse::Parsed* out_parsed,
+                                 bool* out_valid) const {
+  int num_valid = 0;
+  for (int i = 0; i < count; i++) {
+    int begin = output->length();
+    if (!base_.is_valid()) {
+      out_specs[i] = url_parse::Component(begin, 0);
+      out_parsed[i] = url_parse::Parsed();
+      out_valid[i] = false;
+      continue;
+    }
+
+    AppendingCanonOutput resolved(output);
+    out_valid[i] = DoResolve(relatives[i], relative_lens[i],
+                             &resolved, &out_parsed[i]);
+    resolved.Complete();
+    out_specs[i] = url_parse::Component(begin, resolved.length());
+    if (out_valid[i])
+      num_valid++;
+  }
+  return num_valid;
+}
+
+GURL GURLResolver::Resolve(const std::string& relative) const {
+  return DoResolveToGURL(relative);
+}
+
+GURL GURLResolver::Resolve(const string16& relative) const {
+  return DoResolveToGURL(relative);
+}
+
+int GURLResolver::ResolveBatch(const char* const* relatives,
+                               const int* relative_lens,
+                               int count,
+                               url_canon::CanonOutput* output,
+                               url_parse::Component* out_specs,
+                               url_parse::Parsed* out_parsed,
+                               bool* out_valid) const {
+  return DoResolveBatch(relatives, relative_lens, count, output,
+                        out_specs, out_parsed, out_valid);
+}
+
+int GURLResolver::ResolveBatch(const char16* const* relatives,
+                               const int* relative_lens,
+                               int count,
+                               url_canon::CanonOutput* output,
+                               url_parse::Component* out_specs,
+                               url_parse::Parsed* out_parsed,
+                               bool* out_valid) const {
+  return DoResolveBatch(relatives, relative_lens, count, output,
+                        out_specs, out_parsed, out_valid);
+}
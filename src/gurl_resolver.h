@@ -0,0 +1,124 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Resolves many relative URLs against the same base, such as all the links
+// on a page. GURL::Resolve works out from scratch, for every call, whether
+// the base is standard or a file URL and where its path ends.
+// GURLResolver does that once, in its constructor, and then resolves single
+// URLs or whole batches. A batch is written into one output buffer, so no
+// GURL has to be created per link.
+
+#ifndef GOOGLEURL_SRC_GURL_RESOLVER_H__
+#define GOOGLEURL_SRC_GURL_RESOLVER_H__
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "base/string16.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+class GURL_API GURLResolver {
+ public:
+  // Resolves against a copy of |base|. Use the second version to supply a
+  // converter for query strings, which must outlive the resolver. It may be
+  // NULL, meaning UTF-8, like for GURL::ResolveWithCharsetConverter.
+  explicit GURLResolver(const GURL& base);
+  GURLResolver(const GURL& base,
+               url_canon::CharsetConverter* charset_converter);
+  ~GURLResolver();
+
+  const GURL& base() const { return base_; }
+
+  // Equivalent to base().ResolveWithCharsetConverter(relative, converter).
+  GURL Resolve(const std::string& relative) const;
+  GURL Resolve(const string16& relative) const;
+
+  // Resolves the |count| relative URLs given by |relatives| and
+  // |relative_lens| and appends the results to |output| one after another.
+  // The outputs are filled like url_util::CanonicalizeBatch does: the
+  // location of each spec in |output|, its Parsed (relative to the start of
+  // the spec) and whether it resolved to a valid URL. Returns the number of
+  // valid URLs. If the base is invalid, every result is invalid and empty.
+  int ResolveBatch(const char* const* relatives,
+                   const int* relative_lens,
+                   int count,
+                   url_canon::CanonOutput* output,
+                   url_parse::Component* out_specs,
+                   url_parse::Parsed* out_parsed,
+                   bool* out_valid) const;
+  int ResolveBatch(const char16* const* relatives,
+                   const int* relative_lens,
+                   int count,
+                   url_canon::CanonOutput* output,
+                   url_parse::Component* out_specs,
+                   url_parse::Parsed* out_parsed,
+                   bool* out_valid) const;
+
+ private:
+  // Fills in the cached state from |base_|.
+  void Init();
+
+  // Resolves one relative URL into the empty |output|.
+  template<typename CHAR>
+  bool DoResolve(const CHAR* relative, int relative_len,
+                 url_canon::CanonOutput* output,
+                 url_parse::Parsed* out_parsed) const;
+
+  template<typename CHAR>
+  int DoResolveBatch(const CHAR* const* relatives,
+                     const int* relative_lens,
+                     int count,
+                     url_canon::CanonOutput* output,
+                     url_parse::Component* out_specs,
+                     url_parse::Parsed* out_parsed,
+                     bool* out_valid) const;
+
+  template<typename STR>
+  GURL DoResolveToGURL(const STR& relative) const;
+
+  GURL base_;
+  url_canon::CharsetConverter* charset_converter_;
+
+  // What url_util::ResolveRelative would work out about the base on every
+  // call.
+  bool base_is_standard_;
+  bool base_is_file_;
+
+  // Length of the part of the base spec kept when a relative path replaces
+  // the last path segment: everything up to and including the last slash of
+  // the path. 0 when that shortcut can't be used for this base.
+  int path_prefix_len_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLResolver);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_RESOLVER_H__
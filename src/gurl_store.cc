@@ -0,0 +1,355 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_store.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+#include "googleurl/src/gurl_hash.h"
+#include "googleurl/src/url_canon_host_classify.h"
+#include "googleurl/src/url_parse.h"
+#include "googleurl/src/url_scheme_registry.h"
+#include "googleurl/src/url_util.h"
+
+namespace {
+
+// Records are appended to blocks of this size. Longer ones get a block of
+// their own.
+const int kBlockSize = 1 << 20;
+
+// The before-host part of almost every URL, stored as a single zero byte.
+const char kDoubleSlash[] = "//";
+
+int VarintLength(uint32 value) {
+  int len = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    len++;
+  }
+  return len;
+}
+
+char* WriteVarint(uint32 value, char* out) {
+  while (value >= 0x80) {
+    *out++ = static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<char>(value);
+  return out;
+}
+
+const char* ReadVarint(const char* in, uint32* value) {
+  uint32 result = 0;
+  int shift = 0;
+  unsigned char byte;
+  do {
+    byte = static_cast<unsigned char>(*in++);
+    result |= static_cast<uint32>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  *value = result;
+  return in;
+}
+
+GURLStore::Piece MakePiece(const char* data, int len) {
+  GURLStore::Piece piece;
+  piece.data = data;
+  piece.len = len;
+  return piece;
+}
+
+}  // namespace
+
+GURLStore::GURLStore()
+    : current_block_(-1),
+      current_block_used_(kBlockSize),
+      size_(0),
+      record_bytes_(0) {
+}
+
+GURLStore::~GURLStore() {
+  for (size_t i = 0; i < blocks_.size(); i++)
+    delete[] blocks_[i];
+}
+
+bool GURLStore::Add(const char* spec, int spec_len, Handle* handle) {
+  url_canon::RawCanonOutput<1024> output;
+  url_parse::Parsed parsed;
+  if (!url_util::Canonicalize(spec, spec_len, NULL, &output, &parsed))
+    return false;
+  *handle = AddCanonical(output.data(), output.length(), parsed);
+  return true;
+}
+
+bool GURLStore::Add(const char16* spec, int spec_len, Handle* handle) {
+  url_canon::RawCanonOutput<1024> output;
+  url_parse::Parsed parsed;
+  if (!url_util::Canonicalize(spec, spec_len, NULL, &output, &parsed))
+    return false;
+  *handle = AddCanonical(output.data(), output.length(), parsed);
+  return true;
+}
+
+bool GURLStore::Add(const GURL& url, Handle* handle) {
+  if (!url.is_valid())
+    return false;
+  const std::string& spec = url.possibly_invalid_spec();
+  *handle = AddCanonical(spec.data(), static_cast<int>(spec.length()),
+                         url.parsed_for_possibly_invalid_spec());
+  return true;
+}
+
+GURLStore::Handle GURLStore::AddCanonical(const char* spec, int spec_len,
+                                          const url_parse::Parsed& parsed) {
+  // Valid URLs always have a scheme, followed by its colon.
+  DCHECK(parsed.scheme.is_nonempty());
+  uint32 scheme_id = InternScheme(&spec[parsed.scheme.begin],
+                                  parsed.scheme.len);
+  int after_scheme = parsed.scheme.end() + 1;
+
+  // URL records are: the scheme id, the host id plus one (0 for no host), the
+  // before-host length plus one (0 for "//") and bytes, and the after-host
+  // length and bytes.
+  uint32 host_code = 0;
+  int before_host_len = 0;
+  int after_host_begin = after_scheme;
+  if (parsed.host.is_nonempty()) {
+    host_code = InternHost(&spec[parsed.host.begin], parsed.host.len) + 1;
+    before_host_len = parsed.host.begin - after_scheme;
+    after_host_begin = parsed.host.end();
+  }
+  bool double_slash = before_host_len == 2 &&
+      spec[after_scheme] == '/' && spec[after_scheme + 1] == '/';
+  uint32 before_host_code =
+      double_slash ? 0 : static_cast<uint32>(before_host_len) + 1;
+  int stored_before_host_len = double_slash ? 0 : before_host_len;
+  int after_host_len = spec_len - after_host_begin;
+
+  int record_len = VarintLength(scheme_id) + VarintLength(host_code) +
+      VarintLength(before_host_code) + stored_before_host_len +
+      VarintLength(after_host_len) + after_host_len;
+  Handle handle;
+  char* out = AllocateRecord(record_len, &handle);
+  out = WriteVarint(scheme_id, out);
+  out = WriteVarint(host_code, out);
+  out = WriteVarint(before_host_code, out);
+  memcpy(out, &spec[after_scheme], stored_before_host_len);
+  out += stored_before_host_len;
+  out = WriteVarint(after_host_len, out);
+  memcpy(out, &spec[after_host_begin], after_host_len);
+
+  size_++;
+  return handle;
+}
+
+uint32 GURLStore::InternScheme(const char* scheme, int scheme_len) {
+  // There are only ever a handful of schemes.
+  for (size_t i = 0; i < schemes_.size(); i++) {
+    if (static_cast<int>(schemes_[i].length()) == scheme_len &&
+        memcmp(schemes_[i].data(), scheme, scheme_len) == 0)
+      return static_cast<uint32>(i);
+  }
+  schemes_.push_back(std::string(scheme, scheme_len));
+  return static_cast<uint32>(schemes_.size() - 1);
+}
+
+uint32 GURLStore::InternHost(const char* host, int host_len) {
+  uint32 hash = static_cast<uint32>(
+      url_util::HashURLBytes(host, host_len, 0));
+  if ((host_records_.size() + 1) * 2 > host_slots_.size())
+    GrowHostSlots();
+
+  size_t mask = host_slots_.size() - 1;
+  size_t i = hash & mask;
+  for (; host_slots_[i].id_plus_one; i = (i + 1) & mask) {
+    if (host_slots_[i].hash != hash)
+      continue;
+    uint32 id = host_slots_[i].id_plus_one - 1;
+    Piece known;
+    url_canon::CanonHostInfo::Family family;
+    GetHost(id, &known, &family);
+    if (known.len == host_len && memcmp(known.data, host, host_len) == 0)
+      return id;
+  }
+
+  url_canon::CanonHostInfo host_info;
+  if (!url_canon::ClassifyHost(host, url_parse::Component(0, host_len),
+                               &host_info))
+    host_info.family = url_canon::CanonHostInfo::NEUTRAL;
+  Handle record;
+  char* out = AllocateRecord(1 + VarintLength(host_len) + host_len, &record);
+  *out++ = static_cast<char>(host_info.family);
+  out = WriteVarint(host_len, out);
+  memcpy(out, host, host_len);
+
+  uint32 id = static_cast<uint32>(host_records_.size());
+  host_records_.push_back(record);
+  host_slots_[i].hash = hash;
+  host_slots_[i].id_plus_one = id + 1;
+  return id;
+}
+
+void GURLStore::GrowHostSlots() {
+  std::vector<HostSlot> old;
+  old.swap(host_slots_);
+  HostSlot empty = { 0, 0 };
+  host_slots_.resize(old.empty() ? 16 : old.size() * 2, empty);
+  size_t mask = host_slots_.size() - 1;
+  for (size_t i = 0; i < old.size(); i++) {
+    if (!old[i].id_plus_one)
+      continue;
+    size_t j = old[i].hash & mask;
+    while (host_slots_[j].id_plus_one)
+      j = (j + 1) & mask;
+    host_slots_[j] = old[i];
+  }
+}
+
+void GURLStore::GetHost(uint32 id, Piece* host,
+                        url_canon::CanonHostInfo::Family* family) const {
+  DCHECK(id < host_records_.size());
+  const char* in = RecordData(host_records_[id]);
+  *family = static_cast<url_canon::CanonHostInfo::Family>(
+      static_cast<unsigned char>(*in++));
+  uint32 host_len;
+  in = ReadVarint(in, &host_len);
+  *host = MakePiece(in, host_len);
+}
+
+char* GURLStore::AllocateRecord(int len, Handle* handle) {
+  record_bytes_ += len;
+  if (len > kBlockSize) {
+    // Give the record its own block, and keep filling the current one.
+    blocks_.push_back(new char[len]);
+    block_sizes_.push_back(len);
+    *handle = static_cast<Handle>(blocks_.size() - 1) << 32;
+    return blocks_.back();
+  }
+
+  if (kBlockSize - current_block_used_ < len) {
+    blocks_.push_back(new char[kBlockSize]);
+    block_sizes_.push_back(kBlockSize);
+    current_block_ = static_cast<int>(blocks_.size() - 1);
+    current_block_used_ = 0;
+  }
+  *handle = (static_cast<Handle>(current_block_) << 32) |
+      static_cast<Handle>(current_block_used_);
+  char* record = blocks_[current_block_] + current_block_used_;
+  current_block_used_ += len;
+  return record;
+}
+
+const char* GURLStore::RecordData(Handle handle) const {
+  size_t block = static_cast<size_t>(handle >> 32);
+  DCHECK(block < blocks_.size());
+  return blocks_[block] + static_cast<uint32>(handle);
+}
+
+void GURLStore::Get(Handle handle, Entry* entry) const {
+  const char* in = RecordData(handle);
+
+  uint32 scheme_id, host_code, before_host_code, after_host_len;
+  in = ReadVarint(in, &scheme_id);
+  in = ReadVarint(in, &host_code);
+  in = ReadVarint(in, &before_host_code);
+
+  const std::string& scheme = schemes_[scheme_id];
+  entry->scheme = MakePiece(scheme.data(), static_cast<int>(scheme.length()));
+  if (before_host_code == 0) {
+    entry->before_host = MakePiece(kDoubleSlash, 2);
+  } else {
+    entry->before_host = MakePiece(in, before_host_code - 1);
+    in += before_host_code - 1;
+  }
+  if (host_code == 0) {
+    entry->host = MakePiece("", 0);
+    entry->host_family = url_canon::CanonHostInfo::NEUTRAL;
+  } else {
+    GetHost(host_code - 1, &entry->host, &entry->host_family);
+  }
+  in = ReadVarint(in, &after_host_len);
+  entry->after_host = MakePiece(in, after_host_len);
+}
+
+std::string GURLStore::GetSpec(Handle handle) const {
+  Entry entry;
+  Get(handle, &entry);
+  std::string spec;
+  spec.reserve(entry.scheme.len + 1 + entry.before_host.len +
+               entry.host.len + entry.after_host.len);
+  spec.append(entry.scheme.data, entry.scheme.len);
+  spec.push_back(':');
+  spec.append(entry.before_host.data, entry.before_host.len);
+  spec.append(entry.host.data, entry.host.len);
+  spec.append(entry.after_host.data, entry.after_host.len);
+  return spec;
+}
+
+GURL GURLStore::GetGURL(Handle handle) const {
+  std::string spec = GetSpec(handle);
+  const char* data = spec.data();
+  int len = static_cast<int>(spec.length());
+
+  // A canonical spec parses back into its canonical Parsed, given the
+  // parser the canonicalizer picked for the scheme.
+  url_parse::Parsed parsed;
+  url_parse::Component scheme;
+  url_parse::ExtractScheme(data, len, &scheme);
+  const url_util::SchemeInfo* info = url_util::FindSchemeInfo(data, scheme);
+  if (!info) {
+    url_parse::ParsePathURL(data, len, &parsed);
+  } else {
+    switch (info->type) {
+      case url_util::SCHEME_FILE:
+        url_parse::ParseFileURL(data, len, &parsed);
+        break;
+      case url_util::SCHEME_FILESYSTEM:
+        url_parse::ParseFileSystemURL(data, len, &parsed);
+        break;
+      case url_util::SCHEME_MAILTO:
+        url_parse::ParseMailtoURL(data, len, &parsed);
+        break;
+      default:
+        url_parse::ParseStandardURL(data, len, &parsed);
+        break;
+    }
+  }
+  return GURL(data, spec.length(), parsed, true);
+}
+
+int64 GURLStore::bytes_used() const {
+  int64 bytes = record_bytes_;
+  for (size_t i = 0; i < schemes_.size(); i++)
+    bytes += schemes_[i].length();
+  // The host bytes are in the records already.
+  bytes += host_records_.capacity() * sizeof(Handle);
+  bytes += host_slots_.capacity() * sizeof(HostSlot);
+  return bytes;
+}
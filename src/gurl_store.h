@@ -0,0 +1,138 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Keeps a large number of canonical URLs in memory. A GURL costs a
+// std::string and a Parsed per URL, and the scheme and host are repeated in
+// every one of them. GURLStore interns schemes and hosts and appends the rest
+// of each spec to large shared blocks, so a URL costs its unshared bytes plus
+// a few bytes of header, and is named by an 8-byte handle.
+
+#ifndef GOOGLEURL_SRC_GURL_STORE_H__
+#define GOOGLEURL_SRC_GURL_STORE_H__
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/string16.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+class GURL_API GURLStore {
+ public:
+  typedef uint64 Handle;
+
+  // A run of characters owned by the store.
+  struct Piece {
+    const char* data;
+    int len;
+  };
+
+  // The parts of a stored URL, pointing into the store: its spec is
+  // |scheme|, ':', |before_host|, |host| and |after_host| one after another.
+  // URLs without a host, like "mailto:" or "filesystem:" ones, have an empty
+  // |host| and everything after the colon in |after_host|.
+  struct Entry {
+    Piece scheme;
+    Piece before_host;  // Like "//" or "//user:pass@".
+    Piece host;
+    url_canon::CanonHostInfo::Family host_family;
+    Piece after_host;  // The port, path, query and ref.
+  };
+
+  GURLStore();
+  ~GURLStore();
+
+  // Canonicalizes |spec| like GURL does and stores it, setting |*handle| to
+  // refer to it. Invalid URLs aren't stored and return false.
+  bool Add(const char* spec, int spec_len, Handle* handle);
+  bool Add(const char16* spec, int spec_len, Handle* handle);
+
+  // Stores a valid GURL without canonicalizing it again.
+  bool Add(const GURL& url, Handle* handle);
+
+  // Handles stay valid for the life of the store.
+  void Get(Handle handle, Entry* entry) const;
+  std::string GetSpec(Handle handle) const;
+
+  // Rebuilds the GURL. This copies the spec into the new GURL and parses
+  // it, but doesn't canonicalize it again.
+  GURL GetGURL(Handle handle) const;
+
+  // The number of URLs, distinct hosts, and bytes used for them, counting
+  // the host dictionary.
+  size_t size() const { return size_; }
+  size_t host_count() const { return host_records_.size(); }
+  int64 bytes_used() const;
+
+ private:
+  // Stores a valid canonical spec.
+  Handle AddCanonical(const char* spec, int spec_len,
+                      const url_parse::Parsed& parsed);
+
+  uint32 InternScheme(const char* scheme, int scheme_len);
+  uint32 InternHost(const char* host, int host_len);
+
+  // Returns room for |len| bytes of a record, and its handle.
+  char* AllocateRecord(int len, Handle* handle);
+  const char* RecordData(Handle handle) const;
+
+  // Reads the host record for the host with id |id|.
+  void GetHost(uint32 id, Piece* host,
+               url_canon::CanonHostInfo::Family* family) const;
+
+  // Doubles the host hash table, or makes its first one.
+  void GrowHostSlots();
+
+  std::vector<std::string> schemes_;
+
+  // Each host is a record of its own: its family, then its length and
+  // bytes. Host ids index |host_records_|, and |host_slots_| is an open
+  // addressed hash table of them, at most half full.
+  struct HostSlot {
+    uint32 hash;
+    uint32 id_plus_one;  // 0 for an empty slot.
+  };
+  std::vector<Handle> host_records_;
+  std::vector<HostSlot> host_slots_;
+
+  // Records: each block is filled in order and never moves.
+  std::vector<char*> blocks_;
+  std::vector<int> block_sizes_;
+  int current_block_;
+  int current_block_used_;
+
+  size_t size_;
+  int64 record_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLStore);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_STORE_H__
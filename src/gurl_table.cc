@@ -0,0 +1,259 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_table.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+#include "googleurl/src/url_parse_component.h"
+#include "googleurl/src/url_parse_packed.h"
+
+namespace {
+
+const char kMagic[4] = { 'G', 'U', 'R', 'L' };
+
+// The components stored in a record, in order: all of the outer URL's and
+// the first kNumInnerComponents of the inner URL's.
+const int kNumOuterComponents = url_parse::Parsed::REF + 1;
+const int kNumInnerComponents = url_parse::Parsed::PATH + 1;
+const int kInnerValidBit = kNumOuterComponents;
+const uint16 kHasInnerBit = 0x8000;
+
+// Offsets within a record.
+const size_t kSpecOffset = 0;
+const size_t kSpecLength = 4;
+const size_t kFlags = 8;
+const size_t kValidMask = 10;
+const size_t kComponents = 12;
+
+void AppendUint16(uint16 value, std::string* output) {
+  output->push_back(static_cast<char>(value & 0xff));
+  output->push_back(static_cast<char>(value >> 8));
+}
+
+void AppendUint32(uint32 value, std::string* output) {
+  AppendUint16(static_cast<uint16>(value & 0xffff), output);
+  AppendUint16(static_cast<uint16>(value >> 16), output);
+}
+
+uint16 ReadUint16(const unsigned char* data) {
+  return static_cast<uint16>(data[0] | (data[1] << 8));
+}
+
+uint32 ReadUint32(const unsigned char* data) {
+  return ReadUint16(data) | (static_cast<uint32>(ReadUint16(data + 2)) << 16);
+}
+
+// Stored components keep their begin when they're invalid, like a
+// PackedParsed, so that reading one back gives exactly what was written.
+url_parse::Component ReadComponent(const unsigned char* record, int index) {
+  uint16 mask = ReadUint16(record + kValidMask);
+  const unsigned char* component = record + kComponents + 4 * index;
+  return url_parse::Component(
+      ReadUint16(component),
+      (mask & (1 << index)) ? ReadUint16(component + 2) : -1);
+}
+
+}  // namespace
+
+const uint32 GURLTable::kVersion;
+const size_t GURLTable::kHeaderSize;
+const size_t GURLTable::kRecordSize;
+
+GURLTable::GURLTable() : records_(NULL), specs_(NULL), count_(0) {
+}
+
+GURLTable::~GURLTable() {
+}
+
+bool GURLTable::Init(const char* data, size_t data_len) {
+  records_ = NULL;
+  specs_ = NULL;
+  count_ = 0;
+
+  const unsigned char* header = reinterpret_cast<const unsigned char*>(data);
+  if (data_len < kHeaderSize || memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+      ReadUint32(header + 4) != kVersion)
+    return false;
+  size_t count = ReadUint32(header + 8);
+  size_t spec_bytes = ReadUint32(header + 12);
+  if (count > (data_len - kHeaderSize) / kRecordSize ||
+      data_len - kHeaderSize - count * kRecordSize != spec_bytes)
+    return false;
+
+  const unsigned char* records = header + kHeaderSize;
+  for (size_t i = 0; i < count; i++) {
+    const unsigned char* cur = records + i * kRecordSize;
+    uint32 spec_offset = ReadUint32(cur + kSpecOffset);
+    uint32 spec_len = ReadUint32(cur + kSpecLength);
+    if (spec_offset > spec_bytes || spec_len > spec_bytes - spec_offset ||
+        spec_len > static_cast<uint32>(kint32max))
+      return false;
+    if (!(ReadUint16(cur + kFlags) & PACKED))
+      continue;
+    for (int c = 0; c < kNumOuterComponents + kNumInnerComponents; c++) {
+      url_parse::Component component = ReadComponent(cur, c);
+      if (component.is_valid() &&
+          static_cast<uint32>(component.end()) > spec_len)
+        return false;
+    }
+  }
+
+  records_ = records;
+  specs_ = data + kHeaderSize + count * kRecordSize;
+  count_ = count;
+  return true;
+}
+
+const unsigned char* GURLTable::record(size_t index) const {
+  DCHECK(index < count_);
+  return records_ + index * kRecordSize;
+}
+
+bool GURLTable::is_valid(size_t index) const {
+  return (ReadUint16(record(index) + kFlags) & VALID) != 0;
+}
+
+const char* GURLTable::spec_data(size_t index) const {
+  return specs_ + ReadUint32(record(index) + kSpecOffset);
+}
+
+int GURLTable::spec_length(size_t index) const {
+  return static_cast<int>(ReadUint32(record(index) + kSpecLength));
+}
+
+url_parse::Component GURLTable::GetComponent(
+    size_t index,
+    url_parse::Parsed::ComponentType type) const {
+  const unsigned char* cur = record(index);
+  if (ReadUint16(cur + kFlags) & PACKED)
+    return ReadComponent(cur, type);
+  url_parse::Parsed parsed;
+  GetParsed(index, &parsed);
+  return url_parse::ComponentOfType(parsed, type);
+}
+
+void GURLTable::GetParsed(size_t index, url_parse::Parsed* parsed) const {
+  const unsigned char* cur = record(index);
+  if (!(ReadUint16(cur + kFlags) & PACKED)) {
+    // Only URLs of 64K and up get here. There's no way around parsing them.
+    *parsed = ToGURL(index).parsed_for_possibly_invalid_spec();
+    return;
+  }
+
+  for (int i = 0; i < kNumOuterComponents; i++)
+    *url_parse::MutableComponent(parsed, i) = ReadComponent(cur, i);
+  if (!(ReadUint16(cur + kValidMask) & kHasInnerBit)) {
+    parsed->clear_inner_parsed();
+    return;
+  }
+  url_parse::Parsed inner;
+  for (int i = 0; i < kNumInnerComponents; i++)
+    *url_parse::MutableComponent(&inner, i) = ReadComponent(cur, kInnerValidBit + i);
+  parsed->set_inner_parsed(inner);
+}
+
+GURL GURLTable::ToGURL(size_t index) const {
+  const unsigned char* cur = record(index);
+  if (!(ReadUint16(cur + kFlags) & PACKED))
+    return GURL(std::string(spec_data(index), spec_length(index)));
+
+  url_parse::Parsed parsed;
+  GetParsed(index, &parsed);
+  return GURL(spec_data(index), spec_length(index), parsed, is_valid(index));
+}
+
+GURLTableWriter::GURLTableWriter() : count_(0) {
+}
+
+GURLTableWriter::~GURLTableWriter() {
+}
+
+void GURLTableWriter::Add(const GURL& url) {
+  const std::string& spec = url.possibly_invalid_spec();
+  DCHECK(specs_.length() + spec.length() <= kuint32max);
+
+  url_parse::PackedParsed packed;
+  bool is_packed =
+      url_parse::PackedParsed::Pack(url.parsed_for_possibly_invalid_spec(),
+                                    &packed);
+  uint16 flags = 0;
+  if (url.is_valid())
+    flags |= GURLTable::VALID;
+  if (is_packed)
+    flags |= GURLTable::PACKED;
+
+  AppendUint32(static_cast<uint32>(specs_.length()), &records_);
+  AppendUint32(static_cast<uint32>(spec.length()), &records_);
+  AppendUint16(flags, &records_);
+
+  // The components of URLs that can't be packed are left zeroed.
+  url_parse::Component components[kNumOuterComponents + kNumInnerComponents];
+  uint16 mask = 0;
+  if (is_packed) {
+    for (int i = 0; i < kNumOuterComponents; i++) {
+      components[i] = packed.GetComponent(
+          static_cast<url_parse::Parsed::ComponentType>(i));
+    }
+    if (packed.has_inner_parsed()) {
+      mask |= kHasInnerBit;
+      for (int i = 0; i < kNumInnerComponents; i++) {
+        components[kInnerValidBit + i] = packed.GetInnerComponent(
+            static_cast<url_parse::Parsed::ComponentType>(i));
+      }
+    }
+  }
+  for (int i = 0; i < kNumOuterComponents + kNumInnerComponents; i++) {
+    if (components[i].is_valid())
+      mask |= 1 << i;
+  }
+  AppendUint16(mask, &records_);
+  for (int i = 0; i < kNumOuterComponents + kNumInnerComponents; i++) {
+    AppendUint16(static_cast<uint16>(components[i].begin), &records_);
+    AppendUint16(components[i].is_valid() ?
+                     static_cast<uint16>(components[i].len) : 0,
+                 &records_);
+  }
+
+  specs_.append(spec);
+  count_++;
+}
+
+void GURLTableWriter::Serialize(std::string* output) const {
+  DCHECK(records_.length() == count_ * GURLTable::kRecordSize);
+  output->reserve(output->length() + GURLTable::kHeaderSize +
+                  records_.length() + specs_.length());
+  output->append(kMagic, sizeof(kMagic));
+  AppendUint32(GURLTable::kVersion, output);
+  AppendUint32(static_cast<uint32>(count_), output);
+  AppendUint32(static_cast<uint32>(specs_.length()), output);
+  output->append(records_);
+  output->append(specs_);
+}
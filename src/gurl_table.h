@@ -0,0 +1,134 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A file format for saving sets of URLs and loading them again without
+// canonicalizing or parsing anything. GURLTableWriter writes each URL's
+// canonical spec with its parsed components and validity. GURLTable reads
+// that back straight out of the bytes, which are meant to be a memory-mapped
+// file, so loading a table only has to check its bounds.
+//
+// Version 1 of the format, all integers little-endian:
+//
+//   Header, 16 bytes:
+//     char[4] magic "GURL"
+//     uint32  version, 1
+//     uint32  number of URLs
+//     uint32  number of bytes of spec data
+//   One 68-byte record per URL:
+//     uint32  offset of the spec in the spec data
+//     uint32  length of the spec
+//     uint16  flags, VALID and PACKED
+//     uint16  component validity, as in url_parse::PackedParsed
+//     uint16  begin and length of the 8 outer components, then of the
+//             scheme through the path of the inner URL
+//   The spec data.
+//
+// The components are those of a url_parse::PackedParsed. URLs too long for
+// one, 64K and up, are stored without PACKED and are parsed when read.
+
+#ifndef GOOGLEURL_SRC_GURL_TABLE_H__
+#define GOOGLEURL_SRC_GURL_TABLE_H__
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+class GURL_API GURLTable {
+ public:
+  static const uint32 kVersion = 1;
+  static const size_t kHeaderSize = 16;
+  static const size_t kRecordSize = 68;
+
+  // Record flags.
+  enum {
+    VALID = 1,
+    PACKED = 2,
+  };
+
+  GURLTable();
+  ~GURLTable();
+
+  // Uses the |data_len| bytes at |data| as the table. Nothing is copied, so
+  // they must outlive this object. Returns false, leaving the table empty,
+  // if they aren't a table of a version this code reads, or if any spec or
+  // component lies outside the data.
+  bool Init(const char* data, size_t data_len);
+
+  size_t size() const { return count_; }
+
+  // Accessors for entry |index|, reading the table in place. The spec
+  // points into the table's data and isn't NULL-terminated. Getting the
+  // components of an entry that isn't packed parses its spec.
+  bool is_valid(size_t index) const;
+  const char* spec_data(size_t index) const;
+  int spec_length(size_t index) const;
+  url_parse::Component GetComponent(size_t index,
+                                    url_parse::Parsed::ComponentType type)
+      const;
+  void GetParsed(size_t index, url_parse::Parsed* parsed) const;
+
+  // The GURL for entry |index|. This copies the spec but, for packed
+  // entries, doesn't parse or canonicalize it.
+  GURL ToGURL(size_t index) const;
+
+ private:
+  const unsigned char* record(size_t index) const;
+
+  const unsigned char* records_;
+  const char* specs_;
+  size_t count_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLTable);
+};
+
+class GURL_API GURLTableWriter {
+ public:
+  GURLTableWriter();
+  ~GURLTableWriter();
+
+  // Adds |url|, valid or not, as the next entry of the table.
+  void Add(const GURL& url);
+
+  size_t size() const { return count_; }
+
+  // Appends the table to |*output|.
+  void Serialize(std::string* output) const;
+
+ private:
+  size_t count_;
+  std::string records_;
+  std::string specs_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLTableWriter);
+};
+
+#endif  // GOOGLEURL_SRC_GURL_TABLE_H__
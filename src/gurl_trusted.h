@@ -0,0 +1,77 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Control over how much the trusted GURL constructor checks, for code that
+// builds GURLs from specs it canonicalized itself.
+//
+// GURL(canonical_spec, len, parsed, is_valid) can check its arguments by
+// canonicalizing the spec again and comparing. That doubles the cost of
+// every such GURL, so it's sampled: one in N constructions is checked, and
+// the checks and mismatches are counted. By default debug builds check
+// every one and release builds none. Deserializers that already know their
+// input is good can skip the checks entirely with MakeUncheckedGURL().
+
+#ifndef GOOGLEURL_SRC_GURL_TRUSTED_H__
+#define GOOGLEURL_SRC_GURL_TRUSTED_H__
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+struct TrustedGURLValidationStats {
+  TrustedGURLValidationStats() : checked(0), mismatches(0) {}
+
+  // Trusted constructions that were checked, and how many of those didn't
+  // match canonicalizing the spec again. In debug builds a mismatch is also
+  // a DCHECK failure.
+  int64 checked;
+  int64 mismatches;
+};
+
+// Checks one in |one_in_n| valid GURLs from the trusted constructor, or
+// none for 0, and returns the previous setting. This applies to all
+// threads and can be changed at any time.
+GURL_API int SetTrustedGURLValidationRate(int one_in_n);
+
+// Copies the process-wide counters to |*stats|.
+GURL_API void GetTrustedGURLValidationStats(TrustedGURLValidationStats* stats);
+
+// Makes a GURL of a spec and parse known to be canonical, like ones read
+// back from storage that only ever holds GURL specs. This is the trusted
+// constructor without its check: nothing is canonicalized again, whatever
+// the validation rate. A valid filesystem: URL gets its inner URL from the
+// inner parse like the trusted constructor does.
+GURL_API GURL MakeUncheckedGURL(const std::string& canonical_spec,
+                                const url_parse::Parsed& parsed,
+                                bool is_valid);
+
+#endif  // GOOGLEURL_SRC_GURL_TRUSTED_H__
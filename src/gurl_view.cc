@@ -0,0 +1,262 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/gurl_view.h"
+
+#include "base/logging.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_canon_host_classify.h"
+#include "googleurl/src/url_util.h"
+
+GURLView::GURLView()
+    : spec_(""),
+      spec_len_(0),
+      is_valid_(false),
+      inner_parsed_(NULL) {
+}
+
+GURLView::GURLView(const GURL& url)
+    : spec_(url.possibly_invalid_spec().data()),
+      spec_len_(static_cast<int>(url.possibly_invalid_spec().length())),
+      is_valid_(url.is_valid()),
+      inner_parsed_(NULL) {
+  SetParsed(url.parsed_for_possibly_invalid_spec());
+}
+
+GURLView::GURLView(const char* spec, int spec_len,
+                   const url_parse::Parsed& parsed, bool is_valid)
+    : spec_(spec),
+      spec_len_(spec_len),
+      is_valid_(is_valid),
+      inner_parsed_(NULL) {
+  SetParsed(parsed);
+}
+
+GURLView::GURLView(const GURLView& other)
+    : spec_(other.spec_),
+      spec_len_(other.spec_len_),
+      is_valid_(other.is_valid_),
+      parsed_(other.parsed_),
+      inner_parsed_(other.inner_parsed_) {
+}
+
+GURLView& GURLView::operator=(const GURLView& other) {
+  spec_ = other.spec_;
+  spec_len_ = other.spec_len_;
+  is_valid_ = other.is_valid_;
+  parsed_ = other.parsed_;
+  inner_parsed_ = other.inner_parsed_;
+  return *this;
+}
+
+void GURLView::SetParsed(const url_parse::Parsed& parsed) {
+  parsed_.scheme = parsed.scheme;
+  parsed_.username = parsed.username;
+  parsed_.password = parsed.password;
+  parsed_.host = parsed.host;
+  parsed_.port = parsed.port;
+  parsed_.path = parsed.path;
+  parsed_.query = parsed.query;
+  parsed_.ref = parsed.ref;
+  inner_parsed_ = parsed.inner_parsed();
+}
+
+url_parse::StringPiece GURLView::spec() const {
+  if (is_valid_ || spec_len_ == 0)
+    return possibly_invalid_spec();
+
+  DCHECK(false) << "Trying to get the spec of an invalid URL!";
+  return url_parse::StringPiece();
+}
+
+GURL GURLView::ToGURL() const {
+  if (!inner_parsed_)
+    return GURL(spec_, spec_len_, parsed_, is_valid_);
+
+  url_parse::Parsed parsed(parsed_);
+  parsed.set_inner_parsed(*inner_parsed_);
+  return GURL(spec_, spec_len_, parsed, is_valid_);
+}
+
+bool GURLView::GetOrigin(GURLView* origin) const {
+  if (!is_valid_ || !IsStandard()) {
+    *origin = GURLView();
+    return true;
+  }
+
+  GURLView inner;
+  if (GetInnerView(&inner))
+    return inner.GetOrigin(origin);
+  if (parsed_.username.is_valid() || parsed_.password.is_valid())
+    return false;
+
+  // The canonical origin is everything up to and including the slash that
+  // begins the path, which a canonical standard URL always has. Inner URLs
+  // start partway into their spec, so the origin is moved to the start.
+  DCHECK(parsed_.path.is_nonempty() && spec_[parsed_.path.begin] == '/');
+  int begin = parsed_.scheme.begin;
+  url_parse::Parsed parsed;
+  parsed.scheme = url_parse::Component(0, parsed_.scheme.len);
+  parsed.host = url_parse::Component(parsed_.host.begin - begin,
+                                     parsed_.host.len);
+  if (parsed_.port.is_valid()) {
+    parsed.port = url_parse::Component(parsed_.port.begin - begin,
+                                       parsed_.port.len);
+  }
+  parsed.path = url_parse::Component(parsed_.path.begin - begin, 1);
+  *origin = GURLView(spec_ + begin, parsed.path.end(), parsed, true);
+  return true;
+}
+
+bool GURLView::IsStandard() const {
+  return url_util::IsStandard(spec_, parsed_.scheme);
+}
+
+bool GURLView::SchemeIs(const char* lower_ascii_scheme) const {
+  if (parsed_.scheme.len <= 0)
+    return lower_ascii_scheme == NULL;
+  return url_util::LowerCaseEqualsASCII(spec_ + parsed_.scheme.begin,
+                                        spec_ + parsed_.scheme.end(),
+                                        lower_ascii_scheme);
+}
+
+bool GURLView::SchemeIsSecure() const {
+  if (SchemeIs("https") || SchemeIs("wss"))
+    return true;
+  GURLView inner;
+  return SchemeIsFileSystem() && GetInnerView(&inner) &&
+      inner.SchemeIsSecure();
+}
+
+bool GURLView::HostIsIPAddress() const {
+  if (!is_valid_ || spec_len_ == 0)
+     return false;
+
+  url_canon::CanonHostInfo host_info;
+  return url_canon::ClassifyHost(spec_, parsed_.host, &host_info) &&
+         host_info.IsIPAddress();
+}
+
+int GURLView::IntPort() const {
+  if (parsed_.port.is_nonempty())
+    return url_parse::ParsePort(spec_, parsed_.port);
+  return url_parse::PORT_UNSPECIFIED;
+}
+
+int GURLView::EffectiveIntPort() const {
+  int int_port = IntPort();
+  if (int_port == url_parse::PORT_UNSPECIFIED && IsStandard())
+    return url_canon::DefaultPortForScheme(spec_ + parsed_.scheme.begin,
+                                           parsed_.scheme.len);
+  return int_port;
+}
+
+url_parse::StringPiece GURLView::ExtractFileName() const {
+  url_parse::Component file_component;
+  url_parse::ExtractFileName(spec_, parsed_.path, &file_component);
+  return Piece(file_component);
+}
+
+url_parse::StringPiece GURLView::PathForRequest() const {
+  DCHECK(parsed_.path.len > 0)
+      << "Canonical path for requests should be non-empty";
+  if (parsed_.ref.len >= 0) {
+    return url_parse::StringPiece(
+        spec_ + parsed_.path.begin,
+        parsed_.ref.begin - parsed_.path.begin - 1);
+  }
+  // As in GURL, the spec of an inner URL continues into its outer URL's
+  // path, so the end has to be computed.
+  int path_len = parsed_.path.len;
+  if (parsed_.query.is_valid())
+    path_len = parsed_.query.end() - parsed_.path.begin;
+  return url_parse::StringPiece(spec_ + parsed_.path.begin, path_len);
+}
+
+void GURLView::PathForRequest(std::string* output) const {
+  url_parse::StringPiece path = PathForRequest();
+  output->assign(path.data(), path.length());
+}
+
+url_parse::StringPiece GURLView::HostNoBrackets() const {
+  url_parse::Component h(parsed_.host);
+  if (h.len >= 2 && spec_[h.begin] == '[' && spec_[h.end() - 1] == ']') {
+    h.begin++;
+    h.len -= 2;
+  }
+  return Piece(h);
+}
+
+bool GURLView::DomainIs(const char* lower_ascii_domain,
+                        int domain_len) const {
+  if (!is_valid_ || !domain_len)
+    return false;
+
+  // FileSystem URLs have an empty host; check their inner URL's.
+  GURLView inner;
+  if (SchemeIsFileSystem() && GetInnerView(&inner))
+    return inner.DomainIs(lower_ascii_domain, domain_len);
+
+  if (!parsed_.host.is_nonempty())
+    return false;
+
+  // A trailing dot on the host is ignored unless the domain has one too.
+  const char* last_pos = spec_ + parsed_.host.end() - 1;
+  int host_len = parsed_.host.len;
+  if ('.' == *last_pos && '.' != lower_ascii_domain[domain_len - 1]) {
+    last_pos--;
+    host_len--;
+  }
+
+  if (host_len < domain_len)
+    return false;
+
+  const char* start_pos = spec_ + parsed_.host.begin + host_len - domain_len;
+  if (!url_util::LowerCaseEqualsASCII(start_pos,
+                                      last_pos + 1,
+                                      lower_ascii_domain,
+                                      lower_ascii_domain + domain_len))
+    return false;
+
+  // The match has to start at a label boundary.
+  if ('.' != lower_ascii_domain[0] && host_len > domain_len &&
+      '.' != *(start_pos - 1))
+    return false;
+
+  return true;
+}
+
+bool GURLView::GetInnerView(GURLView* inner) const {
+  if (!is_valid_ || !inner_parsed_ || !SchemeIsFileSystem())
+    return false;
+  // Like GURL's inner URL, the inner view's spec starts with the outer
+  // spec and ends where the outer URL's components do.
+  *inner = GURLView(spec_, parsed_.Length(), *inner_parsed_, true);
+  return true;
+}
@@ -0,0 +1,165 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A read-only GURL that doesn't own its spec. Code that only looks at a URL,
+// asking for its scheme or host or whether it's in some domain, can take a
+// GURLView of a canonical spec that already sits in some buffer, like a
+// GURLTable, without copying it into a GURL. A GURL converts to a view of
+// itself implicitly. The accessors behave like GURL's, but return pieces of
+// the spec instead of new strings, so none of them allocate: for a GURL,
+// GURLView(url).host() is url.host() without the copy.
+
+#ifndef GOOGLEURL_SRC_GURL_VIEW_H__
+#define GOOGLEURL_SRC_GURL_VIEW_H__
+
+#include <string.h>
+
+#include <string>
+
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+#include "googleurl/src/url_string_piece.h"
+
+class GURL_API GURLView {
+ public:
+  // The empty, invalid URL.
+  GURLView();
+
+  // Views |url|, which must outlive the view.
+  GURLView(const GURL& url);
+
+  // Views the |spec_len| characters at |spec|, described by |parsed|, with
+  // the same meaning as GURL's constructor that takes them. The spec and
+  // the inner Parsed of filesystem: URLs are not copied, so they must
+  // outlive the view. |parsed|'s outer components are copied.
+  GURLView(const char* spec, int spec_len, const url_parse::Parsed& parsed,
+           bool is_valid);
+
+  GURLView(const GURLView& other);
+  GURLView& operator=(const GURLView& other);
+
+  bool is_valid() const { return is_valid_; }
+  bool is_empty() const { return spec_len_ == 0; }
+
+  // Like GURL's, the spec of an invalid URL is empty.
+  url_parse::StringPiece spec() const;
+  url_parse::StringPiece possibly_invalid_spec() const {
+    return url_parse::StringPiece(spec_, spec_len_);
+  }
+  const url_parse::Parsed& parsed_for_possibly_invalid_spec() const {
+    return parsed_;
+  }
+
+  // A GURL with a copy of the spec.
+  GURL ToGURL() const;
+
+  bool operator==(const GURLView& other) const {
+    return possibly_invalid_spec() == other.possibly_invalid_spec();
+  }
+  bool operator!=(const GURLView& other) const {
+    return !(*this == other);
+  }
+
+  // Sets |*origin| to a view of what GetOrigin() on the GURL would return,
+  // an empty view for invalid or non-standard URLs, and returns true. The
+  // origin is a prefix of the spec, or of the inner URL of a filesystem:
+  // URL, unless there's a username or password in the way. Then there's
+  // nothing to view; this returns false and |*origin| is left alone.
+  bool GetOrigin(GURLView* origin) const;
+
+  bool IsStandard() const;
+  bool SchemeIs(const char* lower_ascii_scheme) const;
+  bool SchemeIsFile() const {
+    return SchemeIs("file");
+  }
+  bool SchemeIsFileSystem() const {
+    return SchemeIs("filesystem");
+  }
+  bool SchemeIsSecure() const;
+  bool HostIsIPAddress() const;
+
+  url_parse::StringPiece scheme() const { return Piece(parsed_.scheme); }
+  url_parse::StringPiece username() const { return Piece(parsed_.username); }
+  url_parse::StringPiece password() const { return Piece(parsed_.password); }
+  url_parse::StringPiece host() const { return Piece(parsed_.host); }
+  url_parse::StringPiece port() const { return Piece(parsed_.port); }
+  url_parse::StringPiece path() const { return Piece(parsed_.path); }
+  url_parse::StringPiece query() const { return Piece(parsed_.query); }
+  url_parse::StringPiece ref() const { return Piece(parsed_.ref); }
+
+  bool has_scheme() const { return parsed_.scheme.len >= 0; }
+  bool has_username() const { return parsed_.username.len >= 0; }
+  bool has_password() const { return parsed_.password.len >= 0; }
+  bool has_host() const { return parsed_.host.len > 0; }
+  bool has_port() const { return parsed_.port.len >= 0; }
+  bool has_path() const { return parsed_.path.len >= 0; }
+  bool has_query() const { return parsed_.query.len >= 0; }
+  bool has_ref() const { return parsed_.ref.len >= 0; }
+
+  int IntPort() const;
+  int EffectiveIntPort() const;
+
+  url_parse::StringPiece ExtractFileName() const;
+  url_parse::StringPiece PathForRequest() const;
+  url_parse::StringPiece HostNoBrackets() const;
+
+  // Copies PathForRequest() into |*output|, replacing what was there. Code
+  // that needs its own copy of every request's path can keep reusing one
+  // string's buffer.
+  void PathForRequest(std::string* output) const;
+
+  bool DomainIs(const char* lower_ascii_domain, int domain_len) const;
+  bool DomainIs(const char* lower_ascii_domain) const {
+    return DomainIs(lower_ascii_domain,
+                    static_cast<int>(strlen(lower_ascii_domain)));
+  }
+
+  // The view of a valid filesystem: URL's inner URL, like GURL's inner_url().
+  // Returns false for other URLs.
+  bool GetInnerView(GURLView* inner) const;
+
+ private:
+  url_parse::StringPiece Piece(const url_parse::Component& comp) const {
+    return url_parse::StringPiece(spec_, comp);
+  }
+
+  // Copies the outer components of |parsed|; the inner one is pointed to.
+  void SetParsed(const url_parse::Parsed& parsed);
+
+  const char* spec_;
+  int spec_len_;
+  bool is_valid_;
+
+  // Never has an inner Parsed of its own, so views copy without allocating.
+  url_parse::Parsed parsed_;
+  const url_parse::Parsed* inner_parsed_;
+};
+
+#endif  // GOOGLEURL_SRC_GURL_VIEW_H__
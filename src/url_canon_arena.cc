@@ -0,0 +1,189 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_canon_arena.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+
+namespace url_canon {
+
+namespace {
+
+// Big enough for the links of a typical page in one block.
+const int kDefaultBlockSize = 16384;
+
+// Allocations are rounded up to this so that the arena can hold objects as
+// well as characters.
+const int kAlignment = 8;
+
+inline int AlignedLength(int len) {
+  return (len + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+}  // namespace
+
+struct URLArena::Block {
+  Block* next;
+  int size;
+
+  char* data() {
+    return reinterpret_cast<char*>(this) + AlignedLength(sizeof(Block));
+  }
+};
+
+URLArena::URLArena()
+    : block_size_(kDefaultBlockSize),
+      first_block_(NULL),
+      current_block_(NULL),
+      next_(NULL),
+      end_(NULL),
+      last_allocation_(NULL),
+      bytes_allocated_(0) {
+}
+
+URLArena::URLArena(int block_size)
+    : block_size_(block_size),
+      first_block_(NULL),
+      current_block_(NULL),
+      next_(NULL),
+      end_(NULL),
+      last_allocation_(NULL),
+      bytes_allocated_(0) {
+  DCHECK(block_size > 0);
+}
+
+URLArena::~URLArena() {
+  Block* block = first_block_;
+  while (block) {
+    Block* next = block->next;
+    delete[] reinterpret_cast<char*>(block);
+    block = next;
+  }
+}
+
+void URLArena::AddBlock(int len) {
+  int size = len > block_size_ ? len : block_size_;
+  Block* block = reinterpret_cast<Block*>(
+      new char[AlignedLength(sizeof(Block)) + size]);
+  block->next = NULL;
+  block->size = size;
+  if (current_block_)
+    current_block_->next = block;
+  else
+    first_block_ = block;
+
+  current_block_ = block;
+  next_ = block->data();
+  end_ = next_ + block->size;
+}
+
+void* URLArena::Allocate(int len) {
+  DCHECK(len >= 0);
+  int aligned_len = AlignedLength(len);
+  if (end_ - next_ < aligned_len)
+    AddBlock(aligned_len);
+  last_allocation_ = next_;
+  next_ += aligned_len;
+  bytes_allocated_ += aligned_len;
+  return last_allocation_;
+}
+
+void* URLArena::Reallocate(void* ptr, int old_len, int new_len) {
+  char* chars = static_cast<char*>(ptr);
+  if (chars && chars == last_allocation_ &&
+      end_ - last_allocation_ >= AlignedLength(new_len)) {
+    char* new_next = last_allocation_ + AlignedLength(new_len);
+    bytes_allocated_ += new_next - next_;
+    next_ = new_next;
+    return ptr;
+  }
+  if (new_len <= old_len)
+    return ptr;  // Shrinking never has to move anything.
+
+  void* new_ptr = Allocate(new_len);
+  if (old_len > 0)
+    memcpy(new_ptr, ptr, old_len);
+  return new_ptr;
+}
+
+void URLArena::Reset() {
+  // Only the first block is kept. Any others came from a batch that needed
+  // more than usual, and a reused arena shouldn't hold on to them forever.
+  if (first_block_) {
+    Block* block = first_block_->next;
+    while (block) {
+      Block* next = block->next;
+      delete[] reinterpret_cast<char*>(block);
+      block = next;
+    }
+    first_block_->next = NULL;
+    current_block_ = first_block_;
+    next_ = first_block_->data();
+    end_ = next_ + first_block_->size;
+  }
+  last_allocation_ = NULL;
+  bytes_allocated_ = 0;
+}
+
+ArenaCanonOutput::ArenaCanonOutput(URLArena* arena)
+    : CanonOutput(),
+      arena_(arena) {
+}
+
+ArenaCanonOutput::~ArenaCanonOutput() {
+}
+
+void ArenaCanonOutput::Resize(int sz) {
+  buffer_ = static_cast<char*>(
+      arena_->Reallocate(buffer_, cur_len_ < sz ? cur_len_ : sz, sz));
+  buffer_len_ = sz;
+}
+
+const char* ArenaCanonOutput::Finish() {
+  if (!buffer_)
+    return NULL;
+  if (cur_len_ == 0) {
+    // Nothing was written, so the whole buffer goes back.
+    arena_->Reallocate(buffer_, 0, 0);
+    buffer_ = NULL;
+    buffer_len_ = 0;
+    return NULL;
+  }
+  const char* result =
+      static_cast<const char*>(arena_->Reallocate(buffer_, cur_len_,
+                                                  cur_len_));
+  buffer_ = NULL;
+  buffer_len_ = 0;
+  cur_len_ = 0;
+  return result;
+}
+
+}  // namespace url_canon
@@ -0,0 +1,121 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Bump allocation for canonicalizer output. RawCanonOutputT falls back to the
+// heap once its stack buffer is full, StdStringCanonOutput grows a
+// std::string, and every GURL owns a heap-allocated spec. A URLArena hands out
+// memory from large blocks instead, and an ArenaCanonOutput writes into it,
+// so a whole batch of URLs costs a few block allocations and is freed with
+// one Reset().
+
+#ifndef GOOGLEURL_SRC_URL_CANON_ARENA_H__
+#define GOOGLEURL_SRC_URL_CANON_ARENA_H__
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_canon {
+
+// Not thread safe. Memory from the arena is never freed individually.
+class GURL_API URLArena {
+ public:
+  // Uses blocks of |block_size| bytes. Allocations larger than that get a
+  // block of their own.
+  URLArena();
+  explicit URLArena(int block_size);
+  ~URLArena();
+
+  // Returns |len| bytes, aligned for any of the types the library stores in
+  // the arena.
+  void* Allocate(int len);
+
+  // Resizes the allocation at |ptr| from |old_len| to |new_len| bytes and
+  // returns where it is now. The most recent allocation grows and shrinks in
+  // place when its block has room; anything else is copied to a new
+  // allocation. |ptr| may be NULL when |old_len| is 0.
+  void* Reallocate(void* ptr, int old_len, int new_len);
+
+  // Frees everything allocated from the arena. The first block is kept for
+  // reuse, so an arena that is reset between batches of similar size stops
+  // touching the heap.
+  void Reset();
+
+  // The number of bytes handed out since construction or the last Reset().
+  int64 bytes_allocated() const { return bytes_allocated_; }
+
+ private:
+  struct Block;
+
+  // Makes a block with room for at least |len| bytes the current one.
+  void AddBlock(int len);
+
+  int block_size_;
+  Block* first_block_;
+  Block* current_block_;
+
+  // The free part of |current_block_|.
+  char* next_;
+  char* end_;
+
+  // The start of the most recent allocation, the only one that may be
+  // resized in place.
+  char* last_allocation_;
+
+  int64 bytes_allocated_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLArena);
+};
+
+// A CanonOutput whose buffer is in an arena. Canonicalize into it, then call
+// Finish() to keep the result: it stays in the arena until the arena is
+// reset, and the output is empty again for the next URL.
+class GURL_API ArenaCanonOutput : public CanonOutput {
+ public:
+  explicit ArenaCanonOutput(URLArena* arena);
+  virtual ~ArenaCanonOutput();
+
+  virtual void Resize(int sz);
+
+  // Gives the unused end of the buffer back to the arena and returns the
+  // output written so far, which the output then forgets about. Returns
+  // NULL when nothing was written.
+  const char* Finish();
+
+  URLArena* arena() const { return arena_; }
+
+ private:
+  URLArena* arena_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArenaCanonOutput);
+};
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_ARENA_H__
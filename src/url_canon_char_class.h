@@ -0,0 +1,121 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// One table that classifies every byte for all of canonicalization and
+// parsing. Each entry holds the character's canonical (lower-cased) form in
+// its low byte and a bit for every class it's in, so asking whether a
+// character is, say, either valid in a host or needs escaping there is one
+// load and one test. The table is generated by
+// gen_url_canon_char_class_tables.py.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_H__
+#define GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_H__
+
+#include "base/basictypes.h"
+#include "base/string16.h"
+
+namespace url_canon {
+
+enum CharClass {
+  // The SharedCharTypes of url_canon_internal.h, in the same order.
+  CHAR_CLASS_QUERY = 1 << 8,
+  CHAR_CLASS_USERINFO = 1 << 9,
+  CHAR_CLASS_IPV4 = 1 << 10,
+  CHAR_CLASS_HEX = 1 << 11,
+  CHAR_CLASS_DEC = 1 << 12,
+  CHAR_CLASS_OCT = 1 << 13,
+  CHAR_CLASS_COMPONENT = 1 << 14,
+
+  // Valid in a host name, either as it is (lower-cased) or escaped.
+  // Characters in neither class make the host invalid.
+  CHAR_CLASS_HOST = 1 << 15,
+  CHAR_CLASS_HOST_ESCAPE = 1 << 16,
+
+  // Valid in a scheme, and valid as its first character.
+  CHAR_CLASS_SCHEME = 1 << 17,
+  CHAR_CLASS_SCHEME_FIRST = 1 << 18,
+
+  // Tabs and newlines, which are removed from anywhere in a URL.
+  CHAR_CLASS_WHITESPACE = 1 << 19,
+
+  // Characters that end the authority: slashes of both kinds, '?' and '#'.
+  CHAR_CLASS_AUTHORITY_TERMINATOR = 1 << 20,
+
+  // Bytes 0x80 and up, and every UTF-16 code unit past ASCII.
+  CHAR_CLASS_NON_ASCII = 1 << 21,
+};
+
+// The bits of an entry holding the canonical character. That's the ASCII
+// lower-case form for 7-bit characters and the byte itself otherwise.
+const uint32 kCharCanonicalMask = 0xff;
+
+extern const uint32 kCharClassTable[0x100];
+
+// Returns the table entry for |ch|. All UTF-16 code units past ASCII share
+// the entry for 0x80, which only has CHAR_CLASS_NON_ASCII.
+inline uint32 LookupCharClass(char ch) {
+  return kCharClassTable[static_cast<unsigned char>(ch)];
+}
+inline uint32 LookupCharClass(unsigned char ch) {
+  return kCharClassTable[ch];
+}
+inline uint32 LookupCharClass(char16 ch) {
+  return kCharClassTable[ch < 0x80 ? ch : 0x80];
+}
+inline uint32 LookupCharClass(unsigned ch) {
+  return kCharClassTable[ch < 0x80 ? ch : 0x80];
+}
+
+// Returns true if |ch| is in any of |kClasses|, which is a compile-time
+// constant so that the test is a single AND with an immediate.
+template<uint32 kClasses, typename CHAR>
+inline bool IsCharOfClass(CHAR ch) {
+  return (LookupCharClass(ch) & kClasses) != 0;
+}
+
+// Returns the canonical character from a table entry. This is only
+// meaningful for characters that are valid in the component at hand.
+inline char CanonicalCharOfClass(uint32 char_class) {
+  return static_cast<char>(char_class & kCharCanonicalMask);
+}
+
+// Returns the first position in [begin, end) of a character in any of
+// |kClasses|, or |end| if there is none.
+template<uint32 kClasses, typename CHAR>
+inline int FindCharOfClass(const CHAR* spec, int begin, int end) {
+  for (int i = begin; i < end; i++) {
+    if (IsCharOfClass<kClasses>(spec[i]))
+      return i;
+  }
+  return end;
+}
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_H__
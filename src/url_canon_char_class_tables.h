@@ -0,0 +1,269 @@
+// Generated by gen_url_canon_char_class_tables.py. Do not edit.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__
+#define GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__
+
+namespace url_canon {
+
+const uint32 kCharClassTable[0x100] = {
+  0x00000000,  // 0x00
+  0x00000001,  // 0x01
+  0x00000002,  // 0x02
+  0x00000003,  // 0x03
+  0x00000004,  // 0x04
+  0x00000005,  // 0x05
+  0x00000006,  // 0x06
+  0x00000007,  // 0x07
+  0x00000008,  // 0x08
+  0x00080009,  // 0x09
+  0x0008000A,  // 0x0a
+  0x0000000B,  // 0x0b
+  0x0000000C,  // 0x0c
+  0x0008000D,  // 0x0d
+  0x0000000E,  // 0x0e
+  0x0000000F,  // 0x0f
+  0x00000010,  // 0x10
+  0x00000011,  // 0x11
+  0x00000012,  // 0x12
+  0x00000013,  // 0x13
+  0x00000014,  // 0x14
+  0x00000015,  // 0x15
+  0x00000016,  // 0x16
+  0x00000017,  // 0x17
+  0x00000018,  // 0x18
+  0x00000019,  // 0x19
+  0x0000001A,  // 0x1a
+  0x0000001B,  // 0x1b
+  0x0000001C,  // 0x1c
+  0x0000001D,  // 0x1d
+  0x0000001E,  // 0x1e
+  0x0000001F,  // 0x1f
+  0x00010020,  // 0x20
+  0x00014321,  // 0x21 '!'
+  0x00010022,  // 0x22 '"'
+  0x00110023,  // 0x23 '#'
+  0x00010324,  // 0x24 '$'
+  0x00000325,  // 0x25 '%'
+  0x00010326,  // 0x26 '&'
+  0x00014327,  // 0x27 '''
+  0x00014328,  // 0x28 '('
+  0x00014329,  // 0x29 ')'
+  0x0001432A,  // 0x2a '*'
+  0x0002832B,  // 0x2b '+'
+  0x0001032C,  // 0x2c ','
+  0x0002C32D,  // 0x2d '-'
+  0x0002C72E,  // 0x2e '.'
+  0x0010012F,  // 0x2f '/'
+  0x0002FF30,  // 0x30 '0'
+  0x0002FF31,  // 0x31 '1'
+  0x0002FF32,  // 0x32 '2'
+  0x0002FF33,  // 0x33 '3'
+  0x0002FF34,  // 0x34 '4'
+  0x0002FF35,  // 0x35 '5'
+  0x0002FF36,  // 0x36 '6'
+  0x0002FF37,  // 0x37 '7'
+  0x0002DF38,  // 0x38 '8'
+  0x0002DF39,  // 0x39 '9'
+  0x0000813A,  // 0x3a ':'
+  0x0000013B,  // 0x3b ';'
+  0x0001003C,  // 0x3c '<'
+  0x0001013D,  // 0x3d '='
+  0x0001003E,  // 0x3e '>'
+  0x0010013F,  // 0x3f '?'
+  0x00010140,  // 0x40 '@'
+  0x0006CF61,  // 0x41 'A'
+  0x0006CF62,  // 0x42 'B'
+  0x0006CF63,  // 0x43 'C'
+  0x0006CF64,  // 0x44 'D'
+  0x0006CF65,  // 0x45 'E'
+  0x0006CF66,  // 0x46 'F'
+  0x0006C367,  // 0x47 'G'
+  0x0006C368,  // 0x48 'H'
+  0x0006C369,  // 0x49 'I'
+  0x0006C36A,  // 0x4a 'J'
+  0x0006C36B,  // 0x4b 'K'
+  0x0006C36C,  // 0x4c 'L'
+  0x0006C36D,  // 0x4d 'M'
+  0x0006C36E,  // 0x4e 'N'
+  0x0006C36F,  // 0x4f 'O'
+  0x0006C370,  // 0x50 'P'
+  0x0006C371,  // 0x51 'Q'
+  0x0006C372,  // 0x52 'R'
+  0x0006C373,  // 0x53 'S'
+  0x0006C374,  // 0x54 'T'
+  0x0006C375,  // 0x55 'U'
+  0x0006C376,  // 0x56 'V'
+  0x0006C377,  // 0x57 'W'
+  0x0006C778,  // 0x58 'X'
+  0x0006C379,  // 0x59 'Y'
+  0x0006C37A,  // 0x5a 'Z'
+  0x0000815B,  // 0x5b '['
+  0x0010015C,  // 0x5c '\'
+  0x0000815D,  // 0x5d ']'
+  0x0000015E,  // 0x5e '^'
+  0x0000C35F,  // 0x5f '_'
+  0x00010160,  // 0x60 '`'
+  0x0006CF61,  // 0x61 'a'
+  0x0006CF62,  // 0x62 'b'
+  0x0006CF63,  // 0x63 'c'
+  0x0006CF64,  // 0x64 'd'
+  0x0006CF65,  // 0x65 'e'
+  0x0006CF66,  // 0x66 'f'
+  0x0006C367,  // 0x67 'g'
+  0x0006C368,  // 0x68 'h'
+  0x0006C369,  // 0x69 'i'
+  0x0006C36A,  // 0x6a 'j'
+  0x0006C36B,  // 0x6b 'k'
+  0x0006C36C,  // 0x6c 'l'
+  0x0006C36D,  // 0x6d 'm'
+  0x0006C36E,  // 0x6e 'n'
+  0x0006C36F,  // 0x6f 'o'
+  0x0006C370,  // 0x70 'p'
+  0x0006C371,  // 0x71 'q'
+  0x0006C372,  // 0x72 'r'
+  0x0006C373,  // 0x73 's'
+  0x0006C374,  // 0x74 't'
+  0x0006C375,  // 0x75 'u'
+  0x0006C376,  // 0x76 'v'
+  0x0006C377,  // 0x77 'w'
+  0x0006C778,  // 0x78 'x'
+  0x0006C379,  // 0x79 'y'
+  0x0006C37A,  // 0x7a 'z'
+  0x0001017B,  // 0x7b '{'
+  0x0001017C,  // 0x7c '|'
+  0x0001017D,  // 0x7d '}'
+  0x0000437E,  // 0x7e '~'
+  0x0000007F,  // 0x7f
+  0x00200080,  // 0x80
+  0x00200081,  // 0x81
+  0x00200082,  // 0x82
+  0x00200083,  // 0x83
+  0x00200084,  // 0x84
+  0x00200085,  // 0x85
+  0x00200086,  // 0x86
+  0x00200087,  // 0x87
+  0x00200088,  // 0x88
+  0x00200089,  // 0x89
+  0x0020008A,  // 0x8a
+  0x0020008B,  // 0x8b
+  0x0020008C,  // 0x8c
+  0x0020008D,  // 0x8d
+  0x0020008E,  // 0x8e
+  0x0020008F,  // 0x8f
+  0x00200090,  // 0x90
+  0x00200091,  // 0x91
+  0x00200092,  // 0x92
+  0x00200093,  // 0x93
+  0x00200094,  // 0x94
+  0x00200095,  // 0x95
+  0x00200096,  // 0x96
+  0x00200097,  // 0x97
+  0x00200098,  // 0x98
+  0x00200099,  // 0x99
+  0x0020009A,  // 0x9a
+  0x0020009B,  // 0x9b
+  0x0020009C,  // 0x9c
+  0x0020009D,  // 0x9d
+  0x0020009E,  // 0x9e
+  0x0020009F,  // 0x9f
+  0x002000A0,  // 0xa0
+  0x002000A1,  // 0xa1
+  0x002000A2,  // 0xa2
+  0x002000A3,  // 0xa3
+  0x002000A4,  // 0xa4
+  0x002000A5,  // 0xa5
+  0x002000A6,  // 0xa6
+  0x002000A7,  // 0xa7
+  0x002000A8,  // 0xa8
+  0x002000A9,  // 0xa9
+  0x002000AA,  // 0xaa
+  0x002000AB,  // 0xab
+  0x002000AC,  // 0xac
+  0x002000AD,  // 0xad
+  0x002000AE,  // 0xae
+  0x002000AF,  // 0xaf
+  0x002000B0,  // 0xb0
+  0x002000B1,  // 0xb1
+  0x002000B2,  // 0xb2
+  0x002000B3,  // 0xb3
+  0x002000B4,  // 0xb4
+  0x002000B5,  // 0xb5
+  0x002000B6,  // 0xb6
+  0x002000B7,  // 0xb7
+  0x002000B8,  // 0xb8
+  0x002000B9,  // 0xb9
+  0x002000BA,  // 0xba
+  0x002000BB,  // 0xbb
+  0x002000BC,  // 0xbc
+  0x002000BD,  // 0xbd
+  0x002000BE,  // 0xbe
+  0x002000BF,  // 0xbf
+  0x002000C0,  // 0xc0
+  0x002000C1,  // 0xc1
+  0x002000C2,  // 0xc2
+  0x002000C3,  // 0xc3
+  0x002000C4,  // 0xc4
+  0x002000C5,  // 0xc5
+  0x002000C6,  // 0xc6
+  0x002000C7,  // 0xc7
+  0x002000C8,  // 0xc8
+  0x002000C9,  // 0xc9
+  0x002000CA,  // 0xca
+  0x002000CB,  // 0xcb
+  0x002000CC,  // 0xcc
+  0x002000CD,  // 0xcd
+  0x002000CE,  // 0xce
+  0x002000CF,  // 0xcf
+  0x002000D0,  // 0xd0
+  0x002000D1,  // 0xd1
+  0x002000D2,  // 0xd2
+  0x002000D3,  // 0xd3
+  0x002000D4,  // 0xd4
+  0x002000D5,  // 0xd5
+  0x002000D6,  // 0xd6
+  0x002000D7,  // 0xd7
+  0x002000D8,  // 0xd8
+  0x002000D9,  // 0xd9
+  0x002000DA,  // 0xda
+  0x002000DB,  // 0xdb
+  0x002000DC,  // 0xdc
+  0x002000DD,  // 0xdd
+  0x002000DE,  // 0xde
+  0x002000DF,  // 0xdf
+  0x002000E0,  // 0xe0
+  0x002000E1,  // 0xe1
+  0x002000E2,  // 0xe2
+  0x002000E3,  // 0xe3
+  0x002000E4,  // 0xe4
+  0x002000E5,  // 0xe5
+  0x002000E6,  // 0xe6
+  0x002000E7,  // 0xe7
+  0x002000E8,  // 0xe8
+  0x002000E9,  // 0xe9
+  0x002000EA,  // 0xea
+  0x002000EB,  // 0xeb
+  0x002000EC,  // 0xec
+  0x002000ED,  // 0xed
+  0x002000EE,  // 0xee
+  0x002000EF,  // 0xef
+  0x002000F0,  // 0xf0
+  0x002000F1,  // 0xf1
+  0x002000F2,  // 0xf2
+  0x002000F3,  // 0xf3
+  0x002000F4,  // 0xf4
+  0x002000F5,  // 0xf5
+  0x002000F6,  // 0xf6
+  0x002000F7,  // 0xf7
+  0x002000F8,  // 0xf8
+  0x002000F9,  // 0xf9
+  0x002000FA,  // 0xfa
+  0x002000FB,  // 0xfb
+  0x002000FC,  // 0xfc
+  0x002000FD,  // 0xfd
+  0x002000FE,  // 0xfe
+  0x002000FF,  // 0xff
+};
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_CHAR_CLASS_TABLES_H__
@@ -32,18 +32,15 @@
 #include <string.h>
 
 #include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_canon_char_class.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 
 namespace url_canon {
 
 namespace {
 
-// Returns true if the given character should be removed from the middle of a
-// URL.
-inline bool IsRemovableURLWhitespace(int ch) {
-  return ch == '\r' || ch == '\n' || ch == '\t';
-}
-
 // Backend for RemoveURLWhitespace (see declaration in url_canon.h).
 // It sucks that we have to do this, since this takes about 13% of the total URL
 // canonicalization time.
@@ -53,58 +50,31 @@ const CHAR* DoRemoveURLWhitespace(const CHAR* input, int input_len,
                                   int* output_len) {
   // Fast verification that there's nothing that needs removal. This is the 99%
   // case, so we want it to be fast and don't care about impacting the speed
-  // when we do find whitespace.
-  int found_whitespace = false;
-  for (int i = 0; i < input_len; i++) {
-    if (!IsRemovableURLWhitespace(input[i]))
-      continue;
-    found_whitespace = true;
-    break;
-  }
-
-  if (!found_whitespace) {
+  // when we do find whitespace. The scan is vectorized where possible.
+  int next = FindRemovableURLWhitespace(input, input_len);
+  if (next == input_len) {
     // Didn't find any whitespace, we don't need to do anything. We can just
     // return the input as the output.
     *output_len = input_len;
     return input;
   }
-
-  // Remove the whitespace into the new buffer and return it.
-  for (int i = 0; i < input_len; i++) {
-    if (!IsRemovableURLWhitespace(input[i]))
-      buffer->push_back(input[i]);
+  GURL_CANON_STAT(CANON_STAT_WHITESPACE_REMOVED);
+
+  // Remove the whitespace into the new buffer and return it. Everything
+  // between two whitespace characters is copied as one run.
+  int begin = 0;
+  while (begin < input_len) {
+    buffer->Append(&input[begin], next - begin);
+    begin = next + 1;
+    if (begin < input_len) {
+      next = begin + FindRemovableURLWhitespace(&input[begin],
+                                                input_len - begin);
+    }
   }
   *output_len = buffer->length();
   return buffer->data();
 }
 
-// Contains the canonical version of each possible input letter in the scheme
-// (basically, lower-cased). The corresponding entry will be 0 if the letter
-// is not allowed in a scheme.
-const char kSchemeCanonical[0x80] = {
-// 00-1f: all are invalid
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-//  ' '   !    "    #    $    %    &    '    (    )    *    +    ,    -    .    /
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  '+',  0,  '-', '.',  0,
-//   0    1    2    3    4    5    6    7    8    9    :    ;    <    =    >    ?
-    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',  0 ,  0 ,  0 ,  0 ,  0 ,  0 ,
-//   @    A    B    C    D    E    F    G    H    I    J    K    L    M    N    O
-     0 , 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
-//   P    Q    R    S    T    U    V    W    X    Y    Z    [    \    ]    ^    _
-    'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',  0,   0 ,  0,   0 ,  0,
-//   `    a    b    c    d    e    f    g    h    i    j    k    l    m    n    o
-     0 , 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
-//   p    q    r    s    t    u    v    w    x    y    z    {    |    }    ~
-    'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',  0 ,  0 ,  0 ,  0 ,  0 };
-
-// This could be a table lookup as well by setting the high bit for each
-// valid character, but it's only called once per URL, and it makes the lookup
-// table easier to read not having extra stuff in it.
-inline bool IsSchemeFirstChar(unsigned char c) {
-  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
-}
-
 template<typename CHAR, typename UCHAR>
 bool DoScheme(const CHAR* spec,
               const url_parse::Component& scheme,
@@ -130,15 +100,11 @@ bool DoScheme(const CHAR* spec,
   for (int i = scheme.begin; i < end; i++) {
     UCHAR ch = static_cast<UCHAR>(spec[i]);
     char replacement = 0;
-    if (ch < 0x80) {
-      if (i == scheme.begin) {
-        // Need to do a special check for the first letter of the scheme.
-        if (IsSchemeFirstChar(static_cast<unsigned char>(ch)))
-          replacement = kSchemeCanonical[ch];
-      } else {
-        replacement = kSchemeCanonical[ch];
-      }
-    }
+    // Need to do a special check for the first letter of the scheme.
+    uint32 char_class = LookupCharClass(ch);
+    if (char_class & (i == scheme.begin ? CHAR_CLASS_SCHEME_FIRST
+                                        : CHAR_CLASS_SCHEME))
+      replacement = CanonicalCharOfClass(char_class);
 
     if (replacement) {
       output->push_back(replacement);
@@ -154,6 +120,7 @@ bool DoScheme(const CHAR* spec,
 
       // This will escape the output and also handle encoding issues.
       // Ignore the return value since we already failed.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendUTF8EscapedChar(spec, &i, end, output);
     }
   }
@@ -254,6 +221,10 @@ bool DoPort(const CHAR* spec,
   return true;
 }
 
+// The ref characters that DoCanonicalizeRef appends unchanged: everything
+// 7-bit except NULL and the control characters.
+const CopyableCharSet kRefCopyableChars = { 0x20, 0x7f, "" };
+
 template<typename CHAR, typename UCHAR>
 void DoCanonicalizeRef(const CHAR* spec,
                        const url_parse::Component& ref,
@@ -273,6 +244,13 @@ void DoCanonicalizeRef(const CHAR* spec,
   // Now iterate through all the characters, converting to UTF-8 and validating.
   int end = ref.end();
   for (int i = ref.begin; i < end; i++) {
+    // Most refs are plain ASCII that gets copied unchanged; do that in bulk.
+    int run = CountCopyableChars(&spec[i], end - i, kRefCopyableChars);
+    AppendCopyableRun(&spec[i], run, output);
+    i += run;
+    if (i == end)
+      break;
+
     if (spec[i] == 0) {
       // IE just strips NULLs, so we do too.
       continue;
@@ -280,6 +258,7 @@ void DoCanonicalizeRef(const CHAR* spec,
       // Unline IE seems to, we escape control characters. This will probably
       // make the reference fragment unusable on a web page, but people
       // shouldn't be using control characters in their anchor names.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendEscapedChar(static_cast<unsigned char>(spec[i]), output);
     } else if (static_cast<UCHAR>(spec[i]) < 0x80) {
       // Normal ASCII characters are just appended.
@@ -313,9 +292,11 @@ const char16* RemoveURLWhitespace(const char16* input, int input_len,
 }
 
 char CanonicalSchemeChar(char16 ch) {
-  if (ch >= 0x80)
-    return 0;  // Non-ASCII is not supported by schemes.
-  return kSchemeCanonical[ch];
+  // Non-ASCII is not supported by schemes.
+  uint32 char_class = LookupCharClass(ch);
+  if (!(char_class & CHAR_CLASS_SCHEME))
+    return 0;
+  return CanonicalCharOfClass(char_class);
 }
 
 bool CanonicalizeScheme(const char* spec,
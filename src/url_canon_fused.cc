@@ -0,0 +1,392 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Fused parsing and canonicalization of standard URLs, see url_canon_fused.h.
+//
+// Each step below writes what the component canonicalizer would write for
+// the component, and bails out on anything where the two-phase path would do
+// something other than copy, lower-case or escape. Bailing out is always
+// safe, so the cases here only need to be the common ones.
+
+#include "googleurl/src/url_canon_fused.h"
+
+#include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
+#include "googleurl/src/url_scheme_registry.h"
+
+namespace url_canon {
+
+namespace {
+
+// The path characters that DoPartialPath copies unchanged.
+const CopyableCharSet kFusedPathCopyableChars =
+    { 0x21, 0x7e, "\"#%.<>?\\^`{|}" };
+
+// Characters that the path canonicalizer unescapes (or, for '.', treats as a
+// possible directory), so an escaped one can't be copied as it is.
+inline bool IsUnescapedInPath(unsigned char ch) {
+  return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+         (ch >= '0' && ch <= '9') ||
+         ch == '-' || ch == '.' || ch == '_' || ch == '~';
+}
+
+// Returns true if |ch| ends the authority or path. Backslashes end them too,
+// but those always go to the full parser.
+template<typename CHAR>
+inline bool IsPathTerminator(CHAR ch) {
+  return ch == '/' || ch == '?' || ch == '#';
+}
+
+// Writes the path, query and ref starting at |i|, which is the end of the
+// authority, like the component canonicalizers would, and returns true.
+// Returns false when they would do more than copy or escape something.
+// Escapes are only counted once the URL is known to be done here, since the
+// full canonicalizer would count them again otherwise.
+template<typename CHAR, typename UCHAR>
+bool DoFusedPathQueryAndRef(const CHAR* spec,
+                            int i,
+                            int spec_len,
+                            CanonOutput* output,
+                            url_parse::Parsed* new_parsed) {
+  // Path. An empty one is written as a slash.
+  int escaped_chars = 0;
+  new_parsed->path.begin = output->length();
+  if (i == spec_len || spec[i] != '/')
+    output->push_back('/');
+  while (i < spec_len) {
+    int run = CountCopyableChars(&spec[i], spec_len - i,
+                                 kFusedPathCopyableChars);
+    AppendCopyableRun(&spec[i], run, output);
+    i += run;
+    if (i == spec_len)
+      break;
+
+    UCHAR ch = static_cast<UCHAR>(spec[i]);
+    if (ch == '?' || ch == '#')
+      break;
+    if (ch == '.') {
+      // "." and ".." segments have to be resolved.
+      if (output->at(output->length() - 1) == '/') {
+        int after = i + 1;
+        if (after < spec_len && spec[after] == '.')
+          after++;
+        if (after == spec_len || IsPathTerminator(spec[after]) ||
+            spec[after] == '%')
+          return false;
+      }
+      output->push_back('.');
+      i++;
+    } else if (ch == '%') {
+      unsigned char value;
+      int last = i;
+      if (DecodeEscaped(spec, &last, spec_len, &value)) {
+        if (value == 0 || IsUnescapedInPath(value))
+          return false;
+        // Kept escaped, without changing the case of the hex digits.
+        output->push_back('%');
+        output->push_back(static_cast<char>(spec[i + 1]));
+        output->push_back(static_cast<char>(spec[i + 2]));
+        i += 3;
+      } else {
+        // Not an escape sequence, the percent is kept as it is.
+        output->push_back('%');
+        i++;
+      }
+    } else if (ch < 0x20 || ch == '\\' ||
+               (sizeof(CHAR) > sizeof(char) && ch >= 0x80)) {
+      // Whitespace to remove, invalid characters, backslashes and UTF-16.
+      return false;
+    } else {
+      AppendEscapedChar(static_cast<unsigned char>(ch), output);
+      escaped_chars++;
+      i++;
+    }
+  }
+  new_parsed->path.len = output->length() - new_parsed->path.begin;
+
+  // Query, when it's all ASCII and so needs no character set conversion.
+  new_parsed->query = url_parse::Component();
+  if (i < spec_len && spec[i] == '?') {
+    i++;
+    output->push_back('?');
+    new_parsed->query.begin = output->length();
+    while (i < spec_len) {
+      int run = CountCopyableChars(&spec[i], spec_len - i,
+                                   kQueryCopyableChars);
+      AppendCopyableRun(&spec[i], run, output);
+      i += run;
+      if (i == spec_len)
+        break;
+
+      UCHAR ch = static_cast<UCHAR>(spec[i]);
+      if (ch == '#')
+        break;
+      if (ch >= 0x80 || ch == '\t' || ch == '\n' || ch == '\r')
+        return false;
+      if (IsQueryChar(static_cast<unsigned char>(ch))) {
+        output->push_back(static_cast<char>(ch));
+      } else {
+        AppendEscapedChar(static_cast<unsigned char>(ch), output);
+        escaped_chars++;
+      }
+      i++;
+    }
+    new_parsed->query.len = output->length() - new_parsed->query.begin;
+  }
+
+  // Ref: the rest of the input, which CanonicalizeRef can take as it is
+  // unless it has whitespace to remove.
+  new_parsed->ref = url_parse::Component();
+  if (i < spec_len) {
+    DCHECK(spec[i] == '#');
+    i++;
+    if (FindRemovableURLWhitespace(&spec[i], spec_len - i) != spec_len - i)
+      return false;
+    CanonicalizeRef(spec, url_parse::MakeRange(i, spec_len), output,
+                    &new_parsed->ref);
+  }
+
+  GURL_CANON_STAT_ADD(CANON_STAT_ESCAPED_CHARS, escaped_chars);
+  return true;
+}
+
+template<typename CHAR, typename UCHAR>
+bool DoFusedCanonicalize(const CHAR* spec,
+                         int spec_len,
+                         CanonOutput* output,
+                         url_parse::Parsed* new_parsed) {
+  // The parser trims leading and trailing spaces and control characters.
+  if (spec_len == 0 || static_cast<UCHAR>(spec[0]) <= ' ' ||
+      static_cast<UCHAR>(spec[spec_len - 1]) <= ' ')
+    return false;
+
+  // Scheme, lower-cased. A one letter scheme could be a Windows drive letter.
+  int i = 0;
+  new_parsed->scheme.begin = output->length();
+  for (; i < spec_len; i++) {
+    UCHAR ch = static_cast<UCHAR>(spec[i]);
+    if (ch >= 'A' && ch <= 'Z') {
+      output->push_back(static_cast<char>(ch + ('a' - 'A')));
+    } else if ((ch >= 'a' && ch <= 'z') ||
+               (i > 0 && ((ch >= '0' && ch <= '9') ||
+                          ch == '+' || ch == '-' || ch == '.'))) {
+      output->push_back(static_cast<char>(ch));
+    } else {
+      break;
+    }
+  }
+  if (i < 2 || i == spec_len || spec[i] != ':')
+    return false;
+  new_parsed->scheme.len = i;
+  const url_util::SchemeInfo* scheme_info = url_util::FindSchemeInfo(
+      &output->data()[new_parsed->scheme.begin],
+      url_parse::Component(0, new_parsed->scheme.len));
+  if (!scheme_info || scheme_info->type != url_util::SCHEME_STANDARD)
+    return false;
+  output->push_back(':');
+  i++;
+
+  // Exactly two slashes; the parser accepts any number of either kind.
+  if (spec_len - i < 3 || spec[i] != '/' || spec[i + 1] != '/' ||
+      spec[i + 2] == '/' || spec[i + 2] == '\\')
+    return false;
+  output->push_back('/');
+  output->push_back('/');
+  i += 2;
+
+  // Host: a plain ASCII host name, lower-cased. Anything made only of IPv4
+  // characters may be an address, which has its own canonical form.
+  new_parsed->host.begin = output->length();
+  bool maybe_ipv4 = true;
+  for (; i < spec_len; i++) {
+    UCHAR ch = static_cast<UCHAR>(spec[i]);
+    if (IsPathTerminator(ch) || ch == ':')
+      break;
+    if (ch >= 'A' && ch <= 'Z') {
+      ch += 'a' - 'A';
+    } else if (!(ch >= 'a' && ch <= 'z') && !(ch >= '0' && ch <= '9') &&
+               ch != '-' && ch != '.' && ch != '_') {
+      return false;  // User info, IPv6, escapes, IDN, invalid characters...
+    }
+    if (!IsIPv4Char(static_cast<unsigned char>(ch)))
+      maybe_ipv4 = false;
+    output->push_back(static_cast<char>(ch));
+  }
+  new_parsed->host.len = output->length() - new_parsed->host.begin;
+  if (new_parsed->host.len == 0 || maybe_ipv4)
+    return false;
+
+  // Port, dropped when it's the default one.
+  new_parsed->port = url_parse::Component();
+  if (i < spec_len && spec[i] == ':') {
+    int port_begin = ++i;
+    int port = 0;
+    for (; i < spec_len && spec[i] >= '0' && spec[i] <= '9'; i++) {
+      port = port * 10 + (spec[i] - '0');
+      if (port > 65535)
+        return false;
+    }
+    if (i < spec_len && !IsPathTerminator(spec[i]))
+      return false;
+    if (i > port_begin && port != scheme_info->default_port) {
+      char buf[6];
+      _itoa_s(port, buf, 10);
+      output->push_back(':');
+      new_parsed->port.begin = output->length();
+      for (int j = 0; buf[j]; j++)
+        output->push_back(buf[j]);
+      new_parsed->port.len = output->length() - new_parsed->port.begin;
+    }
+  }
+
+  if (!DoFusedPathQueryAndRef<CHAR, UCHAR>(spec, i, spec_len, output,
+                                           new_parsed))
+    return false;
+  new_parsed->username = url_parse::Component();
+  new_parsed->password = url_parse::Component();
+  return true;
+}
+
+#ifndef WIN32
+
+// "file:///" followed by a path, the only shape of file: URL taken here.
+// Other numbers of slashes mean a UNC host or a relative-looking path.
+// Windows builds never use this: there the parser also has to look for
+// drive letters and UNC names, which is most of the work.
+template<typename CHAR, typename UCHAR>
+bool DoFusedCanonicalizeFile(const CHAR* spec,
+                             int spec_len,
+                             CanonOutput* output,
+                             url_parse::Parsed* new_parsed) {
+  static const char kPrefix[] = "file:///";
+  const int kPrefixLen = static_cast<int>(sizeof(kPrefix)) - 1;
+  if (spec_len < kPrefixLen ||
+      static_cast<UCHAR>(spec[spec_len - 1]) <= ' ')
+    return false;
+  for (int i = 0; i < kPrefixLen; i++) {
+    UCHAR ch = static_cast<UCHAR>(spec[i]);
+    if (ch >= 'A' && ch <= 'Z')
+      ch += 'a' - 'A';
+    if (ch != kPrefix[i])
+      return false;
+  }
+  if (spec_len > kPrefixLen &&
+      (spec[kPrefixLen] == '/' || spec[kPrefixLen] == '\\'))
+    return false;
+
+  new_parsed->scheme = url_parse::Component(output->length(), 4);
+  output->Append("file://", 7);
+  new_parsed->username = url_parse::Component();
+  new_parsed->password = url_parse::Component();
+  new_parsed->host = url_parse::Component();
+  new_parsed->port = url_parse::Component();
+
+  // The path starts with the third slash.
+  return DoFusedPathQueryAndRef<CHAR, UCHAR>(spec, kPrefixLen - 1, spec_len,
+                                             output, new_parsed);
+}
+
+template<typename CHAR, typename UCHAR>
+bool DoFusedCanonicalizeFileURL(const CHAR* spec,
+                                int spec_len,
+                                CanonOutput* output,
+                                url_parse::Parsed* output_parsed) {
+  int output_begin = output->length();
+  url_parse::Parsed new_parsed;
+  if (!DoFusedCanonicalizeFile<CHAR, UCHAR>(spec, spec_len, output,
+                                            &new_parsed)) {
+    output->set_length(output_begin);
+    return false;
+  }
+  *output_parsed = new_parsed;
+  return true;
+}
+
+#endif  // WIN32
+
+template<typename CHAR, typename UCHAR>
+bool DoFusedCanonicalizeStandardURL(const CHAR* spec,
+                                    int spec_len,
+                                    CanonOutput* output,
+                                    url_parse::Parsed* output_parsed) {
+  int output_begin = output->length();
+  url_parse::Parsed new_parsed;
+  if (!DoFusedCanonicalize<CHAR, UCHAR>(spec, spec_len, output,
+                                        &new_parsed)) {
+    output->set_length(output_begin);
+    return false;
+  }
+  *output_parsed = new_parsed;
+  return true;
+}
+
+}  // namespace
+
+bool FusedCanonicalizeStandardURL(const char* spec,
+                                  int spec_len,
+                                  CanonOutput* output,
+                                  url_parse::Parsed* output_parsed) {
+  return DoFusedCanonicalizeStandardURL<char, unsigned char>(
+      spec, spec_len, output, output_parsed);
+}
+
+bool FusedCanonicalizeStandardURL(const char16* spec,
+                                  int spec_len,
+                                  CanonOutput* output,
+                                  url_parse::Parsed* output_parsed) {
+  return DoFusedCanonicalizeStandardURL<char16, char16>(
+      spec, spec_len, output, output_parsed);
+}
+
+bool FusedCanonicalizeFileURL(const char* spec,
+                              int spec_len,
+                              CanonOutput* output,
+                              url_parse::Parsed* output_parsed) {
+#ifdef WIN32
+  return false;
+#else
+  return DoFusedCanonicalizeFileURL<char, unsigned char>(
+      spec, spec_len, output, output_parsed);
+#endif
+}
+
+bool FusedCanonicalizeFileURL(const char16* spec,
+                              int spec_len,
+                              CanonOutput* output,
+                              url_parse::Parsed* output_parsed) {
+#ifdef WIN32
+  return false;
+#else
+  return DoFusedCanonicalizeFileURL<char16, char16>(
+      spec, spec_len, output, output_parsed);
+#endif
+}
+
+}  // namespace url_canon
@@ -0,0 +1,79 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A single-pass canonicalizer for the common shape of standard URLs. The
+// usual path runs RemoveURLWhitespace, ParseStandardURL and then each
+// component canonicalizer, reading every character three or more times. For
+// URLs like "http://www.example.com/a/b.html?q=1" this finds the component
+// boundaries while it writes the canonical output. Local "file:///" URLs get
+// the same treatment outside Windows.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_FUSED_H__
+#define GOOGLEURL_SRC_URL_CANON_FUSED_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_canon {
+
+// Canonicalizes |spec| if it is a URL with a standard scheme, a plain host
+// name and nothing that needs more than escaping or lower-casing. On success
+// the URL is valid, and the output and |*output_parsed| are exactly what
+// url_util::Canonicalize would have produced.
+//
+// Returns false for anything else, with the output left as it was: input
+// with whitespace to remove, backslashes, user info, IP literals, escaped or
+// non-ASCII hosts, dot segments in the path and non-ASCII queries (as well as
+// non-ASCII paths for 16-bit input). The caller canonicalizes those the usual
+// way; none of them can be told apart without doing most of the work.
+bool FusedCanonicalizeStandardURL(const char* spec,
+                                  int spec_len,
+                                  CanonOutput* output,
+                                  url_parse::Parsed* output_parsed);
+bool FusedCanonicalizeStandardURL(const char16* spec,
+                                  int spec_len,
+                                  CanonOutput* output,
+                                  url_parse::Parsed* output_parsed);
+
+// The same for "file:///" URLs with a path that only needs escaping. Always
+// returns false on Windows, where file: URLs can have drive letters and UNC
+// names that only the full parser handles.
+bool FusedCanonicalizeFileURL(const char* spec,
+                              int spec_len,
+                              CanonOutput* output,
+                              url_parse::Parsed* output_parsed);
+bool FusedCanonicalizeFileURL(const char16* spec,
+                              int spec_len,
+                              CanonOutput* output,
+                              url_parse::Parsed* output_parsed);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_FUSED_H__
@@ -27,9 +27,25 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#include <string.h>
+
+#include <string>
+#include <vector>
+
 #include "base/logging.h"
 #include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_canon_char_class.h"
+#include "googleurl/src/url_canon_host_cache.h"
+#include "googleurl/src/url_canon_host_classify.h"
+#include "googleurl/src/url_canon_idna.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_ip.h"
+#include "googleurl/src/url_canon_stats.h"
 
 namespace url_canon {
 
@@ -62,10 +78,10 @@ namespace {
 // unescaped, eg. (") or (#), which would indicate the beginning of the path.
 // Surprisingly, space is accepted in the input and always escaped.
 
-// This table lists the canonical version of all characters we allow in the
-// input, with 0 indicating it is disallowed. We use the magic kEscapedHostChar
-// value to indicate that this character should be escaped. We are a little more
-// restrictive than IE, but less restrictive than Firefox.
+// The characters we allow in the input are in CHAR_CLASS_HOST, or in
+// CHAR_CLASS_HOST_ESCAPE when they should be escaped, with anything in
+// neither disallowed. We are a little more restrictive than IE, but less
+// restrictive than Firefox.
 //
 // Note that we disallow the % character. We will allow it when part of an
 // escape sequence, of course, but this disallows "%25". Even though IE allows
@@ -74,23 +90,6 @@ namespace {
 // Allowing percents means we'll succeed a second time, so validity would change
 // based on how many times you run the canonicalizer. We prefer to always report
 // the same vailidity, so reject this.
-const unsigned char kEsc = 0xff;
-const unsigned char kHostCharLookup[0x80] = {
-// 00-1f: all are invalid
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-//  ' '   !    "    #    $    %    &    '    (    )    *    +    ,    -    .    /
-   kEsc,kEsc,kEsc,kEsc,kEsc,  0, kEsc,kEsc,kEsc,kEsc,kEsc, '+',kEsc, '-', '.',  0,
-//   0    1    2    3    4    5    6    7    8    9    :    ;    <    =    >    ?
-    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':',  0 ,kEsc,kEsc,kEsc,  0 ,
-//   @    A    B    C    D    E    F    G    H    I    J    K    L    M    N    O
-   kEsc, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
-//   P    Q    R    S    T    U    V    W    X    Y    Z    [    \    ]    ^    _
-    'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '[',  0 , ']',  0 , '_',
-//   `    a    b    c    d    e    f    g    h    i    j    k    l    m    n    o
-   kEsc, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
-//   p    q    r    s    t    u    v    w    x    y    z    {    |    }    ~
-    'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',kEsc,kEsc,kEsc,  0 ,  0 };
 
 const int kTempHostBufferLen = 1024;
 typedef RawCanonOutputT<char, kTempHostBufferLen> StackBuffer;
@@ -152,6 +151,7 @@ bool DoSimpleHost(const INCHAR* host,
         // Invalid escaped character. There is nothing that can make this
         // host valid. We append an escaped percent so the URL looks reasonable
         // and mark as failed.
+        GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
         AppendEscapedChar('%', output);
         success = false;
         continue;
@@ -160,19 +160,21 @@ bool DoSimpleHost(const INCHAR* host,
 
     if (source < 0x80) {
       // We have ASCII input, we can use our lookup table.
-      unsigned char replacement = kHostCharLookup[source];
-      if (!replacement) {
-        // Invalid character, add it as percent-escaped and mark as failed.
-        AppendEscapedChar(source, output);
-        success = false;
-      } else if (replacement == kEsc) {
-        // This character is valid but should be escaped.
-        AppendEscapedChar(source, output);
-      } else {
+      uint32 char_class = LookupCharClass(source);
+      if (char_class & CHAR_CLASS_HOST) {
         // Common case, the given character is valid in a hostname, the lookup
         // table tells us the canonical representation of that character (lower
         // cased).
-        output->push_back(replacement);
+        output->push_back(CanonicalCharOfClass(char_class));
+      } else if (char_class & CHAR_CLASS_HOST_ESCAPE) {
+        // This character is valid but should be escaped.
+        GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
+        AppendEscapedChar(source, output);
+      } else {
+        // Invalid character, add it as percent-escaped and mark as failed.
+        GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
+        AppendEscapedChar(source, output);
+        success = false;
       }
     } else {
       // It's a non-ascii char. Just push it to the output.
@@ -194,6 +196,7 @@ bool DoIDNHost(const char16* src, int src_len, CanonOutput* output) {
   bool has_non_ascii;
   DoSimpleHost(src, src_len, &url_escaped_host, &has_non_ascii);
 
+  GURL_CANON_STAT(CANON_STAT_IDN_CONVERSIONS);
   StackBufferW wide_output;
   if (!IDNToASCII(url_escaped_host.data(),
                   url_escaped_host.length(),
@@ -214,6 +217,55 @@ bool DoIDNHost(const char16* src, int src_len, CanonOutput* output) {
   return success;
 }
 
+#if !defined(GURL_USE_ICU_IDNA)
+
+// 8-bit convert host to its ASCII version. The built-in IDN engine reads
+// UTF-8, so this stays on bytes the whole way: one DoSimpleHost pass
+// unescapes and lower-cases, the engine converts what's left, and a final
+// pass checks its ASCII output. The has_escaped flag should be set if the
+// input string requires unescaping.
+bool DoComplexHost(const char* host, int host_len,
+                   bool has_non_ascii, bool has_escaped, CanonOutput* output) {
+  // We need to escape URL before doing IDN conversion, since punicode strings
+  // cannot be escaped after they are created.
+  StackBuffer url_escaped_host;
+  bool success = DoSimpleHost(host, host_len, &url_escaped_host,
+                              &has_non_ascii);
+
+  // Unescaping may have left us with ASCII input, in which case that's the
+  // answer. A bad escape sequence is also final, DoSimpleHost will have
+  // written some "reasonable" output.
+  if (!has_non_ascii || (has_escaped && !success)) {
+    output->Append(url_escaped_host.data(), url_escaped_host.length());
+    return success;
+  }
+
+  GURL_CANON_STAT(CANON_STAT_IDN_CONVERSIONS);
+  StackBuffer ascii_output;
+  if (!BuiltInIDNToASCII(url_escaped_host.data(),
+                         url_escaped_host.length(),
+                         &ascii_output)) {
+    // Some error, give up. Like the UTF-16 path, this reports the unescaped
+    // host when there was something to unescape.
+    if (has_escaped) {
+      AppendInvalidNarrowString(url_escaped_host.data(), 0,
+                                url_escaped_host.length(), output);
+    } else {
+      AppendInvalidNarrowString(host, 0, host_len, output);
+    }
+    return false;
+  }
+
+  // Now we check the ASCII output like a normal host. This also catches
+  // anything that nameprep mapped to a disallowed ASCII character.
+  success = DoSimpleHost(ascii_output.data(), ascii_output.length(),
+                         output, &has_non_ascii);
+  DCHECK(!has_non_ascii);
+  return success;
+}
+
+#else  // !defined(GURL_USE_ICU_IDNA)
+
 // 8-bit convert host to its ASCII version: this converts the UTF-8 input to
 // UTF-16. The has_escaped flag should be set if the input string requires
 // unescaping.
@@ -277,6 +329,8 @@ bool DoComplexHost(const char* host, int host_len,
   return DoIDNHost(utf16.data(), utf16.length(), output);
 }
 
+#endif  // !defined(GURL_USE_ICU_IDNA)
+
 // UTF-16 convert host to its ASCII version. The set up is already ready for
 // the backend, so we just pass through. The has_escaped flag should be set if
 // the input string requires unescaping.
@@ -285,7 +339,8 @@ bool DoComplexHost(const char16* host, int host_len,
   if (has_escaped) {
     // Yikes, we have escaped characters with wide input. The escaped
     // characters should be interpreted as UTF-8. To solve this problem,
-    // we convert to UTF-8, unescape, then convert back to UTF-16 for IDN.
+    // we convert to UTF-8 and unescape. The built-in IDN engine carries on
+    // from there; with ICU's we convert back to UTF-16 for IDN.
     //
     // We don't bother to optimize the conversion in the ASCII case (which
     // *could* just be a copy) and use the UTF-8 path, because it should be
@@ -310,6 +365,240 @@ bool DoComplexHost(const char16* host, int host_len,
   return DoIDNHost(host, host_len, output);
 }
 
+// Only hosts up to this many bytes of input are cached, so that a page full
+// of junk hosts can't fill the cache with huge entries.
+const int kMaxCachedHostBytes = 256;
+
+// Number of independently locked parts of the cache. Each host always goes to
+// the same shard, picked from the high bits of its hash.
+const int kHostCacheShards = 16;
+
+#ifdef WIN32
+class HostCacheLock {
+ public:
+  HostCacheLock() { InitializeCriticalSection(&section_); }
+  ~HostCacheLock() { DeleteCriticalSection(&section_); }
+  void Acquire() { EnterCriticalSection(&section_); }
+  void Release() { LeaveCriticalSection(&section_); }
+
+ private:
+  CRITICAL_SECTION section_;
+};
+#else
+class HostCacheLock {
+ public:
+  HostCacheLock() { pthread_mutex_init(&mutex_, NULL); }
+  ~HostCacheLock() { pthread_mutex_destroy(&mutex_); }
+  void Acquire() { pthread_mutex_lock(&mutex_); }
+  void Release() { pthread_mutex_unlock(&mutex_); }
+
+ private:
+  pthread_mutex_t mutex_;
+};
+#endif
+
+// The canonical form of one input host, exactly as DoHost would write it.
+struct HostCacheEntry {
+  // The raw bytes of the input host. 8-bit and 16-bit input are never
+  // confused because |wide| is part of the key.
+  std::string key;
+  bool wide;
+  unsigned hash;
+
+  std::string canonical;
+  CanonHostInfo::Family family;
+  int num_ipv4_components;
+  unsigned char address[16];
+
+  // Chain of entries in the same bucket and the LRU list, as indices into
+  // HostCacheShard::entries_ (-1 at the ends).
+  int next_in_bucket;
+  int lru_prev;
+  int lru_next;
+};
+
+// One shard of the cache: a fixed number of entries in a chained hash table,
+// plus a doubly linked list from most to least recently used. When it is
+// full, the least recently used entry is reused.
+class HostCacheShard {
+ public:
+  HostCacheShard() : capacity_(0), lru_head_(-1), lru_tail_(-1),
+                     hits_(0), misses_(0) {
+  }
+
+  void Init(int capacity) {
+    capacity_ = capacity;
+    entries_.reserve(capacity);
+    int num_buckets = 1;
+    while (num_buckets < capacity)
+      num_buckets *= 2;
+    buckets_.assign(num_buckets, -1);
+  }
+
+  // On a hit, appends the canonical host to |output|, fills everything in
+  // |*host_info| except |out_host| and returns true.
+  bool Lookup(const char* key, int key_len, bool wide, unsigned hash,
+              CanonOutput* output, CanonHostInfo* host_info) {
+    lock_.Acquire();
+    int index = Find(key, key_len, wide, hash, NULL);
+    if (index < 0) {
+      misses_++;
+      lock_.Release();
+      return false;
+    }
+    hits_++;
+    MoveToFront(index);
+
+    const HostCacheEntry& entry = entries_[index];
+    output->Append(entry.canonical.data(),
+                   static_cast<int>(entry.canonical.length()));
+    host_info->family = entry.family;
+    host_info->num_ipv4_components = entry.num_ipv4_components;
+    memcpy(host_info->address, entry.address, sizeof(entry.address));
+    lock_.Release();
+    return true;
+  }
+
+  void Insert(const char* key, int key_len, bool wide, unsigned hash,
+              const char* canonical, int canonical_len,
+              const CanonHostInfo& host_info) {
+    lock_.Acquire();
+    if (Find(key, key_len, wide, hash, NULL) >= 0) {
+      // Another thread got here first.
+      lock_.Release();
+      return;
+    }
+
+    int index;
+    if (static_cast<int>(entries_.size()) < capacity_) {
+      index = static_cast<int>(entries_.size());
+      entries_.push_back(HostCacheEntry());
+    } else {
+      index = lru_tail_;
+      Unlink(index);
+    }
+
+    HostCacheEntry& entry = entries_[index];
+    entry.key.assign(key, key_len);
+    entry.wide = wide;
+    entry.hash = hash;
+    entry.canonical.assign(canonical, canonical_len);
+    entry.family = host_info.family;
+    entry.num_ipv4_components = host_info.num_ipv4_components;
+    memcpy(entry.address, host_info.address, sizeof(entry.address));
+
+    int bucket = BucketForHash(hash);
+    entry.next_in_bucket = buckets_[bucket];
+    buckets_[bucket] = index;
+    entry.lru_prev = -1;
+    entry.lru_next = -1;
+    MoveToFront(index);
+    lock_.Release();
+  }
+
+  void AddStats(HostCacheStats* stats) {
+    lock_.Acquire();
+    stats->hits += hits_;
+    stats->misses += misses_;
+    stats->entries += static_cast<int>(entries_.size());
+    lock_.Release();
+  }
+
+ private:
+  int BucketForHash(unsigned hash) const {
+    return static_cast<int>(hash & (buckets_.size() - 1));
+  }
+
+  // Returns the index of the entry for the given key, or -1. When
+  // |prev_in_bucket| is non-NULL it receives the entry before it in the
+  // bucket chain (-1 if it's the first).
+  int Find(const char* key, int key_len, bool wide, unsigned hash,
+           int* prev_in_bucket) const {
+    int prev = -1;
+    for (int i = buckets_[BucketForHash(hash)]; i >= 0;
+         i = entries_[i].next_in_bucket) {
+      const HostCacheEntry& entry = entries_[i];
+      if (entry.hash == hash && entry.wide == wide &&
+          static_cast<int>(entry.key.length()) == key_len &&
+          memcmp(entry.key.data(), key, key_len) == 0) {
+        if (prev_in_bucket)
+          *prev_in_bucket = prev;
+        return i;
+      }
+      prev = i;
+    }
+    return -1;
+  }
+
+  // Removes the entry at |index| from its bucket and from the LRU list.
+  void Unlink(int index) {
+    HostCacheEntry& entry = entries_[index];
+    int prev = -1;
+    Find(entry.key.data(), static_cast<int>(entry.key.length()), entry.wide,
+         entry.hash, &prev);
+    if (prev < 0)
+      buckets_[BucketForHash(entry.hash)] = entry.next_in_bucket;
+    else
+      entries_[prev].next_in_bucket = entry.next_in_bucket;
+    RemoveFromList(index);
+  }
+
+  void RemoveFromList(int index) {
+    HostCacheEntry& entry = entries_[index];
+    if (entry.lru_prev >= 0)
+      entries_[entry.lru_prev].lru_next = entry.lru_next;
+    else if (lru_head_ == index)
+      lru_head_ = entry.lru_next;
+    if (entry.lru_next >= 0)
+      entries_[entry.lru_next].lru_prev = entry.lru_prev;
+    else if (lru_tail_ == index)
+      lru_tail_ = entry.lru_prev;
+    entry.lru_prev = -1;
+    entry.lru_next = -1;
+  }
+
+  void MoveToFront(int index) {
+    if (lru_head_ == index)
+      return;
+    RemoveFromList(index);
+    HostCacheEntry& entry = entries_[index];
+    entry.lru_next = lru_head_;
+    if (lru_head_ >= 0)
+      entries_[lru_head_].lru_prev = index;
+    lru_head_ = index;
+    if (lru_tail_ < 0)
+      lru_tail_ = index;
+  }
+
+  HostCacheLock lock_;
+  int capacity_;
+  std::vector<HostCacheEntry> entries_;
+  std::vector<int> buckets_;  // Heads of the bucket chains, -1 when empty.
+  int lru_head_;  // Most recently used.
+  int lru_tail_;  // Least recently used, the next to be reused.
+  int64 hits_;
+  int64 misses_;
+
+  DISALLOW_COPY_AND_ASSIGN(HostCacheShard);
+};
+
+// The shards of the cache, NULL when it is off. See SetHostCacheSize.
+HostCacheShard* host_cache = NULL;
+
+// FNV-1a over the raw input bytes.
+unsigned HashHostKey(const char* key, int key_len) {
+  unsigned hash = 2166136261u;
+  for (int i = 0; i < key_len; i++) {
+    hash ^= static_cast<unsigned char>(key[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+inline HostCacheShard* HostCacheShardForHash(unsigned hash) {
+  return &host_cache[(hash >> 24) % kHostCacheShards];
+}
+
 template<typename CHAR, typename UCHAR>
 void DoHost(const CHAR* spec,
             const url_parse::Component& host,
@@ -322,11 +611,47 @@ void DoHost(const CHAR* spec,
     return;
   }
 
+  // Keep track of output's initial length, so we can rewind later.
+  const int output_begin = output->length();
+
+  // IP literals are recognized straight from the input, they don't need any
+  // of the host name processing below.
+  if (ClassifyHost(spec, host, host_info)) {
+    if (host_info->family == CanonHostInfo::IPV4) {
+      AppendIPv4Address(host_info->address, output);
+    } else if (host_info->family == CanonHostInfo::IPV6) {
+      output->push_back('[');
+      AppendIPv6Address(host_info->address, output);
+      output->push_back(']');
+    } else {
+      // A host name or a broken address, which is left as it is apart from
+      // lower-casing. All these characters are valid and unescaped.
+      for (int i = host.begin; i < host.end(); i++)
+        output->push_back(CanonicalCharOfClass(LookupCharClass(spec[i])));
+    }
+    host_info->out_host = url_parse::MakeRange(output_begin, output->length());
+    return;
+  }
+
   bool has_non_ascii, has_escaped;
   ScanHostname<CHAR, UCHAR>(spec, host, &has_non_ascii, &has_escaped);
 
-  // Keep track of output's initial length, so we can rewind later.
-  const int output_begin = output->length();
+  // Hosts that need IDN or unescaping are slow enough to be worth caching.
+  const char* cache_key = reinterpret_cast<const char*>(&spec[host.begin]);
+  int cache_key_len = host.len * static_cast<int>(sizeof(CHAR));
+  unsigned cache_hash = 0;
+  HostCacheShard* cache_shard = NULL;
+  if ((has_non_ascii || has_escaped) && host_cache &&
+      cache_key_len <= kMaxCachedHostBytes) {
+    cache_hash = HashHostKey(cache_key, cache_key_len);
+    cache_shard = HostCacheShardForHash(cache_hash);
+    if (cache_shard->Lookup(cache_key, cache_key_len, sizeof(CHAR) != 1,
+                            cache_hash, output, host_info)) {
+      host_info->out_host = url_parse::MakeRange(output_begin,
+                                                 output->length());
+      return;
+    }
+  }
 
   bool success;
   if (!has_non_ascii && !has_escaped) {
@@ -360,6 +685,20 @@ void DoHost(const CHAR* spec,
   }
 
   host_info->out_host = url_parse::MakeRange(output_begin, output->length());
+
+  if (cache_shard) {
+    cache_shard->Insert(cache_key, cache_key_len, sizeof(CHAR) != 1,
+                        cache_hash, &output->data()[output_begin],
+                        output->length() - output_begin, *host_info);
+  }
+}
+
+// Feeds the address family of a canonicalized host to the counters.
+inline void CountHostFamily(const CanonHostInfo& host_info) {
+  if (host_info.family == CanonHostInfo::IPV4)
+    GURL_CANON_STAT(CANON_STAT_IPV4_HOSTS);
+  else if (host_info.family == CanonHostInfo::IPV6)
+    GURL_CANON_STAT(CANON_STAT_IPV6_HOSTS);
 }
 
 }  // namespace
@@ -370,6 +709,7 @@ bool CanonicalizeHost(const char* spec,
                       url_parse::Component* out_host) {
   CanonHostInfo host_info;
   DoHost<char, unsigned char>(spec, host, output, &host_info);
+  CountHostFamily(host_info);
   *out_host = host_info.out_host;
   return (host_info.family != CanonHostInfo::BROKEN);
 }
@@ -380,6 +720,7 @@ bool CanonicalizeHost(const char16* spec,
                       url_parse::Component* out_host) {
   CanonHostInfo host_info;
   DoHost<char16, char16>(spec, host, output, &host_info);
+  CountHostFamily(host_info);
   *out_host = host_info.out_host;
   return (host_info.family != CanonHostInfo::BROKEN);
 }
@@ -389,6 +730,7 @@ void CanonicalizeHostVerbose(const char* spec,
                              CanonOutput* output,
                              CanonHostInfo *host_info) {
   DoHost<char, unsigned char>(spec, host, output, host_info);
+  CountHostFamily(*host_info);
 }
 
 void CanonicalizeHostVerbose(const char16* spec,
@@ -396,6 +738,28 @@ void CanonicalizeHostVerbose(const char16* spec,
                              CanonOutput* output,
                              CanonHostInfo *host_info) {
   DoHost<char16, char16>(spec, host, output, host_info);
+  CountHostFamily(*host_info);
+}
+
+void SetHostCacheSize(int max_entries) {
+  delete[] host_cache;
+  host_cache = NULL;
+  if (max_entries <= 0)
+    return;
+
+  int per_shard = (max_entries + kHostCacheShards - 1) / kHostCacheShards;
+  HostCacheShard* shards = new HostCacheShard[kHostCacheShards];
+  for (int i = 0; i < kHostCacheShards; i++)
+    shards[i].Init(per_shard);
+  host_cache = shards;
+}
+
+void GetHostCacheStats(HostCacheStats* stats) {
+  *stats = HostCacheStats();
+  if (!host_cache)
+    return;
+  for (int i = 0; i < kHostCacheShards; i++)
+    host_cache[i].AddStats(stats);
 }
 
 }  // namespace url_canon
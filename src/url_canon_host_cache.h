@@ -0,0 +1,70 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// An optional cache for the results of canonicalizing hosts that need IDN
+// conversion or unescaping. Those are decoded to code points and run through
+// nameprep and punycode, which is slow next to the plain copy everything else
+// gets, while real traffic tends to see the same few thousand such hosts over
+// and over. The cache is off until SetHostCacheSize is called.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_HOST_CACHE_H__
+#define GOOGLEURL_SRC_URL_CANON_HOST_CACHE_H__
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_canon {
+
+// Turns on the host cache with room for about |max_entries| hosts, or turns
+// it off when |max_entries| is 0. Anything already cached is dropped.
+//
+// The cache itself is safe to use from any thread: it is split into shards
+// by host hash, each with its own lock, so threads rarely wait on each other.
+// Installing or resizing it is not, so call this at startup before any URLs
+// are canonicalized on other threads.
+GURL_API void SetHostCacheSize(int max_entries);
+
+struct HostCacheStats {
+  HostCacheStats() : hits(0), misses(0), entries(0) {}
+
+  // Lookups since the cache was last sized. Hosts that don't need IDN or
+  // unescaping never get looked up.
+  int64 hits;
+  int64 misses;
+
+  // Number of hosts currently cached.
+  int entries;
+};
+
+// Fills |*stats| for the current cache. Everything is 0 when it is off.
+GURL_API void GetHostCacheStats(HostCacheStats* stats);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_HOST_CACHE_H__
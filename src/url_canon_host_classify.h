@@ -0,0 +1,61 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Recognizes IP address literals without canonicalizing the host first.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_HOST_CLASSIFY_H__
+#define GOOGLEURL_SRC_URL_CANON_HOST_CLASSIFY_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_canon {
+
+// Classifies |host| in one pass over the input. If every character in it can
+// be part of an IPv4 or IPv6 literal (hex digits, 'x', dots, colons and
+// square brackets), this parses it as one and returns true. The family of
+// |host_info| is then what CanonicalizeHostVerbose would report: IPV4 or
+// IPV6 with the address filled in, BROKEN for an invalid address, or NEUTRAL
+// for a host name like "cafe.be". |host_info|'s out_host is not changed.
+//
+// Returns false without touching |host_info| for anything else, for example
+// hosts with escapes or non-ASCII characters. Those have to be canonicalized
+// before anyone can tell.
+GURL_API bool ClassifyHost(const char* spec,
+                           const url_parse::Component& host,
+                           CanonHostInfo* host_info);
+GURL_API bool ClassifyHost(const char16* spec,
+                           const url_parse::Component& host,
+                           CanonHostInfo* host_info);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_HOST_CLASSIFY_H__
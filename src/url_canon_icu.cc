@@ -29,14 +29,30 @@
 
 // ICU integration functions.
 
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 #include <stdlib.h>
 #include <string.h>
 #include <unicode/ucnv.h>
 #include <unicode/ucnv_cb.h>
+#if defined(GURL_USE_ICU_IDNA)
 #include <unicode/uidna.h>
+#endif
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/basictypes.h"
 #include "googleurl/src/url_canon_icu.h"
+#include "googleurl/src/url_canon_icu_pool.h"
 #include "googleurl/src/url_canon_internal.h"  // for _itoa_s
+#include "googleurl/src/url_canon_query_converter.h"
+#include "googleurl/src/url_canon_stats.h"
 
 #include "base/logging.h"
 
@@ -75,17 +91,28 @@ void appendURLEscapedChar(const void* context,
 }
 
 // A class for scoping the installation of the invalid character callback.
+// Converters from the thread pool have it installed for good, and are left
+// alone.
 class AppendHandlerInstaller {
  public:
   // The owner of this object must ensure that the converter is alive for the
   // duration of this object's lifetime.
-  AppendHandlerInstaller(UConverter* converter) : converter_(converter) {
+  AppendHandlerInstaller(UConverter* converter) : converter_(NULL) {
+    UConverterFromUCallback callback;
+    const void* context;
+    ucnv_getFromUCallBack(converter, &callback, &context);
+    if (callback == appendURLEscapedChar)
+      return;
+
+    converter_ = converter;
     UErrorCode err = U_ZERO_ERROR;
     ucnv_setFromUCallBack(converter_, appendURLEscapedChar, 0,
                           &old_callback_, &old_context_, &err);
   }
 
   ~AppendHandlerInstaller() {
+    if (!converter_)
+      return;
     UErrorCode err = U_ZERO_ERROR;
     ucnv_setFromUCallBack(converter_, old_callback_, old_context_, 0, 0, &err);
   }
@@ -128,11 +155,289 @@ void ICUCharsetConverter::ConvertFromUTF16(const char16* input,
     }
 
     // Output didn't fit, expand
+    GURL_CANON_STAT(CANON_STAT_ICU_OVERFLOW_RETRIES);
     dest_capacity = required_capacity;
     output->Resize(begin_offset + dest_capacity);
   } while (true);
 }
 
+namespace {
+
+// Appends what appendURLEscapedChar writes for a code point that the charset
+// can't represent.
+void AppendEscapedCharacterReference(unsigned code_point,
+                                     CanonOutput* output) {
+  output->Append("%26%23", 6);  // "&#" percent-escaped
+  char number[8];  // Max Unicode code point is 7 digits.
+  _itoa_s(code_point, number, 10);
+  output->Append(number, static_cast<int>(strlen(number)));
+  output->Append("%3B", 3);  // ";" percent-escaped
+}
+
+// Converts to a charset with one byte per character from a table that's
+// built from the ICU converter when this is created. Only characters the
+// converter maps both ways go in the table, since those are the only ones
+// ucnv_fromUChars uses. Unpaired surrogates stop ucnv_fromUChars part way,
+// so input that has them is left to the ICU converter to get the same
+// result.
+class SingleByteCharsetConverter : public CharsetConverter {
+ public:
+  // |converter| must have the escaping callback installed and outlive this.
+  explicit SingleByteCharsetConverter(UConverter* converter)
+      : icu_converter_(converter) {
+    for (int i = 0; i < 0x100; i++)
+      latin1_[i] = -1;
+
+    for (int i = 0; i < 0x100; i++) {
+      char byte = static_cast<char>(i);
+      UChar ch;
+      UErrorCode err = U_ZERO_ERROR;
+      int len = ucnv_toUChars(converter, &ch, 1, &byte, 1, &err);
+      if (U_FAILURE(err) || len != 1 || U16_IS_SURROGATE(ch))
+        continue;
+
+      char back[16];
+      err = U_ZERO_ERROR;
+      len = ucnv_fromUChars(converter, back, sizeof(back), &ch, 1, &err);
+      if (U_FAILURE(err) || len != 1 || back[0] != byte)
+        continue;
+
+      if (ch < 0x100)
+        latin1_[ch] = static_cast<short>(i);
+      else
+        others_.push_back(std::make_pair(static_cast<char16>(ch),
+                                         static_cast<unsigned char>(i)));
+    }
+    std::sort(others_.begin(), others_.end());
+  }
+
+  virtual ~SingleByteCharsetConverter() {}
+
+  virtual void ConvertFromUTF16(const char16* input,
+                                int input_len,
+                                CanonOutput* output) {
+    int begin_offset = output->length();
+    for (int i = 0; i < input_len; i++) {
+      unsigned code_point = input[i];
+      if (U16_IS_SURROGATE(code_point)) {
+        if (!U16_IS_SURROGATE_LEAD(code_point) || i + 1 >= input_len ||
+            !U16_IS_TRAIL(input[i + 1])) {
+          output->set_length(begin_offset);
+          icu_converter_.ConvertFromUTF16(input, input_len, output);
+          return;
+        }
+        code_point = U16_GET_SUPPLEMENTARY(code_point, input[i + 1]);
+        i++;
+      }
+      AppendCodePoint(code_point, output);
+    }
+  }
+
+  // Like ConvertFromUTF16 on the input converted to UTF-16, where invalid
+  // UTF-8 becomes the replacement character.
+  void ConvertFromUTF8(const char* input, int input_len, CanonOutput* output) {
+    for (int i = 0; i < input_len; i++) {
+      unsigned code_point;
+      ReadUTFChar(input, &i, input_len, &code_point);
+      AppendCodePoint(code_point, output);
+    }
+  }
+
+ private:
+  typedef std::pair<char16, unsigned char> Mapping;
+
+  void AppendCodePoint(unsigned code_point, CanonOutput* output) const {
+    if (code_point < 0x100) {
+      if (latin1_[code_point] >= 0) {
+        output->push_back(static_cast<char>(latin1_[code_point]));
+        return;
+      }
+    } else if (code_point < 0x10000) {
+      std::vector<Mapping>::const_iterator found = std::lower_bound(
+          others_.begin(), others_.end(),
+          Mapping(static_cast<char16>(code_point), 0));
+      if (found != others_.end() && found->first == code_point) {
+        output->push_back(static_cast<char>(found->second));
+        return;
+      }
+    }
+    AppendEscapedCharacterReference(code_point, output);
+  }
+
+  // The byte for each code point below 0x100, or -1 if there isn't one.
+  short latin1_[0x100];
+
+  // The other mappings, sorted by code point.
+  std::vector<Mapping> others_;
+
+  ICUCharsetConverter icu_converter_;
+};
+
+// One charset opened by GetThreadCharsetConverter.
+struct PooledConverter {
+  std::string name;
+  UConverter* converter;
+  CharsetConverter* charset_converter;
+
+  // |charset_converter| when it's a SingleByteCharsetConverter, else NULL.
+  SingleByteCharsetConverter* single_byte;
+};
+
+class ThreadConverterPool {
+ public:
+  ThreadConverterPool() {}
+
+  ~ThreadConverterPool() {
+    for (size_t i = 0; i < converters_.size(); i++) {
+      delete converters_[i].charset_converter;
+      ucnv_close(converters_[i].converter);
+    }
+  }
+
+  CharsetConverter* Get(const char* charset_name) {
+    for (size_t i = 0; i < converters_.size(); i++) {
+      if (ucnv_compareNames(converters_[i].name.c_str(), charset_name) == 0)
+        return converters_[i].charset_converter;
+    }
+
+    UErrorCode err = U_ZERO_ERROR;
+    UConverter* converter = ucnv_open(charset_name, &err);
+    if (U_FAILURE(err))
+      return NULL;
+    err = U_ZERO_ERROR;
+    ucnv_setFromUCallBack(converter, appendURLEscapedChar, 0, NULL, NULL,
+                          &err);
+
+    PooledConverter pooled;
+    pooled.name = charset_name;
+    pooled.converter = converter;
+    pooled.single_byte = NULL;
+    if (IsSingleByte(converter)) {
+      pooled.single_byte = new SingleByteCharsetConverter(converter);
+      pooled.charset_converter = pooled.single_byte;
+    } else {
+      pooled.charset_converter = new ICUCharsetConverter(converter);
+    }
+    converters_.push_back(pooled);
+    return pooled.charset_converter;
+  }
+
+  SingleByteCharsetConverter* FindSingleByte(
+      const CharsetConverter* converter) const {
+    for (size_t i = 0; i < converters_.size(); i++) {
+      if (converters_[i].charset_converter == converter)
+        return converters_[i].single_byte;
+    }
+    return NULL;
+  }
+
+ private:
+  static bool IsSingleByte(UConverter* converter) {
+    if (ucnv_getMaxCharSize(converter) != 1)
+      return false;
+    UConverterType type = ucnv_getType(converter);
+    return type == UCNV_SBCS || type == UCNV_LATIN_1 || type == UCNV_US_ASCII;
+  }
+
+  std::vector<PooledConverter> converters_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadConverterPool);
+};
+
+#ifdef WIN32
+
+DWORD pool_slot = TLS_OUT_OF_INDEXES;
+
+DWORD PoolSlot() {
+  // Be careful that we don't break in the case that this is being called
+  // from multiple threads for the first time.
+  if (pool_slot == TLS_OUT_OF_INDEXES) {
+    DWORD new_slot = TlsAlloc();
+    if (InterlockedCompareExchange(
+            reinterpret_cast<volatile LONG*>(&pool_slot),
+            static_cast<LONG>(new_slot),
+            static_cast<LONG>(TLS_OUT_OF_INDEXES)) !=
+        static_cast<LONG>(TLS_OUT_OF_INDEXES)) {
+      // Another thread allocated the slot out from under us.
+      TlsFree(new_slot);
+    }
+  }
+  return pool_slot;
+}
+
+ThreadConverterPool* GetThreadPool() {
+  return static_cast<ThreadConverterPool*>(TlsGetValue(PoolSlot()));
+}
+
+void SetThreadPool(ThreadConverterPool* pool) {
+  TlsSetValue(PoolSlot(), pool);
+}
+
+#else
+
+pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+pthread_key_t pool_key;
+
+void DeleteThreadPool(void* pool) {
+  delete static_cast<ThreadConverterPool*>(pool);
+}
+
+void CreatePoolKey() {
+  pthread_key_create(&pool_key, DeleteThreadPool);
+}
+
+ThreadConverterPool* GetThreadPool() {
+  pthread_once(&pool_key_once, CreatePoolKey);
+  return static_cast<ThreadConverterPool*>(pthread_getspecific(pool_key));
+}
+
+void SetThreadPool(ThreadConverterPool* pool) {
+  pthread_once(&pool_key_once, CreatePoolKey);
+  pthread_setspecific(pool_key, pool);
+}
+
+#endif  // WIN32
+
+// The UTF8QueryConverter the pool installs once it has opened a single-byte
+// converter. Only this thread's pool can have made |converter|.
+bool ConvertUTF8WithThreadConverter(CharsetConverter* converter,
+                                    const char* input,
+                                    int input_len,
+                                    CanonOutput* output) {
+  ThreadConverterPool* pool = GetThreadPool();
+  if (!pool)
+    return false;
+  SingleByteCharsetConverter* single_byte = pool->FindSingleByte(converter);
+  if (!single_byte)
+    return false;
+  single_byte->ConvertFromUTF8(input, input_len, output);
+  return true;
+}
+
+}  // namespace
+
+CharsetConverter* GetThreadCharsetConverter(const char* charset_name) {
+  ThreadConverterPool* pool = GetThreadPool();
+  if (!pool) {
+    pool = new ThreadConverterPool;
+    SetThreadPool(pool);
+  }
+  CharsetConverter* converter = pool->Get(charset_name);
+  if (converter && pool->FindSingleByte(converter))
+    SetUTF8QueryConverter(&ConvertUTF8WithThreadConverter);
+  return converter;
+}
+
+void ReleaseThreadCharsetConverters() {
+  ThreadConverterPool* pool = GetThreadPool();
+  if (!pool)
+    return;
+  SetThreadPool(NULL);
+  delete pool;
+}
+
+#if defined(GURL_USE_ICU_IDNA)
+
 // Converts the Unicode input representing a hostname to ASCII using IDN rules.
 // The output must be ASCII, but is represented as wide characters.
 //
@@ -160,51 +465,11 @@ bool IDNToASCII(const char16* src, int src_len, CanonOutputW* output) {
       return false;  // Unknown error, give up.
 
     // Not enough room in our buffer, expand.
+    GURL_CANON_STAT(CANON_STAT_ICU_OVERFLOW_RETRIES);
     output->Resize(output->capacity() * 2);
   }
 }
 
-bool ReadUTFChar(const char* str, int* begin, int length,
-                 unsigned* code_point_out) {
-  int code_point;  // Avoids warning when U8_NEXT writes -1 to it.
-  U8_NEXT(str, *begin, length, code_point);
-  *code_point_out = static_cast<unsigned>(code_point);
-
-  // The ICU macro above moves to the next char, we want to point to the last
-  // char consumed.
-  (*begin)--;
-
-  // Validate the decoded value.
-  if (U_IS_UNICODE_CHAR(code_point))
-    return true;
-  *code_point_out = kUnicodeReplacementCharacter;
-  return false;
-}
-
-bool ReadUTFChar(const char16* str, int* begin, int length,
-                 unsigned* code_point) {
-  if (U16_IS_SURROGATE(str[*begin])) {
-    if (!U16_IS_SURROGATE_LEAD(str[*begin]) || *begin + 1 >= length ||
-        !U16_IS_TRAIL(str[*begin + 1])) {
-      // Invalid surrogate pair.
-      *code_point = kUnicodeReplacementCharacter;
-      return false;
-    } else {
-      // Valid surrogate pair.
-      *code_point = U16_GET_SUPPLEMENTARY(str[*begin], str[*begin + 1]);
-      (*begin)++;
-    }
-  } else {
-    // Not a surrogate, just one 16-bit word.
-    *code_point = str[*begin];
-  }
-
-  if (U_IS_UNICODE_CHAR(*code_point))
-    return true;
-
-  // Invalid code point.
-  *code_point = kUnicodeReplacementCharacter;
-  return false;
-}
+#endif  // defined(GURL_USE_ICU_IDNA)
 
 }  // namespace url_canon
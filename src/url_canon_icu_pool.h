@@ -0,0 +1,64 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Query encoding converters that are shared by everything on a thread. A
+// page with a non-UTF-8 charset needs its queries converted with ICU, and
+// opening a converter and installing the escaping callback for every URL
+// adds up. The pool opens each charset once per thread with the callback
+// already installed. Single-byte charsets such as windows-1252 and the
+// ISO-8859 family get a lookup table instead, built from ICU's mapping when
+// the charset is first used, and 8-bit queries go to the table straight
+// from UTF-8 through the hook in url_canon_query_converter.h.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_ICU_POOL_H__
+#define GOOGLEURL_SRC_URL_CANON_ICU_POOL_H__
+
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_canon {
+
+// Returns the calling thread's converter for |charset_name|, opening it on
+// the first call for that name. Returns NULL if ICU doesn't know the
+// charset. The output is the same as an ICUCharsetConverter for that
+// charset would give.
+//
+// The converter belongs to the calling thread and must only be used on it.
+// It stays valid until ReleaseThreadCharsetConverters is called or the
+// thread exits.
+GURL_API CharsetConverter* GetThreadCharsetConverter(const char* charset_name);
+
+// Closes every converter GetThreadCharsetConverter opened on this thread.
+// Threads on Windows must call this before they exit; elsewhere it happens
+// on its own.
+GURL_API void ReleaseThreadCharsetConverters();
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_ICU_POOL_H__
@@ -0,0 +1,466 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The built-in IDNA 2003 engine: nameprep (RFC 3491) and Punycode (RFC 3492)
+// for ToASCII (RFC 3490). See url_canon_idna.h.
+
+#include "googleurl/src/url_canon_idna.h"
+
+#include "base/basictypes.h"
+#include "base/logging.h"
+#include "googleurl/src/url_canon_internal.h"
+
+namespace url_canon {
+
+// The generated tables use these types. Each table is sorted by its first
+// field so it can be binary searched.
+struct IDNAMapping {
+  uint32 code_point;
+  uint16 offset;  // Into kIDNAMappingPool.
+  uint8 length;
+};
+
+struct IDNACombiningClass {
+  uint32 first;
+  uint32 last;
+  uint8 combining_class;
+};
+
+struct IDNAComposition {
+  uint32 first;
+  uint32 second;
+  uint32 composite;
+};
+
+struct IDNARange {
+  uint32 first;
+  uint32 last;
+};
+
+}  // namespace url_canon
+
+#include "googleurl/src/url_canon_idna_tables.h"
+
+namespace url_canon {
+
+namespace {
+
+// RFC 3490 limits.
+const int kMaxLabelLength = 63;
+const int kMaxDomainLength = 255;
+
+// Algorithmic Hangul (de)composition, from the Unicode standard, section 3.12.
+const unsigned kHangulSBase = 0xAC00;
+const unsigned kHangulLBase = 0x1100;
+const unsigned kHangulVBase = 0x1161;
+const unsigned kHangulTBase = 0x11A7;
+const unsigned kHangulLCount = 19;
+const unsigned kHangulVCount = 21;
+const unsigned kHangulTCount = 28;
+const unsigned kHangulNCount = kHangulVCount * kHangulTCount;
+const unsigned kHangulSCount = kHangulLCount * kHangulNCount;
+
+// Punycode parameters, RFC 3492 section 5.
+const unsigned kPunycodeBase = 36;
+const unsigned kPunycodeTMin = 1;
+const unsigned kPunycodeTMax = 26;
+const unsigned kPunycodeSkew = 38;
+const unsigned kPunycodeDamp = 700;
+const unsigned kPunycodeInitialBias = 72;
+const unsigned kPunycodeInitialN = 0x80;
+
+// Most labels are short; longer ones just make the buffers grow.
+typedef RawCanonOutputT<unsigned, 64> CodePointBuffer;
+
+bool IsLabelSeparator(unsigned ch) {
+  // RFC 3490 section 3.1: full stop, ideographic full stop, fullwidth full
+  // stop and halfwidth ideographic full stop.
+  return ch == '.' || ch == 0x3002 || ch == 0xFF0E || ch == 0xFF61;
+}
+
+bool InRanges(const IDNARange* ranges, int count, unsigned ch) {
+  int low = 0;
+  int high = count - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (ch < ranges[mid].first)
+      high = mid - 1;
+    else if (ch > ranges[mid].last)
+      low = mid + 1;
+    else
+      return true;
+  }
+  return false;
+}
+
+int CombiningClass(unsigned ch) {
+  if (ch < 0x300)
+    return 0;  // Nothing below the combining diacritics block.
+  int low = 0;
+  int high = arraysize(kIDNACombiningClasses) - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (ch < kIDNACombiningClasses[mid].first)
+      high = mid - 1;
+    else if (ch > kIDNACombiningClasses[mid].last)
+      low = mid + 1;
+    else
+      return kIDNACombiningClasses[mid].combining_class;
+  }
+  return 0;
+}
+
+const IDNAMapping* FindMapping(unsigned ch) {
+  int low = 0;
+  int high = arraysize(kIDNAMappings) - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (ch < kIDNAMappings[mid].code_point)
+      high = mid - 1;
+    else if (ch > kIDNAMappings[mid].code_point)
+      low = mid + 1;
+    else
+      return &kIDNAMappings[mid];
+  }
+  return NULL;
+}
+
+// Returns true if |ch|, of combining class 0, can compose with the character
+// before it. This is rare enough that checking it first saves looking up
+// almost every pair of starters in kIDNACompositions.
+bool IsComposingStarter(unsigned ch) {
+  if (ch >= kHangulVBase && ch < kHangulTBase + kHangulTCount)
+    return true;  // Hangul vowel and trailing consonant jamo.
+  if (ch < kIDNAComposingStarters[0] ||
+      ch > kIDNAComposingStarters[arraysize(kIDNAComposingStarters) - 1])
+    return false;
+  for (size_t i = 0; i < arraysize(kIDNAComposingStarters); i++) {
+    if (ch == kIDNAComposingStarters[i])
+      return true;
+  }
+  return false;
+}
+
+// Returns the primary composite of the two characters, or 0 if there isn't
+// one.
+unsigned Compose(unsigned first, unsigned second) {
+  if (first >= kHangulLBase && first < kHangulLBase + kHangulLCount &&
+      second >= kHangulVBase && second < kHangulVBase + kHangulVCount) {
+    return kHangulSBase + ((first - kHangulLBase) * kHangulVCount +
+                           (second - kHangulVBase)) * kHangulTCount;
+  }
+  if (first >= kHangulSBase && first < kHangulSBase + kHangulSCount &&
+      (first - kHangulSBase) % kHangulTCount == 0 &&
+      second > kHangulTBase && second < kHangulTBase + kHangulTCount) {
+    return first + (second - kHangulTBase);
+  }
+
+  int low = 0;
+  int high = arraysize(kIDNACompositions) - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    const IDNAComposition& entry = kIDNACompositions[mid];
+    if (first < entry.first || (first == entry.first && second < entry.second))
+      high = mid - 1;
+    else if (first > entry.first || second > entry.second)
+      low = mid + 1;
+    else
+      return entry.composite;
+  }
+  return 0;
+}
+
+// Nameprep steps 1 and 2: maps the label (table B.1 to nothing, B.2 case
+// folding) and normalizes the result to NFKC.
+void MapAndNormalize(const unsigned* label, int label_len,
+                     CodePointBuffer* output) {
+  // Map and fully decompose. The tables hold the decomposition of each
+  // mapping, so this is a single lookup per character.
+  for (int i = 0; i < label_len; i++) {
+    unsigned ch = label[i];
+    if (ch >= kHangulSBase && ch < kHangulSBase + kHangulSCount) {
+      unsigned index = ch - kHangulSBase;
+      output->push_back(kHangulLBase + index / kHangulNCount);
+      output->push_back(kHangulVBase + (index % kHangulNCount) / kHangulTCount);
+      if (index % kHangulTCount)
+        output->push_back(kHangulTBase + index % kHangulTCount);
+      continue;
+    }
+    const IDNAMapping* mapping = FindMapping(ch);
+    if (!mapping) {
+      output->push_back(ch);
+      continue;
+    }
+    for (int j = 0; j < mapping->length; j++)
+      output->push_back(kIDNAMappingPool[mapping->offset + j]);
+  }
+
+  // Canonical ordering: sort each run of combining marks by class, keeping
+  // marks of the same class in order. The runs are almost always one or two
+  // long so an insertion sort is the fastest choice.
+  unsigned* buf = output->data();
+  int len = output->length();
+  for (int i = 1; i < len; i++) {
+    int cc = CombiningClass(buf[i]);
+    if (cc == 0)
+      continue;
+    unsigned ch = buf[i];
+    int j = i;
+    while (j > 0 && CombiningClass(buf[j - 1]) > cc) {
+      buf[j] = buf[j - 1];
+      j--;
+    }
+    buf[j] = ch;
+  }
+
+  // Canonical composition (UAX #15): each character combines with the last
+  // starter unless something of the same or higher class is in between.
+  if (len == 0)
+    return;
+  int starter_pos = 0;
+  unsigned starter = buf[0];
+  int last_class = CombiningClass(starter) ? 256 : 0;
+  int composed_len = 1;
+  for (int i = 1; i < len; i++) {
+    unsigned ch = buf[i];
+    int cc = CombiningClass(ch);
+    unsigned composite = 0;
+    if (cc != 0 || IsComposingStarter(ch))
+      composite = Compose(starter, ch);
+    if (composite && (last_class < cc || last_class == 0)) {
+      buf[starter_pos] = composite;
+      starter = composite;
+      continue;
+    }
+    if (cc == 0) {
+      starter_pos = composed_len;
+      starter = ch;
+    }
+    last_class = cc;
+    buf[composed_len++] = ch;
+  }
+  output->set_length(composed_len);
+}
+
+// Nameprep steps 3 and 4: rejects prohibited output and labels that break
+// the bidi rules of RFC 3454 section 6.
+bool CheckPrepared(const unsigned* label, int label_len) {
+  bool has_rand_al = false;
+  for (int i = 0; i < label_len; i++) {
+    unsigned ch = label[i];
+    if (InRanges(kIDNAProhibited, arraysize(kIDNAProhibited), ch))
+      return false;
+    if (InRanges(kIDNARandAL, arraysize(kIDNARandAL), ch))
+      has_rand_al = true;
+  }
+  if (!has_rand_al)
+    return true;  // Only right-to-left labels have more rules.
+
+  if (!InRanges(kIDNARandAL, arraysize(kIDNARandAL), label[0]) ||
+      !InRanges(kIDNARandAL, arraysize(kIDNARandAL), label[label_len - 1]))
+    return false;
+  for (int i = 0; i < label_len; i++) {
+    if (InRanges(kIDNAL, arraysize(kIDNAL), label[i]))
+      return false;
+  }
+  return true;
+}
+
+bool IsASCII(const unsigned* label, int label_len) {
+  for (int i = 0; i < label_len; i++) {
+    if (label[i] >= 0x80)
+      return false;
+  }
+  return true;
+}
+
+bool HasACEPrefix(const unsigned* label, int label_len) {
+  return label_len >= 4 &&
+      (label[0] | 0x20) == 'x' && (label[1] | 0x20) == 'n' &&
+      label[2] == '-' && label[3] == '-';
+}
+
+char EncodeDigit(unsigned digit) {
+  // 0..25 are 'a'..'z', 26..35 are '0'..'9'.
+  return static_cast<char>(digit < 26 ? 'a' + digit : '0' + digit - 26);
+}
+
+unsigned AdaptBias(unsigned delta, unsigned num_points, bool first_time) {
+  delta = first_time ? delta / kPunycodeDamp : delta / 2;
+  delta += delta / num_points;
+  unsigned k = 0;
+  while (delta > ((kPunycodeBase - kPunycodeTMin) * kPunycodeTMax) / 2) {
+    delta /= kPunycodeBase - kPunycodeTMin;
+    k += kPunycodeBase;
+  }
+  return k + (kPunycodeBase - kPunycodeTMin + 1) * delta /
+      (delta + kPunycodeSkew);
+}
+
+// Punycode-encodes |label|, RFC 3492 section 6.3. Returns false on overflow,
+// which can't happen for labels that fit the length limit anyway.
+template<typename OUTCHAR>
+bool PunycodeEncode(const unsigned* label, int label_len,
+                    CanonOutputT<OUTCHAR>* output) {
+  unsigned basic_count = 0;
+  for (int i = 0; i < label_len; i++) {
+    if (label[i] < 0x80) {
+      output->push_back(static_cast<OUTCHAR>(label[i]));
+      basic_count++;
+    }
+  }
+  if (basic_count > 0)
+    output->push_back('-');
+
+  unsigned n = kPunycodeInitialN;
+  unsigned delta = 0;
+  unsigned bias = kPunycodeInitialBias;
+  unsigned handled = basic_count;
+  const unsigned kMaxUnsigned = static_cast<unsigned>(-1);
+  while (handled < static_cast<unsigned>(label_len)) {
+    // The next code point to insert is the smallest one not yet handled.
+    unsigned m = kMaxUnsigned;
+    for (int i = 0; i < label_len; i++) {
+      if (label[i] >= n && label[i] < m)
+        m = label[i];
+    }
+    if (m - n > (kMaxUnsigned - delta) / (handled + 1))
+      return false;
+    delta += (m - n) * (handled + 1);
+    n = m;
+
+    for (int i = 0; i < label_len; i++) {
+      if (label[i] < n && ++delta == 0)
+        return false;
+      if (label[i] != n)
+        continue;
+      unsigned q = delta;
+      for (unsigned k = kPunycodeBase; ; k += kPunycodeBase) {
+        unsigned t = k <= bias ? kPunycodeTMin :
+            (k >= bias + kPunycodeTMax ? kPunycodeTMax : k - bias);
+        if (q < t)
+          break;
+        output->push_back(EncodeDigit(t + (q - t) % (kPunycodeBase - t)));
+        q = (q - t) / (kPunycodeBase - t);
+      }
+      output->push_back(EncodeDigit(q));
+      bias = AdaptBias(delta, handled + 1, handled == basic_count);
+      delta = 0;
+      handled++;
+    }
+    delta++;
+    n++;
+  }
+  return true;
+}
+
+// Appends the ToASCII form of one label to |output|.
+template<typename OUTCHAR>
+bool LabelToASCII(const unsigned* label, int label_len,
+                  CanonOutputT<OUTCHAR>* output) {
+  int begin = output->length();
+  if (IsASCII(label, label_len)) {
+    // ASCII labels skip nameprep (RFC 3490 section 4.1, step 2).
+    for (int i = 0; i < label_len; i++)
+      output->push_back(static_cast<OUTCHAR>(label[i]));
+  } else {
+    CodePointBuffer prepared;
+    MapAndNormalize(label, label_len, &prepared);
+    if (prepared.length() == 0 ||
+        !CheckPrepared(prepared.data(), prepared.length()))
+      return false;
+
+    if (IsASCII(prepared.data(), prepared.length())) {
+      for (int i = 0; i < prepared.length(); i++)
+        output->push_back(static_cast<OUTCHAR>(prepared.data()[i]));
+    } else {
+      if (HasACEPrefix(prepared.data(), prepared.length()))
+        return false;
+      output->push_back('x');
+      output->push_back('n');
+      output->push_back('-');
+      output->push_back('-');
+      if (!PunycodeEncode(prepared.data(), prepared.length(), output))
+        return false;
+    }
+  }
+  int length = output->length() - begin;
+  return length > 0 && length <= kMaxLabelLength;
+}
+
+template<typename INCHAR, typename OUTCHAR>
+bool DoIDNToASCII(const INCHAR* src, int src_len,
+                  CanonOutputT<OUTCHAR>* output) {
+  DCHECK(output->length() == 0);  // Output buffer is assumed empty.
+
+  CodePointBuffer label;
+  for (int i = 0; i < src_len; i++) {
+    // ASCII is by far the most common, so only decode anything else.
+    unsigned code_point = static_cast<unsigned>(src[i]);
+    if (code_point >= 0x80 && !ReadUTFChar(src, &i, src_len, &code_point))
+      return false;
+    if (!IsLabelSeparator(code_point)) {
+      label.push_back(code_point);
+      continue;
+    }
+    if (!LabelToASCII(label.data(), label.length(), output))
+      return false;
+    output->push_back('.');
+    label.set_length(0);
+  }
+
+  // A trailing dot leaves an empty last label; that's the root, which is
+  // allowed.
+  if (label.length() > 0 || output->length() == 0) {
+    if (!LabelToASCII(label.data(), label.length(), output))
+      return false;
+  }
+  return output->length() <= kMaxDomainLength;
+}
+
+}  // namespace
+
+bool BuiltInIDNToASCII(const char16* src, int src_len, CanonOutputW* output) {
+  return DoIDNToASCII(src, src_len, output);
+}
+
+bool BuiltInIDNToASCII(const char* src, int src_len, CanonOutput* output) {
+  return DoIDNToASCII(src, src_len, output);
+}
+
+#if !defined(GURL_USE_ICU_IDNA)
+
+// Declared in url_canon.h. url_canon_icu.cc has the ICU version.
+bool IDNToASCII(const char16* src, int src_len, CanonOutputW* output) {
+  return BuiltInIDNToASCII(src, src_len, output);
+}
+
+#endif  // !defined(GURL_USE_ICU_IDNA)
+
+}  // namespace url_canon
@@ -0,0 +1,62 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The library's own implementation of IDNA 2003 ToASCII (RFC 3490): each
+// label is prepared with the nameprep profile of stringprep (RFC 3491) and
+// encoded with Punycode (RFC 3492). Unassigned code points are allowed, like
+// ICU's UIDNA_ALLOW_UNASSIGNED, and the STD3 ASCII rules are not applied.
+//
+// Unless the library is built with GURL_USE_ICU_IDNA, IDNToASCII uses this
+// instead of ICU's uidna_IDNToASCII, so the IDN path doesn't need ICU's data
+// at all.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_IDNA_H__
+#define GOOGLEURL_SRC_URL_CANON_IDNA_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_canon {
+
+// Converts the host name |src| to ASCII, writing it to the empty |output|.
+// Returns false if the input isn't valid UTF-16 or some label can't be
+// converted, in which case the output is undefined. This is what IDNToASCII
+// does when the built-in engine is enabled.
+GURL_API bool BuiltInIDNToASCII(const char16* src, int src_len,
+                                CanonOutputW* output);
+
+// The same for UTF-8 input, writing 8-bit output. This lets the host
+// canonicalizer skip converting UTF-8 hosts to UTF-16 first.
+GURL_API bool BuiltInIDNToASCII(const char* src, int src_len,
+                                CanonOutput* output);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_IDNA_H__
@@ -0,0 +1,7819 @@
+// Generated by gen_url_canon_idna_tables.py from Unicode 3.2.0.
+// Do not edit.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__
+#define GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__
+
+namespace url_canon {
+
+// Nameprep mapping followed by compatibility decomposition, for
+// every code point where that changes anything.
+const uint32 kIDNAMappingPool[] = {
+  0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+  0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+  0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+  0x0079, 0x007A, 0x0020, 0x0020, 0x0308, 0x0020, 0x0304, 0x0032,
+  0x0033, 0x0020, 0x0301, 0x03BC, 0x0020, 0x0327, 0x0031, 0x0031,
+  0x2044, 0x0034, 0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034,
+  0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302, 0x0061, 0x0303,
+  0x0061, 0x0308, 0x0061, 0x030A, 0x00E6, 0x0063, 0x0327, 0x0065,
+  0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065, 0x0308, 0x0069,
+  0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308, 0x00F0,
+  0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301, 0x006F, 0x0302,
+  0x006F, 0x0303, 0x006F, 0x0308, 0x00F8, 0x0075, 0x0300, 0x0075,
+  0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301, 0x00FE,
+  0x0073, 0x0073, 0x0079, 0x0308, 0x0061, 0x0304, 0x0061, 0x0306,
+  0x0061, 0x0328, 0x0063, 0x0301, 0x0063, 0x0302, 0x0063, 0x0307,
+  0x0063, 0x030C, 0x0064, 0x030C, 0x0111, 0x0065, 0x0304, 0x0065,
+  0x0306, 0x0065, 0x0307, 0x0065, 0x0328, 0x0065, 0x030C, 0x0067,
+  0x0302, 0x0067, 0x0306, 0x0067, 0x0307, 0x0067, 0x0327, 0x0068,
+  0x0302, 0x0127, 0x0069, 0x0303, 0x0069, 0x0304, 0x0069, 0x0306,
+  0x0069, 0x0328, 0x0069, 0x0307, 0x0069, 0x006A, 0x006A, 0x0302,
+  0x006B, 0x0327, 0x006C, 0x0301, 0x006C, 0x0327, 0x006C, 0x030C,
+  0x006C, 0x00B7, 0x0142, 0x006E, 0x0301, 0x006E, 0x0327, 0x006E,
+  0x030C, 0x02BC, 0x006E, 0x014B, 0x006F, 0x0304, 0x006F, 0x0306,
+  0x006F, 0x030B, 0x0153, 0x0072, 0x0301, 0x0072, 0x0327, 0x0072,
+  0x030C, 0x0073, 0x0301, 0x0073, 0x0302, 0x0073, 0x0327, 0x0073,
+  0x030C, 0x0074, 0x0327, 0x0074, 0x030C, 0x0167, 0x0075, 0x0303,
+  0x0075, 0x0304, 0x0075, 0x0306, 0x0075, 0x030A, 0x0075, 0x030B,
+  0x0075, 0x0328, 0x0077, 0x0302, 0x0079, 0x0302, 0x007A, 0x0301,
+  0x007A, 0x0307, 0x007A, 0x030C, 0x0253, 0x0183, 0x0185, 0x0254,
+  0x0188, 0x0256, 0x0257, 0x018C, 0x01DD, 0x0259, 0x025B, 0x0192,
+  0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026F, 0x0272, 0x0275,
+  0x006F, 0x031B, 0x01A3, 0x01A5, 0x0280, 0x01A8, 0x0283, 0x01AD,
+  0x0288, 0x0075, 0x031B, 0x028A, 0x028B, 0x01B4, 0x01B6, 0x0292,
+  0x01B9, 0x01BD, 0x0064, 0x007A, 0x030C, 0x006C, 0x006A, 0x006E,
+  0x006A, 0x0061, 0x030C, 0x0069, 0x030C, 0x006F, 0x030C, 0x0075,
+  0x030C, 0x0075, 0x0308, 0x0304, 0x0075, 0x0308, 0x0301, 0x0075,
+  0x0308, 0x030C, 0x0075, 0x0308, 0x0300, 0x0061, 0x0308, 0x0304,
+  0x0061, 0x0307, 0x0304, 0x00E6, 0x0304, 0x01E5, 0x0067, 0x030C,
+  0x006B, 0x030C, 0x006F, 0x0328, 0x006F, 0x0328, 0x0304, 0x0292,
+  0x030C, 0x006A, 0x030C, 0x0064, 0x007A, 0x0067, 0x0301, 0x0195,
+  0x01BF, 0x006E, 0x0300, 0x0061, 0x030A, 0x0301, 0x00E6, 0x0301,
+  0x00F8, 0x0301, 0x0061, 0x030F, 0x0061, 0x0311, 0x0065, 0x030F,
+  0x0065, 0x0311, 0x0069, 0x030F, 0x0069, 0x0311, 0x006F, 0x030F,
+  0x006F, 0x0311, 0x0072, 0x030F, 0x0072, 0x0311, 0x0075, 0x030F,
+  0x0075, 0x0311, 0x0073, 0x0326, 0x0074, 0x0326, 0x021D, 0x0068,
+  0x030C, 0x019E, 0x0223, 0x0225, 0x0061, 0x0307, 0x0065, 0x0327,
+  0x006F, 0x0308, 0x0304, 0x006F, 0x0303, 0x0304, 0x006F, 0x0307,
+  0x006F, 0x0307, 0x0304, 0x0079, 0x0304, 0x0266, 0x0279, 0x027B,
+  0x0281, 0x0020, 0x0306, 0x0020, 0x0307, 0x0020, 0x030A, 0x0020,
+  0x0328, 0x0020, 0x0303, 0x0020, 0x030B, 0x0295, 0x0300, 0x0301,
+  0x0313, 0x0308, 0x0301, 0x03B9, 0x02B9, 0x0020, 0x03B9, 0x003B,
+  0x0020, 0x0308, 0x0301, 0x03B1, 0x0301, 0x00B7, 0x03B5, 0x0301,
+  0x03B7, 0x0301, 0x03B9, 0x0301, 0x03BF, 0x0301, 0x03C5, 0x0301,
+  0x03C9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x03B1, 0x03B2, 0x03B3,
+  0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03BA, 0x03BB, 0x03BD,
+  0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
+  0x03C7, 0x03C8, 0x03C9, 0x03B9, 0x0308, 0x03C5, 0x0308, 0x03C5,
+  0x0308, 0x0301, 0x03D9, 0x03DB, 0x03DD, 0x03DF, 0x03E1, 0x03E3,
+  0x03E5, 0x03E7, 0x03E9, 0x03EB, 0x03ED, 0x03EF, 0x0435, 0x0300,
+  0x0435, 0x0308, 0x0452, 0x0433, 0x0301, 0x0454, 0x0455, 0x0456,
+  0x0456, 0x0308, 0x0458, 0x0459, 0x045A, 0x045B, 0x043A, 0x0301,
+  0x0438, 0x0300, 0x0443, 0x0306, 0x045F, 0x0430, 0x0431, 0x0432,
+  0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0438, 0x0306,
+  0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441,
+  0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449,
+  0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0461, 0x0463,
+  0x0465, 0x0467, 0x0469, 0x046B, 0x046D, 0x046F, 0x0471, 0x0473,
+  0x0475, 0x0475, 0x030F, 0x0479, 0x047B, 0x047D, 0x047F, 0x0481,
+  0x048B, 0x048D, 0x048F, 0x0491, 0x0493, 0x0495, 0x0497, 0x0499,
+  0x049B, 0x049D, 0x049F, 0x04A1, 0x04A3, 0x04A5, 0x04A7, 0x04A9,
+  0x04AB, 0x04AD, 0x04AF, 0x04B1, 0x04B3, 0x04B5, 0x04B7, 0x04B9,
+  0x04BB, 0x04BD, 0x04BF, 0x0436, 0x0306, 0x04C4, 0x04C6, 0x04C8,
+  0x04CA, 0x04CC, 0x04CE, 0x0430, 0x0306, 0x0430, 0x0308, 0x04D5,
+  0x0435, 0x0306, 0x04D9, 0x04D9, 0x0308, 0x0436, 0x0308, 0x0437,
+  0x0308, 0x04E1, 0x0438, 0x0304, 0x0438, 0x0308, 0x043E, 0x0308,
+  0x04E9, 0x04E9, 0x0308, 0x044D, 0x0308, 0x0443, 0x0304, 0x0443,
+  0x0308, 0x0443, 0x030B, 0x0447, 0x0308, 0x044B, 0x0308, 0x0501,
+  0x0503, 0x0505, 0x0507, 0x0509, 0x050B, 0x050D, 0x050F, 0x0561,
+  0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569,
+  0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571,
+  0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579,
+  0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581,
+  0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0565, 0x0582, 0x0627,
+  0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A,
+  0x0654, 0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A,
+  0x0674, 0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928,
+  0x093C, 0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916,
+  0x093C, 0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922,
+  0x093C, 0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7,
+  0x09D7, 0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32,
+  0x0A3C, 0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C,
+  0x0A3C, 0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47,
+  0x0B57, 0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6,
+  0x0BBE, 0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF,
+  0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6,
+  0x0CC2, 0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57,
+  0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9,
+  0x0DDF, 0x0E4D, 0x0E32, 0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB,
+  0x0EA1, 0x0F0B, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7,
+  0x0F56, 0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72,
+  0x0F71, 0x0F74, 0x0FB2, 0x0F80, 0x0FB2, 0x0F71, 0x0F80, 0x0FB3,
+  0x0F80, 0x0FB3, 0x0F71, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+  0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7,
+  0x0F90, 0x0FB5, 0x1025, 0x102E, 0x0061, 0x0325, 0x0062, 0x0307,
+  0x0062, 0x0323, 0x0062, 0x0331, 0x0063, 0x0327, 0x0301, 0x0064,
+  0x0307, 0x0064, 0x0323, 0x0064, 0x0331, 0x0064, 0x0327, 0x0064,
+  0x032D, 0x0065, 0x0304, 0x0300, 0x0065, 0x0304, 0x0301, 0x0065,
+  0x032D, 0x0065, 0x0330, 0x0065, 0x0327, 0x0306, 0x0066, 0x0307,
+  0x0067, 0x0304, 0x0068, 0x0307, 0x0068, 0x0323, 0x0068, 0x0308,
+  0x0068, 0x0327, 0x0068, 0x032E, 0x0069, 0x0330, 0x0069, 0x0308,
+  0x0301, 0x006B, 0x0301, 0x006B, 0x0323, 0x006B, 0x0331, 0x006C,
+  0x0323, 0x006C, 0x0323, 0x0304, 0x006C, 0x0331, 0x006C, 0x032D,
+  0x006D, 0x0301, 0x006D, 0x0307, 0x006D, 0x0323, 0x006E, 0x0307,
+  0x006E, 0x0323, 0x006E, 0x0331, 0x006E, 0x032D, 0x006F, 0x0303,
+  0x0301, 0x006F, 0x0303, 0x0308, 0x006F, 0x0304, 0x0300, 0x006F,
+  0x0304, 0x0301, 0x0070, 0x0301, 0x0070, 0x0307, 0x0072, 0x0307,
+  0x0072, 0x0323, 0x0072, 0x0323, 0x0304, 0x0072, 0x0331, 0x0073,
+  0x0307, 0x0073, 0x0323, 0x0073, 0x0301, 0x0307, 0x0073, 0x030C,
+  0x0307, 0x0073, 0x0323, 0x0307, 0x0074, 0x0307, 0x0074, 0x0323,
+  0x0074, 0x0331, 0x0074, 0x032D, 0x0075, 0x0324, 0x0075, 0x0330,
+  0x0075, 0x032D, 0x0075, 0x0303, 0x0301, 0x0075, 0x0304, 0x0308,
+  0x0076, 0x0303, 0x0076, 0x0323, 0x0077, 0x0300, 0x0077, 0x0301,
+  0x0077, 0x0308, 0x0077, 0x0307, 0x0077, 0x0323, 0x0078, 0x0307,
+  0x0078, 0x0308, 0x0079, 0x0307, 0x007A, 0x0302, 0x007A, 0x0323,
+  0x007A, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A,
+  0x0079, 0x030A, 0x0061, 0x02BE, 0x0061, 0x0323, 0x0061, 0x0309,
+  0x0061, 0x0302, 0x0301, 0x0061, 0x0302, 0x0300, 0x0061, 0x0302,
+  0x0309, 0x0061, 0x0302, 0x0303, 0x0061, 0x0323, 0x0302, 0x0061,
+  0x0306, 0x0301, 0x0061, 0x0306, 0x0300, 0x0061, 0x0306, 0x0309,
+  0x0061, 0x0306, 0x0303, 0x0061, 0x0323, 0x0306, 0x0065, 0x0323,
+  0x0065, 0x0309, 0x0065, 0x0303, 0x0065, 0x0302, 0x0301, 0x0065,
+  0x0302, 0x0300, 0x0065, 0x0302, 0x0309, 0x0065, 0x0302, 0x0303,
+  0x0065, 0x0323, 0x0302, 0x0069, 0x0309, 0x0069, 0x0323, 0x006F,
+  0x0323, 0x006F, 0x0309, 0x006F, 0x0302, 0x0301, 0x006F, 0x0302,
+  0x0300, 0x006F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0303, 0x006F,
+  0x0323, 0x0302, 0x006F, 0x031B, 0x0301, 0x006F, 0x031B, 0x0300,
+  0x006F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0303, 0x006F, 0x031B,
+  0x0323, 0x0075, 0x0323, 0x0075, 0x0309, 0x0075, 0x031B, 0x0301,
+  0x0075, 0x031B, 0x0300, 0x0075, 0x031B, 0x0309, 0x0075, 0x031B,
+  0x0303, 0x0075, 0x031B, 0x0323, 0x0079, 0x0300, 0x0079, 0x0323,
+  0x0079, 0x0309, 0x0079, 0x0303, 0x03B1, 0x0313, 0x03B1, 0x0314,
+  0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313,
+  0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1,
+  0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5, 0x0313,
+  0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5,
+  0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7, 0x0313,
+  0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7,
+  0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314, 0x0342,
+  0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+  0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+  0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x03BF, 0x0313,
+  0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300,
+  0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x03C5, 0x0313,
+  0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300,
+  0x03C5, 0x0313, 0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313,
+  0x0342, 0x03C5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314,
+  0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313,
+  0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9,
+  0x0314, 0x0342, 0x03B1, 0x0300, 0x03B5, 0x0300, 0x03B7, 0x0300,
+  0x03B9, 0x0300, 0x03BF, 0x0300, 0x03C5, 0x0300, 0x03C9, 0x0300,
+  0x03B1, 0x0313, 0x03B9, 0x03B1, 0x0314, 0x03B9, 0x03B1, 0x0313,
+  0x0300, 0x03B9, 0x03B1, 0x0314, 0x0300, 0x03B9, 0x03B1, 0x0313,
+  0x0301, 0x03B9, 0x03B1, 0x0314, 0x0301, 0x03B9, 0x03B1, 0x0313,
+  0x0342, 0x03B9, 0x03B1, 0x0314, 0x0342, 0x03B9, 0x03B7, 0x0313,
+  0x03B9, 0x03B7, 0x0314, 0x03B9, 0x03B7, 0x0313, 0x0300, 0x03B9,
+  0x03B7, 0x0314, 0x0300, 0x03B9, 0x03B7, 0x0313, 0x0301, 0x03B9,
+  0x03B7, 0x0314, 0x0301, 0x03B9, 0x03B7, 0x0313, 0x0342, 0x03B9,
+  0x03B7, 0x0314, 0x0342, 0x03B9, 0x03C9, 0x0313, 0x03B9, 0x03C9,
+  0x0314, 0x03B9, 0x03C9, 0x0313, 0x0300, 0x03B9, 0x03C9, 0x0314,
+  0x0300, 0x03B9, 0x03C9, 0x0313, 0x0301, 0x03B9, 0x03C9, 0x0314,
+  0x0301, 0x03B9, 0x03C9, 0x0313, 0x0342, 0x03B9, 0x03C9, 0x0314,
+  0x0342, 0x03B9, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300,
+  0x03B9, 0x03B1, 0x03B9, 0x03B1, 0x0301, 0x03B9, 0x03B1, 0x0342,
+  0x03B1, 0x0342, 0x03B9, 0x0020, 0x0313, 0x0020, 0x0342, 0x0020,
+  0x0308, 0x0342, 0x03B7, 0x0300, 0x03B9, 0x03B7, 0x03B9, 0x03B7,
+  0x0301, 0x03B9, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x03B9, 0x0020,
+  0x0313, 0x0300, 0x0020, 0x0313, 0x0301, 0x0020, 0x0313, 0x0342,
+  0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9,
+  0x0342, 0x03B9, 0x0308, 0x0342, 0x0020, 0x0314, 0x0300, 0x0020,
+  0x0314, 0x0301, 0x0020, 0x0314, 0x0342, 0x03C5, 0x0306, 0x03C5,
+  0x0304, 0x03C5, 0x0308, 0x0300, 0x03C1, 0x0313, 0x03C1, 0x0314,
+  0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x0020, 0x0308, 0x0300,
+  0x0060, 0x03C9, 0x0300, 0x03B9, 0x03C9, 0x03B9, 0x03C9, 0x0301,
+  0x03B9, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x03B9, 0x0020, 0x0314,
+  0x2010, 0x0020, 0x0333, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E,
+  0x002E, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035,
+  0x2035, 0x2035, 0x2035, 0x0021, 0x0021, 0x0020, 0x0305, 0x003F,
+  0x003F, 0x003F, 0x0021, 0x0021, 0x003F, 0x2032, 0x2032, 0x2032,
+  0x2032, 0x0030, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+  0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x0072, 0x0073, 0x0061,
+  0x002F, 0x0063, 0x0061, 0x002F, 0x0073, 0x00B0, 0x0063, 0x0063,
+  0x002F, 0x006F, 0x0063, 0x002F, 0x0075, 0x00B0, 0x0066, 0x006E,
+  0x006F, 0x0073, 0x006D, 0x0074, 0x0065, 0x006C, 0x0074, 0x006D,
+  0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x2211, 0x0031, 0x2044, 0x0033,
+  0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044,
+  0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035, 0x0031,
+  0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038,
+  0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038, 0x0037, 0x2044,
+  0x0038, 0x0031, 0x2044, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069,
+  0x0069, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076,
+  0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0069, 0x0078,
+  0x0069, 0x0069, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338,
+  0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338,
+  0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338,
+  0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E, 0x222E,
+  0x222E, 0x222E, 0x223C, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338,
+  0x2248, 0x0338, 0x003D, 0x0338, 0x2261, 0x0338, 0x224D, 0x0338,
+  0x003C, 0x0338, 0x003E, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338,
+  0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338,
+  0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338, 0x2283, 0x0338,
+  0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338,
+  0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338, 0x227D, 0x0338,
+  0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338,
+  0x22B4, 0x0338, 0x22B5, 0x0338, 0x3008, 0x3009, 0x0031, 0x0030,
+  0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034,
+  0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038,
+  0x0031, 0x0039, 0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028,
+  0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028, 0x0034, 0x0029,
+  0x0028, 0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037,
+  0x0029, 0x0028, 0x0038, 0x0029, 0x0028, 0x0039, 0x0029, 0x0028,
+  0x0031, 0x0030, 0x0029, 0x0028, 0x0031, 0x0031, 0x0029, 0x0028,
+  0x0031, 0x0032, 0x0029, 0x0028, 0x0031, 0x0033, 0x0029, 0x0028,
+  0x0031, 0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028,
+  0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029, 0x0028,
+  0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028,
+  0x0032, 0x0030, 0x0029, 0x0031, 0x002E, 0x0032, 0x002E, 0x0033,
+  0x002E, 0x0034, 0x002E, 0x0035, 0x002E, 0x0036, 0x002E, 0x0037,
+  0x002E, 0x0038, 0x002E, 0x0039, 0x002E, 0x0031, 0x0030, 0x002E,
+  0x0031, 0x0031, 0x002E, 0x0031, 0x0032, 0x002E, 0x0031, 0x0033,
+  0x002E, 0x0031, 0x0034, 0x002E, 0x0031, 0x0035, 0x002E, 0x0031,
+  0x0036, 0x002E, 0x0031, 0x0037, 0x002E, 0x0031, 0x0038, 0x002E,
+  0x0031, 0x0039, 0x002E, 0x0032, 0x0030, 0x002E, 0x0028, 0x0061,
+  0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028,
+  0x0064, 0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029,
+  0x0028, 0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069,
+  0x0029, 0x0028, 0x006A, 0x0029, 0x0028, 0x006B, 0x0029, 0x0028,
+  0x006C, 0x0029, 0x0028, 0x006D, 0x0029, 0x0028, 0x006E, 0x0029,
+  0x0028, 0x006F, 0x0029, 0x0028, 0x0070, 0x0029, 0x0028, 0x0071,
+  0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028,
+  0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076, 0x0029,
+  0x0028, 0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079,
+  0x0029, 0x0028, 0x007A, 0x0029, 0x222B, 0x222B, 0x222B, 0x222B,
+  0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
+  0x2ADD, 0x0338, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F,
+  0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B,
+  0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9,
+  0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6,
+  0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A, 0x5915,
+  0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38,
+  0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A,
+  0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73,
+  0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534, 0x6587, 0x6597,
+  0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20,
+  0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14,
+  0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259,
+  0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F,
+  0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF,
+  0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74,
+  0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD,
+  0x8001, 0x800C, 0x8012, 0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA,
+  0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278,
+  0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2,
+  0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70,
+  0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149,
+  0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9,
+  0x96E8, 0x9751, 0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3,
+  0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8,
+  0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5,
+  0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9,
+  0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D,
+  0x9F9C, 0x9FA0, 0x3012, 0x5344, 0x5345, 0x304B, 0x3099, 0x304D,
+  0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+  0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+  0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+  0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+  0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+  0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+  0x3099, 0x0020, 0x3099, 0x0020, 0x309A, 0x309D, 0x3099, 0x3088,
+  0x308A, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1,
+  0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9,
+  0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1,
+  0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF,
+  0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5,
+  0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB,
+  0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0,
+  0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3,
+  0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103,
+  0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5,
+  0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+  0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161,
+  0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+  0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171,
+  0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7,
+  0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD,
+  0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129,
+  0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140,
+  0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184,
+  0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E09,
+  0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E19, 0x4E01, 0x5929,
+  0x5730, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029, 0x0028,
+  0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029,
+  0x0028, 0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110B,
+  0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E, 0x0029, 0x0028,
+  0x110F, 0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029,
+  0x0028, 0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028,
+  0x1102, 0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029, 0x0028,
+  0x1105, 0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028,
+  0x1107, 0x1161, 0x0029, 0x0028, 0x1109, 0x1161, 0x0029, 0x0028,
+  0x110B, 0x1161, 0x0029, 0x0028, 0x110C, 0x1161, 0x0029, 0x0028,
+  0x110E, 0x1161, 0x0029, 0x0028, 0x110F, 0x1161, 0x0029, 0x0028,
+  0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028,
+  0x1112, 0x1161, 0x0029, 0x0028, 0x110C, 0x116E, 0x0029, 0x0028,
+  0x4E00, 0x0029, 0x0028, 0x4E8C, 0x0029, 0x0028, 0x4E09, 0x0029,
+  0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029, 0x0028, 0x516D,
+  0x0029, 0x0028, 0x4E03, 0x0029, 0x0028, 0x516B, 0x0029, 0x0028,
+  0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028, 0x6708, 0x0029,
+  0x0028, 0x706B, 0x0029, 0x0028, 0x6C34, 0x0029, 0x0028, 0x6728,
+  0x0029, 0x0028, 0x91D1, 0x0029, 0x0028, 0x571F, 0x0029, 0x0028,
+  0x65E5, 0x0029, 0x0028, 0x682A, 0x0029, 0x0028, 0x6709, 0x0029,
+  0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029, 0x0028, 0x7279,
+  0x0029, 0x0028, 0x8CA1, 0x0029, 0x0028, 0x795D, 0x0029, 0x0028,
+  0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029, 0x0028, 0x547C, 0x0029,
+  0x0028, 0x5B66, 0x0029, 0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01,
+  0x0029, 0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028,
+  0x796D, 0x0029, 0x0028, 0x4F11, 0x0029, 0x0028, 0x81EA, 0x0029,
+  0x0028, 0x81F3, 0x0029, 0x0032, 0x0031, 0x0032, 0x0032, 0x0032,
+  0x0033, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032,
+  0x0037, 0x0032, 0x0038, 0x0032, 0x0039, 0x0033, 0x0030, 0x0033,
+  0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033,
+  0x0035, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105,
+  0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B,
+  0x1161, 0x110C, 0x1161, 0x110E, 0x1161, 0x110F, 0x1161, 0x1110,
+  0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x4E94, 0x516D, 0x4E03,
+  0x4E5D, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D,
+  0x52B4, 0x79D8, 0x7537, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805,
+  0x4F11, 0x5199, 0x6B63, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66,
+  0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x0033, 0x0036, 0x0033,
+  0x0037, 0x0033, 0x0038, 0x0033, 0x0039, 0x0034, 0x0030, 0x0034,
+  0x0031, 0x0034, 0x0032, 0x0034, 0x0033, 0x0034, 0x0034, 0x0034,
+  0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038, 0x0034,
+  0x0039, 0x0035, 0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033,
+  0x6708, 0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037,
+  0x6708, 0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708,
+  0x0031, 0x0031, 0x6708, 0x0031, 0x0032, 0x6708, 0x30A2, 0x30A4,
+  0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3,
+  0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4,
+  0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF,
+  0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1,
+  0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC,
+  0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x30A2, 0x30CF, 0x309A,
+  0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3,
+  0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB,
+  0x30F3, 0x30AF, 0x3099, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9,
+  0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8,
+  0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC,
+  0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8,
+  0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AB, 0x3099, 0x30ED, 0x30F3,
+  0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099,
+  0x30AD, 0x3099, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC,
+  0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED,
+  0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED,
+  0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3,
+  0x30C8, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AF, 0x3099, 0x30E9,
+  0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4,
+  0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9,
+  0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5,
+  0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0,
+  0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1,
+  0x30BB, 0x30F3, 0x30C8, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x30C6,
+  0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA,
+  0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF,
+  0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC,
+  0x30C4, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A,
+  0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB,
+  0x30D2, 0x309A, 0x30B3, 0x30D2, 0x3099, 0x30EB, 0x30D5, 0x30A1,
+  0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8,
+  0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9,
+  0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A,
+  0x30BD, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4,
+  0x30D8, 0x309A, 0x30F3, 0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7,
+  0x3099, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x30DB, 0x309A, 0x30A4,
+  0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3,
+  0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB,
+  0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE,
+  0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF,
+  0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED,
+  0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC,
+  0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8,
+  0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8,
+  0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA,
+  0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A,
+  0x30FC, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0,
+  0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3, 0x30EF, 0x30C3,
+  0x30C8, 0x0030, 0x70B9, 0x0031, 0x70B9, 0x0032, 0x70B9, 0x0033,
+  0x70B9, 0x0034, 0x70B9, 0x0035, 0x70B9, 0x0036, 0x70B9, 0x0037,
+  0x70B9, 0x0038, 0x70B9, 0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9,
+  0x0031, 0x0031, 0x70B9, 0x0031, 0x0032, 0x70B9, 0x0031, 0x0033,
+  0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031,
+  0x0036, 0x70B9, 0x0031, 0x0037, 0x70B9, 0x0031, 0x0038, 0x70B9,
+  0x0031, 0x0039, 0x70B9, 0x0032, 0x0030, 0x70B9, 0x0032, 0x0031,
+  0x70B9, 0x0032, 0x0032, 0x70B9, 0x0032, 0x0033, 0x70B9, 0x0032,
+  0x0034, 0x70B9, 0x0068, 0x0070, 0x0061, 0x0064, 0x0061, 0x0061,
+  0x0075, 0x0062, 0x0061, 0x0072, 0x006F, 0x0076, 0x0070, 0x0063,
+  0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB,
+  0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x0070, 0x0061, 0x006E, 0x0061,
+  0x03BC, 0x0061, 0x006D, 0x0061, 0x006B, 0x0061, 0x006B, 0x0062,
+  0x006D, 0x0062, 0x0067, 0x0062, 0x0063, 0x0061, 0x006C, 0x006B,
+  0x0063, 0x0061, 0x006C, 0x0070, 0x0066, 0x006E, 0x0066, 0x03BC,
+  0x0066, 0x03BC, 0x0067, 0x006D, 0x0067, 0x006B, 0x0067, 0x0068,
+  0x007A, 0x006B, 0x0068, 0x007A, 0x006D, 0x0068, 0x007A, 0x0067,
+  0x0068, 0x007A, 0x0074, 0x0068, 0x007A, 0x03BC, 0x006C, 0x006D,
+  0x006C, 0x0064, 0x006C, 0x006B, 0x006C, 0x0066, 0x006D, 0x006E,
+  0x006D, 0x03BC, 0x006D, 0x006D, 0x006D, 0x0063, 0x006D, 0x006B,
+  0x006D, 0x006D, 0x006D, 0x0032, 0x0063, 0x006D, 0x0032, 0x006D,
+  0x0032, 0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033, 0x0063,
+  0x006D, 0x0033, 0x006D, 0x0033, 0x006B, 0x006D, 0x0033, 0x006D,
+  0x2215, 0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x006B, 0x0070,
+  0x0061, 0x006D, 0x0070, 0x0061, 0x0067, 0x0070, 0x0061, 0x0072,
+  0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0072,
+  0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006E,
+  0x0073, 0x03BC, 0x0073, 0x006D, 0x0073, 0x0070, 0x0076, 0x006E,
+  0x0076, 0x03BC, 0x0076, 0x006D, 0x0076, 0x006B, 0x0076, 0x0070,
+  0x0077, 0x006E, 0x0077, 0x03BC, 0x0077, 0x006D, 0x0077, 0x006B,
+  0x0077, 0x006B, 0x03C9, 0x006D, 0x03C9, 0x0061, 0x002E, 0x006D,
+  0x002E, 0x0062, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064, 0x0063,
+  0x2215, 0x006B, 0x0067, 0x0063, 0x006F, 0x002E, 0x0064, 0x0062,
+  0x0067, 0x0079, 0x0068, 0x0061, 0x0068, 0x0070, 0x0069, 0x006E,
+  0x006B, 0x006B, 0x006B, 0x0074, 0x006C, 0x006D, 0x006C, 0x006E,
+  0x006C, 0x006F, 0x0067, 0x006C, 0x0078, 0x006D, 0x0069, 0x006C,
+  0x006D, 0x006F, 0x006C, 0x0070, 0x0068, 0x0070, 0x002E, 0x006D,
+  0x002E, 0x0070, 0x0070, 0x006D, 0x0070, 0x0072, 0x0073, 0x0072,
+  0x0073, 0x0076, 0x0077, 0x0062, 0x0031, 0x65E5, 0x0032, 0x65E5,
+  0x0033, 0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5,
+  0x0037, 0x65E5, 0x0038, 0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030,
+  0x65E5, 0x0031, 0x0031, 0x65E5, 0x0031, 0x0032, 0x65E5, 0x0031,
+  0x0033, 0x65E5, 0x0031, 0x0034, 0x65E5, 0x0031, 0x0035, 0x65E5,
+  0x0031, 0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031, 0x0038,
+  0x65E5, 0x0031, 0x0039, 0x65E5, 0x0032, 0x0030, 0x65E5, 0x0032,
+  0x0031, 0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5,
+  0x0032, 0x0034, 0x65E5, 0x0032, 0x0035, 0x65E5, 0x0032, 0x0036,
+  0x65E5, 0x0032, 0x0037, 0x65E5, 0x0032, 0x0038, 0x65E5, 0x0032,
+  0x0039, 0x65E5, 0x0033, 0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5,
+  0x8C48, 0x66F4, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x5951, 0x5587,
+  0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F,
+  0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82,
+  0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD,
+  0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC,
+  0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7,
+  0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F,
+  0x7DA0, 0x83C9, 0x9304, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E,
+  0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA,
+  0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC,
+  0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x8AFE, 0x4E39,
+  0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+  0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+  0x8AAA, 0x6BBA, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE,
+  0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5,
+  0x5442, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97,
+  0x9ECE, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A,
+  0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE,
+  0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x5EC9,
+  0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5DBA,
+  0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748,
+  0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA,
+  0x5BEE, 0x5C3F, 0x6599, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x6688,
+  0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559,
+  0x786B, 0x7D10, 0x985E, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+  0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65,
+  0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF,
+  0x88E1, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA,
+  0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7B20, 0x7C92,
+  0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6,
+  0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x964D, 0x5ED3,
+  0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C,
+  0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x8612, 0x8AF8, 0x9038,
+  0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x4FAE, 0x50E7, 0x514D,
+  0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+  0x5C64, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691,
+  0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891,
+  0x7949, 0x7948, 0x7950, 0x7956, 0x798D, 0x798E, 0x7A40, 0x7A81,
+  0x7BC0, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8457,
+  0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x96E3,
+  0x97FF, 0x983B, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006C,
+  0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0073, 0x0074,
+  0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576,
+  0x0574, 0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E2, 0x05D4,
+  0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA, 0x05E9, 0x05C1, 0x05E9,
+  0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2, 0x05D0,
+  0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2,
+  0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC, 0x05D6,
+  0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB,
+  0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC, 0x05E1,
+  0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7,
+  0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC, 0x05D5,
+  0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0x05D0,
+  0x05DC, 0x0671, 0x067B, 0x067E, 0x0680, 0x067A, 0x067F, 0x0679,
+  0x06A4, 0x06A6, 0x0684, 0x0683, 0x0686, 0x0687, 0x068D, 0x068C,
+  0x068E, 0x0688, 0x0698, 0x0691, 0x06A9, 0x06AF, 0x06B3, 0x06B1,
+  0x06BA, 0x06BB, 0x06C1, 0x06BE, 0x06D2, 0x06AD, 0x06C7, 0x06C6,
+  0x06C8, 0x06CB, 0x06C5, 0x06C9, 0x06D0, 0x0649, 0x064A, 0x0654,
+  0x0627, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x0648, 0x064A,
+  0x0654, 0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654, 0x06C8,
+  0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x0649, 0x06CC, 0x064A,
+  0x0654, 0x062C, 0x064A, 0x0654, 0x062D, 0x064A, 0x0654, 0x0645,
+  0x064A, 0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628,
+  0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A,
+  0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A,
+  0x0649, 0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645, 0x062B,
+  0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D,
+  0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D, 0x062E,
+  0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633,
+  0x0645, 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636,
+  0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637,
+  0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A,
+  0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641,
+  0x062E, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642,
+  0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643,
+  0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643,
+  0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644,
+  0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644,
+  0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645,
+  0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A, 0x0646,
+  0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646,
+  0x0649, 0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647,
+  0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A,
+  0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x0630,
+  0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064C, 0x0651,
+  0x0020, 0x064D, 0x0651, 0x0020, 0x064E, 0x0651, 0x0020, 0x064F,
+  0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064A,
+  0x0654, 0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654, 0x0646,
+  0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0646, 0x062A, 0x0631,
+  0x062A, 0x0632, 0x062A, 0x0646, 0x062B, 0x0631, 0x062B, 0x0632,
+  0x062B, 0x0646, 0x0645, 0x0627, 0x0646, 0x0631, 0x0646, 0x0632,
+  0x0646, 0x0646, 0x064A, 0x0631, 0x064A, 0x0632, 0x064A, 0x0646,
+  0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0647, 0x0628, 0x0647,
+  0x062A, 0x0647, 0x0635, 0x062E, 0x0644, 0x0647, 0x0646, 0x0647,
+  0x0647, 0x0670, 0x064A, 0x0647, 0x062B, 0x0647, 0x0633, 0x0647,
+  0x0634, 0x0645, 0x0634, 0x0647, 0x0640, 0x064E, 0x0651, 0x0640,
+  0x064F, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637,
+  0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649, 0x063A,
+  0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634,
+  0x064A, 0x062D, 0x0649, 0x062D, 0x064A, 0x062C, 0x0649, 0x062C,
+  0x064A, 0x062E, 0x0649, 0x062E, 0x064A, 0x0635, 0x0649, 0x0635,
+  0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C, 0x0634,
+  0x062D, 0x0634, 0x062E, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635,
+  0x0631, 0x0636, 0x0631, 0x0627, 0x064B, 0x062A, 0x062C, 0x0645,
+  0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E,
+  0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645, 0x062D, 0x062A,
+  0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062D, 0x0645, 0x064A,
+  0x062D, 0x0645, 0x0649, 0x0633, 0x062D, 0x062C, 0x0633, 0x062C,
+  0x062D, 0x0633, 0x062C, 0x0649, 0x0633, 0x0645, 0x062D, 0x0633,
+  0x0645, 0x062C, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D, 0x062D,
+  0x0635, 0x0645, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C,
+  0x064A, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x0645, 0x0636,
+  0x062D, 0x0649, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645, 0x062D,
+  0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064A, 0x0639, 0x062C,
+  0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A,
+  0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649,
+  0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642, 0x0645,
+  0x0645, 0x0644, 0x062D, 0x0645, 0x0644, 0x062D, 0x064A, 0x0644,
+  0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645,
+  0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D,
+  0x0645, 0x0645, 0x062D, 0x064A, 0x0645, 0x062C, 0x062D, 0x0645,
+  0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645, 0x062E, 0x0645,
+  0x0645, 0x062C, 0x062E, 0x0647, 0x0645, 0x062C, 0x0647, 0x0645,
+  0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D, 0x0649, 0x0646,
+  0x062C, 0x0645, 0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A,
+  0x0646, 0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x0628, 0x062E,
+  0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C, 0x0649, 0x062A,
+  0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645, 0x064A,
+  0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D,
+  0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649, 0x0635,
+  0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636, 0x062D, 0x064A,
+  0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A, 0x062D,
+  0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645,
+  0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D, 0x064A,
+  0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C,
+  0x062D, 0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643,
+  0x0645, 0x0645, 0x062C, 0x062D, 0x064A, 0x062D, 0x062C, 0x064A,
+  0x0645, 0x062C, 0x064A, 0x0641, 0x0645, 0x064A, 0x0628, 0x062D,
+  0x064A, 0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0635,
+  0x0644, 0x06D2, 0x0642, 0x0644, 0x06D2, 0x0627, 0x0644, 0x0644,
+  0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D, 0x0645,
+  0x062F, 0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648,
+  0x0644, 0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644,
+  0x0645, 0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020,
+  0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A,
+  0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645, 0x062C, 0x0644,
+  0x0020, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC,
+  0x0627, 0x0644, 0x2014, 0x2013, 0x005F, 0x007B, 0x007D, 0x3014,
+  0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E,
+  0x300F, 0x002C, 0x3001, 0x003A, 0x003F, 0x0021, 0x0023, 0x0026,
+  0x002A, 0x002D, 0x003C, 0x003E, 0x005C, 0x0024, 0x0025, 0x0040,
+  0x0020, 0x064B, 0x0640, 0x064B, 0x0020, 0x064C, 0x0020, 0x064D,
+  0x0020, 0x064E, 0x0640, 0x064E, 0x0020, 0x064F, 0x0640, 0x064F,
+  0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651, 0x0640, 0x0651,
+  0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0628, 0x0629,
+  0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, 0x0630, 0x0631,
+  0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639,
+  0x063A, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+  0x0648, 0x064A, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654,
+  0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0022, 0x0027, 0x002F,
+  0x005B, 0x005D, 0x005E, 0x007C, 0x007E, 0x2985, 0x2986, 0x3002,
+  0x30FB, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5,
+  0x30E7, 0x30C3, 0x30FC, 0x30F3, 0x3099, 0x309A, 0x00A2, 0x00A3,
+  0x00AC, 0x00A6, 0x00A5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192,
+  0x2193, 0x25A0, 0x25CB, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C,
+  0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434,
+  0x10435, 0x10436, 0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C,
+  0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442, 0x10443, 0x10444,
+  0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C,
+  0x1044D, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E,
+  0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165,
+  0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165,
+  0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165,
+  0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x2207, 0x2202, 0x4E3D, 0x4E38,
+  0x4E41, 0x20122, 0x4F60, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50CF,
+  0x349E, 0x2063A, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167,
+  0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF,
+  0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7,
+  0x52FA, 0x5305, 0x5306, 0x5349, 0x535A, 0x5373, 0x537D, 0x537F,
+  0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406,
+  0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553,
+  0x5563, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5717,
+  0x5651, 0x5674, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832,
+  0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922,
+  0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66,
+  0x36EE, 0x2136A, 0x5B08, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BF3,
+  0x21B18, 0x5BFF, 0x5C06, 0x5F33, 0x3781, 0x5C60, 0x5CC0, 0x5C8D,
+  0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2,
+  0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C,
+  0x5EB0, 0x5EB3, 0x5EB6, 0x2A392, 0x22331, 0x8201, 0x5F22, 0x38C7,
+  0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7,
+  0x5FF9, 0x6081, 0x393A, 0x391C, 0x226D4, 0x60C7, 0x6148, 0x614C,
+  0x614E, 0x617A, 0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x6210, 0x621B,
+  0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368,
+  0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469,
+  0x647E, 0x649D, 0x6477, 0x3A6C, 0x656C, 0x2300A, 0x65E3, 0x66F8,
+  0x6649, 0x3B19, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C,
+  0x80AD, 0x43D9, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49,
+  0x67FA, 0x6785, 0x6852, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+  0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+  0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBB, 0x23A8D, 0x21D0B,
+  0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E,
+  0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33,
+  0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6,
+  0x7039, 0x701E, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD,
+  0x20525, 0x7145, 0x24263, 0x719C, 0x43AB, 0x7228, 0x7235, 0x7250,
+  0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC,
+  0x73A5, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B,
+  0x7524, 0x24C36, 0x753E, 0x24C92, 0x2219F, 0x7610, 0x24FA1, 0x24FB8,
+  0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133,
+  0x771E, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D,
+  0x784E, 0x78CC, 0x40E3, 0x25626, 0x2569A, 0x256C5, 0x79EB, 0x412F,
+  0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x7AAE, 0x4202, 0x25BAB, 0x7BC6,
+  0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00,
+  0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228,
+  0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x264DA,
+  0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103,
+  0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8204,
+  0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3,
+  0x82BD, 0x82E6, 0x26B3C, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD,
+  0x83E7, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5,
+  0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D,
+  0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x8667, 0x8669, 0x86A9,
+  0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x4D57,
+  0x87E1, 0x8801, 0x45F9, 0x8860, 0x27667, 0x88D7, 0x88DE, 0x4635,
+  0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED,
+  0x8B8A, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804,
+  0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2, 0x285ED,
+  0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8,
+  0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77,
+  0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76,
+  0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x9829, 0x295B6, 0x98E2,
+  0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12,
+  0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105,
+  0x2A20E, 0x2A291, 0x4D56, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x2A600,
+};
+
+const IDNAMapping kIDNAMappings[] = {
+  { 0x0041, 0, 1 },
+  { 0x0042, 1, 1 },
+  { 0x0043, 2, 1 },
+  { 0x0044, 3, 1 },
+  { 0x0045, 4, 1 },
+  { 0x0046, 5, 1 },
+  { 0x0047, 6, 1 },
+  { 0x0048, 7, 1 },
+  { 0x0049, 8, 1 },
+  { 0x004A, 9, 1 },
+  { 0x004B, 10, 1 },
+  { 0x004C, 11, 1 },
+  { 0x004D, 12, 1 },
+  { 0x004E, 13, 1 },
+  { 0x004F, 14, 1 },
+  { 0x0050, 15, 1 },
+  { 0x0051, 16, 1 },
+  { 0x0052, 17, 1 },
+  { 0x0053, 18, 1 },
+  { 0x0054, 19, 1 },
+  { 0x0055, 20, 1 },
+  { 0x0056, 21, 1 },
+  { 0x0057, 22, 1 },
+  { 0x0058, 23, 1 },
+  { 0x0059, 24, 1 },
+  { 0x005A, 25, 1 },
+  { 0x00A0, 26, 1 },
+  { 0x00A8, 27, 2 },
+  { 0x00AA, 0, 1 },
+  { 0x00AD, 29, 0 },
+  { 0x00AF, 29, 2 },
+  { 0x00B2, 31, 1 },
+  { 0x00B3, 32, 1 },
+  { 0x00B4, 33, 2 },
+  { 0x00B5, 35, 1 },
+  { 0x00B8, 36, 2 },
+  { 0x00B9, 38, 1 },
+  { 0x00BA, 14, 1 },
+  { 0x00BC, 39, 3 },
+  { 0x00BD, 42, 3 },
+  { 0x00BE, 45, 3 },
+  { 0x00C0, 48, 2 },
+  { 0x00C1, 50, 2 },
+  { 0x00C2, 52, 2 },
+  { 0x00C3, 54, 2 },
+  { 0x00C4, 56, 2 },
+  { 0x00C5, 58, 2 },
+  { 0x00C6, 60, 1 },
+  { 0x00C7, 61, 2 },
+  { 0x00C8, 63, 2 },
+  { 0x00C9, 65, 2 },
+  { 0x00CA, 67, 2 },
+  { 0x00CB, 69, 2 },
+  { 0x00CC, 71, 2 },
+  { 0x00CD, 73, 2 },
+  { 0x00CE, 75, 2 },
+  { 0x00CF, 77, 2 },
+  { 0x00D0, 79, 1 },
+  { 0x00D1, 80, 2 },
+  { 0x00D2, 82, 2 },
+  { 0x00D3, 84, 2 },
+  { 0x00D4, 86, 2 },
+  { 0x00D5, 88, 2 },
+  { 0x00D6, 90, 2 },
+  { 0x00D8, 92, 1 },
+  { 0x00D9, 93, 2 },
+  { 0x00DA, 95, 2 },
+  { 0x00DB, 97, 2 },
+  { 0x00DC, 99, 2 },
+  { 0x00DD, 101, 2 },
+  { 0x00DE, 103, 1 },
+  { 0x00DF, 104, 2 },
+  { 0x00E0, 48, 2 },
+  { 0x00E1, 50, 2 },
+  { 0x00E2, 52, 2 },
+  { 0x00E3, 54, 2 },
+  { 0x00E4, 56, 2 },
+  { 0x00E5, 58, 2 },
+  { 0x00E7, 61, 2 },
+  { 0x00E8, 63, 2 },
+  { 0x00E9, 65, 2 },
+  { 0x00EA, 67, 2 },
+  { 0x00EB, 69, 2 },
+  { 0x00EC, 71, 2 },
+  { 0x00ED, 73, 2 },
+  { 0x00EE, 75, 2 },
+  { 0x00EF, 77, 2 },
+  { 0x00F1, 80, 2 },
+  { 0x00F2, 82, 2 },
+  { 0x00F3, 84, 2 },
+  { 0x00F4, 86, 2 },
+  { 0x00F5, 88, 2 },
+  { 0x00F6, 90, 2 },
+  { 0x00F9, 93, 2 },
+  { 0x00FA, 95, 2 },
+  { 0x00FB, 97, 2 },
+  { 0x00FC, 99, 2 },
+  { 0x00FD, 101, 2 },
+  { 0x00FF, 106, 2 },
+  { 0x0100, 108, 2 },
+  { 0x0101, 108, 2 },
+  { 0x0102, 110, 2 },
+  { 0x0103, 110, 2 },
+  { 0x0104, 112, 2 },
+  { 0x0105, 112, 2 },
+  { 0x0106, 114, 2 },
+  { 0x0107, 114, 2 },
+  { 0x0108, 116, 2 },
+  { 0x0109, 116, 2 },
+  { 0x010A, 118, 2 },
+  { 0x010B, 118, 2 },
+  { 0x010C, 120, 2 },
+  { 0x010D, 120, 2 },
+  { 0x010E, 122, 2 },
+  { 0x010F, 122, 2 },
+  { 0x0110, 124, 1 },
+  { 0x0112, 125, 2 },
+  { 0x0113, 125, 2 },
+  { 0x0114, 127, 2 },
+  { 0x0115, 127, 2 },
+  { 0x0116, 129, 2 },
+  { 0x0117, 129, 2 },
+  { 0x0118, 131, 2 },
+  { 0x0119, 131, 2 },
+  { 0x011A, 133, 2 },
+  { 0x011B, 133, 2 },
+  { 0x011C, 135, 2 },
+  { 0x011D, 135, 2 },
+  { 0x011E, 137, 2 },
+  { 0x011F, 137, 2 },
+  { 0x0120, 139, 2 },
+  { 0x0121, 139, 2 },
+  { 0x0122, 141, 2 },
+  { 0x0123, 141, 2 },
+  { 0x0124, 143, 2 },
+  { 0x0125, 143, 2 },
+  { 0x0126, 145, 1 },
+  { 0x0128, 146, 2 },
+  { 0x0129, 146, 2 },
+  { 0x012A, 148, 2 },
+  { 0x012B, 148, 2 },
+  { 0x012C, 150, 2 },
+  { 0x012D, 150, 2 },
+  { 0x012E, 152, 2 },
+  { 0x012F, 152, 2 },
+  { 0x0130, 154, 2 },
+  { 0x0132, 156, 2 },
+  { 0x0133, 156, 2 },
+  { 0x0134, 158, 2 },
+  { 0x0135, 158, 2 },
+  { 0x0136, 160, 2 },
+  { 0x0137, 160, 2 },
+  { 0x0139, 162, 2 },
+  { 0x013A, 162, 2 },
+  { 0x013B, 164, 2 },
+  { 0x013C, 164, 2 },
+  { 0x013D, 166, 2 },
+  { 0x013E, 166, 2 },
+  { 0x013F, 168, 2 },
+  { 0x0140, 168, 2 },
+  { 0x0141, 170, 1 },
+  { 0x0143, 171, 2 },
+  { 0x0144, 171, 2 },
+  { 0x0145, 173, 2 },
+  { 0x0146, 173, 2 },
+  { 0x0147, 175, 2 },
+  { 0x0148, 175, 2 },
+  { 0x0149, 177, 2 },
+  { 0x014A, 179, 1 },
+  { 0x014C, 180, 2 },
+  { 0x014D, 180, 2 },
+  { 0x014E, 182, 2 },
+  { 0x014F, 182, 2 },
+  { 0x0150, 184, 2 },
+  { 0x0151, 184, 2 },
+  { 0x0152, 186, 1 },
+  { 0x0154, 187, 2 },
+  { 0x0155, 187, 2 },
+  { 0x0156, 189, 2 },
+  { 0x0157, 189, 2 },
+  { 0x0158, 191, 2 },
+  { 0x0159, 191, 2 },
+  { 0x015A, 193, 2 },
+  { 0x015B, 193, 2 },
+  { 0x015C, 195, 2 },
+  { 0x015D, 195, 2 },
+  { 0x015E, 197, 2 },
+  { 0x015F, 197, 2 },
+  { 0x0160, 199, 2 },
+  { 0x0161, 199, 2 },
+  { 0x0162, 201, 2 },
+  { 0x0163, 201, 2 },
+  { 0x0164, 203, 2 },
+  { 0x0165, 203, 2 },
+  { 0x0166, 205, 1 },
+  { 0x0168, 206, 2 },
+  { 0x0169, 206, 2 },
+  { 0x016A, 208, 2 },
+  { 0x016B, 208, 2 },
+  { 0x016C, 210, 2 },
+  { 0x016D, 210, 2 },
+  { 0x016E, 212, 2 },
+  { 0x016F, 212, 2 },
+  { 0x0170, 214, 2 },
+  { 0x0171, 214, 2 },
+  { 0x0172, 216, 2 },
+  { 0x0173, 216, 2 },
+  { 0x0174, 218, 2 },
+  { 0x0175, 218, 2 },
+  { 0x0176, 220, 2 },
+  { 0x0177, 220, 2 },
+  { 0x0178, 106, 2 },
+  { 0x0179, 222, 2 },
+  { 0x017A, 222, 2 },
+  { 0x017B, 224, 2 },
+  { 0x017C, 224, 2 },
+  { 0x017D, 226, 2 },
+  { 0x017E, 226, 2 },
+  { 0x017F, 18, 1 },
+  { 0x0181, 228, 1 },
+  { 0x0182, 229, 1 },
+  { 0x0184, 230, 1 },
+  { 0x0186, 231, 1 },
+  { 0x0187, 232, 1 },
+  { 0x0189, 233, 1 },
+  { 0x018A, 234, 1 },
+  { 0x018B, 235, 1 },
+  { 0x018E, 236, 1 },
+  { 0x018F, 237, 1 },
+  { 0x0190, 238, 1 },
+  { 0x0191, 239, 1 },
+  { 0x0193, 240, 1 },
+  { 0x0194, 241, 1 },
+  { 0x0196, 242, 1 },
+  { 0x0197, 243, 1 },
+  { 0x0198, 244, 1 },
+  { 0x019C, 245, 1 },
+  { 0x019D, 246, 1 },
+  { 0x019F, 247, 1 },
+  { 0x01A0, 248, 2 },
+  { 0x01A1, 248, 2 },
+  { 0x01A2, 250, 1 },
+  { 0x01A4, 251, 1 },
+  { 0x01A6, 252, 1 },
+  { 0x01A7, 253, 1 },
+  { 0x01A9, 254, 1 },
+  { 0x01AC, 255, 1 },
+  { 0x01AE, 256, 1 },
+  { 0x01AF, 257, 2 },
+  { 0x01B0, 257, 2 },
+  { 0x01B1, 259, 1 },
+  { 0x01B2, 260, 1 },
+  { 0x01B3, 261, 1 },
+  { 0x01B5, 262, 1 },
+  { 0x01B7, 263, 1 },
+  { 0x01B8, 264, 1 },
+  { 0x01BC, 265, 1 },
+  { 0x01C4, 266, 3 },
+  { 0x01C5, 266, 3 },
+  { 0x01C6, 266, 3 },
+  { 0x01C7, 269, 2 },
+  { 0x01C8, 269, 2 },
+  { 0x01C9, 269, 2 },
+  { 0x01CA, 271, 2 },
+  { 0x01CB, 271, 2 },
+  { 0x01CC, 271, 2 },
+  { 0x01CD, 273, 2 },
+  { 0x01CE, 273, 2 },
+  { 0x01CF, 275, 2 },
+  { 0x01D0, 275, 2 },
+  { 0x01D1, 277, 2 },
+  { 0x01D2, 277, 2 },
+  { 0x01D3, 279, 2 },
+  { 0x01D4, 279, 2 },
+  { 0x01D5, 281, 3 },
+  { 0x01D6, 281, 3 },
+  { 0x01D7, 284, 3 },
+  { 0x01D8, 284, 3 },
+  { 0x01D9, 287, 3 },
+  { 0x01DA, 287, 3 },
+  { 0x01DB, 290, 3 },
+  { 0x01DC, 290, 3 },
+  { 0x01DE, 293, 3 },
+  { 0x01DF, 293, 3 },
+  { 0x01E0, 296, 3 },
+  { 0x01E1, 296, 3 },
+  { 0x01E2, 299, 2 },
+  { 0x01E3, 299, 2 },
+  { 0x01E4, 301, 1 },
+  { 0x01E6, 302, 2 },
+  { 0x01E7, 302, 2 },
+  { 0x01E8, 304, 2 },
+  { 0x01E9, 304, 2 },
+  { 0x01EA, 306, 2 },
+  { 0x01EB, 306, 2 },
+  { 0x01EC, 308, 3 },
+  { 0x01ED, 308, 3 },
+  { 0x01EE, 311, 2 },
+  { 0x01EF, 311, 2 },
+  { 0x01F0, 313, 2 },
+  { 0x01F1, 315, 2 },
+  { 0x01F2, 315, 2 },
+  { 0x01F3, 315, 2 },
+  { 0x01F4, 317, 2 },
+  { 0x01F5, 317, 2 },
+  { 0x01F6, 319, 1 },
+  { 0x01F7, 320, 1 },
+  { 0x01F8, 321, 2 },
+  { 0x01F9, 321, 2 },
+  { 0x01FA, 323, 3 },
+  { 0x01FB, 323, 3 },
+  { 0x01FC, 326, 2 },
+  { 0x01FD, 326, 2 },
+  { 0x01FE, 328, 2 },
+  { 0x01FF, 328, 2 },
+  { 0x0200, 330, 2 },
+  { 0x0201, 330, 2 },
+  { 0x0202, 332, 2 },
+  { 0x0203, 332, 2 },
+  { 0x0204, 334, 2 },
+  { 0x0205, 334, 2 },
+  { 0x0206, 336, 2 },
+  { 0x0207, 336, 2 },
+  { 0x0208, 338, 2 },
+  { 0x0209, 338, 2 },
+  { 0x020A, 340, 2 },
+  { 0x020B, 340, 2 },
+  { 0x020C, 342, 2 },
+  { 0x020D, 342, 2 },
+  { 0x020E, 344, 2 },
+  { 0x020F, 344, 2 },
+  { 0x0210, 346, 2 },
+  { 0x0211, 346, 2 },
+  { 0x0212, 348, 2 },
+  { 0x0213, 348, 2 },
+  { 0x0214, 350, 2 },
+  { 0x0215, 350, 2 },
+  { 0x0216, 352, 2 },
+  { 0x0217, 352, 2 },
+  { 0x0218, 354, 2 },
+  { 0x0219, 354, 2 },
+  { 0x021A, 356, 2 },
+  { 0x021B, 356, 2 },
+  { 0x021C, 358, 1 },
+  { 0x021E, 359, 2 },
+  { 0x021F, 359, 2 },
+  { 0x0220, 361, 1 },
+  { 0x0222, 362, 1 },
+  { 0x0224, 363, 1 },
+  { 0x0226, 364, 2 },
+  { 0x0227, 364, 2 },
+  { 0x0228, 366, 2 },
+  { 0x0229, 366, 2 },
+  { 0x022A, 368, 3 },
+  { 0x022B, 368, 3 },
+  { 0x022C, 371, 3 },
+  { 0x022D, 371, 3 },
+  { 0x022E, 374, 2 },
+  { 0x022F, 374, 2 },
+  { 0x0230, 376, 3 },
+  { 0x0231, 376, 3 },
+  { 0x0232, 379, 2 },
+  { 0x0233, 379, 2 },
+  { 0x02B0, 7, 1 },
+  { 0x02B1, 381, 1 },
+  { 0x02B2, 9, 1 },
+  { 0x02B3, 17, 1 },
+  { 0x02B4, 382, 1 },
+  { 0x02B5, 383, 1 },
+  { 0x02B6, 384, 1 },
+  { 0x02B7, 22, 1 },
+  { 0x02B8, 24, 1 },
+  { 0x02D8, 385, 2 },
+  { 0x02D9, 387, 2 },
+  { 0x02DA, 389, 2 },
+  { 0x02DB, 391, 2 },
+  { 0x02DC, 393, 2 },
+  { 0x02DD, 395, 2 },
+  { 0x02E0, 241, 1 },
+  { 0x02E1, 11, 1 },
+  { 0x02E2, 18, 1 },
+  { 0x02E3, 23, 1 },
+  { 0x02E4, 397, 1 },
+  { 0x0340, 398, 1 },
+  { 0x0341, 399, 1 },
+  { 0x0343, 400, 1 },
+  { 0x0344, 401, 2 },
+  { 0x0345, 403, 1 },
+  { 0x034F, 29, 0 },
+  { 0x0374, 404, 1 },
+  { 0x037A, 405, 2 },
+  { 0x037E, 407, 1 },
+  { 0x0384, 33, 2 },
+  { 0x0385, 408, 3 },
+  { 0x0386, 411, 2 },
+  { 0x0387, 413, 1 },
+  { 0x0388, 414, 2 },
+  { 0x0389, 416, 2 },
+  { 0x038A, 418, 2 },
+  { 0x038C, 420, 2 },
+  { 0x038E, 422, 2 },
+  { 0x038F, 424, 2 },
+  { 0x0390, 426, 3 },
+  { 0x0391, 429, 1 },
+  { 0x0392, 430, 1 },
+  { 0x0393, 431, 1 },
+  { 0x0394, 432, 1 },
+  { 0x0395, 433, 1 },
+  { 0x0396, 434, 1 },
+  { 0x0397, 435, 1 },
+  { 0x0398, 436, 1 },
+  { 0x0399, 403, 1 },
+  { 0x039A, 437, 1 },
+  { 0x039B, 438, 1 },
+  { 0x039C, 35, 1 },
+  { 0x039D, 439, 1 },
+  { 0x039E, 440, 1 },
+  { 0x039F, 441, 1 },
+  { 0x03A0, 442, 1 },
+  { 0x03A1, 443, 1 },
+  { 0x03A3, 444, 1 },
+  { 0x03A4, 445, 1 },
+  { 0x03A5, 446, 1 },
+  { 0x03A6, 447, 1 },
+  { 0x03A7, 448, 1 },
+  { 0x03A8, 449, 1 },
+  { 0x03A9, 450, 1 },
+  { 0x03AA, 451, 2 },
+  { 0x03AB, 453, 2 },
+  { 0x03AC, 411, 2 },
+  { 0x03AD, 414, 2 },
+  { 0x03AE, 416, 2 },
+  { 0x03AF, 418, 2 },
+  { 0x03B0, 455, 3 },
+  { 0x03C2, 444, 1 },
+  { 0x03CA, 451, 2 },
+  { 0x03CB, 453, 2 },
+  { 0x03CC, 420, 2 },
+  { 0x03CD, 422, 2 },
+  { 0x03CE, 424, 2 },
+  { 0x03D0, 430, 1 },
+  { 0x03D1, 436, 1 },
+  { 0x03D2, 446, 1 },
+  { 0x03D3, 422, 2 },
+  { 0x03D4, 453, 2 },
+  { 0x03D5, 447, 1 },
+  { 0x03D6, 442, 1 },
+  { 0x03D8, 458, 1 },
+  { 0x03DA, 459, 1 },
+  { 0x03DC, 460, 1 },
+  { 0x03DE, 461, 1 },
+  { 0x03E0, 462, 1 },
+  { 0x03E2, 463, 1 },
+  { 0x03E4, 464, 1 },
+  { 0x03E6, 465, 1 },
+  { 0x03E8, 466, 1 },
+  { 0x03EA, 467, 1 },
+  { 0x03EC, 468, 1 },
+  { 0x03EE, 469, 1 },
+  { 0x03F0, 437, 1 },
+  { 0x03F1, 443, 1 },
+  { 0x03F2, 444, 1 },
+  { 0x03F4, 436, 1 },
+  { 0x03F5, 433, 1 },
+  { 0x0400, 470, 2 },
+  { 0x0401, 472, 2 },
+  { 0x0402, 474, 1 },
+  { 0x0403, 475, 2 },
+  { 0x0404, 477, 1 },
+  { 0x0405, 478, 1 },
+  { 0x0406, 479, 1 },
+  { 0x0407, 480, 2 },
+  { 0x0408, 482, 1 },
+  { 0x0409, 483, 1 },
+  { 0x040A, 484, 1 },
+  { 0x040B, 485, 1 },
+  { 0x040C, 486, 2 },
+  { 0x040D, 488, 2 },
+  { 0x040E, 490, 2 },
+  { 0x040F, 492, 1 },
+  { 0x0410, 493, 1 },
+  { 0x0411, 494, 1 },
+  { 0x0412, 495, 1 },
+  { 0x0413, 496, 1 },
+  { 0x0414, 497, 1 },
+  { 0x0415, 498, 1 },
+  { 0x0416, 499, 1 },
+  { 0x0417, 500, 1 },
+  { 0x0418, 501, 1 },
+  { 0x0419, 502, 2 },
+  { 0x041A, 504, 1 },
+  { 0x041B, 505, 1 },
+  { 0x041C, 506, 1 },
+  { 0x041D, 507, 1 },
+  { 0x041E, 508, 1 },
+  { 0x041F, 509, 1 },
+  { 0x0420, 510, 1 },
+  { 0x0421, 511, 1 },
+  { 0x0422, 512, 1 },
+  { 0x0423, 513, 1 },
+  { 0x0424, 514, 1 },
+  { 0x0425, 515, 1 },
+  { 0x0426, 516, 1 },
+  { 0x0427, 517, 1 },
+  { 0x0428, 518, 1 },
+  { 0x0429, 519, 1 },
+  { 0x042A, 520, 1 },
+  { 0x042B, 521, 1 },
+  { 0x042C, 522, 1 },
+  { 0x042D, 523, 1 },
+  { 0x042E, 524, 1 },
+  { 0x042F, 525, 1 },
+  { 0x0439, 502, 2 },
+  { 0x0450, 470, 2 },
+  { 0x0451, 472, 2 },
+  { 0x0453, 475, 2 },
+  { 0x0457, 480, 2 },
+  { 0x045C, 486, 2 },
+  { 0x045D, 488, 2 },
+  { 0x045E, 490, 2 },
+  { 0x0460, 526, 1 },
+  { 0x0462, 527, 1 },
+  { 0x0464, 528, 1 },
+  { 0x0466, 529, 1 },
+  { 0x0468, 530, 1 },
+  { 0x046A, 531, 1 },
+  { 0x046C, 532, 1 },
+  { 0x046E, 533, 1 },
+  { 0x0470, 534, 1 },
+  { 0x0472, 535, 1 },
+  { 0x0474, 536, 1 },
+  { 0x0476, 537, 2 },
+  { 0x0477, 537, 2 },
+  { 0x0478, 539, 1 },
+  { 0x047A, 540, 1 },
+  { 0x047C, 541, 1 },
+  { 0x047E, 542, 1 },
+  { 0x0480, 543, 1 },
+  { 0x048A, 544, 1 },
+  { 0x048C, 545, 1 },
+  { 0x048E, 546, 1 },
+  { 0x0490, 547, 1 },
+  { 0x0492, 548, 1 },
+  { 0x0494, 549, 1 },
+  { 0x0496, 550, 1 },
+  { 0x0498, 551, 1 },
+  { 0x049A, 552, 1 },
+  { 0x049C, 553, 1 },
+  { 0x049E, 554, 1 },
+  { 0x04A0, 555, 1 },
+  { 0x04A2, 556, 1 },
+  { 0x04A4, 557, 1 },
+  { 0x04A6, 558, 1 },
+  { 0x04A8, 559, 1 },
+  { 0x04AA, 560, 1 },
+  { 0x04AC, 561, 1 },
+  { 0x04AE, 562, 1 },
+  { 0x04B0, 563, 1 },
+  { 0x04B2, 564, 1 },
+  { 0x04B4, 565, 1 },
+  { 0x04B6, 566, 1 },
+  { 0x04B8, 567, 1 },
+  { 0x04BA, 568, 1 },
+  { 0x04BC, 569, 1 },
+  { 0x04BE, 570, 1 },
+  { 0x04C1, 571, 2 },
+  { 0x04C2, 571, 2 },
+  { 0x04C3, 573, 1 },
+  { 0x04C5, 574, 1 },
+  { 0x04C7, 575, 1 },
+  { 0x04C9, 576, 1 },
+  { 0x04CB, 577, 1 },
+  { 0x04CD, 578, 1 },
+  { 0x04D0, 579, 2 },
+  { 0x04D1, 579, 2 },
+  { 0x04D2, 581, 2 },
+  { 0x04D3, 581, 2 },
+  { 0x04D4, 583, 1 },
+  { 0x04D6, 584, 2 },
+  { 0x04D7, 584, 2 },
+  { 0x04D8, 586, 1 },
+  { 0x04DA, 587, 2 },
+  { 0x04DB, 587, 2 },
+  { 0x04DC, 589, 2 },
+  { 0x04DD, 589, 2 },
+  { 0x04DE, 591, 2 },
+  { 0x04DF, 591, 2 },
+  { 0x04E0, 593, 1 },
+  { 0x04E2, 594, 2 },
+  { 0x04E3, 594, 2 },
+  { 0x04E4, 596, 2 },
+  { 0x04E5, 596, 2 },
+  { 0x04E6, 598, 2 },
+  { 0x04E7, 598, 2 },
+  { 0x04E8, 600, 1 },
+  { 0x04EA, 601, 2 },
+  { 0x04EB, 601, 2 },
+  { 0x04EC, 603, 2 },
+  { 0x04ED, 603, 2 },
+  { 0x04EE, 605, 2 },
+  { 0x04EF, 605, 2 },
+  { 0x04F0, 607, 2 },
+  { 0x04F1, 607, 2 },
+  { 0x04F2, 609, 2 },
+  { 0x04F3, 609, 2 },
+  { 0x04F4, 611, 2 },
+  { 0x04F5, 611, 2 },
+  { 0x04F8, 613, 2 },
+  { 0x04F9, 613, 2 },
+  { 0x0500, 615, 1 },
+  { 0x0502, 616, 1 },
+  { 0x0504, 617, 1 },
+  { 0x0506, 618, 1 },
+  { 0x0508, 619, 1 },
+  { 0x050A, 620, 1 },
+  { 0x050C, 621, 1 },
+  { 0x050E, 622, 1 },
+  { 0x0531, 623, 1 },
+  { 0x0532, 624, 1 },
+  { 0x0533, 625, 1 },
+  { 0x0534, 626, 1 },
+  { 0x0535, 627, 1 },
+  { 0x0536, 628, 1 },
+  { 0x0537, 629, 1 },
+  { 0x0538, 630, 1 },
+  { 0x0539, 631, 1 },
+  { 0x053A, 632, 1 },
+  { 0x053B, 633, 1 },
+  { 0x053C, 634, 1 },
+  { 0x053D, 635, 1 },
+  { 0x053E, 636, 1 },
+  { 0x053F, 637, 1 },
+  { 0x0540, 638, 1 },
+  { 0x0541, 639, 1 },
+  { 0x0542, 640, 1 },
+  { 0x0543, 641, 1 },
+  { 0x0544, 642, 1 },
+  { 0x0545, 643, 1 },
+  { 0x0546, 644, 1 },
+  { 0x0547, 645, 1 },
+  { 0x0548, 646, 1 },
+  { 0x0549, 647, 1 },
+  { 0x054A, 648, 1 },
+  { 0x054B, 649, 1 },
+  { 0x054C, 650, 1 },
+  { 0x054D, 651, 1 },
+  { 0x054E, 652, 1 },
+  { 0x054F, 653, 1 },
+  { 0x0550, 654, 1 },
+  { 0x0551, 655, 1 },
+  { 0x0552, 656, 1 },
+  { 0x0553, 657, 1 },
+  { 0x0554, 658, 1 },
+  { 0x0555, 659, 1 },
+  { 0x0556, 660, 1 },
+  { 0x0587, 661, 2 },
+  { 0x0622, 663, 2 },
+  { 0x0623, 665, 2 },
+  { 0x0624, 667, 2 },
+  { 0x0625, 669, 2 },
+  { 0x0626, 671, 2 },
+  { 0x0675, 673, 2 },
+  { 0x0676, 675, 2 },
+  { 0x0677, 677, 2 },
+  { 0x0678, 679, 2 },
+  { 0x06C0, 681, 2 },
+  { 0x06C2, 683, 2 },
+  { 0x06D3, 685, 2 },
+  { 0x0929, 687, 2 },
+  { 0x0931, 689, 2 },
+  { 0x0934, 691, 2 },
+  { 0x0958, 693, 2 },
+  { 0x0959, 695, 2 },
+  { 0x095A, 697, 2 },
+  { 0x095B, 699, 2 },
+  { 0x095C, 701, 2 },
+  { 0x095D, 703, 2 },
+  { 0x095E, 705, 2 },
+  { 0x095F, 707, 2 },
+  { 0x09CB, 709, 2 },
+  { 0x09CC, 711, 2 },
+  { 0x09DC, 713, 2 },
+  { 0x09DD, 715, 2 },
+  { 0x09DF, 717, 2 },
+  { 0x0A33, 719, 2 },
+  { 0x0A36, 721, 2 },
+  { 0x0A59, 723, 2 },
+  { 0x0A5A, 725, 2 },
+  { 0x0A5B, 727, 2 },
+  { 0x0A5E, 729, 2 },
+  { 0x0B48, 731, 2 },
+  { 0x0B4B, 733, 2 },
+  { 0x0B4C, 735, 2 },
+  { 0x0B5C, 737, 2 },
+  { 0x0B5D, 739, 2 },
+  { 0x0B94, 741, 2 },
+  { 0x0BCA, 743, 2 },
+  { 0x0BCB, 745, 2 },
+  { 0x0BCC, 747, 2 },
+  { 0x0C48, 749, 2 },
+  { 0x0CC0, 751, 2 },
+  { 0x0CC7, 753, 2 },
+  { 0x0CC8, 755, 2 },
+  { 0x0CCA, 757, 2 },
+  { 0x0CCB, 759, 3 },
+  { 0x0D4A, 762, 2 },
+  { 0x0D4B, 764, 2 },
+  { 0x0D4C, 766, 2 },
+  { 0x0DDA, 768, 2 },
+  { 0x0DDC, 770, 2 },
+  { 0x0DDD, 772, 3 },
+  { 0x0DDE, 775, 2 },
+  { 0x0E33, 777, 2 },
+  { 0x0EB3, 779, 2 },
+  { 0x0EDC, 781, 2 },
+  { 0x0EDD, 783, 2 },
+  { 0x0F0C, 785, 1 },
+  { 0x0F43, 786, 2 },
+  { 0x0F4D, 788, 2 },
+  { 0x0F52, 790, 2 },
+  { 0x0F57, 792, 2 },
+  { 0x0F5C, 794, 2 },
+  { 0x0F69, 796, 2 },
+  { 0x0F73, 798, 2 },
+  { 0x0F75, 800, 2 },
+  { 0x0F76, 802, 2 },
+  { 0x0F77, 804, 3 },
+  { 0x0F78, 807, 2 },
+  { 0x0F79, 809, 3 },
+  { 0x0F81, 812, 2 },
+  { 0x0F93, 814, 2 },
+  { 0x0F9D, 816, 2 },
+  { 0x0FA2, 818, 2 },
+  { 0x0FA7, 820, 2 },
+  { 0x0FAC, 822, 2 },
+  { 0x0FB9, 824, 2 },
+  { 0x1026, 826, 2 },
+  { 0x1806, 29, 0 },
+  { 0x180B, 29, 0 },
+  { 0x180C, 29, 0 },
+  { 0x180D, 29, 0 },
+  { 0x1E00, 828, 2 },
+  { 0x1E01, 828, 2 },
+  { 0x1E02, 830, 2 },
+  { 0x1E03, 830, 2 },
+  { 0x1E04, 832, 2 },
+  { 0x1E05, 832, 2 },
+  { 0x1E06, 834, 2 },
+  { 0x1E07, 834, 2 },
+  { 0x1E08, 836, 3 },
+  { 0x1E09, 836, 3 },
+  { 0x1E0A, 839, 2 },
+  { 0x1E0B, 839, 2 },
+  { 0x1E0C, 841, 2 },
+  { 0x1E0D, 841, 2 },
+  { 0x1E0E, 843, 2 },
+  { 0x1E0F, 843, 2 },
+  { 0x1E10, 845, 2 },
+  { 0x1E11, 845, 2 },
+  { 0x1E12, 847, 2 },
+  { 0x1E13, 847, 2 },
+  { 0x1E14, 849, 3 },
+  { 0x1E15, 849, 3 },
+  { 0x1E16, 852, 3 },
+  { 0x1E17, 852, 3 },
+  { 0x1E18, 855, 2 },
+  { 0x1E19, 855, 2 },
+  { 0x1E1A, 857, 2 },
+  { 0x1E1B, 857, 2 },
+  { 0x1E1C, 859, 3 },
+  { 0x1E1D, 859, 3 },
+  { 0x1E1E, 862, 2 },
+  { 0x1E1F, 862, 2 },
+  { 0x1E20, 864, 2 },
+  { 0x1E21, 864, 2 },
+  { 0x1E22, 866, 2 },
+  { 0x1E23, 866, 2 },
+  { 0x1E24, 868, 2 },
+  { 0x1E25, 868, 2 },
+  { 0x1E26, 870, 2 },
+  { 0x1E27, 870, 2 },
+  { 0x1E28, 872, 2 },
+  { 0x1E29, 872, 2 },
+  { 0x1E2A, 874, 2 },
+  { 0x1E2B, 874, 2 },
+  { 0x1E2C, 876, 2 },
+  { 0x1E2D, 876, 2 },
+  { 0x1E2E, 878, 3 },
+  { 0x1E2F, 878, 3 },
+  { 0x1E30, 881, 2 },
+  { 0x1E31, 881, 2 },
+  { 0x1E32, 883, 2 },
+  { 0x1E33, 883, 2 },
+  { 0x1E34, 885, 2 },
+  { 0x1E35, 885, 2 },
+  { 0x1E36, 887, 2 },
+  { 0x1E37, 887, 2 },
+  { 0x1E38, 889, 3 },
+  { 0x1E39, 889, 3 },
+  { 0x1E3A, 892, 2 },
+  { 0x1E3B, 892, 2 },
+  { 0x1E3C, 894, 2 },
+  { 0x1E3D, 894, 2 },
+  { 0x1E3E, 896, 2 },
+  { 0x1E3F, 896, 2 },
+  { 0x1E40, 898, 2 },
+  { 0x1E41, 898, 2 },
+  { 0x1E42, 900, 2 },
+  { 0x1E43, 900, 2 },
+  { 0x1E44, 902, 2 },
+  { 0x1E45, 902, 2 },
+  { 0x1E46, 904, 2 },
+  { 0x1E47, 904, 2 },
+  { 0x1E48, 906, 2 },
+  { 0x1E49, 906, 2 },
+  { 0x1E4A, 908, 2 },
+  { 0x1E4B, 908, 2 },
+  { 0x1E4C, 910, 3 },
+  { 0x1E4D, 910, 3 },
+  { 0x1E4E, 913, 3 },
+  { 0x1E4F, 913, 3 },
+  { 0x1E50, 916, 3 },
+  { 0x1E51, 916, 3 },
+  { 0x1E52, 919, 3 },
+  { 0x1E53, 919, 3 },
+  { 0x1E54, 922, 2 },
+  { 0x1E55, 922, 2 },
+  { 0x1E56, 924, 2 },
+  { 0x1E57, 924, 2 },
+  { 0x1E58, 926, 2 },
+  { 0x1E59, 926, 2 },
+  { 0x1E5A, 928, 2 },
+  { 0x1E5B, 928, 2 },
+  { 0x1E5C, 930, 3 },
+  { 0x1E5D, 930, 3 },
+  { 0x1E5E, 933, 2 },
+  { 0x1E5F, 933, 2 },
+  { 0x1E60, 935, 2 },
+  { 0x1E61, 935, 2 },
+  { 0x1E62, 937, 2 },
+  { 0x1E63, 937, 2 },
+  { 0x1E64, 939, 3 },
+  { 0x1E65, 939, 3 },
+  { 0x1E66, 942, 3 },
+  { 0x1E67, 942, 3 },
+  { 0x1E68, 945, 3 },
+  { 0x1E69, 945, 3 },
+  { 0x1E6A, 948, 2 },
+  { 0x1E6B, 948, 2 },
+  { 0x1E6C, 950, 2 },
+  { 0x1E6D, 950, 2 },
+  { 0x1E6E, 952, 2 },
+  { 0x1E6F, 952, 2 },
+  { 0x1E70, 954, 2 },
+  { 0x1E71, 954, 2 },
+  { 0x1E72, 956, 2 },
+  { 0x1E73, 956, 2 },
+  { 0x1E74, 958, 2 },
+  { 0x1E75, 958, 2 },
+  { 0x1E76, 960, 2 },
+  { 0x1E77, 960, 2 },
+  { 0x1E78, 962, 3 },
+  { 0x1E79, 962, 3 },
+  { 0x1E7A, 965, 3 },
+  { 0x1E7B, 965, 3 },
+  { 0x1E7C, 968, 2 },
+  { 0x1E7D, 968, 2 },
+  { 0x1E7E, 970, 2 },
+  { 0x1E7F, 970, 2 },
+  { 0x1E80, 972, 2 },
+  { 0x1E81, 972, 2 },
+  { 0x1E82, 974, 2 },
+  { 0x1E83, 974, 2 },
+  { 0x1E84, 976, 2 },
+  { 0x1E85, 976, 2 },
+  { 0x1E86, 978, 2 },
+  { 0x1E87, 978, 2 },
+  { 0x1E88, 980, 2 },
+  { 0x1E89, 980, 2 },
+  { 0x1E8A, 982, 2 },
+  { 0x1E8B, 982, 2 },
+  { 0x1E8C, 984, 2 },
+  { 0x1E8D, 984, 2 },
+  { 0x1E8E, 986, 2 },
+  { 0x1E8F, 986, 2 },
+  { 0x1E90, 988, 2 },
+  { 0x1E91, 988, 2 },
+  { 0x1E92, 990, 2 },
+  { 0x1E93, 990, 2 },
+  { 0x1E94, 992, 2 },
+  { 0x1E95, 992, 2 },
+  { 0x1E96, 994, 2 },
+  { 0x1E97, 996, 2 },
+  { 0x1E98, 998, 2 },
+  { 0x1E99, 1000, 2 },
+  { 0x1E9A, 1002, 2 },
+  { 0x1E9B, 935, 2 },
+  { 0x1EA0, 1004, 2 },
+  { 0x1EA1, 1004, 2 },
+  { 0x1EA2, 1006, 2 },
+  { 0x1EA3, 1006, 2 },
+  { 0x1EA4, 1008, 3 },
+  { 0x1EA5, 1008, 3 },
+  { 0x1EA6, 1011, 3 },
+  { 0x1EA7, 1011, 3 },
+  { 0x1EA8, 1014, 3 },
+  { 0x1EA9, 1014, 3 },
+  { 0x1EAA, 1017, 3 },
+  { 0x1EAB, 1017, 3 },
+  { 0x1EAC, 1020, 3 },
+  { 0x1EAD, 1020, 3 },
+  { 0x1EAE, 1023, 3 },
+  { 0x1EAF, 1023, 3 },
+  { 0x1EB0, 1026, 3 },
+  { 0x1EB1, 1026, 3 },
+  { 0x1EB2, 1029, 3 },
+  { 0x1EB3, 1029, 3 },
+  { 0x1EB4, 1032, 3 },
+  { 0x1EB5, 1032, 3 },
+  { 0x1EB6, 1035, 3 },
+  { 0x1EB7, 1035, 3 },
+  { 0x1EB8, 1038, 2 },
+  { 0x1EB9, 1038, 2 },
+  { 0x1EBA, 1040, 2 },
+  { 0x1EBB, 1040, 2 },
+  { 0x1EBC, 1042, 2 },
+  { 0x1EBD, 1042, 2 },
+  { 0x1EBE, 1044, 3 },
+  { 0x1EBF, 1044, 3 },
+  { 0x1EC0, 1047, 3 },
+  { 0x1EC1, 1047, 3 },
+  { 0x1EC2, 1050, 3 },
+  { 0x1EC3, 1050, 3 },
+  { 0x1EC4, 1053, 3 },
+  { 0x1EC5, 1053, 3 },
+  { 0x1EC6, 1056, 3 },
+  { 0x1EC7, 1056, 3 },
+  { 0x1EC8, 1059, 2 },
+  { 0x1EC9, 1059, 2 },
+  { 0x1ECA, 1061, 2 },
+  { 0x1ECB, 1061, 2 },
+  { 0x1ECC, 1063, 2 },
+  { 0x1ECD, 1063, 2 },
+  { 0x1ECE, 1065, 2 },
+  { 0x1ECF, 1065, 2 },
+  { 0x1ED0, 1067, 3 },
+  { 0x1ED1, 1067, 3 },
+  { 0x1ED2, 1070, 3 },
+  { 0x1ED3, 1070, 3 },
+  { 0x1ED4, 1073, 3 },
+  { 0x1ED5, 1073, 3 },
+  { 0x1ED6, 1076, 3 },
+  { 0x1ED7, 1076, 3 },
+  { 0x1ED8, 1079, 3 },
+  { 0x1ED9, 1079, 3 },
+  { 0x1EDA, 1082, 3 },
+  { 0x1EDB, 1082, 3 },
+  { 0x1EDC, 1085, 3 },
+  { 0x1EDD, 1085, 3 },
+  { 0x1EDE, 1088, 3 },
+  { 0x1EDF, 1088, 3 },
+  { 0x1EE0, 1091, 3 },
+  { 0x1EE1, 1091, 3 },
+  { 0x1EE2, 1094, 3 },
+  { 0x1EE3, 1094, 3 },
+  { 0x1EE4, 1097, 2 },
+  { 0x1EE5, 1097, 2 },
+  { 0x1EE6, 1099, 2 },
+  { 0x1EE7, 1099, 2 },
+  { 0x1EE8, 1101, 3 },
+  { 0x1EE9, 1101, 3 },
+  { 0x1EEA, 1104, 3 },
+  { 0x1EEB, 1104, 3 },
+  { 0x1EEC, 1107, 3 },
+  { 0x1EED, 1107, 3 },
+  { 0x1EEE, 1110, 3 },
+  { 0x1EEF, 1110, 3 },
+  { 0x1EF0, 1113, 3 },
+  { 0x1EF1, 1113, 3 },
+  { 0x1EF2, 1116, 2 },
+  { 0x1EF3, 1116, 2 },
+  { 0x1EF4, 1118, 2 },
+  { 0x1EF5, 1118, 2 },
+  { 0x1EF6, 1120, 2 },
+  { 0x1EF7, 1120, 2 },
+  { 0x1EF8, 1122, 2 },
+  { 0x1EF9, 1122, 2 },
+  { 0x1F00, 1124, 2 },
+  { 0x1F01, 1126, 2 },
+  { 0x1F02, 1128, 3 },
+  { 0x1F03, 1131, 3 },
+  { 0x1F04, 1134, 3 },
+  { 0x1F05, 1137, 3 },
+  { 0x1F06, 1140, 3 },
+  { 0x1F07, 1143, 3 },
+  { 0x1F08, 1124, 2 },
+  { 0x1F09, 1126, 2 },
+  { 0x1F0A, 1128, 3 },
+  { 0x1F0B, 1131, 3 },
+  { 0x1F0C, 1134, 3 },
+  { 0x1F0D, 1137, 3 },
+  { 0x1F0E, 1140, 3 },
+  { 0x1F0F, 1143, 3 },
+  { 0x1F10, 1146, 2 },
+  { 0x1F11, 1148, 2 },
+  { 0x1F12, 1150, 3 },
+  { 0x1F13, 1153, 3 },
+  { 0x1F14, 1156, 3 },
+  { 0x1F15, 1159, 3 },
+  { 0x1F18, 1146, 2 },
+  { 0x1F19, 1148, 2 },
+  { 0x1F1A, 1150, 3 },
+  { 0x1F1B, 1153, 3 },
+  { 0x1F1C, 1156, 3 },
+  { 0x1F1D, 1159, 3 },
+  { 0x1F20, 1162, 2 },
+  { 0x1F21, 1164, 2 },
+  { 0x1F22, 1166, 3 },
+  { 0x1F23, 1169, 3 },
+  { 0x1F24, 1172, 3 },
+  { 0x1F25, 1175, 3 },
+  { 0x1F26, 1178, 3 },
+  { 0x1F27, 1181, 3 },
+  { 0x1F28, 1162, 2 },
+  { 0x1F29, 1164, 2 },
+  { 0x1F2A, 1166, 3 },
+  { 0x1F2B, 1169, 3 },
+  { 0x1F2C, 1172, 3 },
+  { 0x1F2D, 1175, 3 },
+  { 0x1F2E, 1178, 3 },
+  { 0x1F2F, 1181, 3 },
+  { 0x1F30, 1184, 2 },
+  { 0x1F31, 1186, 2 },
+  { 0x1F32, 1188, 3 },
+  { 0x1F33, 1191, 3 },
+  { 0x1F34, 1194, 3 },
+  { 0x1F35, 1197, 3 },
+  { 0x1F36, 1200, 3 },
+  { 0x1F37, 1203, 3 },
+  { 0x1F38, 1184, 2 },
+  { 0x1F39, 1186, 2 },
+  { 0x1F3A, 1188, 3 },
+  { 0x1F3B, 1191, 3 },
+  { 0x1F3C, 1194, 3 },
+  { 0x1F3D, 1197, 3 },
+  { 0x1F3E, 1200, 3 },
+  { 0x1F3F, 1203, 3 },
+  { 0x1F40, 1206, 2 },
+  { 0x1F41, 1208, 2 },
+  { 0x1F42, 1210, 3 },
+  { 0x1F43, 1213, 3 },
+  { 0x1F44, 1216, 3 },
+  { 0x1F45, 1219, 3 },
+  { 0x1F48, 1206, 2 },
+  { 0x1F49, 1208, 2 },
+  { 0x1F4A, 1210, 3 },
+  { 0x1F4B, 1213, 3 },
+  { 0x1F4C, 1216, 3 },
+  { 0x1F4D, 1219, 3 },
+  { 0x1F50, 1222, 2 },
+  { 0x1F51, 1224, 2 },
+  { 0x1F52, 1226, 3 },
+  { 0x1F53, 1229, 3 },
+  { 0x1F54, 1232, 3 },
+  { 0x1F55, 1235, 3 },
+  { 0x1F56, 1238, 3 },
+  { 0x1F57, 1241, 3 },
+  { 0x1F59, 1224, 2 },
+  { 0x1F5B, 1229, 3 },
+  { 0x1F5D, 1235, 3 },
+  { 0x1F5F, 1241, 3 },
+  { 0x1F60, 1244, 2 },
+  { 0x1F61, 1246, 2 },
+  { 0x1F62, 1248, 3 },
+  { 0x1F63, 1251, 3 },
+  { 0x1F64, 1254, 3 },
+  { 0x1F65, 1257, 3 },
+  { 0x1F66, 1260, 3 },
+  { 0x1F67, 1263, 3 },
+  { 0x1F68, 1244, 2 },
+  { 0x1F69, 1246, 2 },
+  { 0x1F6A, 1248, 3 },
+  { 0x1F6B, 1251, 3 },
+  { 0x1F6C, 1254, 3 },
+  { 0x1F6D, 1257, 3 },
+  { 0x1F6E, 1260, 3 },
+  { 0x1F6F, 1263, 3 },
+  { 0x1F70, 1266, 2 },
+  { 0x1F71, 411, 2 },
+  { 0x1F72, 1268, 2 },
+  { 0x1F73, 414, 2 },
+  { 0x1F74, 1270, 2 },
+  { 0x1F75, 416, 2 },
+  { 0x1F76, 1272, 2 },
+  { 0x1F77, 418, 2 },
+  { 0x1F78, 1274, 2 },
+  { 0x1F79, 420, 2 },
+  { 0x1F7A, 1276, 2 },
+  { 0x1F7B, 422, 2 },
+  { 0x1F7C, 1278, 2 },
+  { 0x1F7D, 424, 2 },
+  { 0x1F80, 1280, 3 },
+  { 0x1F81, 1283, 3 },
+  { 0x1F82, 1286, 4 },
+  { 0x1F83, 1290, 4 },
+  { 0x1F84, 1294, 4 },
+  { 0x1F85, 1298, 4 },
+  { 0x1F86, 1302, 4 },
+  { 0x1F87, 1306, 4 },
+  { 0x1F88, 1280, 3 },
+  { 0x1F89, 1283, 3 },
+  { 0x1F8A, 1286, 4 },
+  { 0x1F8B, 1290, 4 },
+  { 0x1F8C, 1294, 4 },
+  { 0x1F8D, 1298, 4 },
+  { 0x1F8E, 1302, 4 },
+  { 0x1F8F, 1306, 4 },
+  { 0x1F90, 1310, 3 },
+  { 0x1F91, 1313, 3 },
+  { 0x1F92, 1316, 4 },
+  { 0x1F93, 1320, 4 },
+  { 0x1F94, 1324, 4 },
+  { 0x1F95, 1328, 4 },
+  { 0x1F96, 1332, 4 },
+  { 0x1F97, 1336, 4 },
+  { 0x1F98, 1310, 3 },
+  { 0x1F99, 1313, 3 },
+  { 0x1F9A, 1316, 4 },
+  { 0x1F9B, 1320, 4 },
+  { 0x1F9C, 1324, 4 },
+  { 0x1F9D, 1328, 4 },
+  { 0x1F9E, 1332, 4 },
+  { 0x1F9F, 1336, 4 },
+  { 0x1FA0, 1340, 3 },
+  { 0x1FA1, 1343, 3 },
+  { 0x1FA2, 1346, 4 },
+  { 0x1FA3, 1350, 4 },
+  { 0x1FA4, 1354, 4 },
+  { 0x1FA5, 1358, 4 },
+  { 0x1FA6, 1362, 4 },
+  { 0x1FA7, 1366, 4 },
+  { 0x1FA8, 1340, 3 },
+  { 0x1FA9, 1343, 3 },
+  { 0x1FAA, 1346, 4 },
+  { 0x1FAB, 1350, 4 },
+  { 0x1FAC, 1354, 4 },
+  { 0x1FAD, 1358, 4 },
+  { 0x1FAE, 1362, 4 },
+  { 0x1FAF, 1366, 4 },
+  { 0x1FB0, 1370, 2 },
+  { 0x1FB1, 1372, 2 },
+  { 0x1FB2, 1374, 3 },
+  { 0x1FB3, 1377, 2 },
+  { 0x1FB4, 1379, 3 },
+  { 0x1FB6, 1382, 2 },
+  { 0x1FB7, 1384, 3 },
+  { 0x1FB8, 1370, 2 },
+  { 0x1FB9, 1372, 2 },
+  { 0x1FBA, 1266, 2 },
+  { 0x1FBB, 411, 2 },
+  { 0x1FBC, 1377, 2 },
+  { 0x1FBD, 1387, 2 },
+  { 0x1FBE, 403, 1 },
+  { 0x1FBF, 1387, 2 },
+  { 0x1FC0, 1389, 2 },
+  { 0x1FC1, 1391, 3 },
+  { 0x1FC2, 1394, 3 },
+  { 0x1FC3, 1397, 2 },
+  { 0x1FC4, 1399, 3 },
+  { 0x1FC6, 1402, 2 },
+  { 0x1FC7, 1404, 3 },
+  { 0x1FC8, 1268, 2 },
+  { 0x1FC9, 414, 2 },
+  { 0x1FCA, 1270, 2 },
+  { 0x1FCB, 416, 2 },
+  { 0x1FCC, 1397, 2 },
+  { 0x1FCD, 1407, 3 },
+  { 0x1FCE, 1410, 3 },
+  { 0x1FCF, 1413, 3 },
+  { 0x1FD0, 1416, 2 },
+  { 0x1FD1, 1418, 2 },
+  { 0x1FD2, 1420, 3 },
+  { 0x1FD3, 426, 3 },
+  { 0x1FD6, 1423, 2 },
+  { 0x1FD7, 1425, 3 },
+  { 0x1FD8, 1416, 2 },
+  { 0x1FD9, 1418, 2 },
+  { 0x1FDA, 1272, 2 },
+  { 0x1FDB, 418, 2 },
+  { 0x1FDD, 1428, 3 },
+  { 0x1FDE, 1431, 3 },
+  { 0x1FDF, 1434, 3 },
+  { 0x1FE0, 1437, 2 },
+  { 0x1FE1, 1439, 2 },
+  { 0x1FE2, 1441, 3 },
+  { 0x1FE3, 455, 3 },
+  { 0x1FE4, 1444, 2 },
+  { 0x1FE5, 1446, 2 },
+  { 0x1FE6, 1448, 2 },
+  { 0x1FE7, 1450, 3 },
+  { 0x1FE8, 1437, 2 },
+  { 0x1FE9, 1439, 2 },
+  { 0x1FEA, 1276, 2 },
+  { 0x1FEB, 422, 2 },
+  { 0x1FEC, 1446, 2 },
+  { 0x1FED, 1453, 3 },
+  { 0x1FEE, 408, 3 },
+  { 0x1FEF, 1456, 1 },
+  { 0x1FF2, 1457, 3 },
+  { 0x1FF3, 1460, 2 },
+  { 0x1FF4, 1462, 3 },
+  { 0x1FF6, 1465, 2 },
+  { 0x1FF7, 1467, 3 },
+  { 0x1FF8, 1274, 2 },
+  { 0x1FF9, 420, 2 },
+  { 0x1FFA, 1278, 2 },
+  { 0x1FFB, 424, 2 },
+  { 0x1FFC, 1460, 2 },
+  { 0x1FFD, 33, 2 },
+  { 0x1FFE, 1470, 2 },
+  { 0x2000, 26, 1 },
+  { 0x2001, 26, 1 },
+  { 0x2002, 26, 1 },
+  { 0x2003, 26, 1 },
+  { 0x2004, 26, 1 },
+  { 0x2005, 26, 1 },
+  { 0x2006, 26, 1 },
+  { 0x2007, 26, 1 },
+  { 0x2008, 26, 1 },
+  { 0x2009, 26, 1 },
+  { 0x200A, 26, 1 },
+  { 0x200B, 29, 0 },
+  { 0x200C, 29, 0 },
+  { 0x200D, 29, 0 },
+  { 0x2011, 1472, 1 },
+  { 0x2017, 1473, 2 },
+  { 0x2024, 1475, 1 },
+  { 0x2025, 1476, 2 },
+  { 0x2026, 1478, 3 },
+  { 0x202F, 26, 1 },
+  { 0x2033, 1481, 2 },
+  { 0x2034, 1483, 3 },
+  { 0x2036, 1486, 2 },
+  { 0x2037, 1488, 3 },
+  { 0x203C, 1491, 2 },
+  { 0x203E, 1493, 2 },
+  { 0x2047, 1495, 2 },
+  { 0x2048, 1497, 2 },
+  { 0x2049, 1499, 2 },
+  { 0x2057, 1501, 4 },
+  { 0x205F, 26, 1 },
+  { 0x2060, 29, 0 },
+  { 0x2070, 1505, 1 },
+  { 0x2071, 8, 1 },
+  { 0x2074, 1506, 1 },
+  { 0x2075, 1507, 1 },
+  { 0x2076, 1508, 1 },
+  { 0x2077, 1509, 1 },
+  { 0x2078, 1510, 1 },
+  { 0x2079, 1511, 1 },
+  { 0x207A, 1512, 1 },
+  { 0x207B, 1513, 1 },
+  { 0x207C, 1514, 1 },
+  { 0x207D, 1515, 1 },
+  { 0x207E, 1516, 1 },
+  { 0x207F, 13, 1 },
+  { 0x2080, 1505, 1 },
+  { 0x2081, 38, 1 },
+  { 0x2082, 31, 1 },
+  { 0x2083, 32, 1 },
+  { 0x2084, 1506, 1 },
+  { 0x2085, 1507, 1 },
+  { 0x2086, 1508, 1 },
+  { 0x2087, 1509, 1 },
+  { 0x2088, 1510, 1 },
+  { 0x2089, 1511, 1 },
+  { 0x208A, 1512, 1 },
+  { 0x208B, 1513, 1 },
+  { 0x208C, 1514, 1 },
+  { 0x208D, 1515, 1 },
+  { 0x208E, 1516, 1 },
+  { 0x20A8, 1517, 2 },
+  { 0x2100, 1519, 3 },
+  { 0x2101, 1522, 3 },
+  { 0x2102, 2, 1 },
+  { 0x2103, 1525, 2 },
+  { 0x2105, 1527, 3 },
+  { 0x2106, 1530, 3 },
+  { 0x2107, 238, 1 },
+  { 0x2109, 1533, 2 },
+  { 0x210A, 6, 1 },
+  { 0x210B, 7, 1 },
+  { 0x210C, 7, 1 },
+  { 0x210D, 7, 1 },
+  { 0x210E, 7, 1 },
+  { 0x210F, 145, 1 },
+  { 0x2110, 8, 1 },
+  { 0x2111, 8, 1 },
+  { 0x2112, 11, 1 },
+  { 0x2113, 11, 1 },
+  { 0x2115, 13, 1 },
+  { 0x2116, 1535, 2 },
+  { 0x2119, 15, 1 },
+  { 0x211A, 16, 1 },
+  { 0x211B, 17, 1 },
+  { 0x211C, 17, 1 },
+  { 0x211D, 17, 1 },
+  { 0x2120, 1537, 2 },
+  { 0x2121, 1539, 3 },
+  { 0x2122, 1542, 2 },
+  { 0x2124, 25, 1 },
+  { 0x2126, 450, 1 },
+  { 0x2128, 25, 1 },
+  { 0x212A, 10, 1 },
+  { 0x212B, 58, 2 },
+  { 0x212C, 1, 1 },
+  { 0x212D, 2, 1 },
+  { 0x212F, 4, 1 },
+  { 0x2130, 4, 1 },
+  { 0x2131, 5, 1 },
+  { 0x2133, 12, 1 },
+  { 0x2134, 14, 1 },
+  { 0x2135, 1544, 1 },
+  { 0x2136, 1545, 1 },
+  { 0x2137, 1546, 1 },
+  { 0x2138, 1547, 1 },
+  { 0x2139, 8, 1 },
+  { 0x213D, 431, 1 },
+  { 0x213E, 431, 1 },
+  { 0x213F, 442, 1 },
+  { 0x2140, 1548, 1 },
+  { 0x2145, 3, 1 },
+  { 0x2146, 3, 1 },
+  { 0x2147, 4, 1 },
+  { 0x2148, 8, 1 },
+  { 0x2149, 9, 1 },
+  { 0x2153, 1549, 3 },
+  { 0x2154, 1552, 3 },
+  { 0x2155, 1555, 3 },
+  { 0x2156, 1558, 3 },
+  { 0x2157, 1561, 3 },
+  { 0x2158, 1564, 3 },
+  { 0x2159, 1567, 3 },
+  { 0x215A, 1570, 3 },
+  { 0x215B, 1573, 3 },
+  { 0x215C, 1576, 3 },
+  { 0x215D, 1579, 3 },
+  { 0x215E, 1582, 3 },
+  { 0x215F, 1585, 2 },
+  { 0x2160, 8, 1 },
+  { 0x2161, 1587, 2 },
+  { 0x2162, 1589, 3 },
+  { 0x2163, 1592, 2 },
+  { 0x2164, 21, 1 },
+  { 0x2165, 1594, 2 },
+  { 0x2166, 1596, 3 },
+  { 0x2167, 1599, 4 },
+  { 0x2168, 1603, 2 },
+  { 0x2169, 23, 1 },
+  { 0x216A, 1605, 2 },
+  { 0x216B, 1607, 3 },
+  { 0x216C, 11, 1 },
+  { 0x216D, 2, 1 },
+  { 0x216E, 3, 1 },
+  { 0x216F, 12, 1 },
+  { 0x2170, 8, 1 },
+  { 0x2171, 1587, 2 },
+  { 0x2172, 1589, 3 },
+  { 0x2173, 1592, 2 },
+  { 0x2174, 21, 1 },
+  { 0x2175, 1594, 2 },
+  { 0x2176, 1596, 3 },
+  { 0x2177, 1599, 4 },
+  { 0x2178, 1603, 2 },
+  { 0x2179, 23, 1 },
+  { 0x217A, 1605, 2 },
+  { 0x217B, 1607, 3 },
+  { 0x217C, 11, 1 },
+  { 0x217D, 2, 1 },
+  { 0x217E, 3, 1 },
+  { 0x217F, 12, 1 },
+  { 0x219A, 1610, 2 },
+  { 0x219B, 1612, 2 },
+  { 0x21AE, 1614, 2 },
+  { 0x21CD, 1616, 2 },
+  { 0x21CE, 1618, 2 },
+  { 0x21CF, 1620, 2 },
+  { 0x2204, 1622, 2 },
+  { 0x2209, 1624, 2 },
+  { 0x220C, 1626, 2 },
+  { 0x2224, 1628, 2 },
+  { 0x2226, 1630, 2 },
+  { 0x222C, 1632, 2 },
+  { 0x222D, 1634, 3 },
+  { 0x222F, 1637, 2 },
+  { 0x2230, 1639, 3 },
+  { 0x2241, 1642, 2 },
+  { 0x2244, 1644, 2 },
+  { 0x2247, 1646, 2 },
+  { 0x2249, 1648, 2 },
+  { 0x2260, 1650, 2 },
+  { 0x2262, 1652, 2 },
+  { 0x226D, 1654, 2 },
+  { 0x226E, 1656, 2 },
+  { 0x226F, 1658, 2 },
+  { 0x2270, 1660, 2 },
+  { 0x2271, 1662, 2 },
+  { 0x2274, 1664, 2 },
+  { 0x2275, 1666, 2 },
+  { 0x2278, 1668, 2 },
+  { 0x2279, 1670, 2 },
+  { 0x2280, 1672, 2 },
+  { 0x2281, 1674, 2 },
+  { 0x2284, 1676, 2 },
+  { 0x2285, 1678, 2 },
+  { 0x2288, 1680, 2 },
+  { 0x2289, 1682, 2 },
+  { 0x22AC, 1684, 2 },
+  { 0x22AD, 1686, 2 },
+  { 0x22AE, 1688, 2 },
+  { 0x22AF, 1690, 2 },
+  { 0x22E0, 1692, 2 },
+  { 0x22E1, 1694, 2 },
+  { 0x22E2, 1696, 2 },
+  { 0x22E3, 1698, 2 },
+  { 0x22EA, 1700, 2 },
+  { 0x22EB, 1702, 2 },
+  { 0x22EC, 1704, 2 },
+  { 0x22ED, 1706, 2 },
+  { 0x2329, 1708, 1 },
+  { 0x232A, 1709, 1 },
+  { 0x2460, 38, 1 },
+  { 0x2461, 31, 1 },
+  { 0x2462, 32, 1 },
+  { 0x2463, 1506, 1 },
+  { 0x2464, 1507, 1 },
+  { 0x2465, 1508, 1 },
+  { 0x2466, 1509, 1 },
+  { 0x2467, 1510, 1 },
+  { 0x2468, 1511, 1 },
+  { 0x2469, 1710, 2 },
+  { 0x246A, 1712, 2 },
+  { 0x246B, 1714, 2 },
+  { 0x246C, 1716, 2 },
+  { 0x246D, 1718, 2 },
+  { 0x246E, 1720, 2 },
+  { 0x246F, 1722, 2 },
+  { 0x2470, 1724, 2 },
+  { 0x2471, 1726, 2 },
+  { 0x2472, 1728, 2 },
+  { 0x2473, 1730, 2 },
+  { 0x2474, 1732, 3 },
+  { 0x2475, 1735, 3 },
+  { 0x2476, 1738, 3 },
+  { 0x2477, 1741, 3 },
+  { 0x2478, 1744, 3 },
+  { 0x2479, 1747, 3 },
+  { 0x247A, 1750, 3 },
+  { 0x247B, 1753, 3 },
+  { 0x247C, 1756, 3 },
+  { 0x247D, 1759, 4 },
+  { 0x247E, 1763, 4 },
+  { 0x247F, 1767, 4 },
+  { 0x2480, 1771, 4 },
+  { 0x2481, 1775, 4 },
+  { 0x2482, 1779, 4 },
+  { 0x2483, 1783, 4 },
+  { 0x2484, 1787, 4 },
+  { 0x2485, 1791, 4 },
+  { 0x2486, 1795, 4 },
+  { 0x2487, 1799, 4 },
+  { 0x2488, 1803, 2 },
+  { 0x2489, 1805, 2 },
+  { 0x248A, 1807, 2 },
+  { 0x248B, 1809, 2 },
+  { 0x248C, 1811, 2 },
+  { 0x248D, 1813, 2 },
+  { 0x248E, 1815, 2 },
+  { 0x248F, 1817, 2 },
+  { 0x2490, 1819, 2 },
+  { 0x2491, 1821, 3 },
+  { 0x2492, 1824, 3 },
+  { 0x2493, 1827, 3 },
+  { 0x2494, 1830, 3 },
+  { 0x2495, 1833, 3 },
+  { 0x2496, 1836, 3 },
+  { 0x2497, 1839, 3 },
+  { 0x2498, 1842, 3 },
+  { 0x2499, 1845, 3 },
+  { 0x249A, 1848, 3 },
+  { 0x249B, 1851, 3 },
+  { 0x249C, 1854, 3 },
+  { 0x249D, 1857, 3 },
+  { 0x249E, 1860, 3 },
+  { 0x249F, 1863, 3 },
+  { 0x24A0, 1866, 3 },
+  { 0x24A1, 1869, 3 },
+  { 0x24A2, 1872, 3 },
+  { 0x24A3, 1875, 3 },
+  { 0x24A4, 1878, 3 },
+  { 0x24A5, 1881, 3 },
+  { 0x24A6, 1884, 3 },
+  { 0x24A7, 1887, 3 },
+  { 0x24A8, 1890, 3 },
+  { 0x24A9, 1893, 3 },
+  { 0x24AA, 1896, 3 },
+  { 0x24AB, 1899, 3 },
+  { 0x24AC, 1902, 3 },
+  { 0x24AD, 1905, 3 },
+  { 0x24AE, 1908, 3 },
+  { 0x24AF, 1911, 3 },
+  { 0x24B0, 1914, 3 },
+  { 0x24B1, 1917, 3 },
+  { 0x24B2, 1920, 3 },
+  { 0x24B3, 1923, 3 },
+  { 0x24B4, 1926, 3 },
+  { 0x24B5, 1929, 3 },
+  { 0x24B6, 0, 1 },
+  { 0x24B7, 1, 1 },
+  { 0x24B8, 2, 1 },
+  { 0x24B9, 3, 1 },
+  { 0x24BA, 4, 1 },
+  { 0x24BB, 5, 1 },
+  { 0x24BC, 6, 1 },
+  { 0x24BD, 7, 1 },
+  { 0x24BE, 8, 1 },
+  { 0x24BF, 9, 1 },
+  { 0x24C0, 10, 1 },
+  { 0x24C1, 11, 1 },
+  { 0x24C2, 12, 1 },
+  { 0x24C3, 13, 1 },
+  { 0x24C4, 14, 1 },
+  { 0x24C5, 15, 1 },
+  { 0x24C6, 16, 1 },
+  { 0x24C7, 17, 1 },
+  { 0x24C8, 18, 1 },
+  { 0x24C9, 19, 1 },
+  { 0x24CA, 20, 1 },
+  { 0x24CB, 21, 1 },
+  { 0x24CC, 22, 1 },
+  { 0x24CD, 23, 1 },
+  { 0x24CE, 24, 1 },
+  { 0x24CF, 25, 1 },
+  { 0x24D0, 0, 1 },
+  { 0x24D1, 1, 1 },
+  { 0x24D2, 2, 1 },
+  { 0x24D3, 3, 1 },
+  { 0x24D4, 4, 1 },
+  { 0x24D5, 5, 1 },
+  { 0x24D6, 6, 1 },
+  { 0x24D7, 7, 1 },
+  { 0x24D8, 8, 1 },
+  { 0x24D9, 9, 1 },
+  { 0x24DA, 10, 1 },
+  { 0x24DB, 11, 1 },
+  { 0x24DC, 12, 1 },
+  { 0x24DD, 13, 1 },
+  { 0x24DE, 14, 1 },
+  { 0x24DF, 15, 1 },
+  { 0x24E0, 16, 1 },
+  { 0x24E1, 17, 1 },
+  { 0x24E2, 18, 1 },
+  { 0x24E3, 19, 1 },
+  { 0x24E4, 20, 1 },
+  { 0x24E5, 21, 1 },
+  { 0x24E6, 22, 1 },
+  { 0x24E7, 23, 1 },
+  { 0x24E8, 24, 1 },
+  { 0x24E9, 25, 1 },
+  { 0x24EA, 1505, 1 },
+  { 0x2A0C, 1932, 4 },
+  { 0x2A74, 1936, 3 },
+  { 0x2A75, 1939, 2 },
+  { 0x2A76, 1941, 3 },
+  { 0x2ADC, 1944, 2 },
+  { 0x2E9F, 1946, 1 },
+  { 0x2EF3, 1947, 1 },
+  { 0x2F00, 1948, 1 },
+  { 0x2F01, 1949, 1 },
+  { 0x2F02, 1950, 1 },
+  { 0x2F03, 1951, 1 },
+  { 0x2F04, 1952, 1 },
+  { 0x2F05, 1953, 1 },
+  { 0x2F06, 1954, 1 },
+  { 0x2F07, 1955, 1 },
+  { 0x2F08, 1956, 1 },
+  { 0x2F09, 1957, 1 },
+  { 0x2F0A, 1958, 1 },
+  { 0x2F0B, 1959, 1 },
+  { 0x2F0C, 1960, 1 },
+  { 0x2F0D, 1961, 1 },
+  { 0x2F0E, 1962, 1 },
+  { 0x2F0F, 1963, 1 },
+  { 0x2F10, 1964, 1 },
+  { 0x2F11, 1965, 1 },
+  { 0x2F12, 1966, 1 },
+  { 0x2F13, 1967, 1 },
+  { 0x2F14, 1968, 1 },
+  { 0x2F15, 1969, 1 },
+  { 0x2F16, 1970, 1 },
+  { 0x2F17, 1971, 1 },
+  { 0x2F18, 1972, 1 },
+  { 0x2F19, 1973, 1 },
+  { 0x2F1A, 1974, 1 },
+  { 0x2F1B, 1975, 1 },
+  { 0x2F1C, 1976, 1 },
+  { 0x2F1D, 1977, 1 },
+  { 0x2F1E, 1978, 1 },
+  { 0x2F1F, 1979, 1 },
+  { 0x2F20, 1980, 1 },
+  { 0x2F21, 1981, 1 },
+  { 0x2F22, 1982, 1 },
+  { 0x2F23, 1983, 1 },
+  { 0x2F24, 1984, 1 },
+  { 0x2F25, 1985, 1 },
+  { 0x2F26, 1986, 1 },
+  { 0x2F27, 1987, 1 },
+  { 0x2F28, 1988, 1 },
+  { 0x2F29, 1989, 1 },
+  { 0x2F2A, 1990, 1 },
+  { 0x2F2B, 1991, 1 },
+  { 0x2F2C, 1992, 1 },
+  { 0x2F2D, 1993, 1 },
+  { 0x2F2E, 1994, 1 },
+  { 0x2F2F, 1995, 1 },
+  { 0x2F30, 1996, 1 },
+  { 0x2F31, 1997, 1 },
+  { 0x2F32, 1998, 1 },
+  { 0x2F33, 1999, 1 },
+  { 0x2F34, 2000, 1 },
+  { 0x2F35, 2001, 1 },
+  { 0x2F36, 2002, 1 },
+  { 0x2F37, 2003, 1 },
+  { 0x2F38, 2004, 1 },
+  { 0x2F39, 2005, 1 },
+  { 0x2F3A, 2006, 1 },
+  { 0x2F3B, 2007, 1 },
+  { 0x2F3C, 2008, 1 },
+  { 0x2F3D, 2009, 1 },
+  { 0x2F3E, 2010, 1 },
+  { 0x2F3F, 2011, 1 },
+  { 0x2F40, 2012, 1 },
+  { 0x2F41, 2013, 1 },
+  { 0x2F42, 2014, 1 },
+  { 0x2F43, 2015, 1 },
+  { 0x2F44, 2016, 1 },
+  { 0x2F45, 2017, 1 },
+  { 0x2F46, 2018, 1 },
+  { 0x2F47, 2019, 1 },
+  { 0x2F48, 2020, 1 },
+  { 0x2F49, 2021, 1 },
+  { 0x2F4A, 2022, 1 },
+  { 0x2F4B, 2023, 1 },
+  { 0x2F4C, 2024, 1 },
+  { 0x2F4D, 2025, 1 },
+  { 0x2F4E, 2026, 1 },
+  { 0x2F4F, 2027, 1 },
+  { 0x2F50, 2028, 1 },
+  { 0x2F51, 2029, 1 },
+  { 0x2F52, 2030, 1 },
+  { 0x2F53, 2031, 1 },
+  { 0x2F54, 2032, 1 },
+  { 0x2F55, 2033, 1 },
+  { 0x2F56, 2034, 1 },
+  { 0x2F57, 2035, 1 },
+  { 0x2F58, 2036, 1 },
+  { 0x2F59, 2037, 1 },
+  { 0x2F5A, 2038, 1 },
+  { 0x2F5B, 2039, 1 },
+  { 0x2F5C, 2040, 1 },
+  { 0x2F5D, 2041, 1 },
+  { 0x2F5E, 2042, 1 },
+  { 0x2F5F, 2043, 1 },
+  { 0x2F60, 2044, 1 },
+  { 0x2F61, 2045, 1 },
+  { 0x2F62, 2046, 1 },
+  { 0x2F63, 2047, 1 },
+  { 0x2F64, 2048, 1 },
+  { 0x2F65, 2049, 1 },
+  { 0x2F66, 2050, 1 },
+  { 0x2F67, 2051, 1 },
+  { 0x2F68, 2052, 1 },
+  { 0x2F69, 2053, 1 },
+  { 0x2F6A, 2054, 1 },
+  { 0x2F6B, 2055, 1 },
+  { 0x2F6C, 2056, 1 },
+  { 0x2F6D, 2057, 1 },
+  { 0x2F6E, 2058, 1 },
+  { 0x2F6F, 2059, 1 },
+  { 0x2F70, 2060, 1 },
+  { 0x2F71, 2061, 1 },
+  { 0x2F72, 2062, 1 },
+  { 0x2F73, 2063, 1 },
+  { 0x2F74, 2064, 1 },
+  { 0x2F75, 2065, 1 },
+  { 0x2F76, 2066, 1 },
+  { 0x2F77, 2067, 1 },
+  { 0x2F78, 2068, 1 },
+  { 0x2F79, 2069, 1 },
+  { 0x2F7A, 2070, 1 },
+  { 0x2F7B, 2071, 1 },
+  { 0x2F7C, 2072, 1 },
+  { 0x2F7D, 2073, 1 },
+  { 0x2F7E, 2074, 1 },
+  { 0x2F7F, 2075, 1 },
+  { 0x2F80, 2076, 1 },
+  { 0x2F81, 2077, 1 },
+  { 0x2F82, 2078, 1 },
+  { 0x2F83, 2079, 1 },
+  { 0x2F84, 2080, 1 },
+  { 0x2F85, 2081, 1 },
+  { 0x2F86, 2082, 1 },
+  { 0x2F87, 2083, 1 },
+  { 0x2F88, 2084, 1 },
+  { 0x2F89, 2085, 1 },
+  { 0x2F8A, 2086, 1 },
+  { 0x2F8B, 2087, 1 },
+  { 0x2F8C, 2088, 1 },
+  { 0x2F8D, 2089, 1 },
+  { 0x2F8E, 2090, 1 },
+  { 0x2F8F, 2091, 1 },
+  { 0x2F90, 2092, 1 },
+  { 0x2F91, 2093, 1 },
+  { 0x2F92, 2094, 1 },
+  { 0x2F93, 2095, 1 },
+  { 0x2F94, 2096, 1 },
+  { 0x2F95, 2097, 1 },
+  { 0x2F96, 2098, 1 },
+  { 0x2F97, 2099, 1 },
+  { 0x2F98, 2100, 1 },
+  { 0x2F99, 2101, 1 },
+  { 0x2F9A, 2102, 1 },
+  { 0x2F9B, 2103, 1 },
+  { 0x2F9C, 2104, 1 },
+  { 0x2F9D, 2105, 1 },
+  { 0x2F9E, 2106, 1 },
+  { 0x2F9F, 2107, 1 },
+  { 0x2FA0, 2108, 1 },
+  { 0x2FA1, 2109, 1 },
+  { 0x2FA2, 2110, 1 },
+  { 0x2FA3, 2111, 1 },
+  { 0x2FA4, 2112, 1 },
+  { 0x2FA5, 2113, 1 },
+  { 0x2FA6, 2114, 1 },
+  { 0x2FA7, 2115, 1 },
+  { 0x2FA8, 2116, 1 },
+  { 0x2FA9, 2117, 1 },
+  { 0x2FAA, 2118, 1 },
+  { 0x2FAB, 2119, 1 },
+  { 0x2FAC, 2120, 1 },
+  { 0x2FAD, 2121, 1 },
+  { 0x2FAE, 2122, 1 },
+  { 0x2FAF, 2123, 1 },
+  { 0x2FB0, 2124, 1 },
+  { 0x2FB1, 2125, 1 },
+  { 0x2FB2, 2126, 1 },
+  { 0x2FB3, 2127, 1 },
+  { 0x2FB4, 2128, 1 },
+  { 0x2FB5, 2129, 1 },
+  { 0x2FB6, 2130, 1 },
+  { 0x2FB7, 2131, 1 },
+  { 0x2FB8, 2132, 1 },
+  { 0x2FB9, 2133, 1 },
+  { 0x2FBA, 2134, 1 },
+  { 0x2FBB, 2135, 1 },
+  { 0x2FBC, 2136, 1 },
+  { 0x2FBD, 2137, 1 },
+  { 0x2FBE, 2138, 1 },
+  { 0x2FBF, 2139, 1 },
+  { 0x2FC0, 2140, 1 },
+  { 0x2FC1, 2141, 1 },
+  { 0x2FC2, 2142, 1 },
+  { 0x2FC3, 2143, 1 },
+  { 0x2FC4, 2144, 1 },
+  { 0x2FC5, 2145, 1 },
+  { 0x2FC6, 2146, 1 },
+  { 0x2FC7, 2147, 1 },
+  { 0x2FC8, 2148, 1 },
+  { 0x2FC9, 2149, 1 },
+  { 0x2FCA, 2150, 1 },
+  { 0x2FCB, 2151, 1 },
+  { 0x2FCC, 2152, 1 },
+  { 0x2FCD, 2153, 1 },
+  { 0x2FCE, 2154, 1 },
+  { 0x2FCF, 2155, 1 },
+  { 0x2FD0, 2156, 1 },
+  { 0x2FD1, 2157, 1 },
+  { 0x2FD2, 2158, 1 },
+  { 0x2FD3, 2159, 1 },
+  { 0x2FD4, 2160, 1 },
+  { 0x2FD5, 2161, 1 },
+  { 0x3000, 26, 1 },
+  { 0x3036, 2162, 1 },
+  { 0x3038, 1971, 1 },
+  { 0x3039, 2163, 1 },
+  { 0x303A, 2164, 1 },
+  { 0x304C, 2165, 2 },
+  { 0x304E, 2167, 2 },
+  { 0x3050, 2169, 2 },
+  { 0x3052, 2171, 2 },
+  { 0x3054, 2173, 2 },
+  { 0x3056, 2175, 2 },
+  { 0x3058, 2177, 2 },
+  { 0x305A, 2179, 2 },
+  { 0x305C, 2181, 2 },
+  { 0x305E, 2183, 2 },
+  { 0x3060, 2185, 2 },
+  { 0x3062, 2187, 2 },
+  { 0x3065, 2189, 2 },
+  { 0x3067, 2191, 2 },
+  { 0x3069, 2193, 2 },
+  { 0x3070, 2195, 2 },
+  { 0x3071, 2197, 2 },
+  { 0x3073, 2199, 2 },
+  { 0x3074, 2201, 2 },
+  { 0x3076, 2203, 2 },
+  { 0x3077, 2205, 2 },
+  { 0x3079, 2207, 2 },
+  { 0x307A, 2209, 2 },
+  { 0x307C, 2211, 2 },
+  { 0x307D, 2213, 2 },
+  { 0x3094, 2215, 2 },
+  { 0x309B, 2217, 2 },
+  { 0x309C, 2219, 2 },
+  { 0x309E, 2221, 2 },
+  { 0x309F, 2223, 2 },
+  { 0x30AC, 2225, 2 },
+  { 0x30AE, 2227, 2 },
+  { 0x30B0, 2229, 2 },
+  { 0x30B2, 2231, 2 },
+  { 0x30B4, 2233, 2 },
+  { 0x30B6, 2235, 2 },
+  { 0x30B8, 2237, 2 },
+  { 0x30BA, 2239, 2 },
+  { 0x30BC, 2241, 2 },
+  { 0x30BE, 2243, 2 },
+  { 0x30C0, 2245, 2 },
+  { 0x30C2, 2247, 2 },
+  { 0x30C5, 2249, 2 },
+  { 0x30C7, 2251, 2 },
+  { 0x30C9, 2253, 2 },
+  { 0x30D0, 2255, 2 },
+  { 0x30D1, 2257, 2 },
+  { 0x30D3, 2259, 2 },
+  { 0x30D4, 2261, 2 },
+  { 0x30D6, 2263, 2 },
+  { 0x30D7, 2265, 2 },
+  { 0x30D9, 2267, 2 },
+  { 0x30DA, 2269, 2 },
+  { 0x30DC, 2271, 2 },
+  { 0x30DD, 2273, 2 },
+  { 0x30F4, 2275, 2 },
+  { 0x30F7, 2277, 2 },
+  { 0x30F8, 2279, 2 },
+  { 0x30F9, 2281, 2 },
+  { 0x30FA, 2283, 2 },
+  { 0x30FE, 2285, 2 },
+  { 0x30FF, 2287, 2 },
+  { 0x3131, 2289, 1 },
+  { 0x3132, 2290, 1 },
+  { 0x3133, 2291, 1 },
+  { 0x3134, 2292, 1 },
+  { 0x3135, 2293, 1 },
+  { 0x3136, 2294, 1 },
+  { 0x3137, 2295, 1 },
+  { 0x3138, 2296, 1 },
+  { 0x3139, 2297, 1 },
+  { 0x313A, 2298, 1 },
+  { 0x313B, 2299, 1 },
+  { 0x313C, 2300, 1 },
+  { 0x313D, 2301, 1 },
+  { 0x313E, 2302, 1 },
+  { 0x313F, 2303, 1 },
+  { 0x3140, 2304, 1 },
+  { 0x3141, 2305, 1 },
+  { 0x3142, 2306, 1 },
+  { 0x3143, 2307, 1 },
+  { 0x3144, 2308, 1 },
+  { 0x3145, 2309, 1 },
+  { 0x3146, 2310, 1 },
+  { 0x3147, 2311, 1 },
+  { 0x3148, 2312, 1 },
+  { 0x3149, 2313, 1 },
+  { 0x314A, 2314, 1 },
+  { 0x314B, 2315, 1 },
+  { 0x314C, 2316, 1 },
+  { 0x314D, 2317, 1 },
+  { 0x314E, 2318, 1 },
+  { 0x314F, 2319, 1 },
+  { 0x3150, 2320, 1 },
+  { 0x3151, 2321, 1 },
+  { 0x3152, 2322, 1 },
+  { 0x3153, 2323, 1 },
+  { 0x3154, 2324, 1 },
+  { 0x3155, 2325, 1 },
+  { 0x3156, 2326, 1 },
+  { 0x3157, 2327, 1 },
+  { 0x3158, 2328, 1 },
+  { 0x3159, 2329, 1 },
+  { 0x315A, 2330, 1 },
+  { 0x315B, 2331, 1 },
+  { 0x315C, 2332, 1 },
+  { 0x315D, 2333, 1 },
+  { 0x315E, 2334, 1 },
+  { 0x315F, 2335, 1 },
+  { 0x3160, 2336, 1 },
+  { 0x3161, 2337, 1 },
+  { 0x3162, 2338, 1 },
+  { 0x3163, 2339, 1 },
+  { 0x3164, 2340, 1 },
+  { 0x3165, 2341, 1 },
+  { 0x3166, 2342, 1 },
+  { 0x3167, 2343, 1 },
+  { 0x3168, 2344, 1 },
+  { 0x3169, 2345, 1 },
+  { 0x316A, 2346, 1 },
+  { 0x316B, 2347, 1 },
+  { 0x316C, 2348, 1 },
+  { 0x316D, 2349, 1 },
+  { 0x316E, 2350, 1 },
+  { 0x316F, 2351, 1 },
+  { 0x3170, 2352, 1 },
+  { 0x3171, 2353, 1 },
+  { 0x3172, 2354, 1 },
+  { 0x3173, 2355, 1 },
+  { 0x3174, 2356, 1 },
+  { 0x3175, 2357, 1 },
+  { 0x3176, 2358, 1 },
+  { 0x3177, 2359, 1 },
+  { 0x3178, 2360, 1 },
+  { 0x3179, 2361, 1 },
+  { 0x317A, 2362, 1 },
+  { 0x317B, 2363, 1 },
+  { 0x317C, 2364, 1 },
+  { 0x317D, 2365, 1 },
+  { 0x317E, 2366, 1 },
+  { 0x317F, 2367, 1 },
+  { 0x3180, 2368, 1 },
+  { 0x3181, 2369, 1 },
+  { 0x3182, 2370, 1 },
+  { 0x3183, 2371, 1 },
+  { 0x3184, 2372, 1 },
+  { 0x3185, 2373, 1 },
+  { 0x3186, 2374, 1 },
+  { 0x3187, 2375, 1 },
+  { 0x3188, 2376, 1 },
+  { 0x3189, 2377, 1 },
+  { 0x318A, 2378, 1 },
+  { 0x318B, 2379, 1 },
+  { 0x318C, 2380, 1 },
+  { 0x318D, 2381, 1 },
+  { 0x318E, 2382, 1 },
+  { 0x3192, 1948, 1 },
+  { 0x3193, 1954, 1 },
+  { 0x3194, 2383, 1 },
+  { 0x3195, 2384, 1 },
+  { 0x3196, 2385, 1 },
+  { 0x3197, 2386, 1 },
+  { 0x3198, 2387, 1 },
+  { 0x3199, 2388, 1 },
+  { 0x319A, 1952, 1 },
+  { 0x319B, 2389, 1 },
+  { 0x319C, 2390, 1 },
+  { 0x319D, 2391, 1 },
+  { 0x319E, 2392, 1 },
+  { 0x319F, 1956, 1 },
+  { 0x3200, 2393, 3 },
+  { 0x3201, 2396, 3 },
+  { 0x3202, 2399, 3 },
+  { 0x3203, 2402, 3 },
+  { 0x3204, 2405, 3 },
+  { 0x3205, 2408, 3 },
+  { 0x3206, 2411, 3 },
+  { 0x3207, 2414, 3 },
+  { 0x3208, 2417, 3 },
+  { 0x3209, 2420, 3 },
+  { 0x320A, 2423, 3 },
+  { 0x320B, 2426, 3 },
+  { 0x320C, 2429, 3 },
+  { 0x320D, 2432, 3 },
+  { 0x320E, 2435, 4 },
+  { 0x320F, 2439, 4 },
+  { 0x3210, 2443, 4 },
+  { 0x3211, 2447, 4 },
+  { 0x3212, 2451, 4 },
+  { 0x3213, 2455, 4 },
+  { 0x3214, 2459, 4 },
+  { 0x3215, 2463, 4 },
+  { 0x3216, 2467, 4 },
+  { 0x3217, 2471, 4 },
+  { 0x3218, 2475, 4 },
+  { 0x3219, 2479, 4 },
+  { 0x321A, 2483, 4 },
+  { 0x321B, 2487, 4 },
+  { 0x321C, 2491, 4 },
+  { 0x3220, 2495, 3 },
+  { 0x3221, 2498, 3 },
+  { 0x3222, 2501, 3 },
+  { 0x3223, 2504, 3 },
+  { 0x3224, 2507, 3 },
+  { 0x3225, 2510, 3 },
+  { 0x3226, 2513, 3 },
+  { 0x3227, 2516, 3 },
+  { 0x3228, 2519, 3 },
+  { 0x3229, 2522, 3 },
+  { 0x322A, 2525, 3 },
+  { 0x322B, 2528, 3 },
+  { 0x322C, 2531, 3 },
+  { 0x322D, 2534, 3 },
+  { 0x322E, 2537, 3 },
+  { 0x322F, 2540, 3 },
+  { 0x3230, 2543, 3 },
+  { 0x3231, 2546, 3 },
+  { 0x3232, 2549, 3 },
+  { 0x3233, 2552, 3 },
+  { 0x3234, 2555, 3 },
+  { 0x3235, 2558, 3 },
+  { 0x3236, 2561, 3 },
+  { 0x3237, 2564, 3 },
+  { 0x3238, 2567, 3 },
+  { 0x3239, 2570, 3 },
+  { 0x323A, 2573, 3 },
+  { 0x323B, 2576, 3 },
+  { 0x323C, 2579, 3 },
+  { 0x323D, 2582, 3 },
+  { 0x323E, 2585, 3 },
+  { 0x323F, 2588, 3 },
+  { 0x3240, 2591, 3 },
+  { 0x3241, 2594, 3 },
+  { 0x3242, 2597, 3 },
+  { 0x3243, 2600, 3 },
+  { 0x3251, 2603, 2 },
+  { 0x3252, 2605, 2 },
+  { 0x3253, 2607, 2 },
+  { 0x3254, 2609, 2 },
+  { 0x3255, 2611, 2 },
+  { 0x3256, 2613, 2 },
+  { 0x3257, 2615, 2 },
+  { 0x3258, 2617, 2 },
+  { 0x3259, 2619, 2 },
+  { 0x325A, 2621, 2 },
+  { 0x325B, 2623, 2 },
+  { 0x325C, 2625, 2 },
+  { 0x325D, 2627, 2 },
+  { 0x325E, 2629, 2 },
+  { 0x325F, 2631, 2 },
+  { 0x3260, 2289, 1 },
+  { 0x3261, 2292, 1 },
+  { 0x3262, 2295, 1 },
+  { 0x3263, 2297, 1 },
+  { 0x3264, 2305, 1 },
+  { 0x3265, 2306, 1 },
+  { 0x3266, 2309, 1 },
+  { 0x3267, 2311, 1 },
+  { 0x3268, 2312, 1 },
+  { 0x3269, 2314, 1 },
+  { 0x326A, 2315, 1 },
+  { 0x326B, 2316, 1 },
+  { 0x326C, 2317, 1 },
+  { 0x326D, 2318, 1 },
+  { 0x326E, 2633, 2 },
+  { 0x326F, 2635, 2 },
+  { 0x3270, 2637, 2 },
+  { 0x3271, 2639, 2 },
+  { 0x3272, 2641, 2 },
+  { 0x3273, 2643, 2 },
+  { 0x3274, 2645, 2 },
+  { 0x3275, 2647, 2 },
+  { 0x3276, 2649, 2 },
+  { 0x3277, 2651, 2 },
+  { 0x3278, 2653, 2 },
+  { 0x3279, 2655, 2 },
+  { 0x327A, 2657, 2 },
+  { 0x327B, 2659, 2 },
+  { 0x3280, 1948, 1 },
+  { 0x3281, 1954, 1 },
+  { 0x3282, 2383, 1 },
+  { 0x3283, 2384, 1 },
+  { 0x3284, 2661, 1 },
+  { 0x3285, 2662, 1 },
+  { 0x3286, 2663, 1 },
+  { 0x3287, 1959, 1 },
+  { 0x3288, 2664, 1 },
+  { 0x3289, 1971, 1 },
+  { 0x328A, 2021, 1 },
+  { 0x328B, 2033, 1 },
+  { 0x328C, 2032, 1 },
+  { 0x328D, 2022, 1 },
+  { 0x328E, 2114, 1 },
+  { 0x328F, 1979, 1 },
+  { 0x3290, 2019, 1 },
+  { 0x3291, 2665, 1 },
+  { 0x3292, 2666, 1 },
+  { 0x3293, 2667, 1 },
+  { 0x3294, 2668, 1 },
+  { 0x3295, 2669, 1 },
+  { 0x3296, 2670, 1 },
+  { 0x3297, 2671, 1 },
+  { 0x3298, 2672, 1 },
+  { 0x3299, 2673, 1 },
+  { 0x329A, 2674, 1 },
+  { 0x329B, 1985, 1 },
+  { 0x329C, 2675, 1 },
+  { 0x329D, 2676, 1 },
+  { 0x329E, 2677, 1 },
+  { 0x329F, 2678, 1 },
+  { 0x32A0, 2679, 1 },
+  { 0x32A1, 2680, 1 },
+  { 0x32A2, 2681, 1 },
+  { 0x32A3, 2682, 1 },
+  { 0x32A4, 2385, 1 },
+  { 0x32A5, 2386, 1 },
+  { 0x32A6, 2387, 1 },
+  { 0x32A7, 2683, 1 },
+  { 0x32A8, 2684, 1 },
+  { 0x32A9, 2685, 1 },
+  { 0x32AA, 2686, 1 },
+  { 0x32AB, 2687, 1 },
+  { 0x32AC, 2688, 1 },
+  { 0x32AD, 2689, 1 },
+  { 0x32AE, 2690, 1 },
+  { 0x32AF, 2691, 1 },
+  { 0x32B0, 2692, 1 },
+  { 0x32B1, 2693, 2 },
+  { 0x32B2, 2695, 2 },
+  { 0x32B3, 2697, 2 },
+  { 0x32B4, 2699, 2 },
+  { 0x32B5, 2701, 2 },
+  { 0x32B6, 2703, 2 },
+  { 0x32B7, 2705, 2 },
+  { 0x32B8, 2707, 2 },
+  { 0x32B9, 2709, 2 },
+  { 0x32BA, 2711, 2 },
+  { 0x32BB, 2713, 2 },
+  { 0x32BC, 2715, 2 },
+  { 0x32BD, 2717, 2 },
+  { 0x32BE, 2719, 2 },
+  { 0x32BF, 2721, 2 },
+  { 0x32C0, 2723, 2 },
+  { 0x32C1, 2725, 2 },
+  { 0x32C2, 2727, 2 },
+  { 0x32C3, 2729, 2 },
+  { 0x32C4, 2731, 2 },
+  { 0x32C5, 2733, 2 },
+  { 0x32C6, 2735, 2 },
+  { 0x32C7, 2737, 2 },
+  { 0x32C8, 2739, 2 },
+  { 0x32C9, 2741, 3 },
+  { 0x32CA, 2744, 3 },
+  { 0x32CB, 2747, 3 },
+  { 0x32D0, 2750, 1 },
+  { 0x32D1, 2751, 1 },
+  { 0x32D2, 2752, 1 },
+  { 0x32D3, 2753, 1 },
+  { 0x32D4, 2754, 1 },
+  { 0x32D5, 2755, 1 },
+  { 0x32D6, 2756, 1 },
+  { 0x32D7, 2757, 1 },
+  { 0x32D8, 2758, 1 },
+  { 0x32D9, 2759, 1 },
+  { 0x32DA, 2760, 1 },
+  { 0x32DB, 2761, 1 },
+  { 0x32DC, 2762, 1 },
+  { 0x32DD, 2763, 1 },
+  { 0x32DE, 2764, 1 },
+  { 0x32DF, 2765, 1 },
+  { 0x32E0, 2766, 1 },
+  { 0x32E1, 2767, 1 },
+  { 0x32E2, 2768, 1 },
+  { 0x32E3, 2769, 1 },
+  { 0x32E4, 2770, 1 },
+  { 0x32E5, 2771, 1 },
+  { 0x32E6, 2772, 1 },
+  { 0x32E7, 2773, 1 },
+  { 0x32E8, 2774, 1 },
+  { 0x32E9, 2775, 1 },
+  { 0x32EA, 2776, 1 },
+  { 0x32EB, 2777, 1 },
+  { 0x32EC, 2778, 1 },
+  { 0x32ED, 2779, 1 },
+  { 0x32EE, 2780, 1 },
+  { 0x32EF, 2781, 1 },
+  { 0x32F0, 2782, 1 },
+  { 0x32F1, 2783, 1 },
+  { 0x32F2, 2784, 1 },
+  { 0x32F3, 2785, 1 },
+  { 0x32F4, 2786, 1 },
+  { 0x32F5, 2787, 1 },
+  { 0x32F6, 2788, 1 },
+  { 0x32F7, 2789, 1 },
+  { 0x32F8, 2790, 1 },
+  { 0x32F9, 2791, 1 },
+  { 0x32FA, 2792, 1 },
+  { 0x32FB, 2793, 1 },
+  { 0x32FC, 2794, 1 },
+  { 0x32FD, 2795, 1 },
+  { 0x32FE, 2796, 1 },
+  { 0x3300, 2797, 5 },
+  { 0x3301, 2802, 4 },
+  { 0x3302, 2806, 5 },
+  { 0x3303, 2811, 3 },
+  { 0x3304, 2814, 5 },
+  { 0x3305, 2819, 3 },
+  { 0x3306, 2822, 3 },
+  { 0x3307, 2825, 6 },
+  { 0x3308, 2831, 4 },
+  { 0x3309, 2835, 3 },
+  { 0x330A, 2838, 3 },
+  { 0x330B, 2841, 3 },
+  { 0x330C, 2844, 4 },
+  { 0x330D, 2848, 4 },
+  { 0x330E, 2852, 4 },
+  { 0x330F, 2856, 4 },
+  { 0x3310, 2860, 4 },
+  { 0x3311, 2864, 4 },
+  { 0x3312, 2868, 4 },
+  { 0x3313, 2872, 6 },
+  { 0x3314, 2878, 2 },
+  { 0x3315, 2880, 6 },
+  { 0x3316, 2886, 6 },
+  { 0x3317, 2892, 5 },
+  { 0x3318, 2897, 4 },
+  { 0x3319, 2901, 6 },
+  { 0x331A, 2907, 6 },
+  { 0x331B, 2913, 4 },
+  { 0x331C, 2917, 3 },
+  { 0x331D, 2920, 3 },
+  { 0x331E, 2923, 4 },
+  { 0x331F, 2927, 4 },
+  { 0x3320, 2931, 5 },
+  { 0x3321, 2936, 5 },
+  { 0x3322, 2941, 3 },
+  { 0x3323, 2944, 3 },
+  { 0x3324, 2947, 4 },
+  { 0x3325, 2951, 3 },
+  { 0x3326, 2954, 3 },
+  { 0x3327, 2957, 2 },
+  { 0x3328, 2959, 2 },
+  { 0x3329, 2961, 3 },
+  { 0x332A, 2964, 3 },
+  { 0x332B, 2967, 6 },
+  { 0x332C, 2973, 4 },
+  { 0x332D, 2977, 5 },
+  { 0x332E, 2982, 6 },
+  { 0x332F, 2988, 4 },
+  { 0x3330, 2992, 3 },
+  { 0x3331, 2995, 3 },
+  { 0x3332, 2998, 6 },
+  { 0x3333, 3004, 4 },
+  { 0x3334, 3008, 6 },
+  { 0x3335, 3014, 3 },
+  { 0x3336, 3017, 5 },
+  { 0x3337, 3022, 3 },
+  { 0x3338, 3025, 4 },
+  { 0x3339, 3029, 3 },
+  { 0x333A, 3032, 4 },
+  { 0x333B, 3036, 5 },
+  { 0x333C, 3041, 4 },
+  { 0x333D, 3045, 5 },
+  { 0x333E, 3050, 4 },
+  { 0x333F, 3054, 2 },
+  { 0x3340, 3056, 5 },
+  { 0x3341, 3061, 3 },
+  { 0x3342, 3064, 3 },
+  { 0x3343, 3067, 4 },
+  { 0x3344, 3071, 3 },
+  { 0x3345, 3074, 3 },
+  { 0x3346, 3077, 3 },
+  { 0x3347, 3080, 5 },
+  { 0x3348, 3085, 4 },
+  { 0x3349, 3089, 2 },
+  { 0x334A, 3091, 6 },
+  { 0x334B, 3097, 3 },
+  { 0x334C, 3100, 5 },
+  { 0x334D, 3105, 4 },
+  { 0x334E, 3109, 4 },
+  { 0x334F, 3113, 3 },
+  { 0x3350, 3116, 3 },
+  { 0x3351, 3119, 4 },
+  { 0x3352, 3123, 2 },
+  { 0x3353, 3125, 4 },
+  { 0x3354, 3129, 5 },
+  { 0x3355, 3134, 2 },
+  { 0x3356, 3136, 6 },
+  { 0x3357, 3142, 3 },
+  { 0x3358, 3145, 2 },
+  { 0x3359, 3147, 2 },
+  { 0x335A, 3149, 2 },
+  { 0x335B, 3151, 2 },
+  { 0x335C, 3153, 2 },
+  { 0x335D, 3155, 2 },
+  { 0x335E, 3157, 2 },
+  { 0x335F, 3159, 2 },
+  { 0x3360, 3161, 2 },
+  { 0x3361, 3163, 2 },
+  { 0x3362, 3165, 3 },
+  { 0x3363, 3168, 3 },
+  { 0x3364, 3171, 3 },
+  { 0x3365, 3174, 3 },
+  { 0x3366, 3177, 3 },
+  { 0x3367, 3180, 3 },
+  { 0x3368, 3183, 3 },
+  { 0x3369, 3186, 3 },
+  { 0x336A, 3189, 3 },
+  { 0x336B, 3192, 3 },
+  { 0x336C, 3195, 3 },
+  { 0x336D, 3198, 3 },
+  { 0x336E, 3201, 3 },
+  { 0x336F, 3204, 3 },
+  { 0x3370, 3207, 3 },
+  { 0x3371, 3210, 3 },
+  { 0x3372, 3213, 2 },
+  { 0x3373, 3215, 2 },
+  { 0x3374, 3217, 3 },
+  { 0x3375, 3220, 2 },
+  { 0x3376, 3222, 2 },
+  { 0x337B, 3224, 2 },
+  { 0x337C, 3226, 2 },
+  { 0x337D, 3228, 2 },
+  { 0x337E, 3230, 2 },
+  { 0x337F, 3232, 4 },
+  { 0x3380, 3236, 2 },
+  { 0x3381, 3238, 2 },
+  { 0x3382, 3240, 2 },
+  { 0x3383, 3242, 2 },
+  { 0x3384, 3244, 2 },
+  { 0x3385, 3246, 2 },
+  { 0x3386, 3248, 2 },
+  { 0x3387, 3250, 2 },
+  { 0x3388, 3252, 3 },
+  { 0x3389, 3255, 4 },
+  { 0x338A, 3259, 2 },
+  { 0x338B, 3261, 2 },
+  { 0x338C, 3263, 2 },
+  { 0x338D, 3265, 2 },
+  { 0x338E, 3267, 2 },
+  { 0x338F, 3269, 2 },
+  { 0x3390, 3271, 2 },
+  { 0x3391, 3273, 3 },
+  { 0x3392, 3276, 3 },
+  { 0x3393, 3279, 3 },
+  { 0x3394, 3282, 3 },
+  { 0x3395, 3285, 2 },
+  { 0x3396, 3287, 2 },
+  { 0x3397, 3289, 2 },
+  { 0x3398, 3291, 2 },
+  { 0x3399, 3293, 2 },
+  { 0x339A, 3295, 2 },
+  { 0x339B, 3297, 2 },
+  { 0x339C, 3299, 2 },
+  { 0x339D, 3301, 2 },
+  { 0x339E, 3303, 2 },
+  { 0x339F, 3305, 3 },
+  { 0x33A0, 3308, 3 },
+  { 0x33A1, 3311, 2 },
+  { 0x33A2, 3313, 3 },
+  { 0x33A3, 3316, 3 },
+  { 0x33A4, 3319, 3 },
+  { 0x33A5, 3322, 2 },
+  { 0x33A6, 3324, 3 },
+  { 0x33A7, 3327, 3 },
+  { 0x33A8, 3330, 4 },
+  { 0x33A9, 3236, 2 },
+  { 0x33AA, 3334, 3 },
+  { 0x33AB, 3337, 3 },
+  { 0x33AC, 3340, 3 },
+  { 0x33AD, 3343, 3 },
+  { 0x33AE, 3346, 5 },
+  { 0x33AF, 3351, 6 },
+  { 0x33B0, 3357, 2 },
+  { 0x33B1, 3359, 2 },
+  { 0x33B2, 3361, 2 },
+  { 0x33B3, 3363, 2 },
+  { 0x33B4, 3365, 2 },
+  { 0x33B5, 3367, 2 },
+  { 0x33B6, 3369, 2 },
+  { 0x33B7, 3371, 2 },
+  { 0x33B8, 3373, 2 },
+  { 0x33B9, 3371, 2 },
+  { 0x33BA, 3375, 2 },
+  { 0x33BB, 3377, 2 },
+  { 0x33BC, 3379, 2 },
+  { 0x33BD, 3381, 2 },
+  { 0x33BE, 3383, 2 },
+  { 0x33BF, 3381, 2 },
+  { 0x33C0, 3385, 2 },
+  { 0x33C1, 3387, 2 },
+  { 0x33C2, 3389, 4 },
+  { 0x33C3, 3393, 2 },
+  { 0x33C4, 3395, 2 },
+  { 0x33C5, 3397, 2 },
+  { 0x33C6, 3399, 4 },
+  { 0x33C7, 3403, 3 },
+  { 0x33C8, 3406, 2 },
+  { 0x33C9, 3408, 2 },
+  { 0x33CA, 3410, 2 },
+  { 0x33CB, 3412, 2 },
+  { 0x33CC, 3414, 2 },
+  { 0x33CD, 3416, 2 },
+  { 0x33CE, 3303, 2 },
+  { 0x33CF, 3418, 2 },
+  { 0x33D0, 3420, 2 },
+  { 0x33D1, 3422, 2 },
+  { 0x33D2, 3424, 3 },
+  { 0x33D3, 3427, 2 },
+  { 0x33D4, 3248, 2 },
+  { 0x33D5, 3429, 3 },
+  { 0x33D6, 3432, 3 },
+  { 0x33D7, 3435, 2 },
+  { 0x33D8, 3437, 4 },
+  { 0x33D9, 3441, 3 },
+  { 0x33DA, 3444, 2 },
+  { 0x33DB, 3446, 2 },
+  { 0x33DC, 3448, 2 },
+  { 0x33DD, 3450, 2 },
+  { 0x33E0, 3452, 2 },
+  { 0x33E1, 3454, 2 },
+  { 0x33E2, 3456, 2 },
+  { 0x33E3, 3458, 2 },
+  { 0x33E4, 3460, 2 },
+  { 0x33E5, 3462, 2 },
+  { 0x33E6, 3464, 2 },
+  { 0x33E7, 3466, 2 },
+  { 0x33E8, 3468, 2 },
+  { 0x33E9, 3470, 3 },
+  { 0x33EA, 3473, 3 },
+  { 0x33EB, 3476, 3 },
+  { 0x33EC, 3479, 3 },
+  { 0x33ED, 3482, 3 },
+  { 0x33EE, 3485, 3 },
+  { 0x33EF, 3488, 3 },
+  { 0x33F0, 3491, 3 },
+  { 0x33F1, 3494, 3 },
+  { 0x33F2, 3497, 3 },
+  { 0x33F3, 3500, 3 },
+  { 0x33F4, 3503, 3 },
+  { 0x33F5, 3506, 3 },
+  { 0x33F6, 3509, 3 },
+  { 0x33F7, 3512, 3 },
+  { 0x33F8, 3515, 3 },
+  { 0x33F9, 3518, 3 },
+  { 0x33FA, 3521, 3 },
+  { 0x33FB, 3524, 3 },
+  { 0x33FC, 3527, 3 },
+  { 0x33FD, 3530, 3 },
+  { 0x33FE, 3533, 3 },
+  { 0xF900, 3536, 1 },
+  { 0xF901, 3537, 1 },
+  { 0xF902, 2106, 1 },
+  { 0xF903, 3538, 1 },
+  { 0xF904, 3539, 1 },
+  { 0xF905, 3540, 1 },
+  { 0xF906, 3541, 1 },
+  { 0xF907, 2160, 1 },
+  { 0xF908, 2160, 1 },
+  { 0xF909, 3542, 1 },
+  { 0xF90A, 2114, 1 },
+  { 0xF90B, 3543, 1 },
+  { 0xF90C, 3544, 1 },
+  { 0xF90D, 3545, 1 },
+  { 0xF90E, 3546, 1 },
+  { 0xF90F, 3547, 1 },
+  { 0xF910, 3548, 1 },
+  { 0xF911, 3549, 1 },
+  { 0xF912, 3550, 1 },
+  { 0xF913, 3551, 1 },
+  { 0xF914, 3552, 1 },
+  { 0xF915, 3553, 1 },
+  { 0xF916, 3554, 1 },
+  { 0xF917, 3555, 1 },
+  { 0xF918, 3556, 1 },
+  { 0xF919, 3557, 1 },
+  { 0xF91A, 3558, 1 },
+  { 0xF91B, 3559, 1 },
+  { 0xF91C, 3560, 1 },
+  { 0xF91D, 3561, 1 },
+  { 0xF91E, 3562, 1 },
+  { 0xF91F, 3563, 1 },
+  { 0xF920, 3564, 1 },
+  { 0xF921, 3565, 1 },
+  { 0xF922, 3566, 1 },
+  { 0xF923, 3567, 1 },
+  { 0xF924, 3568, 1 },
+  { 0xF925, 3569, 1 },
+  { 0xF926, 3570, 1 },
+  { 0xF927, 3571, 1 },
+  { 0xF928, 3572, 1 },
+  { 0xF929, 3573, 1 },
+  { 0xF92A, 3574, 1 },
+  { 0xF92B, 3575, 1 },
+  { 0xF92C, 3576, 1 },
+  { 0xF92D, 3577, 1 },
+  { 0xF92E, 3578, 1 },
+  { 0xF92F, 3579, 1 },
+  { 0xF930, 3580, 1 },
+  { 0xF931, 3581, 1 },
+  { 0xF932, 3582, 1 },
+  { 0xF933, 3583, 1 },
+  { 0xF934, 2072, 1 },
+  { 0xF935, 3584, 1 },
+  { 0xF936, 3585, 1 },
+  { 0xF937, 3586, 1 },
+  { 0xF938, 3587, 1 },
+  { 0xF939, 3588, 1 },
+  { 0xF93A, 3589, 1 },
+  { 0xF93B, 3590, 1 },
+  { 0xF93C, 3591, 1 },
+  { 0xF93D, 3592, 1 },
+  { 0xF93E, 3593, 1 },
+  { 0xF93F, 3594, 1 },
+  { 0xF940, 2145, 1 },
+  { 0xF941, 3595, 1 },
+  { 0xF942, 3596, 1 },
+  { 0xF943, 3597, 1 },
+  { 0xF944, 3598, 1 },
+  { 0xF945, 3599, 1 },
+  { 0xF946, 3600, 1 },
+  { 0xF947, 3601, 1 },
+  { 0xF948, 3602, 1 },
+  { 0xF949, 3603, 1 },
+  { 0xF94A, 3604, 1 },
+  { 0xF94B, 3605, 1 },
+  { 0xF94C, 3606, 1 },
+  { 0xF94D, 3607, 1 },
+  { 0xF94E, 3608, 1 },
+  { 0xF94F, 3609, 1 },
+  { 0xF950, 3610, 1 },
+  { 0xF951, 3611, 1 },
+  { 0xF952, 3612, 1 },
+  { 0xF953, 3613, 1 },
+  { 0xF954, 3614, 1 },
+  { 0xF955, 3615, 1 },
+  { 0xF956, 3616, 1 },
+  { 0xF957, 3617, 1 },
+  { 0xF958, 3618, 1 },
+  { 0xF959, 3619, 1 },
+  { 0xF95A, 3620, 1 },
+  { 0xF95B, 3621, 1 },
+  { 0xF95C, 3552, 1 },
+  { 0xF95D, 3622, 1 },
+  { 0xF95E, 3623, 1 },
+  { 0xF95F, 3624, 1 },
+  { 0xF960, 3625, 1 },
+  { 0xF961, 3626, 1 },
+  { 0xF962, 3627, 1 },
+  { 0xF963, 3628, 1 },
+  { 0xF964, 3629, 1 },
+  { 0xF965, 3630, 1 },
+  { 0xF966, 3631, 1 },
+  { 0xF967, 3632, 1 },
+  { 0xF968, 3633, 1 },
+  { 0xF969, 3634, 1 },
+  { 0xF96A, 3635, 1 },
+  { 0xF96B, 3636, 1 },
+  { 0xF96C, 3637, 1 },
+  { 0xF96D, 3638, 1 },
+  { 0xF96E, 3639, 1 },
+  { 0xF96F, 3640, 1 },
+  { 0xF970, 3641, 1 },
+  { 0xF971, 2108, 1 },
+  { 0xF972, 3642, 1 },
+  { 0xF973, 3643, 1 },
+  { 0xF974, 3644, 1 },
+  { 0xF975, 3645, 1 },
+  { 0xF976, 3646, 1 },
+  { 0xF977, 3647, 1 },
+  { 0xF978, 3648, 1 },
+  { 0xF979, 3649, 1 },
+  { 0xF97A, 3650, 1 },
+  { 0xF97B, 3651, 1 },
+  { 0xF97C, 3652, 1 },
+  { 0xF97D, 3653, 1 },
+  { 0xF97E, 3654, 1 },
+  { 0xF97F, 3655, 1 },
+  { 0xF980, 3656, 1 },
+  { 0xF981, 1985, 1 },
+  { 0xF982, 3657, 1 },
+  { 0xF983, 3658, 1 },
+  { 0xF984, 3659, 1 },
+  { 0xF985, 3660, 1 },
+  { 0xF986, 3661, 1 },
+  { 0xF987, 3662, 1 },
+  { 0xF988, 3663, 1 },
+  { 0xF989, 3664, 1 },
+  { 0xF98A, 1966, 1 },
+  { 0xF98B, 3665, 1 },
+  { 0xF98C, 3666, 1 },
+  { 0xF98D, 3667, 1 },
+  { 0xF98E, 3668, 1 },
+  { 0xF98F, 3669, 1 },
+  { 0xF990, 3670, 1 },
+  { 0xF991, 3671, 1 },
+  { 0xF992, 3672, 1 },
+  { 0xF993, 3673, 1 },
+  { 0xF994, 3674, 1 },
+  { 0xF995, 3675, 1 },
+  { 0xF996, 3676, 1 },
+  { 0xF997, 3677, 1 },
+  { 0xF998, 3678, 1 },
+  { 0xF999, 3679, 1 },
+  { 0xF99A, 3680, 1 },
+  { 0xF99B, 3681, 1 },
+  { 0xF99C, 3682, 1 },
+  { 0xF99D, 3683, 1 },
+  { 0xF99E, 3684, 1 },
+  { 0xF99F, 3685, 1 },
+  { 0xF9A0, 3686, 1 },
+  { 0xF9A1, 3640, 1 },
+  { 0xF9A2, 3687, 1 },
+  { 0xF9A3, 3688, 1 },
+  { 0xF9A4, 3689, 1 },
+  { 0xF9A5, 3690, 1 },
+  { 0xF9A6, 3691, 1 },
+  { 0xF9A7, 3692, 1 },
+  { 0xF9A8, 3693, 1 },
+  { 0xF9A9, 3694, 1 },
+  { 0xF9AA, 3624, 1 },
+  { 0xF9AB, 3695, 1 },
+  { 0xF9AC, 3696, 1 },
+  { 0xF9AD, 3697, 1 },
+  { 0xF9AE, 3698, 1 },
+  { 0xF9AF, 3699, 1 },
+  { 0xF9B0, 3700, 1 },
+  { 0xF9B1, 3701, 1 },
+  { 0xF9B2, 3702, 1 },
+  { 0xF9B3, 3703, 1 },
+  { 0xF9B4, 3704, 1 },
+  { 0xF9B5, 3705, 1 },
+  { 0xF9B6, 3706, 1 },
+  { 0xF9B7, 3707, 1 },
+  { 0xF9B8, 3708, 1 },
+  { 0xF9B9, 3709, 1 },
+  { 0xF9BA, 3710, 1 },
+  { 0xF9BB, 3711, 1 },
+  { 0xF9BC, 3712, 1 },
+  { 0xF9BD, 3713, 1 },
+  { 0xF9BE, 3714, 1 },
+  { 0xF9BF, 3552, 1 },
+  { 0xF9C0, 3715, 1 },
+  { 0xF9C1, 3716, 1 },
+  { 0xF9C2, 3717, 1 },
+  { 0xF9C3, 3718, 1 },
+  { 0xF9C4, 2159, 1 },
+  { 0xF9C5, 3719, 1 },
+  { 0xF9C6, 3720, 1 },
+  { 0xF9C7, 3721, 1 },
+  { 0xF9C8, 3722, 1 },
+  { 0xF9C9, 3723, 1 },
+  { 0xF9CA, 3724, 1 },
+  { 0xF9CB, 3725, 1 },
+  { 0xF9CC, 3726, 1 },
+  { 0xF9CD, 3727, 1 },
+  { 0xF9CE, 3728, 1 },
+  { 0xF9CF, 3729, 1 },
+  { 0xF9D0, 3730, 1 },
+  { 0xF9D1, 2662, 1 },
+  { 0xF9D2, 3731, 1 },
+  { 0xF9D3, 3732, 1 },
+  { 0xF9D4, 3733, 1 },
+  { 0xF9D5, 3734, 1 },
+  { 0xF9D6, 3735, 1 },
+  { 0xF9D7, 3736, 1 },
+  { 0xF9D8, 3737, 1 },
+  { 0xF9D9, 3738, 1 },
+  { 0xF9DA, 3739, 1 },
+  { 0xF9DB, 3626, 1 },
+  { 0xF9DC, 3740, 1 },
+  { 0xF9DD, 3741, 1 },
+  { 0xF9DE, 3742, 1 },
+  { 0xF9DF, 3743, 1 },
+  { 0xF9E0, 3744, 1 },
+  { 0xF9E1, 3745, 1 },
+  { 0xF9E2, 3746, 1 },
+  { 0xF9E3, 3747, 1 },
+  { 0xF9E4, 3748, 1 },
+  { 0xF9E5, 3749, 1 },
+  { 0xF9E6, 3750, 1 },
+  { 0xF9E7, 3751, 1 },
+  { 0xF9E8, 3752, 1 },
+  { 0xF9E9, 2113, 1 },
+  { 0xF9EA, 3753, 1 },
+  { 0xF9EB, 3754, 1 },
+  { 0xF9EC, 3755, 1 },
+  { 0xF9ED, 3756, 1 },
+  { 0xF9EE, 3757, 1 },
+  { 0xF9EF, 3758, 1 },
+  { 0xF9F0, 3759, 1 },
+  { 0xF9F1, 3760, 1 },
+  { 0xF9F2, 3761, 1 },
+  { 0xF9F3, 3762, 1 },
+  { 0xF9F4, 3763, 1 },
+  { 0xF9F5, 3764, 1 },
+  { 0xF9F6, 3765, 1 },
+  { 0xF9F7, 2064, 1 },
+  { 0xF9F8, 3766, 1 },
+  { 0xF9F9, 3767, 1 },
+  { 0xF9FA, 3768, 1 },
+  { 0xF9FB, 3769, 1 },
+  { 0xF9FC, 3770, 1 },
+  { 0xF9FD, 3771, 1 },
+  { 0xF9FE, 3772, 1 },
+  { 0xF9FF, 3773, 1 },
+  { 0xFA00, 3774, 1 },
+  { 0xFA01, 3775, 1 },
+  { 0xFA02, 3776, 1 },
+  { 0xFA03, 3777, 1 },
+  { 0xFA04, 3778, 1 },
+  { 0xFA05, 3779, 1 },
+  { 0xFA06, 3780, 1 },
+  { 0xFA07, 3781, 1 },
+  { 0xFA08, 2091, 1 },
+  { 0xFA09, 3782, 1 },
+  { 0xFA0A, 2094, 1 },
+  { 0xFA0B, 3783, 1 },
+  { 0xFA0C, 3784, 1 },
+  { 0xFA0D, 3785, 1 },
+  { 0xFA10, 3786, 1 },
+  { 0xFA12, 3787, 1 },
+  { 0xFA15, 3788, 1 },
+  { 0xFA16, 3789, 1 },
+  { 0xFA17, 3790, 1 },
+  { 0xFA18, 3791, 1 },
+  { 0xFA19, 3792, 1 },
+  { 0xFA1A, 3793, 1 },
+  { 0xFA1B, 3794, 1 },
+  { 0xFA1C, 3795, 1 },
+  { 0xFA1D, 3796, 1 },
+  { 0xFA1E, 2071, 1 },
+  { 0xFA20, 3797, 1 },
+  { 0xFA22, 3798, 1 },
+  { 0xFA25, 3799, 1 },
+  { 0xFA26, 3800, 1 },
+  { 0xFA2A, 3801, 1 },
+  { 0xFA2B, 3802, 1 },
+  { 0xFA2C, 3803, 1 },
+  { 0xFA2D, 3804, 1 },
+  { 0xFA30, 3805, 1 },
+  { 0xFA31, 3806, 1 },
+  { 0xFA32, 3807, 1 },
+  { 0xFA33, 3808, 1 },
+  { 0xFA34, 3809, 1 },
+  { 0xFA35, 3810, 1 },
+  { 0xFA36, 3811, 1 },
+  { 0xFA37, 3812, 1 },
+  { 0xFA38, 3813, 1 },
+  { 0xFA39, 3814, 1 },
+  { 0xFA3A, 3815, 1 },
+  { 0xFA3B, 3816, 1 },
+  { 0xFA3C, 1992, 1 },
+  { 0xFA3D, 3817, 1 },
+  { 0xFA3E, 3818, 1 },
+  { 0xFA3F, 3819, 1 },
+  { 0xFA40, 3820, 1 },
+  { 0xFA41, 3821, 1 },
+  { 0xFA42, 3822, 1 },
+  { 0xFA43, 3823, 1 },
+  { 0xFA44, 3824, 1 },
+  { 0xFA45, 3825, 1 },
+  { 0xFA46, 3826, 1 },
+  { 0xFA47, 3827, 1 },
+  { 0xFA48, 3828, 1 },
+  { 0xFA49, 3829, 1 },
+  { 0xFA4A, 3830, 1 },
+  { 0xFA4B, 3831, 1 },
+  { 0xFA4C, 2667, 1 },
+  { 0xFA4D, 3832, 1 },
+  { 0xFA4E, 3833, 1 },
+  { 0xFA4F, 3834, 1 },
+  { 0xFA50, 3835, 1 },
+  { 0xFA51, 2671, 1 },
+  { 0xFA52, 3836, 1 },
+  { 0xFA53, 3837, 1 },
+  { 0xFA54, 3838, 1 },
+  { 0xFA55, 3839, 1 },
+  { 0xFA56, 3840, 1 },
+  { 0xFA57, 3676, 1 },
+  { 0xFA58, 3841, 1 },
+  { 0xFA59, 3842, 1 },
+  { 0xFA5A, 3843, 1 },
+  { 0xFA5B, 3844, 1 },
+  { 0xFA5C, 3845, 1 },
+  { 0xFA5D, 3846, 1 },
+  { 0xFA5E, 3846, 1 },
+  { 0xFA5F, 3847, 1 },
+  { 0xFA60, 3848, 1 },
+  { 0xFA61, 3849, 1 },
+  { 0xFA62, 3850, 1 },
+  { 0xFA63, 3851, 1 },
+  { 0xFA64, 3852, 1 },
+  { 0xFA65, 3853, 1 },
+  { 0xFA66, 3854, 1 },
+  { 0xFA67, 3799, 1 },
+  { 0xFA68, 3855, 1 },
+  { 0xFA69, 3856, 1 },
+  { 0xFA6A, 3857, 1 },
+  { 0xFB00, 3858, 2 },
+  { 0xFB01, 3860, 2 },
+  { 0xFB02, 3862, 2 },
+  { 0xFB03, 3864, 3 },
+  { 0xFB04, 3867, 3 },
+  { 0xFB05, 3870, 2 },
+  { 0xFB06, 3870, 2 },
+  { 0xFB13, 3872, 2 },
+  { 0xFB14, 3874, 2 },
+  { 0xFB15, 3876, 2 },
+  { 0xFB16, 3878, 2 },
+  { 0xFB17, 3880, 2 },
+  { 0xFB1D, 3882, 2 },
+  { 0xFB1F, 3884, 2 },
+  { 0xFB20, 3886, 1 },
+  { 0xFB21, 1544, 1 },
+  { 0xFB22, 1547, 1 },
+  { 0xFB23, 3887, 1 },
+  { 0xFB24, 3888, 1 },
+  { 0xFB25, 3889, 1 },
+  { 0xFB26, 3890, 1 },
+  { 0xFB27, 3891, 1 },
+  { 0xFB28, 3892, 1 },
+  { 0xFB29, 1512, 1 },
+  { 0xFB2A, 3893, 2 },
+  { 0xFB2B, 3895, 2 },
+  { 0xFB2C, 3897, 3 },
+  { 0xFB2D, 3900, 3 },
+  { 0xFB2E, 3903, 2 },
+  { 0xFB2F, 3905, 2 },
+  { 0xFB30, 3907, 2 },
+  { 0xFB31, 3909, 2 },
+  { 0xFB32, 3911, 2 },
+  { 0xFB33, 3913, 2 },
+  { 0xFB34, 3915, 2 },
+  { 0xFB35, 3917, 2 },
+  { 0xFB36, 3919, 2 },
+  { 0xFB38, 3921, 2 },
+  { 0xFB39, 3923, 2 },
+  { 0xFB3A, 3925, 2 },
+  { 0xFB3B, 3927, 2 },
+  { 0xFB3C, 3929, 2 },
+  { 0xFB3E, 3931, 2 },
+  { 0xFB40, 3933, 2 },
+  { 0xFB41, 3935, 2 },
+  { 0xFB43, 3937, 2 },
+  { 0xFB44, 3939, 2 },
+  { 0xFB46, 3941, 2 },
+  { 0xFB47, 3943, 2 },
+  { 0xFB48, 3945, 2 },
+  { 0xFB49, 3947, 2 },
+  { 0xFB4A, 3949, 2 },
+  { 0xFB4B, 3951, 2 },
+  { 0xFB4C, 3953, 2 },
+  { 0xFB4D, 3955, 2 },
+  { 0xFB4E, 3957, 2 },
+  { 0xFB4F, 3959, 2 },
+  { 0xFB50, 3961, 1 },
+  { 0xFB51, 3961, 1 },
+  { 0xFB52, 3962, 1 },
+  { 0xFB53, 3962, 1 },
+  { 0xFB54, 3962, 1 },
+  { 0xFB55, 3962, 1 },
+  { 0xFB56, 3963, 1 },
+  { 0xFB57, 3963, 1 },
+  { 0xFB58, 3963, 1 },
+  { 0xFB59, 3963, 1 },
+  { 0xFB5A, 3964, 1 },
+  { 0xFB5B, 3964, 1 },
+  { 0xFB5C, 3964, 1 },
+  { 0xFB5D, 3964, 1 },
+  { 0xFB5E, 3965, 1 },
+  { 0xFB5F, 3965, 1 },
+  { 0xFB60, 3965, 1 },
+  { 0xFB61, 3965, 1 },
+  { 0xFB62, 3966, 1 },
+  { 0xFB63, 3966, 1 },
+  { 0xFB64, 3966, 1 },
+  { 0xFB65, 3966, 1 },
+  { 0xFB66, 3967, 1 },
+  { 0xFB67, 3967, 1 },
+  { 0xFB68, 3967, 1 },
+  { 0xFB69, 3967, 1 },
+  { 0xFB6A, 3968, 1 },
+  { 0xFB6B, 3968, 1 },
+  { 0xFB6C, 3968, 1 },
+  { 0xFB6D, 3968, 1 },
+  { 0xFB6E, 3969, 1 },
+  { 0xFB6F, 3969, 1 },
+  { 0xFB70, 3969, 1 },
+  { 0xFB71, 3969, 1 },
+  { 0xFB72, 3970, 1 },
+  { 0xFB73, 3970, 1 },
+  { 0xFB74, 3970, 1 },
+  { 0xFB75, 3970, 1 },
+  { 0xFB76, 3971, 1 },
+  { 0xFB77, 3971, 1 },
+  { 0xFB78, 3971, 1 },
+  { 0xFB79, 3971, 1 },
+  { 0xFB7A, 3972, 1 },
+  { 0xFB7B, 3972, 1 },
+  { 0xFB7C, 3972, 1 },
+  { 0xFB7D, 3972, 1 },
+  { 0xFB7E, 3973, 1 },
+  { 0xFB7F, 3973, 1 },
+  { 0xFB80, 3973, 1 },
+  { 0xFB81, 3973, 1 },
+  { 0xFB82, 3974, 1 },
+  { 0xFB83, 3974, 1 },
+  { 0xFB84, 3975, 1 },
+  { 0xFB85, 3975, 1 },
+  { 0xFB86, 3976, 1 },
+  { 0xFB87, 3976, 1 },
+  { 0xFB88, 3977, 1 },
+  { 0xFB89, 3977, 1 },
+  { 0xFB8A, 3978, 1 },
+  { 0xFB8B, 3978, 1 },
+  { 0xFB8C, 3979, 1 },
+  { 0xFB8D, 3979, 1 },
+  { 0xFB8E, 3980, 1 },
+  { 0xFB8F, 3980, 1 },
+  { 0xFB90, 3980, 1 },
+  { 0xFB91, 3980, 1 },
+  { 0xFB92, 3981, 1 },
+  { 0xFB93, 3981, 1 },
+  { 0xFB94, 3981, 1 },
+  { 0xFB95, 3981, 1 },
+  { 0xFB96, 3982, 1 },
+  { 0xFB97, 3982, 1 },
+  { 0xFB98, 3982, 1 },
+  { 0xFB99, 3982, 1 },
+  { 0xFB9A, 3983, 1 },
+  { 0xFB9B, 3983, 1 },
+  { 0xFB9C, 3983, 1 },
+  { 0xFB9D, 3983, 1 },
+  { 0xFB9E, 3984, 1 },
+  { 0xFB9F, 3984, 1 },
+  { 0xFBA0, 3985, 1 },
+  { 0xFBA1, 3985, 1 },
+  { 0xFBA2, 3985, 1 },
+  { 0xFBA3, 3985, 1 },
+  { 0xFBA4, 681, 2 },
+  { 0xFBA5, 681, 2 },
+  { 0xFBA6, 3986, 1 },
+  { 0xFBA7, 3986, 1 },
+  { 0xFBA8, 3986, 1 },
+  { 0xFBA9, 3986, 1 },
+  { 0xFBAA, 3987, 1 },
+  { 0xFBAB, 3987, 1 },
+  { 0xFBAC, 3987, 1 },
+  { 0xFBAD, 3987, 1 },
+  { 0xFBAE, 3988, 1 },
+  { 0xFBAF, 3988, 1 },
+  { 0xFBB0, 685, 2 },
+  { 0xFBB1, 685, 2 },
+  { 0xFBD3, 3989, 1 },
+  { 0xFBD4, 3989, 1 },
+  { 0xFBD5, 3989, 1 },
+  { 0xFBD6, 3989, 1 },
+  { 0xFBD7, 3990, 1 },
+  { 0xFBD8, 3990, 1 },
+  { 0xFBD9, 3991, 1 },
+  { 0xFBDA, 3991, 1 },
+  { 0xFBDB, 3992, 1 },
+  { 0xFBDC, 3992, 1 },
+  { 0xFBDD, 677, 2 },
+  { 0xFBDE, 3993, 1 },
+  { 0xFBDF, 3993, 1 },
+  { 0xFBE0, 3994, 1 },
+  { 0xFBE1, 3994, 1 },
+  { 0xFBE2, 3995, 1 },
+  { 0xFBE3, 3995, 1 },
+  { 0xFBE4, 3996, 1 },
+  { 0xFBE5, 3996, 1 },
+  { 0xFBE6, 3996, 1 },
+  { 0xFBE7, 3996, 1 },
+  { 0xFBE8, 3997, 1 },
+  { 0xFBE9, 3997, 1 },
+  { 0xFBEA, 3998, 3 },
+  { 0xFBEB, 3998, 3 },
+  { 0xFBEC, 4001, 3 },
+  { 0xFBED, 4001, 3 },
+  { 0xFBEE, 4004, 3 },
+  { 0xFBEF, 4004, 3 },
+  { 0xFBF0, 4007, 3 },
+  { 0xFBF1, 4007, 3 },
+  { 0xFBF2, 4010, 3 },
+  { 0xFBF3, 4010, 3 },
+  { 0xFBF4, 4013, 3 },
+  { 0xFBF5, 4013, 3 },
+  { 0xFBF6, 4016, 3 },
+  { 0xFBF7, 4016, 3 },
+  { 0xFBF8, 4016, 3 },
+  { 0xFBF9, 4019, 3 },
+  { 0xFBFA, 4019, 3 },
+  { 0xFBFB, 4019, 3 },
+  { 0xFBFC, 4022, 1 },
+  { 0xFBFD, 4022, 1 },
+  { 0xFBFE, 4022, 1 },
+  { 0xFBFF, 4022, 1 },
+  { 0xFC00, 4023, 3 },
+  { 0xFC01, 4026, 3 },
+  { 0xFC02, 4029, 3 },
+  { 0xFC03, 4019, 3 },
+  { 0xFC04, 4032, 3 },
+  { 0xFC05, 4035, 2 },
+  { 0xFC06, 4037, 2 },
+  { 0xFC07, 4039, 2 },
+  { 0xFC08, 4041, 2 },
+  { 0xFC09, 4043, 2 },
+  { 0xFC0A, 4045, 2 },
+  { 0xFC0B, 4047, 2 },
+  { 0xFC0C, 4049, 2 },
+  { 0xFC0D, 4051, 2 },
+  { 0xFC0E, 4053, 2 },
+  { 0xFC0F, 4055, 2 },
+  { 0xFC10, 4057, 2 },
+  { 0xFC11, 4059, 2 },
+  { 0xFC12, 4061, 2 },
+  { 0xFC13, 4063, 2 },
+  { 0xFC14, 4065, 2 },
+  { 0xFC15, 4067, 2 },
+  { 0xFC16, 4069, 2 },
+  { 0xFC17, 4071, 2 },
+  { 0xFC18, 4073, 2 },
+  { 0xFC19, 4075, 2 },
+  { 0xFC1A, 4077, 2 },
+  { 0xFC1B, 4079, 2 },
+  { 0xFC1C, 4081, 2 },
+  { 0xFC1D, 4083, 2 },
+  { 0xFC1E, 4085, 2 },
+  { 0xFC1F, 4087, 2 },
+  { 0xFC20, 4089, 2 },
+  { 0xFC21, 4091, 2 },
+  { 0xFC22, 4093, 2 },
+  { 0xFC23, 4095, 2 },
+  { 0xFC24, 4097, 2 },
+  { 0xFC25, 4099, 2 },
+  { 0xFC26, 4101, 2 },
+  { 0xFC27, 4103, 2 },
+  { 0xFC28, 4105, 2 },
+  { 0xFC29, 4107, 2 },
+  { 0xFC2A, 4109, 2 },
+  { 0xFC2B, 4111, 2 },
+  { 0xFC2C, 4113, 2 },
+  { 0xFC2D, 4115, 2 },
+  { 0xFC2E, 4117, 2 },
+  { 0xFC2F, 4119, 2 },
+  { 0xFC30, 4121, 2 },
+  { 0xFC31, 4123, 2 },
+  { 0xFC32, 4125, 2 },
+  { 0xFC33, 4127, 2 },
+  { 0xFC34, 4129, 2 },
+  { 0xFC35, 4131, 2 },
+  { 0xFC36, 4133, 2 },
+  { 0xFC37, 4135, 2 },
+  { 0xFC38, 4137, 2 },
+  { 0xFC39, 4139, 2 },
+  { 0xFC3A, 4141, 2 },
+  { 0xFC3B, 4143, 2 },
+  { 0xFC3C, 4145, 2 },
+  { 0xFC3D, 4147, 2 },
+  { 0xFC3E, 4149, 2 },
+  { 0xFC3F, 4151, 2 },
+  { 0xFC40, 4153, 2 },
+  { 0xFC41, 4155, 2 },
+  { 0xFC42, 4157, 2 },
+  { 0xFC43, 4159, 2 },
+  { 0xFC44, 4161, 2 },
+  { 0xFC45, 4163, 2 },
+  { 0xFC46, 4165, 2 },
+  { 0xFC47, 4167, 2 },
+  { 0xFC48, 4169, 2 },
+  { 0xFC49, 4171, 2 },
+  { 0xFC4A, 4173, 2 },
+  { 0xFC4B, 4175, 2 },
+  { 0xFC4C, 4177, 2 },
+  { 0xFC4D, 4179, 2 },
+  { 0xFC4E, 4181, 2 },
+  { 0xFC4F, 4183, 2 },
+  { 0xFC50, 4185, 2 },
+  { 0xFC51, 4187, 2 },
+  { 0xFC52, 4189, 2 },
+  { 0xFC53, 4191, 2 },
+  { 0xFC54, 4193, 2 },
+  { 0xFC55, 4195, 2 },
+  { 0xFC56, 4197, 2 },
+  { 0xFC57, 4199, 2 },
+  { 0xFC58, 4201, 2 },
+  { 0xFC59, 4203, 2 },
+  { 0xFC5A, 4205, 2 },
+  { 0xFC5B, 4207, 2 },
+  { 0xFC5C, 4209, 2 },
+  { 0xFC5D, 4211, 2 },
+  { 0xFC5E, 4213, 3 },
+  { 0xFC5F, 4216, 3 },
+  { 0xFC60, 4219, 3 },
+  { 0xFC61, 4222, 3 },
+  { 0xFC62, 4225, 3 },
+  { 0xFC63, 4228, 3 },
+  { 0xFC64, 4231, 3 },
+  { 0xFC65, 4234, 3 },
+  { 0xFC66, 4029, 3 },
+  { 0xFC67, 4237, 3 },
+  { 0xFC68, 4019, 3 },
+  { 0xFC69, 4032, 3 },
+  { 0xFC6A, 4240, 2 },
+  { 0xFC6B, 4242, 2 },
+  { 0xFC6C, 4041, 2 },
+  { 0xFC6D, 4244, 2 },
+  { 0xFC6E, 4043, 2 },
+  { 0xFC6F, 4045, 2 },
+  { 0xFC70, 4246, 2 },
+  { 0xFC71, 4248, 2 },
+  { 0xFC72, 4053, 2 },
+  { 0xFC73, 4250, 2 },
+  { 0xFC74, 4055, 2 },
+  { 0xFC75, 4057, 2 },
+  { 0xFC76, 4252, 2 },
+  { 0xFC77, 4254, 2 },
+  { 0xFC78, 4061, 2 },
+  { 0xFC79, 4256, 2 },
+  { 0xFC7A, 4063, 2 },
+  { 0xFC7B, 4065, 2 },
+  { 0xFC7C, 4123, 2 },
+  { 0xFC7D, 4125, 2 },
+  { 0xFC7E, 4131, 2 },
+  { 0xFC7F, 4133, 2 },
+  { 0xFC80, 4135, 2 },
+  { 0xFC81, 4143, 2 },
+  { 0xFC82, 4145, 2 },
+  { 0xFC83, 4147, 2 },
+  { 0xFC84, 4149, 2 },
+  { 0xFC85, 4157, 2 },
+  { 0xFC86, 4159, 2 },
+  { 0xFC87, 4161, 2 },
+  { 0xFC88, 4258, 2 },
+  { 0xFC89, 4169, 2 },
+  { 0xFC8A, 4260, 2 },
+  { 0xFC8B, 4262, 2 },
+  { 0xFC8C, 4181, 2 },
+  { 0xFC8D, 4264, 2 },
+  { 0xFC8E, 4183, 2 },
+  { 0xFC8F, 4185, 2 },
+  { 0xFC90, 4211, 2 },
+  { 0xFC91, 4266, 2 },
+  { 0xFC92, 4268, 2 },
+  { 0xFC93, 4201, 2 },
+  { 0xFC94, 4270, 2 },
+  { 0xFC95, 4203, 2 },
+  { 0xFC96, 4205, 2 },
+  { 0xFC97, 4023, 3 },
+  { 0xFC98, 4026, 3 },
+  { 0xFC99, 4272, 3 },
+  { 0xFC9A, 4029, 3 },
+  { 0xFC9B, 4275, 3 },
+  { 0xFC9C, 4035, 2 },
+  { 0xFC9D, 4037, 2 },
+  { 0xFC9E, 4039, 2 },
+  { 0xFC9F, 4041, 2 },
+  { 0xFCA0, 4278, 2 },
+  { 0xFCA1, 4047, 2 },
+  { 0xFCA2, 4049, 2 },
+  { 0xFCA3, 4051, 2 },
+  { 0xFCA4, 4053, 2 },
+  { 0xFCA5, 4280, 2 },
+  { 0xFCA6, 4061, 2 },
+  { 0xFCA7, 4067, 2 },
+  { 0xFCA8, 4069, 2 },
+  { 0xFCA9, 4071, 2 },
+  { 0xFCAA, 4073, 2 },
+  { 0xFCAB, 4075, 2 },
+  { 0xFCAC, 4079, 2 },
+  { 0xFCAD, 4081, 2 },
+  { 0xFCAE, 4083, 2 },
+  { 0xFCAF, 4085, 2 },
+  { 0xFCB0, 4087, 2 },
+  { 0xFCB1, 4089, 2 },
+  { 0xFCB2, 4282, 2 },
+  { 0xFCB3, 4091, 2 },
+  { 0xFCB4, 4093, 2 },
+  { 0xFCB5, 4095, 2 },
+  { 0xFCB6, 4097, 2 },
+  { 0xFCB7, 4099, 2 },
+  { 0xFCB8, 4101, 2 },
+  { 0xFCB9, 4105, 2 },
+  { 0xFCBA, 4107, 2 },
+  { 0xFCBB, 4109, 2 },
+  { 0xFCBC, 4111, 2 },
+  { 0xFCBD, 4113, 2 },
+  { 0xFCBE, 4115, 2 },
+  { 0xFCBF, 4117, 2 },
+  { 0xFCC0, 4119, 2 },
+  { 0xFCC1, 4121, 2 },
+  { 0xFCC2, 4127, 2 },
+  { 0xFCC3, 4129, 2 },
+  { 0xFCC4, 4137, 2 },
+  { 0xFCC5, 4139, 2 },
+  { 0xFCC6, 4141, 2 },
+  { 0xFCC7, 4143, 2 },
+  { 0xFCC8, 4145, 2 },
+  { 0xFCC9, 4151, 2 },
+  { 0xFCCA, 4153, 2 },
+  { 0xFCCB, 4155, 2 },
+  { 0xFCCC, 4157, 2 },
+  { 0xFCCD, 4284, 2 },
+  { 0xFCCE, 4163, 2 },
+  { 0xFCCF, 4165, 2 },
+  { 0xFCD0, 4167, 2 },
+  { 0xFCD1, 4169, 2 },
+  { 0xFCD2, 4175, 2 },
+  { 0xFCD3, 4177, 2 },
+  { 0xFCD4, 4179, 2 },
+  { 0xFCD5, 4181, 2 },
+  { 0xFCD6, 4286, 2 },
+  { 0xFCD7, 4187, 2 },
+  { 0xFCD8, 4189, 2 },
+  { 0xFCD9, 4288, 2 },
+  { 0xFCDA, 4195, 2 },
+  { 0xFCDB, 4197, 2 },
+  { 0xFCDC, 4199, 2 },
+  { 0xFCDD, 4201, 2 },
+  { 0xFCDE, 4290, 2 },
+  { 0xFCDF, 4029, 3 },
+  { 0xFCE0, 4275, 3 },
+  { 0xFCE1, 4041, 2 },
+  { 0xFCE2, 4278, 2 },
+  { 0xFCE3, 4053, 2 },
+  { 0xFCE4, 4280, 2 },
+  { 0xFCE5, 4061, 2 },
+  { 0xFCE6, 4292, 2 },
+  { 0xFCE7, 4087, 2 },
+  { 0xFCE8, 4294, 2 },
+  { 0xFCE9, 4296, 2 },
+  { 0xFCEA, 4298, 2 },
+  { 0xFCEB, 4143, 2 },
+  { 0xFCEC, 4145, 2 },
+  { 0xFCED, 4157, 2 },
+  { 0xFCEE, 4181, 2 },
+  { 0xFCEF, 4286, 2 },
+  { 0xFCF0, 4201, 2 },
+  { 0xFCF1, 4290, 2 },
+  { 0xFCF2, 4300, 3 },
+  { 0xFCF3, 4303, 3 },
+  { 0xFCF4, 4306, 3 },
+  { 0xFCF5, 4309, 2 },
+  { 0xFCF6, 4311, 2 },
+  { 0xFCF7, 4313, 2 },
+  { 0xFCF8, 4315, 2 },
+  { 0xFCF9, 4317, 2 },
+  { 0xFCFA, 4319, 2 },
+  { 0xFCFB, 4321, 2 },
+  { 0xFCFC, 4323, 2 },
+  { 0xFCFD, 4325, 2 },
+  { 0xFCFE, 4327, 2 },
+  { 0xFCFF, 4329, 2 },
+  { 0xFD00, 4331, 2 },
+  { 0xFD01, 4333, 2 },
+  { 0xFD02, 4335, 2 },
+  { 0xFD03, 4337, 2 },
+  { 0xFD04, 4339, 2 },
+  { 0xFD05, 4341, 2 },
+  { 0xFD06, 4343, 2 },
+  { 0xFD07, 4345, 2 },
+  { 0xFD08, 4347, 2 },
+  { 0xFD09, 4349, 2 },
+  { 0xFD0A, 4351, 2 },
+  { 0xFD0B, 4353, 2 },
+  { 0xFD0C, 4296, 2 },
+  { 0xFD0D, 4355, 2 },
+  { 0xFD0E, 4357, 2 },
+  { 0xFD0F, 4359, 2 },
+  { 0xFD10, 4361, 2 },
+  { 0xFD11, 4309, 2 },
+  { 0xFD12, 4311, 2 },
+  { 0xFD13, 4313, 2 },
+  { 0xFD14, 4315, 2 },
+  { 0xFD15, 4317, 2 },
+  { 0xFD16, 4319, 2 },
+  { 0xFD17, 4321, 2 },
+  { 0xFD18, 4323, 2 },
+  { 0xFD19, 4325, 2 },
+  { 0xFD1A, 4327, 2 },
+  { 0xFD1B, 4329, 2 },
+  { 0xFD1C, 4331, 2 },
+  { 0xFD1D, 4333, 2 },
+  { 0xFD1E, 4335, 2 },
+  { 0xFD1F, 4337, 2 },
+  { 0xFD20, 4339, 2 },
+  { 0xFD21, 4341, 2 },
+  { 0xFD22, 4343, 2 },
+  { 0xFD23, 4345, 2 },
+  { 0xFD24, 4347, 2 },
+  { 0xFD25, 4349, 2 },
+  { 0xFD26, 4351, 2 },
+  { 0xFD27, 4353, 2 },
+  { 0xFD28, 4296, 2 },
+  { 0xFD29, 4355, 2 },
+  { 0xFD2A, 4357, 2 },
+  { 0xFD2B, 4359, 2 },
+  { 0xFD2C, 4361, 2 },
+  { 0xFD2D, 4349, 2 },
+  { 0xFD2E, 4351, 2 },
+  { 0xFD2F, 4353, 2 },
+  { 0xFD30, 4296, 2 },
+  { 0xFD31, 4294, 2 },
+  { 0xFD32, 4298, 2 },
+  { 0xFD33, 4103, 2 },
+  { 0xFD34, 4081, 2 },
+  { 0xFD35, 4083, 2 },
+  { 0xFD36, 4085, 2 },
+  { 0xFD37, 4349, 2 },
+  { 0xFD38, 4351, 2 },
+  { 0xFD39, 4353, 2 },
+  { 0xFD3A, 4103, 2 },
+  { 0xFD3B, 4105, 2 },
+  { 0xFD3C, 4363, 2 },
+  { 0xFD3D, 4363, 2 },
+  { 0xFD50, 4365, 3 },
+  { 0xFD51, 4368, 3 },
+  { 0xFD52, 4368, 3 },
+  { 0xFD53, 4371, 3 },
+  { 0xFD54, 4374, 3 },
+  { 0xFD55, 4377, 3 },
+  { 0xFD56, 4380, 3 },
+  { 0xFD57, 4383, 3 },
+  { 0xFD58, 4386, 3 },
+  { 0xFD59, 4386, 3 },
+  { 0xFD5A, 4389, 3 },
+  { 0xFD5B, 4392, 3 },
+  { 0xFD5C, 4395, 3 },
+  { 0xFD5D, 4398, 3 },
+  { 0xFD5E, 4401, 3 },
+  { 0xFD5F, 4404, 3 },
+  { 0xFD60, 4404, 3 },
+  { 0xFD61, 4407, 3 },
+  { 0xFD62, 4410, 3 },
+  { 0xFD63, 4410, 3 },
+  { 0xFD64, 4413, 3 },
+  { 0xFD65, 4413, 3 },
+  { 0xFD66, 4416, 3 },
+  { 0xFD67, 4419, 3 },
+  { 0xFD68, 4419, 3 },
+  { 0xFD69, 4422, 3 },
+  { 0xFD6A, 4425, 3 },
+  { 0xFD6B, 4425, 3 },
+  { 0xFD6C, 4428, 3 },
+  { 0xFD6D, 4428, 3 },
+  { 0xFD6E, 4431, 3 },
+  { 0xFD6F, 4434, 3 },
+  { 0xFD70, 4434, 3 },
+  { 0xFD71, 4437, 3 },
+  { 0xFD72, 4437, 3 },
+  { 0xFD73, 4440, 3 },
+  { 0xFD74, 4443, 3 },
+  { 0xFD75, 4446, 3 },
+  { 0xFD76, 4449, 3 },
+  { 0xFD77, 4449, 3 },
+  { 0xFD78, 4452, 3 },
+  { 0xFD79, 4455, 3 },
+  { 0xFD7A, 4458, 3 },
+  { 0xFD7B, 4461, 3 },
+  { 0xFD7C, 4464, 3 },
+  { 0xFD7D, 4464, 3 },
+  { 0xFD7E, 4467, 3 },
+  { 0xFD7F, 4470, 3 },
+  { 0xFD80, 4473, 3 },
+  { 0xFD81, 4476, 3 },
+  { 0xFD82, 4479, 3 },
+  { 0xFD83, 4482, 3 },
+  { 0xFD84, 4482, 3 },
+  { 0xFD85, 4485, 3 },
+  { 0xFD86, 4485, 3 },
+  { 0xFD87, 4488, 3 },
+  { 0xFD88, 4488, 3 },
+  { 0xFD89, 4491, 3 },
+  { 0xFD8A, 4494, 3 },
+  { 0xFD8B, 4497, 3 },
+  { 0xFD8C, 4500, 3 },
+  { 0xFD8D, 4503, 3 },
+  { 0xFD8E, 4506, 3 },
+  { 0xFD8F, 4509, 3 },
+  { 0xFD92, 4512, 3 },
+  { 0xFD93, 4515, 3 },
+  { 0xFD94, 4518, 3 },
+  { 0xFD95, 4521, 3 },
+  { 0xFD96, 4524, 3 },
+  { 0xFD97, 4527, 3 },
+  { 0xFD98, 4527, 3 },
+  { 0xFD99, 4530, 3 },
+  { 0xFD9A, 4533, 3 },
+  { 0xFD9B, 4536, 3 },
+  { 0xFD9C, 4539, 3 },
+  { 0xFD9D, 4539, 3 },
+  { 0xFD9E, 4542, 3 },
+  { 0xFD9F, 4545, 3 },
+  { 0xFDA0, 4548, 3 },
+  { 0xFDA1, 4551, 3 },
+  { 0xFDA2, 4554, 3 },
+  { 0xFDA3, 4557, 3 },
+  { 0xFDA4, 4560, 3 },
+  { 0xFDA5, 4563, 3 },
+  { 0xFDA6, 4566, 3 },
+  { 0xFDA7, 4569, 3 },
+  { 0xFDA8, 4572, 3 },
+  { 0xFDA9, 4575, 3 },
+  { 0xFDAA, 4578, 3 },
+  { 0xFDAB, 4581, 3 },
+  { 0xFDAC, 4584, 3 },
+  { 0xFDAD, 4587, 3 },
+  { 0xFDAE, 4590, 3 },
+  { 0xFDAF, 4593, 3 },
+  { 0xFDB0, 4596, 3 },
+  { 0xFDB1, 4599, 3 },
+  { 0xFDB2, 4602, 3 },
+  { 0xFDB3, 4605, 3 },
+  { 0xFDB4, 4467, 3 },
+  { 0xFDB5, 4473, 3 },
+  { 0xFDB6, 4608, 3 },
+  { 0xFDB7, 4611, 3 },
+  { 0xFDB8, 4614, 3 },
+  { 0xFDB9, 4617, 3 },
+  { 0xFDBA, 4620, 3 },
+  { 0xFDBB, 4623, 3 },
+  { 0xFDBC, 4620, 3 },
+  { 0xFDBD, 4614, 3 },
+  { 0xFDBE, 4626, 3 },
+  { 0xFDBF, 4629, 3 },
+  { 0xFDC0, 4632, 3 },
+  { 0xFDC1, 4635, 3 },
+  { 0xFDC2, 4638, 3 },
+  { 0xFDC3, 4623, 3 },
+  { 0xFDC4, 4446, 3 },
+  { 0xFDC5, 4416, 3 },
+  { 0xFDC6, 4641, 3 },
+  { 0xFDC7, 4644, 3 },
+  { 0xFDF0, 4647, 3 },
+  { 0xFDF1, 4650, 3 },
+  { 0xFDF2, 4653, 4 },
+  { 0xFDF3, 4657, 4 },
+  { 0xFDF4, 4661, 4 },
+  { 0xFDF5, 4665, 4 },
+  { 0xFDF6, 4669, 4 },
+  { 0xFDF7, 4673, 4 },
+  { 0xFDF8, 4677, 4 },
+  { 0xFDF9, 4681, 3 },
+  { 0xFDFA, 4684, 18 },
+  { 0xFDFB, 4702, 8 },
+  { 0xFDFC, 4710, 4 },
+  { 0xFE00, 29, 0 },
+  { 0xFE01, 29, 0 },
+  { 0xFE02, 29, 0 },
+  { 0xFE03, 29, 0 },
+  { 0xFE04, 29, 0 },
+  { 0xFE05, 29, 0 },
+  { 0xFE06, 29, 0 },
+  { 0xFE07, 29, 0 },
+  { 0xFE08, 29, 0 },
+  { 0xFE09, 29, 0 },
+  { 0xFE0A, 29, 0 },
+  { 0xFE0B, 29, 0 },
+  { 0xFE0C, 29, 0 },
+  { 0xFE0D, 29, 0 },
+  { 0xFE0E, 29, 0 },
+  { 0xFE0F, 29, 0 },
+  { 0xFE30, 1476, 2 },
+  { 0xFE31, 4714, 1 },
+  { 0xFE32, 4715, 1 },
+  { 0xFE33, 4716, 1 },
+  { 0xFE34, 4716, 1 },
+  { 0xFE35, 1515, 1 },
+  { 0xFE36, 1516, 1 },
+  { 0xFE37, 4717, 1 },
+  { 0xFE38, 4718, 1 },
+  { 0xFE39, 4719, 1 },
+  { 0xFE3A, 4720, 1 },
+  { 0xFE3B, 4721, 1 },
+  { 0xFE3C, 4722, 1 },
+  { 0xFE3D, 4723, 1 },
+  { 0xFE3E, 4724, 1 },
+  { 0xFE3F, 1708, 1 },
+  { 0xFE40, 1709, 1 },
+  { 0xFE41, 4725, 1 },
+  { 0xFE42, 4726, 1 },
+  { 0xFE43, 4727, 1 },
+  { 0xFE44, 4728, 1 },
+  { 0xFE49, 1493, 2 },
+  { 0xFE4A, 1493, 2 },
+  { 0xFE4B, 1493, 2 },
+  { 0xFE4C, 1493, 2 },
+  { 0xFE4D, 4716, 1 },
+  { 0xFE4E, 4716, 1 },
+  { 0xFE4F, 4716, 1 },
+  { 0xFE50, 4729, 1 },
+  { 0xFE51, 4730, 1 },
+  { 0xFE52, 1475, 1 },
+  { 0xFE54, 407, 1 },
+  { 0xFE55, 4731, 1 },
+  { 0xFE56, 4732, 1 },
+  { 0xFE57, 4733, 1 },
+  { 0xFE58, 4714, 1 },
+  { 0xFE59, 1515, 1 },
+  { 0xFE5A, 1516, 1 },
+  { 0xFE5B, 4717, 1 },
+  { 0xFE5C, 4718, 1 },
+  { 0xFE5D, 4719, 1 },
+  { 0xFE5E, 4720, 1 },
+  { 0xFE5F, 4734, 1 },
+  { 0xFE60, 4735, 1 },
+  { 0xFE61, 4736, 1 },
+  { 0xFE62, 1512, 1 },
+  { 0xFE63, 4737, 1 },
+  { 0xFE64, 4738, 1 },
+  { 0xFE65, 4739, 1 },
+  { 0xFE66, 1514, 1 },
+  { 0xFE68, 4740, 1 },
+  { 0xFE69, 4741, 1 },
+  { 0xFE6A, 4742, 1 },
+  { 0xFE6B, 4743, 1 },
+  { 0xFE70, 4744, 2 },
+  { 0xFE71, 4746, 2 },
+  { 0xFE72, 4748, 2 },
+  { 0xFE74, 4750, 2 },
+  { 0xFE76, 4752, 2 },
+  { 0xFE77, 4754, 2 },
+  { 0xFE78, 4756, 2 },
+  { 0xFE79, 4758, 2 },
+  { 0xFE7A, 4760, 2 },
+  { 0xFE7B, 4762, 2 },
+  { 0xFE7C, 4764, 2 },
+  { 0xFE7D, 4766, 2 },
+  { 0xFE7E, 4768, 2 },
+  { 0xFE7F, 4770, 2 },
+  { 0xFE80, 4772, 1 },
+  { 0xFE81, 663, 2 },
+  { 0xFE82, 663, 2 },
+  { 0xFE83, 665, 2 },
+  { 0xFE84, 665, 2 },
+  { 0xFE85, 667, 2 },
+  { 0xFE86, 667, 2 },
+  { 0xFE87, 669, 2 },
+  { 0xFE88, 669, 2 },
+  { 0xFE89, 671, 2 },
+  { 0xFE8A, 671, 2 },
+  { 0xFE8B, 671, 2 },
+  { 0xFE8C, 671, 2 },
+  { 0xFE8D, 4773, 1 },
+  { 0xFE8E, 4773, 1 },
+  { 0xFE8F, 4774, 1 },
+  { 0xFE90, 4774, 1 },
+  { 0xFE91, 4774, 1 },
+  { 0xFE92, 4774, 1 },
+  { 0xFE93, 4775, 1 },
+  { 0xFE94, 4775, 1 },
+  { 0xFE95, 4776, 1 },
+  { 0xFE96, 4776, 1 },
+  { 0xFE97, 4776, 1 },
+  { 0xFE98, 4776, 1 },
+  { 0xFE99, 4777, 1 },
+  { 0xFE9A, 4777, 1 },
+  { 0xFE9B, 4777, 1 },
+  { 0xFE9C, 4777, 1 },
+  { 0xFE9D, 4778, 1 },
+  { 0xFE9E, 4778, 1 },
+  { 0xFE9F, 4778, 1 },
+  { 0xFEA0, 4778, 1 },
+  { 0xFEA1, 4779, 1 },
+  { 0xFEA2, 4779, 1 },
+  { 0xFEA3, 4779, 1 },
+  { 0xFEA4, 4779, 1 },
+  { 0xFEA5, 4780, 1 },
+  { 0xFEA6, 4780, 1 },
+  { 0xFEA7, 4780, 1 },
+  { 0xFEA8, 4780, 1 },
+  { 0xFEA9, 4781, 1 },
+  { 0xFEAA, 4781, 1 },
+  { 0xFEAB, 4782, 1 },
+  { 0xFEAC, 4782, 1 },
+  { 0xFEAD, 4783, 1 },
+  { 0xFEAE, 4783, 1 },
+  { 0xFEAF, 4784, 1 },
+  { 0xFEB0, 4784, 1 },
+  { 0xFEB1, 4785, 1 },
+  { 0xFEB2, 4785, 1 },
+  { 0xFEB3, 4785, 1 },
+  { 0xFEB4, 4785, 1 },
+  { 0xFEB5, 4786, 1 },
+  { 0xFEB6, 4786, 1 },
+  { 0xFEB7, 4786, 1 },
+  { 0xFEB8, 4786, 1 },
+  { 0xFEB9, 4787, 1 },
+  { 0xFEBA, 4787, 1 },
+  { 0xFEBB, 4787, 1 },
+  { 0xFEBC, 4787, 1 },
+  { 0xFEBD, 4788, 1 },
+  { 0xFEBE, 4788, 1 },
+  { 0xFEBF, 4788, 1 },
+  { 0xFEC0, 4788, 1 },
+  { 0xFEC1, 4789, 1 },
+  { 0xFEC2, 4789, 1 },
+  { 0xFEC3, 4789, 1 },
+  { 0xFEC4, 4789, 1 },
+  { 0xFEC5, 4790, 1 },
+  { 0xFEC6, 4790, 1 },
+  { 0xFEC7, 4790, 1 },
+  { 0xFEC8, 4790, 1 },
+  { 0xFEC9, 4791, 1 },
+  { 0xFECA, 4791, 1 },
+  { 0xFECB, 4791, 1 },
+  { 0xFECC, 4791, 1 },
+  { 0xFECD, 4792, 1 },
+  { 0xFECE, 4792, 1 },
+  { 0xFECF, 4792, 1 },
+  { 0xFED0, 4792, 1 },
+  { 0xFED1, 4793, 1 },
+  { 0xFED2, 4793, 1 },
+  { 0xFED3, 4793, 1 },
+  { 0xFED4, 4793, 1 },
+  { 0xFED5, 4794, 1 },
+  { 0xFED6, 4794, 1 },
+  { 0xFED7, 4794, 1 },
+  { 0xFED8, 4794, 1 },
+  { 0xFED9, 4795, 1 },
+  { 0xFEDA, 4795, 1 },
+  { 0xFEDB, 4795, 1 },
+  { 0xFEDC, 4795, 1 },
+  { 0xFEDD, 4796, 1 },
+  { 0xFEDE, 4796, 1 },
+  { 0xFEDF, 4796, 1 },
+  { 0xFEE0, 4796, 1 },
+  { 0xFEE1, 4797, 1 },
+  { 0xFEE2, 4797, 1 },
+  { 0xFEE3, 4797, 1 },
+  { 0xFEE4, 4797, 1 },
+  { 0xFEE5, 4798, 1 },
+  { 0xFEE6, 4798, 1 },
+  { 0xFEE7, 4798, 1 },
+  { 0xFEE8, 4798, 1 },
+  { 0xFEE9, 4799, 1 },
+  { 0xFEEA, 4799, 1 },
+  { 0xFEEB, 4799, 1 },
+  { 0xFEEC, 4799, 1 },
+  { 0xFEED, 4800, 1 },
+  { 0xFEEE, 4800, 1 },
+  { 0xFEEF, 3997, 1 },
+  { 0xFEF0, 3997, 1 },
+  { 0xFEF1, 4801, 1 },
+  { 0xFEF2, 4801, 1 },
+  { 0xFEF3, 4801, 1 },
+  { 0xFEF4, 4801, 1 },
+  { 0xFEF5, 4802, 3 },
+  { 0xFEF6, 4802, 3 },
+  { 0xFEF7, 4805, 3 },
+  { 0xFEF8, 4805, 3 },
+  { 0xFEF9, 4808, 3 },
+  { 0xFEFA, 4808, 3 },
+  { 0xFEFB, 4811, 2 },
+  { 0xFEFC, 4811, 2 },
+  { 0xFEFF, 29, 0 },
+  { 0xFF01, 4733, 1 },
+  { 0xFF02, 4813, 1 },
+  { 0xFF03, 4734, 1 },
+  { 0xFF04, 4741, 1 },
+  { 0xFF05, 4742, 1 },
+  { 0xFF06, 4735, 1 },
+  { 0xFF07, 4814, 1 },
+  { 0xFF08, 1515, 1 },
+  { 0xFF09, 1516, 1 },
+  { 0xFF0A, 4736, 1 },
+  { 0xFF0B, 1512, 1 },
+  { 0xFF0C, 4729, 1 },
+  { 0xFF0D, 4737, 1 },
+  { 0xFF0E, 1475, 1 },
+  { 0xFF0F, 4815, 1 },
+  { 0xFF10, 1505, 1 },
+  { 0xFF11, 38, 1 },
+  { 0xFF12, 31, 1 },
+  { 0xFF13, 32, 1 },
+  { 0xFF14, 1506, 1 },
+  { 0xFF15, 1507, 1 },
+  { 0xFF16, 1508, 1 },
+  { 0xFF17, 1509, 1 },
+  { 0xFF18, 1510, 1 },
+  { 0xFF19, 1511, 1 },
+  { 0xFF1A, 4731, 1 },
+  { 0xFF1B, 407, 1 },
+  { 0xFF1C, 4738, 1 },
+  { 0xFF1D, 1514, 1 },
+  { 0xFF1E, 4739, 1 },
+  { 0xFF1F, 4732, 1 },
+  { 0xFF20, 4743, 1 },
+  { 0xFF21, 0, 1 },
+  { 0xFF22, 1, 1 },
+  { 0xFF23, 2, 1 },
+  { 0xFF24, 3, 1 },
+  { 0xFF25, 4, 1 },
+  { 0xFF26, 5, 1 },
+  { 0xFF27, 6, 1 },
+  { 0xFF28, 7, 1 },
+  { 0xFF29, 8, 1 },
+  { 0xFF2A, 9, 1 },
+  { 0xFF2B, 10, 1 },
+  { 0xFF2C, 11, 1 },
+  { 0xFF2D, 12, 1 },
+  { 0xFF2E, 13, 1 },
+  { 0xFF2F, 14, 1 },
+  { 0xFF30, 15, 1 },
+  { 0xFF31, 16, 1 },
+  { 0xFF32, 17, 1 },
+  { 0xFF33, 18, 1 },
+  { 0xFF34, 19, 1 },
+  { 0xFF35, 20, 1 },
+  { 0xFF36, 21, 1 },
+  { 0xFF37, 22, 1 },
+  { 0xFF38, 23, 1 },
+  { 0xFF39, 24, 1 },
+  { 0xFF3A, 25, 1 },
+  { 0xFF3B, 4816, 1 },
+  { 0xFF3C, 4740, 1 },
+  { 0xFF3D, 4817, 1 },
+  { 0xFF3E, 4818, 1 },
+  { 0xFF3F, 4716, 1 },
+  { 0xFF40, 1456, 1 },
+  { 0xFF41, 0, 1 },
+  { 0xFF42, 1, 1 },
+  { 0xFF43, 2, 1 },
+  { 0xFF44, 3, 1 },
+  { 0xFF45, 4, 1 },
+  { 0xFF46, 5, 1 },
+  { 0xFF47, 6, 1 },
+  { 0xFF48, 7, 1 },
+  { 0xFF49, 8, 1 },
+  { 0xFF4A, 9, 1 },
+  { 0xFF4B, 10, 1 },
+  { 0xFF4C, 11, 1 },
+  { 0xFF4D, 12, 1 },
+  { 0xFF4E, 13, 1 },
+  { 0xFF4F, 14, 1 },
+  { 0xFF50, 15, 1 },
+  { 0xFF51, 16, 1 },
+  { 0xFF52, 17, 1 },
+  { 0xFF53, 18, 1 },
+  { 0xFF54, 19, 1 },
+  { 0xFF55, 20, 1 },
+  { 0xFF56, 21, 1 },
+  { 0xFF57, 22, 1 },
+  { 0xFF58, 23, 1 },
+  { 0xFF59, 24, 1 },
+  { 0xFF5A, 25, 1 },
+  { 0xFF5B, 4717, 1 },
+  { 0xFF5C, 4819, 1 },
+  { 0xFF5D, 4718, 1 },
+  { 0xFF5E, 4820, 1 },
+  { 0xFF5F, 4821, 1 },
+  { 0xFF60, 4822, 1 },
+  { 0xFF61, 4823, 1 },
+  { 0xFF62, 4725, 1 },
+  { 0xFF63, 4726, 1 },
+  { 0xFF64, 4730, 1 },
+  { 0xFF65, 4824, 1 },
+  { 0xFF66, 2796, 1 },
+  { 0xFF67, 4825, 1 },
+  { 0xFF68, 4826, 1 },
+  { 0xFF69, 4827, 1 },
+  { 0xFF6A, 4828, 1 },
+  { 0xFF6B, 4829, 1 },
+  { 0xFF6C, 4830, 1 },
+  { 0xFF6D, 4831, 1 },
+  { 0xFF6E, 4832, 1 },
+  { 0xFF6F, 4833, 1 },
+  { 0xFF70, 4834, 1 },
+  { 0xFF71, 2750, 1 },
+  { 0xFF72, 2751, 1 },
+  { 0xFF73, 2752, 1 },
+  { 0xFF74, 2753, 1 },
+  { 0xFF75, 2754, 1 },
+  { 0xFF76, 2755, 1 },
+  { 0xFF77, 2756, 1 },
+  { 0xFF78, 2757, 1 },
+  { 0xFF79, 2758, 1 },
+  { 0xFF7A, 2759, 1 },
+  { 0xFF7B, 2760, 1 },
+  { 0xFF7C, 2761, 1 },
+  { 0xFF7D, 2762, 1 },
+  { 0xFF7E, 2763, 1 },
+  { 0xFF7F, 2764, 1 },
+  { 0xFF80, 2765, 1 },
+  { 0xFF81, 2766, 1 },
+  { 0xFF82, 2767, 1 },
+  { 0xFF83, 2768, 1 },
+  { 0xFF84, 2769, 1 },
+  { 0xFF85, 2770, 1 },
+  { 0xFF86, 2771, 1 },
+  { 0xFF87, 2772, 1 },
+  { 0xFF88, 2773, 1 },
+  { 0xFF89, 2774, 1 },
+  { 0xFF8A, 2775, 1 },
+  { 0xFF8B, 2776, 1 },
+  { 0xFF8C, 2777, 1 },
+  { 0xFF8D, 2778, 1 },
+  { 0xFF8E, 2779, 1 },
+  { 0xFF8F, 2780, 1 },
+  { 0xFF90, 2781, 1 },
+  { 0xFF91, 2782, 1 },
+  { 0xFF92, 2783, 1 },
+  { 0xFF93, 2784, 1 },
+  { 0xFF94, 2785, 1 },
+  { 0xFF95, 2786, 1 },
+  { 0xFF96, 2787, 1 },
+  { 0xFF97, 2788, 1 },
+  { 0xFF98, 2789, 1 },
+  { 0xFF99, 2790, 1 },
+  { 0xFF9A, 2791, 1 },
+  { 0xFF9B, 2792, 1 },
+  { 0xFF9C, 2793, 1 },
+  { 0xFF9D, 4835, 1 },
+  { 0xFF9E, 4836, 1 },
+  { 0xFF9F, 4837, 1 },
+  { 0xFFA0, 2340, 1 },
+  { 0xFFA1, 2289, 1 },
+  { 0xFFA2, 2290, 1 },
+  { 0xFFA3, 2291, 1 },
+  { 0xFFA4, 2292, 1 },
+  { 0xFFA5, 2293, 1 },
+  { 0xFFA6, 2294, 1 },
+  { 0xFFA7, 2295, 1 },
+  { 0xFFA8, 2296, 1 },
+  { 0xFFA9, 2297, 1 },
+  { 0xFFAA, 2298, 1 },
+  { 0xFFAB, 2299, 1 },
+  { 0xFFAC, 2300, 1 },
+  { 0xFFAD, 2301, 1 },
+  { 0xFFAE, 2302, 1 },
+  { 0xFFAF, 2303, 1 },
+  { 0xFFB0, 2304, 1 },
+  { 0xFFB1, 2305, 1 },
+  { 0xFFB2, 2306, 1 },
+  { 0xFFB3, 2307, 1 },
+  { 0xFFB4, 2308, 1 },
+  { 0xFFB5, 2309, 1 },
+  { 0xFFB6, 2310, 1 },
+  { 0xFFB7, 2311, 1 },
+  { 0xFFB8, 2312, 1 },
+  { 0xFFB9, 2313, 1 },
+  { 0xFFBA, 2314, 1 },
+  { 0xFFBB, 2315, 1 },
+  { 0xFFBC, 2316, 1 },
+  { 0xFFBD, 2317, 1 },
+  { 0xFFBE, 2318, 1 },
+  { 0xFFC2, 2319, 1 },
+  { 0xFFC3, 2320, 1 },
+  { 0xFFC4, 2321, 1 },
+  { 0xFFC5, 2322, 1 },
+  { 0xFFC6, 2323, 1 },
+  { 0xFFC7, 2324, 1 },
+  { 0xFFCA, 2325, 1 },
+  { 0xFFCB, 2326, 1 },
+  { 0xFFCC, 2327, 1 },
+  { 0xFFCD, 2328, 1 },
+  { 0xFFCE, 2329, 1 },
+  { 0xFFCF, 2330, 1 },
+  { 0xFFD2, 2331, 1 },
+  { 0xFFD3, 2332, 1 },
+  { 0xFFD4, 2333, 1 },
+  { 0xFFD5, 2334, 1 },
+  { 0xFFD6, 2335, 1 },
+  { 0xFFD7, 2336, 1 },
+  { 0xFFDA, 2337, 1 },
+  { 0xFFDB, 2338, 1 },
+  { 0xFFDC, 2339, 1 },
+  { 0xFFE0, 4838, 1 },
+  { 0xFFE1, 4839, 1 },
+  { 0xFFE2, 4840, 1 },
+  { 0xFFE3, 29, 2 },
+  { 0xFFE4, 4841, 1 },
+  { 0xFFE5, 4842, 1 },
+  { 0xFFE6, 4843, 1 },
+  { 0xFFE8, 4844, 1 },
+  { 0xFFE9, 4845, 1 },
+  { 0xFFEA, 4846, 1 },
+  { 0xFFEB, 4847, 1 },
+  { 0xFFEC, 4848, 1 },
+  { 0xFFED, 4849, 1 },
+  { 0xFFEE, 4850, 1 },
+  { 0x10400, 4851, 1 },
+  { 0x10401, 4852, 1 },
+  { 0x10402, 4853, 1 },
+  { 0x10403, 4854, 1 },
+  { 0x10404, 4855, 1 },
+  { 0x10405, 4856, 1 },
+  { 0x10406, 4857, 1 },
+  { 0x10407, 4858, 1 },
+  { 0x10408, 4859, 1 },
+  { 0x10409, 4860, 1 },
+  { 0x1040A, 4861, 1 },
+  { 0x1040B, 4862, 1 },
+  { 0x1040C, 4863, 1 },
+  { 0x1040D, 4864, 1 },
+  { 0x1040E, 4865, 1 },
+  { 0x1040F, 4866, 1 },
+  { 0x10410, 4867, 1 },
+  { 0x10411, 4868, 1 },
+  { 0x10412, 4869, 1 },
+  { 0x10413, 4870, 1 },
+  { 0x10414, 4871, 1 },
+  { 0x10415, 4872, 1 },
+  { 0x10416, 4873, 1 },
+  { 0x10417, 4874, 1 },
+  { 0x10418, 4875, 1 },
+  { 0x10419, 4876, 1 },
+  { 0x1041A, 4877, 1 },
+  { 0x1041B, 4878, 1 },
+  { 0x1041C, 4879, 1 },
+  { 0x1041D, 4880, 1 },
+  { 0x1041E, 4881, 1 },
+  { 0x1041F, 4882, 1 },
+  { 0x10420, 4883, 1 },
+  { 0x10421, 4884, 1 },
+  { 0x10422, 4885, 1 },
+  { 0x10423, 4886, 1 },
+  { 0x10424, 4887, 1 },
+  { 0x10425, 4888, 1 },
+  { 0x1D15E, 4889, 2 },
+  { 0x1D15F, 4891, 2 },
+  { 0x1D160, 4893, 3 },
+  { 0x1D161, 4896, 3 },
+  { 0x1D162, 4899, 3 },
+  { 0x1D163, 4902, 3 },
+  { 0x1D164, 4905, 3 },
+  { 0x1D1BB, 4908, 2 },
+  { 0x1D1BC, 4910, 2 },
+  { 0x1D1BD, 4912, 3 },
+  { 0x1D1BE, 4915, 3 },
+  { 0x1D1BF, 4918, 3 },
+  { 0x1D1C0, 4921, 3 },
+  { 0x1D400, 0, 1 },
+  { 0x1D401, 1, 1 },
+  { 0x1D402, 2, 1 },
+  { 0x1D403, 3, 1 },
+  { 0x1D404, 4, 1 },
+  { 0x1D405, 5, 1 },
+  { 0x1D406, 6, 1 },
+  { 0x1D407, 7, 1 },
+  { 0x1D408, 8, 1 },
+  { 0x1D409, 9, 1 },
+  { 0x1D40A, 10, 1 },
+  { 0x1D40B, 11, 1 },
+  { 0x1D40C, 12, 1 },
+  { 0x1D40D, 13, 1 },
+  { 0x1D40E, 14, 1 },
+  { 0x1D40F, 15, 1 },
+  { 0x1D410, 16, 1 },
+  { 0x1D411, 17, 1 },
+  { 0x1D412, 18, 1 },
+  { 0x1D413, 19, 1 },
+  { 0x1D414, 20, 1 },
+  { 0x1D415, 21, 1 },
+  { 0x1D416, 22, 1 },
+  { 0x1D417, 23, 1 },
+  { 0x1D418, 24, 1 },
+  { 0x1D419, 25, 1 },
+  { 0x1D41A, 0, 1 },
+  { 0x1D41B, 1, 1 },
+  { 0x1D41C, 2, 1 },
+  { 0x1D41D, 3, 1 },
+  { 0x1D41E, 4, 1 },
+  { 0x1D41F, 5, 1 },
+  { 0x1D420, 6, 1 },
+  { 0x1D421, 7, 1 },
+  { 0x1D422, 8, 1 },
+  { 0x1D423, 9, 1 },
+  { 0x1D424, 10, 1 },
+  { 0x1D425, 11, 1 },
+  { 0x1D426, 12, 1 },
+  { 0x1D427, 13, 1 },
+  { 0x1D428, 14, 1 },
+  { 0x1D429, 15, 1 },
+  { 0x1D42A, 16, 1 },
+  { 0x1D42B, 17, 1 },
+  { 0x1D42C, 18, 1 },
+  { 0x1D42D, 19, 1 },
+  { 0x1D42E, 20, 1 },
+  { 0x1D42F, 21, 1 },
+  { 0x1D430, 22, 1 },
+  { 0x1D431, 23, 1 },
+  { 0x1D432, 24, 1 },
+  { 0x1D433, 25, 1 },
+  { 0x1D434, 0, 1 },
+  { 0x1D435, 1, 1 },
+  { 0x1D436, 2, 1 },
+  { 0x1D437, 3, 1 },
+  { 0x1D438, 4, 1 },
+  { 0x1D439, 5, 1 },
+  { 0x1D43A, 6, 1 },
+  { 0x1D43B, 7, 1 },
+  { 0x1D43C, 8, 1 },
+  { 0x1D43D, 9, 1 },
+  { 0x1D43E, 10, 1 },
+  { 0x1D43F, 11, 1 },
+  { 0x1D440, 12, 1 },
+  { 0x1D441, 13, 1 },
+  { 0x1D442, 14, 1 },
+  { 0x1D443, 15, 1 },
+  { 0x1D444, 16, 1 },
+  { 0x1D445, 17, 1 },
+  { 0x1D446, 18, 1 },
+  { 0x1D447, 19, 1 },
+  { 0x1D448, 20, 1 },
+  { 0x1D449, 21, 1 },
+  { 0x1D44A, 22, 1 },
+  { 0x1D44B, 23, 1 },
+  { 0x1D44C, 24, 1 },
+  { 0x1D44D, 25, 1 },
+  { 0x1D44E, 0, 1 },
+  { 0x1D44F, 1, 1 },
+  { 0x1D450, 2, 1 },
+  { 0x1D451, 3, 1 },
+  { 0x1D452, 4, 1 },
+  { 0x1D453, 5, 1 },
+  { 0x1D454, 6, 1 },
+  { 0x1D456, 8, 1 },
+  { 0x1D457, 9, 1 },
+  { 0x1D458, 10, 1 },
+  { 0x1D459, 11, 1 },
+  { 0x1D45A, 12, 1 },
+  { 0x1D45B, 13, 1 },
+  { 0x1D45C, 14, 1 },
+  { 0x1D45D, 15, 1 },
+  { 0x1D45E, 16, 1 },
+  { 0x1D45F, 17, 1 },
+  { 0x1D460, 18, 1 },
+  { 0x1D461, 19, 1 },
+  { 0x1D462, 20, 1 },
+  { 0x1D463, 21, 1 },
+  { 0x1D464, 22, 1 },
+  { 0x1D465, 23, 1 },
+  { 0x1D466, 24, 1 },
+  { 0x1D467, 25, 1 },
+  { 0x1D468, 0, 1 },
+  { 0x1D469, 1, 1 },
+  { 0x1D46A, 2, 1 },
+  { 0x1D46B, 3, 1 },
+  { 0x1D46C, 4, 1 },
+  { 0x1D46D, 5, 1 },
+  { 0x1D46E, 6, 1 },
+  { 0x1D46F, 7, 1 },
+  { 0x1D470, 8, 1 },
+  { 0x1D471, 9, 1 },
+  { 0x1D472, 10, 1 },
+  { 0x1D473, 11, 1 },
+  { 0x1D474, 12, 1 },
+  { 0x1D475, 13, 1 },
+  { 0x1D476, 14, 1 },
+  { 0x1D477, 15, 1 },
+  { 0x1D478, 16, 1 },
+  { 0x1D479, 17, 1 },
+  { 0x1D47A, 18, 1 },
+  { 0x1D47B, 19, 1 },
+  { 0x1D47C, 20, 1 },
+  { 0x1D47D, 21, 1 },
+  { 0x1D47E, 22, 1 },
+  { 0x1D47F, 23, 1 },
+  { 0x1D480, 24, 1 },
+  { 0x1D481, 25, 1 },
+  { 0x1D482, 0, 1 },
+  { 0x1D483, 1, 1 },
+  { 0x1D484, 2, 1 },
+  { 0x1D485, 3, 1 },
+  { 0x1D486, 4, 1 },
+  { 0x1D487, 5, 1 },
+  { 0x1D488, 6, 1 },
+  { 0x1D489, 7, 1 },
+  { 0x1D48A, 8, 1 },
+  { 0x1D48B, 9, 1 },
+  { 0x1D48C, 10, 1 },
+  { 0x1D48D, 11, 1 },
+  { 0x1D48E, 12, 1 },
+  { 0x1D48F, 13, 1 },
+  { 0x1D490, 14, 1 },
+  { 0x1D491, 15, 1 },
+  { 0x1D492, 16, 1 },
+  { 0x1D493, 17, 1 },
+  { 0x1D494, 18, 1 },
+  { 0x1D495, 19, 1 },
+  { 0x1D496, 20, 1 },
+  { 0x1D497, 21, 1 },
+  { 0x1D498, 22, 1 },
+  { 0x1D499, 23, 1 },
+  { 0x1D49A, 24, 1 },
+  { 0x1D49B, 25, 1 },
+  { 0x1D49C, 0, 1 },
+  { 0x1D49E, 2, 1 },
+  { 0x1D49F, 3, 1 },
+  { 0x1D4A2, 6, 1 },
+  { 0x1D4A5, 9, 1 },
+  { 0x1D4A6, 10, 1 },
+  { 0x1D4A9, 13, 1 },
+  { 0x1D4AA, 14, 1 },
+  { 0x1D4AB, 15, 1 },
+  { 0x1D4AC, 16, 1 },
+  { 0x1D4AE, 18, 1 },
+  { 0x1D4AF, 19, 1 },
+  { 0x1D4B0, 20, 1 },
+  { 0x1D4B1, 21, 1 },
+  { 0x1D4B2, 22, 1 },
+  { 0x1D4B3, 23, 1 },
+  { 0x1D4B4, 24, 1 },
+  { 0x1D4B5, 25, 1 },
+  { 0x1D4B6, 0, 1 },
+  { 0x1D4B7, 1, 1 },
+  { 0x1D4B8, 2, 1 },
+  { 0x1D4B9, 3, 1 },
+  { 0x1D4BB, 5, 1 },
+  { 0x1D4BD, 7, 1 },
+  { 0x1D4BE, 8, 1 },
+  { 0x1D4BF, 9, 1 },
+  { 0x1D4C0, 10, 1 },
+  { 0x1D4C2, 12, 1 },
+  { 0x1D4C3, 13, 1 },
+  { 0x1D4C5, 15, 1 },
+  { 0x1D4C6, 16, 1 },
+  { 0x1D4C7, 17, 1 },
+  { 0x1D4C8, 18, 1 },
+  { 0x1D4C9, 19, 1 },
+  { 0x1D4CA, 20, 1 },
+  { 0x1D4CB, 21, 1 },
+  { 0x1D4CC, 22, 1 },
+  { 0x1D4CD, 23, 1 },
+  { 0x1D4CE, 24, 1 },
+  { 0x1D4CF, 25, 1 },
+  { 0x1D4D0, 0, 1 },
+  { 0x1D4D1, 1, 1 },
+  { 0x1D4D2, 2, 1 },
+  { 0x1D4D3, 3, 1 },
+  { 0x1D4D4, 4, 1 },
+  { 0x1D4D5, 5, 1 },
+  { 0x1D4D6, 6, 1 },
+  { 0x1D4D7, 7, 1 },
+  { 0x1D4D8, 8, 1 },
+  { 0x1D4D9, 9, 1 },
+  { 0x1D4DA, 10, 1 },
+  { 0x1D4DB, 11, 1 },
+  { 0x1D4DC, 12, 1 },
+  { 0x1D4DD, 13, 1 },
+  { 0x1D4DE, 14, 1 },
+  { 0x1D4DF, 15, 1 },
+  { 0x1D4E0, 16, 1 },
+  { 0x1D4E1, 17, 1 },
+  { 0x1D4E2, 18, 1 },
+  { 0x1D4E3, 19, 1 },
+  { 0x1D4E4, 20, 1 },
+  { 0x1D4E5, 21, 1 },
+  { 0x1D4E6, 22, 1 },
+  { 0x1D4E7, 23, 1 },
+  { 0x1D4E8, 24, 1 },
+  { 0x1D4E9, 25, 1 },
+  { 0x1D4EA, 0, 1 },
+  { 0x1D4EB, 1, 1 },
+  { 0x1D4EC, 2, 1 },
+  { 0x1D4ED, 3, 1 },
+  { 0x1D4EE, 4, 1 },
+  { 0x1D4EF, 5, 1 },
+  { 0x1D4F0, 6, 1 },
+  { 0x1D4F1, 7, 1 },
+  { 0x1D4F2, 8, 1 },
+  { 0x1D4F3, 9, 1 },
+  { 0x1D4F4, 10, 1 },
+  { 0x1D4F5, 11, 1 },
+  { 0x1D4F6, 12, 1 },
+  { 0x1D4F7, 13, 1 },
+  { 0x1D4F8, 14, 1 },
+  { 0x1D4F9, 15, 1 },
+  { 0x1D4FA, 16, 1 },
+  { 0x1D4FB, 17, 1 },
+  { 0x1D4FC, 18, 1 },
+  { 0x1D4FD, 19, 1 },
+  { 0x1D4FE, 20, 1 },
+  { 0x1D4FF, 21, 1 },
+  { 0x1D500, 22, 1 },
+  { 0x1D501, 23, 1 },
+  { 0x1D502, 24, 1 },
+  { 0x1D503, 25, 1 },
+  { 0x1D504, 0, 1 },
+  { 0x1D505, 1, 1 },
+  { 0x1D507, 3, 1 },
+  { 0x1D508, 4, 1 },
+  { 0x1D509, 5, 1 },
+  { 0x1D50A, 6, 1 },
+  { 0x1D50D, 9, 1 },
+  { 0x1D50E, 10, 1 },
+  { 0x1D50F, 11, 1 },
+  { 0x1D510, 12, 1 },
+  { 0x1D511, 13, 1 },
+  { 0x1D512, 14, 1 },
+  { 0x1D513, 15, 1 },
+  { 0x1D514, 16, 1 },
+  { 0x1D516, 18, 1 },
+  { 0x1D517, 19, 1 },
+  { 0x1D518, 20, 1 },
+  { 0x1D519, 21, 1 },
+  { 0x1D51A, 22, 1 },
+  { 0x1D51B, 23, 1 },
+  { 0x1D51C, 24, 1 },
+  { 0x1D51E, 0, 1 },
+  { 0x1D51F, 1, 1 },
+  { 0x1D520, 2, 1 },
+  { 0x1D521, 3, 1 },
+  { 0x1D522, 4, 1 },
+  { 0x1D523, 5, 1 },
+  { 0x1D524, 6, 1 },
+  { 0x1D525, 7, 1 },
+  { 0x1D526, 8, 1 },
+  { 0x1D527, 9, 1 },
+  { 0x1D528, 10, 1 },
+  { 0x1D529, 11, 1 },
+  { 0x1D52A, 12, 1 },
+  { 0x1D52B, 13, 1 },
+  { 0x1D52C, 14, 1 },
+  { 0x1D52D, 15, 1 },
+  { 0x1D52E, 16, 1 },
+  { 0x1D52F, 17, 1 },
+  { 0x1D530, 18, 1 },
+  { 0x1D531, 19, 1 },
+  { 0x1D532, 20, 1 },
+  { 0x1D533, 21, 1 },
+  { 0x1D534, 22, 1 },
+  { 0x1D535, 23, 1 },
+  { 0x1D536, 24, 1 },
+  { 0x1D537, 25, 1 },
+  { 0x1D538, 0, 1 },
+  { 0x1D539, 1, 1 },
+  { 0x1D53B, 3, 1 },
+  { 0x1D53C, 4, 1 },
+  { 0x1D53D, 5, 1 },
+  { 0x1D53E, 6, 1 },
+  { 0x1D540, 8, 1 },
+  { 0x1D541, 9, 1 },
+  { 0x1D542, 10, 1 },
+  { 0x1D543, 11, 1 },
+  { 0x1D544, 12, 1 },
+  { 0x1D546, 14, 1 },
+  { 0x1D54A, 18, 1 },
+  { 0x1D54B, 19, 1 },
+  { 0x1D54C, 20, 1 },
+  { 0x1D54D, 21, 1 },
+  { 0x1D54E, 22, 1 },
+  { 0x1D54F, 23, 1 },
+  { 0x1D550, 24, 1 },
+  { 0x1D552, 0, 1 },
+  { 0x1D553, 1, 1 },
+  { 0x1D554, 2, 1 },
+  { 0x1D555, 3, 1 },
+  { 0x1D556, 4, 1 },
+  { 0x1D557, 5, 1 },
+  { 0x1D558, 6, 1 },
+  { 0x1D559, 7, 1 },
+  { 0x1D55A, 8, 1 },
+  { 0x1D55B, 9, 1 },
+  { 0x1D55C, 10, 1 },
+  { 0x1D55D, 11, 1 },
+  { 0x1D55E, 12, 1 },
+  { 0x1D55F, 13, 1 },
+  { 0x1D560, 14, 1 },
+  { 0x1D561, 15, 1 },
+  { 0x1D562, 16, 1 },
+  { 0x1D563, 17, 1 },
+  { 0x1D564, 18, 1 },
+  { 0x1D565, 19, 1 },
+  { 0x1D566, 20, 1 },
+  { 0x1D567, 21, 1 },
+  { 0x1D568, 22, 1 },
+  { 0x1D569, 23, 1 },
+  { 0x1D56A, 24, 1 },
+  { 0x1D56B, 25, 1 },
+  { 0x1D56C, 0, 1 },
+  { 0x1D56D, 1, 1 },
+  { 0x1D56E, 2, 1 },
+  { 0x1D56F, 3, 1 },
+  { 0x1D570, 4, 1 },
+  { 0x1D571, 5, 1 },
+  { 0x1D572, 6, 1 },
+  { 0x1D573, 7, 1 },
+  { 0x1D574, 8, 1 },
+  { 0x1D575, 9, 1 },
+  { 0x1D576, 10, 1 },
+  { 0x1D577, 11, 1 },
+  { 0x1D578, 12, 1 },
+  { 0x1D579, 13, 1 },
+  { 0x1D57A, 14, 1 },
+  { 0x1D57B, 15, 1 },
+  { 0x1D57C, 16, 1 },
+  { 0x1D57D, 17, 1 },
+  { 0x1D57E, 18, 1 },
+  { 0x1D57F, 19, 1 },
+  { 0x1D580, 20, 1 },
+  { 0x1D581, 21, 1 },
+  { 0x1D582, 22, 1 },
+  { 0x1D583, 23, 1 },
+  { 0x1D584, 24, 1 },
+  { 0x1D585, 25, 1 },
+  { 0x1D586, 0, 1 },
+  { 0x1D587, 1, 1 },
+  { 0x1D588, 2, 1 },
+  { 0x1D589, 3, 1 },
+  { 0x1D58A, 4, 1 },
+  { 0x1D58B, 5, 1 },
+  { 0x1D58C, 6, 1 },
+  { 0x1D58D, 7, 1 },
+  { 0x1D58E, 8, 1 },
+  { 0x1D58F, 9, 1 },
+  { 0x1D590, 10, 1 },
+  { 0x1D591, 11, 1 },
+  { 0x1D592, 12, 1 },
+  { 0x1D593, 13, 1 },
+  { 0x1D594, 14, 1 },
+  { 0x1D595, 15, 1 },
+  { 0x1D596, 16, 1 },
+  { 0x1D597, 17, 1 },
+  { 0x1D598, 18, 1 },
+  { 0x1D599, 19, 1 },
+  { 0x1D59A, 20, 1 },
+  { 0x1D59B, 21, 1 },
+  { 0x1D59C, 22, 1 },
+  { 0x1D59D, 23, 1 },
+  { 0x1D59E, 24, 1 },
+  { 0x1D59F, 25, 1 },
+  { 0x1D5A0, 0, 1 },
+  { 0x1D5A1, 1, 1 },
+  { 0x1D5A2, 2, 1 },
+  { 0x1D5A3, 3, 1 },
+  { 0x1D5A4, 4, 1 },
+  { 0x1D5A5, 5, 1 },
+  { 0x1D5A6, 6, 1 },
+  { 0x1D5A7, 7, 1 },
+  { 0x1D5A8, 8, 1 },
+  { 0x1D5A9, 9, 1 },
+  { 0x1D5AA, 10, 1 },
+  { 0x1D5AB, 11, 1 },
+  { 0x1D5AC, 12, 1 },
+  { 0x1D5AD, 13, 1 },
+  { 0x1D5AE, 14, 1 },
+  { 0x1D5AF, 15, 1 },
+  { 0x1D5B0, 16, 1 },
+  { 0x1D5B1, 17, 1 },
+  { 0x1D5B2, 18, 1 },
+  { 0x1D5B3, 19, 1 },
+  { 0x1D5B4, 20, 1 },
+  { 0x1D5B5, 21, 1 },
+  { 0x1D5B6, 22, 1 },
+  { 0x1D5B7, 23, 1 },
+  { 0x1D5B8, 24, 1 },
+  { 0x1D5B9, 25, 1 },
+  { 0x1D5BA, 0, 1 },
+  { 0x1D5BB, 1, 1 },
+  { 0x1D5BC, 2, 1 },
+  { 0x1D5BD, 3, 1 },
+  { 0x1D5BE, 4, 1 },
+  { 0x1D5BF, 5, 1 },
+  { 0x1D5C0, 6, 1 },
+  { 0x1D5C1, 7, 1 },
+  { 0x1D5C2, 8, 1 },
+  { 0x1D5C3, 9, 1 },
+  { 0x1D5C4, 10, 1 },
+  { 0x1D5C5, 11, 1 },
+  { 0x1D5C6, 12, 1 },
+  { 0x1D5C7, 13, 1 },
+  { 0x1D5C8, 14, 1 },
+  { 0x1D5C9, 15, 1 },
+  { 0x1D5CA, 16, 1 },
+  { 0x1D5CB, 17, 1 },
+  { 0x1D5CC, 18, 1 },
+  { 0x1D5CD, 19, 1 },
+  { 0x1D5CE, 20, 1 },
+  { 0x1D5CF, 21, 1 },
+  { 0x1D5D0, 22, 1 },
+  { 0x1D5D1, 23, 1 },
+  { 0x1D5D2, 24, 1 },
+  { 0x1D5D3, 25, 1 },
+  { 0x1D5D4, 0, 1 },
+  { 0x1D5D5, 1, 1 },
+  { 0x1D5D6, 2, 1 },
+  { 0x1D5D7, 3, 1 },
+  { 0x1D5D8, 4, 1 },
+  { 0x1D5D9, 5, 1 },
+  { 0x1D5DA, 6, 1 },
+  { 0x1D5DB, 7, 1 },
+  { 0x1D5DC, 8, 1 },
+  { 0x1D5DD, 9, 1 },
+  { 0x1D5DE, 10, 1 },
+  { 0x1D5DF, 11, 1 },
+  { 0x1D5E0, 12, 1 },
+  { 0x1D5E1, 13, 1 },
+  { 0x1D5E2, 14, 1 },
+  { 0x1D5E3, 15, 1 },
+  { 0x1D5E4, 16, 1 },
+  { 0x1D5E5, 17, 1 },
+  { 0x1D5E6, 18, 1 },
+  { 0x1D5E7, 19, 1 },
+  { 0x1D5E8, 20, 1 },
+  { 0x1D5E9, 21, 1 },
+  { 0x1D5EA, 22, 1 },
+  { 0x1D5EB, 23, 1 },
+  { 0x1D5EC, 24, 1 },
+  { 0x1D5ED, 25, 1 },
+  { 0x1D5EE, 0, 1 },
+  { 0x1D5EF, 1, 1 },
+  { 0x1D5F0, 2, 1 },
+  { 0x1D5F1, 3, 1 },
+  { 0x1D5F2, 4, 1 },
+  { 0x1D5F3, 5, 1 },
+  { 0x1D5F4, 6, 1 },
+  { 0x1D5F5, 7, 1 },
+  { 0x1D5F6, 8, 1 },
+  { 0x1D5F7, 9, 1 },
+  { 0x1D5F8, 10, 1 },
+  { 0x1D5F9, 11, 1 },
+  { 0x1D5FA, 12, 1 },
+  { 0x1D5FB, 13, 1 },
+  { 0x1D5FC, 14, 1 },
+  { 0x1D5FD, 15, 1 },
+  { 0x1D5FE, 16, 1 },
+  { 0x1D5FF, 17, 1 },
+  { 0x1D600, 18, 1 },
+  { 0x1D601, 19, 1 },
+  { 0x1D602, 20, 1 },
+  { 0x1D603, 21, 1 },
+  { 0x1D604, 22, 1 },
+  { 0x1D605, 23, 1 },
+  { 0x1D606, 24, 1 },
+  { 0x1D607, 25, 1 },
+  { 0x1D608, 0, 1 },
+  { 0x1D609, 1, 1 },
+  { 0x1D60A, 2, 1 },
+  { 0x1D60B, 3, 1 },
+  { 0x1D60C, 4, 1 },
+  { 0x1D60D, 5, 1 },
+  { 0x1D60E, 6, 1 },
+  { 0x1D60F, 7, 1 },
+  { 0x1D610, 8, 1 },
+  { 0x1D611, 9, 1 },
+  { 0x1D612, 10, 1 },
+  { 0x1D613, 11, 1 },
+  { 0x1D614, 12, 1 },
+  { 0x1D615, 13, 1 },
+  { 0x1D616, 14, 1 },
+  { 0x1D617, 15, 1 },
+  { 0x1D618, 16, 1 },
+  { 0x1D619, 17, 1 },
+  { 0x1D61A, 18, 1 },
+  { 0x1D61B, 19, 1 },
+  { 0x1D61C, 20, 1 },
+  { 0x1D61D, 21, 1 },
+  { 0x1D61E, 22, 1 },
+  { 0x1D61F, 23, 1 },
+  { 0x1D620, 24, 1 },
+  { 0x1D621, 25, 1 },
+  { 0x1D622, 0, 1 },
+  { 0x1D623, 1, 1 },
+  { 0x1D624, 2, 1 },
+  { 0x1D625, 3, 1 },
+  { 0x1D626, 4, 1 },
+  { 0x1D627, 5, 1 },
+  { 0x1D628, 6, 1 },
+  { 0x1D629, 7, 1 },
+  { 0x1D62A, 8, 1 },
+  { 0x1D62B, 9, 1 },
+  { 0x1D62C, 10, 1 },
+  { 0x1D62D, 11, 1 },
+  { 0x1D62E, 12, 1 },
+  { 0x1D62F, 13, 1 },
+  { 0x1D630, 14, 1 },
+  { 0x1D631, 15, 1 },
+  { 0x1D632, 16, 1 },
+  { 0x1D633, 17, 1 },
+  { 0x1D634, 18, 1 },
+  { 0x1D635, 19, 1 },
+  { 0x1D636, 20, 1 },
+  { 0x1D637, 21, 1 },
+  { 0x1D638, 22, 1 },
+  { 0x1D639, 23, 1 },
+  { 0x1D63A, 24, 1 },
+  { 0x1D63B, 25, 1 },
+  { 0x1D63C, 0, 1 },
+  { 0x1D63D, 1, 1 },
+  { 0x1D63E, 2, 1 },
+  { 0x1D63F, 3, 1 },
+  { 0x1D640, 4, 1 },
+  { 0x1D641, 5, 1 },
+  { 0x1D642, 6, 1 },
+  { 0x1D643, 7, 1 },
+  { 0x1D644, 8, 1 },
+  { 0x1D645, 9, 1 },
+  { 0x1D646, 10, 1 },
+  { 0x1D647, 11, 1 },
+  { 0x1D648, 12, 1 },
+  { 0x1D649, 13, 1 },
+  { 0x1D64A, 14, 1 },
+  { 0x1D64B, 15, 1 },
+  { 0x1D64C, 16, 1 },
+  { 0x1D64D, 17, 1 },
+  { 0x1D64E, 18, 1 },
+  { 0x1D64F, 19, 1 },
+  { 0x1D650, 20, 1 },
+  { 0x1D651, 21, 1 },
+  { 0x1D652, 22, 1 },
+  { 0x1D653, 23, 1 },
+  { 0x1D654, 24, 1 },
+  { 0x1D655, 25, 1 },
+  { 0x1D656, 0, 1 },
+  { 0x1D657, 1, 1 },
+  { 0x1D658, 2, 1 },
+  { 0x1D659, 3, 1 },
+  { 0x1D65A, 4, 1 },
+  { 0x1D65B, 5, 1 },
+  { 0x1D65C, 6, 1 },
+  { 0x1D65D, 7, 1 },
+  { 0x1D65E, 8, 1 },
+  { 0x1D65F, 9, 1 },
+  { 0x1D660, 10, 1 },
+  { 0x1D661, 11, 1 },
+  { 0x1D662, 12, 1 },
+  { 0x1D663, 13, 1 },
+  { 0x1D664, 14, 1 },
+  { 0x1D665, 15, 1 },
+  { 0x1D666, 16, 1 },
+  { 0x1D667, 17, 1 },
+  { 0x1D668, 18, 1 },
+  { 0x1D669, 19, 1 },
+  { 0x1D66A, 20, 1 },
+  { 0x1D66B, 21, 1 },
+  { 0x1D66C, 22, 1 },
+  { 0x1D66D, 23, 1 },
+  { 0x1D66E, 24, 1 },
+  { 0x1D66F, 25, 1 },
+  { 0x1D670, 0, 1 },
+  { 0x1D671, 1, 1 },
+  { 0x1D672, 2, 1 },
+  { 0x1D673, 3, 1 },
+  { 0x1D674, 4, 1 },
+  { 0x1D675, 5, 1 },
+  { 0x1D676, 6, 1 },
+  { 0x1D677, 7, 1 },
+  { 0x1D678, 8, 1 },
+  { 0x1D679, 9, 1 },
+  { 0x1D67A, 10, 1 },
+  { 0x1D67B, 11, 1 },
+  { 0x1D67C, 12, 1 },
+  { 0x1D67D, 13, 1 },
+  { 0x1D67E, 14, 1 },
+  { 0x1D67F, 15, 1 },
+  { 0x1D680, 16, 1 },
+  { 0x1D681, 17, 1 },
+  { 0x1D682, 18, 1 },
+  { 0x1D683, 19, 1 },
+  { 0x1D684, 20, 1 },
+  { 0x1D685, 21, 1 },
+  { 0x1D686, 22, 1 },
+  { 0x1D687, 23, 1 },
+  { 0x1D688, 24, 1 },
+  { 0x1D689, 25, 1 },
+  { 0x1D68A, 0, 1 },
+  { 0x1D68B, 1, 1 },
+  { 0x1D68C, 2, 1 },
+  { 0x1D68D, 3, 1 },
+  { 0x1D68E, 4, 1 },
+  { 0x1D68F, 5, 1 },
+  { 0x1D690, 6, 1 },
+  { 0x1D691, 7, 1 },
+  { 0x1D692, 8, 1 },
+  { 0x1D693, 9, 1 },
+  { 0x1D694, 10, 1 },
+  { 0x1D695, 11, 1 },
+  { 0x1D696, 12, 1 },
+  { 0x1D697, 13, 1 },
+  { 0x1D698, 14, 1 },
+  { 0x1D699, 15, 1 },
+  { 0x1D69A, 16, 1 },
+  { 0x1D69B, 17, 1 },
+  { 0x1D69C, 18, 1 },
+  { 0x1D69D, 19, 1 },
+  { 0x1D69E, 20, 1 },
+  { 0x1D69F, 21, 1 },
+  { 0x1D6A0, 22, 1 },
+  { 0x1D6A1, 23, 1 },
+  { 0x1D6A2, 24, 1 },
+  { 0x1D6A3, 25, 1 },
+  { 0x1D6A8, 429, 1 },
+  { 0x1D6A9, 430, 1 },
+  { 0x1D6AA, 431, 1 },
+  { 0x1D6AB, 432, 1 },
+  { 0x1D6AC, 433, 1 },
+  { 0x1D6AD, 434, 1 },
+  { 0x1D6AE, 435, 1 },
+  { 0x1D6AF, 436, 1 },
+  { 0x1D6B0, 403, 1 },
+  { 0x1D6B1, 437, 1 },
+  { 0x1D6B2, 438, 1 },
+  { 0x1D6B3, 35, 1 },
+  { 0x1D6B4, 439, 1 },
+  { 0x1D6B5, 440, 1 },
+  { 0x1D6B6, 441, 1 },
+  { 0x1D6B7, 442, 1 },
+  { 0x1D6B8, 443, 1 },
+  { 0x1D6B9, 436, 1 },
+  { 0x1D6BA, 444, 1 },
+  { 0x1D6BB, 445, 1 },
+  { 0x1D6BC, 446, 1 },
+  { 0x1D6BD, 447, 1 },
+  { 0x1D6BE, 448, 1 },
+  { 0x1D6BF, 449, 1 },
+  { 0x1D6C0, 450, 1 },
+  { 0x1D6C1, 4924, 1 },
+  { 0x1D6C2, 429, 1 },
+  { 0x1D6C3, 430, 1 },
+  { 0x1D6C4, 431, 1 },
+  { 0x1D6C5, 432, 1 },
+  { 0x1D6C6, 433, 1 },
+  { 0x1D6C7, 434, 1 },
+  { 0x1D6C8, 435, 1 },
+  { 0x1D6C9, 436, 1 },
+  { 0x1D6CA, 403, 1 },
+  { 0x1D6CB, 437, 1 },
+  { 0x1D6CC, 438, 1 },
+  { 0x1D6CD, 35, 1 },
+  { 0x1D6CE, 439, 1 },
+  { 0x1D6CF, 440, 1 },
+  { 0x1D6D0, 441, 1 },
+  { 0x1D6D1, 442, 1 },
+  { 0x1D6D2, 443, 1 },
+  { 0x1D6D3, 444, 1 },
+  { 0x1D6D4, 444, 1 },
+  { 0x1D6D5, 445, 1 },
+  { 0x1D6D6, 446, 1 },
+  { 0x1D6D7, 447, 1 },
+  { 0x1D6D8, 448, 1 },
+  { 0x1D6D9, 449, 1 },
+  { 0x1D6DA, 450, 1 },
+  { 0x1D6DB, 4925, 1 },
+  { 0x1D6DC, 433, 1 },
+  { 0x1D6DD, 436, 1 },
+  { 0x1D6DE, 437, 1 },
+  { 0x1D6DF, 447, 1 },
+  { 0x1D6E0, 443, 1 },
+  { 0x1D6E1, 442, 1 },
+  { 0x1D6E2, 429, 1 },
+  { 0x1D6E3, 430, 1 },
+  { 0x1D6E4, 431, 1 },
+  { 0x1D6E5, 432, 1 },
+  { 0x1D6E6, 433, 1 },
+  { 0x1D6E7, 434, 1 },
+  { 0x1D6E8, 435, 1 },
+  { 0x1D6E9, 436, 1 },
+  { 0x1D6EA, 403, 1 },
+  { 0x1D6EB, 437, 1 },
+  { 0x1D6EC, 438, 1 },
+  { 0x1D6ED, 35, 1 },
+  { 0x1D6EE, 439, 1 },
+  { 0x1D6EF, 440, 1 },
+  { 0x1D6F0, 441, 1 },
+  { 0x1D6F1, 442, 1 },
+  { 0x1D6F2, 443, 1 },
+  { 0x1D6F3, 436, 1 },
+  { 0x1D6F4, 444, 1 },
+  { 0x1D6F5, 445, 1 },
+  { 0x1D6F6, 446, 1 },
+  { 0x1D6F7, 447, 1 },
+  { 0x1D6F8, 448, 1 },
+  { 0x1D6F9, 449, 1 },
+  { 0x1D6FA, 450, 1 },
+  { 0x1D6FB, 4924, 1 },
+  { 0x1D6FC, 429, 1 },
+  { 0x1D6FD, 430, 1 },
+  { 0x1D6FE, 431, 1 },
+  { 0x1D6FF, 432, 1 },
+  { 0x1D700, 433, 1 },
+  { 0x1D701, 434, 1 },
+  { 0x1D702, 435, 1 },
+  { 0x1D703, 436, 1 },
+  { 0x1D704, 403, 1 },
+  { 0x1D705, 437, 1 },
+  { 0x1D706, 438, 1 },
+  { 0x1D707, 35, 1 },
+  { 0x1D708, 439, 1 },
+  { 0x1D709, 440, 1 },
+  { 0x1D70A, 441, 1 },
+  { 0x1D70B, 442, 1 },
+  { 0x1D70C, 443, 1 },
+  { 0x1D70D, 444, 1 },
+  { 0x1D70E, 444, 1 },
+  { 0x1D70F, 445, 1 },
+  { 0x1D710, 446, 1 },
+  { 0x1D711, 447, 1 },
+  { 0x1D712, 448, 1 },
+  { 0x1D713, 449, 1 },
+  { 0x1D714, 450, 1 },
+  { 0x1D715, 4925, 1 },
+  { 0x1D716, 433, 1 },
+  { 0x1D717, 436, 1 },
+  { 0x1D718, 437, 1 },
+  { 0x1D719, 447, 1 },
+  { 0x1D71A, 443, 1 },
+  { 0x1D71B, 442, 1 },
+  { 0x1D71C, 429, 1 },
+  { 0x1D71D, 430, 1 },
+  { 0x1D71E, 431, 1 },
+  { 0x1D71F, 432, 1 },
+  { 0x1D720, 433, 1 },
+  { 0x1D721, 434, 1 },
+  { 0x1D722, 435, 1 },
+  { 0x1D723, 436, 1 },
+  { 0x1D724, 403, 1 },
+  { 0x1D725, 437, 1 },
+  { 0x1D726, 438, 1 },
+  { 0x1D727, 35, 1 },
+  { 0x1D728, 439, 1 },
+  { 0x1D729, 440, 1 },
+  { 0x1D72A, 441, 1 },
+  { 0x1D72B, 442, 1 },
+  { 0x1D72C, 443, 1 },
+  { 0x1D72D, 436, 1 },
+  { 0x1D72E, 444, 1 },
+  { 0x1D72F, 445, 1 },
+  { 0x1D730, 446, 1 },
+  { 0x1D731, 447, 1 },
+  { 0x1D732, 448, 1 },
+  { 0x1D733, 449, 1 },
+  { 0x1D734, 450, 1 },
+  { 0x1D735, 4924, 1 },
+  { 0x1D736, 429, 1 },
+  { 0x1D737, 430, 1 },
+  { 0x1D738, 431, 1 },
+  { 0x1D739, 432, 1 },
+  { 0x1D73A, 433, 1 },
+  { 0x1D73B, 434, 1 },
+  { 0x1D73C, 435, 1 },
+  { 0x1D73D, 436, 1 },
+  { 0x1D73E, 403, 1 },
+  { 0x1D73F, 437, 1 },
+  { 0x1D740, 438, 1 },
+  { 0x1D741, 35, 1 },
+  { 0x1D742, 439, 1 },
+  { 0x1D743, 440, 1 },
+  { 0x1D744, 441, 1 },
+  { 0x1D745, 442, 1 },
+  { 0x1D746, 443, 1 },
+  { 0x1D747, 444, 1 },
+  { 0x1D748, 444, 1 },
+  { 0x1D749, 445, 1 },
+  { 0x1D74A, 446, 1 },
+  { 0x1D74B, 447, 1 },
+  { 0x1D74C, 448, 1 },
+  { 0x1D74D, 449, 1 },
+  { 0x1D74E, 450, 1 },
+  { 0x1D74F, 4925, 1 },
+  { 0x1D750, 433, 1 },
+  { 0x1D751, 436, 1 },
+  { 0x1D752, 437, 1 },
+  { 0x1D753, 447, 1 },
+  { 0x1D754, 443, 1 },
+  { 0x1D755, 442, 1 },
+  { 0x1D756, 429, 1 },
+  { 0x1D757, 430, 1 },
+  { 0x1D758, 431, 1 },
+  { 0x1D759, 432, 1 },
+  { 0x1D75A, 433, 1 },
+  { 0x1D75B, 434, 1 },
+  { 0x1D75C, 435, 1 },
+  { 0x1D75D, 436, 1 },
+  { 0x1D75E, 403, 1 },
+  { 0x1D75F, 437, 1 },
+  { 0x1D760, 438, 1 },
+  { 0x1D761, 35, 1 },
+  { 0x1D762, 439, 1 },
+  { 0x1D763, 440, 1 },
+  { 0x1D764, 441, 1 },
+  { 0x1D765, 442, 1 },
+  { 0x1D766, 443, 1 },
+  { 0x1D767, 436, 1 },
+  { 0x1D768, 444, 1 },
+  { 0x1D769, 445, 1 },
+  { 0x1D76A, 446, 1 },
+  { 0x1D76B, 447, 1 },
+  { 0x1D76C, 448, 1 },
+  { 0x1D76D, 449, 1 },
+  { 0x1D76E, 450, 1 },
+  { 0x1D76F, 4924, 1 },
+  { 0x1D770, 429, 1 },
+  { 0x1D771, 430, 1 },
+  { 0x1D772, 431, 1 },
+  { 0x1D773, 432, 1 },
+  { 0x1D774, 433, 1 },
+  { 0x1D775, 434, 1 },
+  { 0x1D776, 435, 1 },
+  { 0x1D777, 436, 1 },
+  { 0x1D778, 403, 1 },
+  { 0x1D779, 437, 1 },
+  { 0x1D77A, 438, 1 },
+  { 0x1D77B, 35, 1 },
+  { 0x1D77C, 439, 1 },
+  { 0x1D77D, 440, 1 },
+  { 0x1D77E, 441, 1 },
+  { 0x1D77F, 442, 1 },
+  { 0x1D780, 443, 1 },
+  { 0x1D781, 444, 1 },
+  { 0x1D782, 444, 1 },
+  { 0x1D783, 445, 1 },
+  { 0x1D784, 446, 1 },
+  { 0x1D785, 447, 1 },
+  { 0x1D786, 448, 1 },
+  { 0x1D787, 449, 1 },
+  { 0x1D788, 450, 1 },
+  { 0x1D789, 4925, 1 },
+  { 0x1D78A, 433, 1 },
+  { 0x1D78B, 436, 1 },
+  { 0x1D78C, 437, 1 },
+  { 0x1D78D, 447, 1 },
+  { 0x1D78E, 443, 1 },
+  { 0x1D78F, 442, 1 },
+  { 0x1D790, 429, 1 },
+  { 0x1D791, 430, 1 },
+  { 0x1D792, 431, 1 },
+  { 0x1D793, 432, 1 },
+  { 0x1D794, 433, 1 },
+  { 0x1D795, 434, 1 },
+  { 0x1D796, 435, 1 },
+  { 0x1D797, 436, 1 },
+  { 0x1D798, 403, 1 },
+  { 0x1D799, 437, 1 },
+  { 0x1D79A, 438, 1 },
+  { 0x1D79B, 35, 1 },
+  { 0x1D79C, 439, 1 },
+  { 0x1D79D, 440, 1 },
+  { 0x1D79E, 441, 1 },
+  { 0x1D79F, 442, 1 },
+  { 0x1D7A0, 443, 1 },
+  { 0x1D7A1, 436, 1 },
+  { 0x1D7A2, 444, 1 },
+  { 0x1D7A3, 445, 1 },
+  { 0x1D7A4, 446, 1 },
+  { 0x1D7A5, 447, 1 },
+  { 0x1D7A6, 448, 1 },
+  { 0x1D7A7, 449, 1 },
+  { 0x1D7A8, 450, 1 },
+  { 0x1D7A9, 4924, 1 },
+  { 0x1D7AA, 429, 1 },
+  { 0x1D7AB, 430, 1 },
+  { 0x1D7AC, 431, 1 },
+  { 0x1D7AD, 432, 1 },
+  { 0x1D7AE, 433, 1 },
+  { 0x1D7AF, 434, 1 },
+  { 0x1D7B0, 435, 1 },
+  { 0x1D7B1, 436, 1 },
+  { 0x1D7B2, 403, 1 },
+  { 0x1D7B3, 437, 1 },
+  { 0x1D7B4, 438, 1 },
+  { 0x1D7B5, 35, 1 },
+  { 0x1D7B6, 439, 1 },
+  { 0x1D7B7, 440, 1 },
+  { 0x1D7B8, 441, 1 },
+  { 0x1D7B9, 442, 1 },
+  { 0x1D7BA, 443, 1 },
+  { 0x1D7BB, 444, 1 },
+  { 0x1D7BC, 444, 1 },
+  { 0x1D7BD, 445, 1 },
+  { 0x1D7BE, 446, 1 },
+  { 0x1D7BF, 447, 1 },
+  { 0x1D7C0, 448, 1 },
+  { 0x1D7C1, 449, 1 },
+  { 0x1D7C2, 450, 1 },
+  { 0x1D7C3, 4925, 1 },
+  { 0x1D7C4, 433, 1 },
+  { 0x1D7C5, 436, 1 },
+  { 0x1D7C6, 437, 1 },
+  { 0x1D7C7, 447, 1 },
+  { 0x1D7C8, 443, 1 },
+  { 0x1D7C9, 442, 1 },
+  { 0x1D7CE, 1505, 1 },
+  { 0x1D7CF, 38, 1 },
+  { 0x1D7D0, 31, 1 },
+  { 0x1D7D1, 32, 1 },
+  { 0x1D7D2, 1506, 1 },
+  { 0x1D7D3, 1507, 1 },
+  { 0x1D7D4, 1508, 1 },
+  { 0x1D7D5, 1509, 1 },
+  { 0x1D7D6, 1510, 1 },
+  { 0x1D7D7, 1511, 1 },
+  { 0x1D7D8, 1505, 1 },
+  { 0x1D7D9, 38, 1 },
+  { 0x1D7DA, 31, 1 },
+  { 0x1D7DB, 32, 1 },
+  { 0x1D7DC, 1506, 1 },
+  { 0x1D7DD, 1507, 1 },
+  { 0x1D7DE, 1508, 1 },
+  { 0x1D7DF, 1509, 1 },
+  { 0x1D7E0, 1510, 1 },
+  { 0x1D7E1, 1511, 1 },
+  { 0x1D7E2, 1505, 1 },
+  { 0x1D7E3, 38, 1 },
+  { 0x1D7E4, 31, 1 },
+  { 0x1D7E5, 32, 1 },
+  { 0x1D7E6, 1506, 1 },
+  { 0x1D7E7, 1507, 1 },
+  { 0x1D7E8, 1508, 1 },
+  { 0x1D7E9, 1509, 1 },
+  { 0x1D7EA, 1510, 1 },
+  { 0x1D7EB, 1511, 1 },
+  { 0x1D7EC, 1505, 1 },
+  { 0x1D7ED, 38, 1 },
+  { 0x1D7EE, 31, 1 },
+  { 0x1D7EF, 32, 1 },
+  { 0x1D7F0, 1506, 1 },
+  { 0x1D7F1, 1507, 1 },
+  { 0x1D7F2, 1508, 1 },
+  { 0x1D7F3, 1509, 1 },
+  { 0x1D7F4, 1510, 1 },
+  { 0x1D7F5, 1511, 1 },
+  { 0x1D7F6, 1505, 1 },
+  { 0x1D7F7, 38, 1 },
+  { 0x1D7F8, 31, 1 },
+  { 0x1D7F9, 32, 1 },
+  { 0x1D7FA, 1506, 1 },
+  { 0x1D7FB, 1507, 1 },
+  { 0x1D7FC, 1508, 1 },
+  { 0x1D7FD, 1509, 1 },
+  { 0x1D7FE, 1510, 1 },
+  { 0x1D7FF, 1511, 1 },
+  { 0x2F800, 4926, 1 },
+  { 0x2F801, 4927, 1 },
+  { 0x2F802, 4928, 1 },
+  { 0x2F803, 4929, 1 },
+  { 0x2F804, 4930, 1 },
+  { 0x2F805, 3805, 1 },
+  { 0x2F806, 4931, 1 },
+  { 0x2F807, 4932, 1 },
+  { 0x2F808, 4933, 1 },
+  { 0x2F809, 4934, 1 },
+  { 0x2F80A, 3806, 1 },
+  { 0x2F80B, 4935, 1 },
+  { 0x2F80C, 4936, 1 },
+  { 0x2F80D, 4937, 1 },
+  { 0x2F80E, 3807, 1 },
+  { 0x2F80F, 4938, 1 },
+  { 0x2F810, 4939, 1 },
+  { 0x2F811, 4940, 1 },
+  { 0x2F812, 4941, 1 },
+  { 0x2F813, 4942, 1 },
+  { 0x2F814, 4943, 1 },
+  { 0x2F815, 4944, 1 },
+  { 0x2F816, 4945, 1 },
+  { 0x2F817, 4946, 1 },
+  { 0x2F818, 4947, 1 },
+  { 0x2F819, 4948, 1 },
+  { 0x2F81A, 4949, 1 },
+  { 0x2F81B, 4950, 1 },
+  { 0x2F81C, 4951, 1 },
+  { 0x2F81D, 1964, 1 },
+  { 0x2F81E, 4952, 1 },
+  { 0x2F81F, 4953, 1 },
+  { 0x2F820, 4954, 1 },
+  { 0x2F821, 4955, 1 },
+  { 0x2F822, 4956, 1 },
+  { 0x2F823, 4957, 1 },
+  { 0x2F824, 4958, 1 },
+  { 0x2F825, 4959, 1 },
+  { 0x2F826, 3808, 1 },
+  { 0x2F827, 3809, 1 },
+  { 0x2F828, 4960, 1 },
+  { 0x2F829, 4961, 1 },
+  { 0x2F82A, 4962, 1 },
+  { 0x2F82B, 3628, 1 },
+  { 0x2F82C, 4963, 1 },
+  { 0x2F82D, 3810, 1 },
+  { 0x2F82E, 4964, 1 },
+  { 0x2F82F, 4965, 1 },
+  { 0x2F830, 4966, 1 },
+  { 0x2F831, 4967, 1 },
+  { 0x2F832, 4967, 1 },
+  { 0x2F833, 4967, 1 },
+  { 0x2F834, 4968, 1 },
+  { 0x2F835, 4969, 1 },
+  { 0x2F836, 4970, 1 },
+  { 0x2F837, 4971, 1 },
+  { 0x2F838, 4972, 1 },
+  { 0x2F839, 4973, 1 },
+  { 0x2F83A, 4974, 1 },
+  { 0x2F83B, 4975, 1 },
+  { 0x2F83C, 4976, 1 },
+  { 0x2F83D, 4977, 1 },
+  { 0x2F83E, 4978, 1 },
+  { 0x2F83F, 4979, 1 },
+  { 0x2F840, 4980, 1 },
+  { 0x2F841, 4981, 1 },
+  { 0x2F842, 4982, 1 },
+  { 0x2F843, 4983, 1 },
+  { 0x2F844, 4984, 1 },
+  { 0x2F845, 4985, 1 },
+  { 0x2F846, 4985, 1 },
+  { 0x2F847, 4986, 1 },
+  { 0x2F848, 4987, 1 },
+  { 0x2F849, 4988, 1 },
+  { 0x2F84A, 4989, 1 },
+  { 0x2F84B, 4990, 1 },
+  { 0x2F84C, 3812, 1 },
+  { 0x2F84D, 4991, 1 },
+  { 0x2F84E, 4992, 1 },
+  { 0x2F84F, 4993, 1 },
+  { 0x2F850, 3774, 1 },
+  { 0x2F851, 4994, 1 },
+  { 0x2F852, 4995, 1 },
+  { 0x2F853, 4996, 1 },
+  { 0x2F854, 4997, 1 },
+  { 0x2F855, 4998, 1 },
+  { 0x2F856, 4999, 1 },
+  { 0x2F857, 5000, 1 },
+  { 0x2F858, 5001, 1 },
+  { 0x2F859, 5002, 1 },
+  { 0x2F85A, 5003, 1 },
+  { 0x2F85B, 5004, 1 },
+  { 0x2F85C, 5005, 1 },
+  { 0x2F85D, 5006, 1 },
+  { 0x2F85E, 5007, 1 },
+  { 0x2F85F, 5008, 1 },
+  { 0x2F860, 5009, 1 },
+  { 0x2F861, 5010, 1 },
+  { 0x2F862, 5011, 1 },
+  { 0x2F863, 5012, 1 },
+  { 0x2F864, 5013, 1 },
+  { 0x2F865, 5014, 1 },
+  { 0x2F866, 5015, 1 },
+  { 0x2F867, 5016, 1 },
+  { 0x2F868, 5017, 1 },
+  { 0x2F869, 5018, 1 },
+  { 0x2F86A, 5019, 1 },
+  { 0x2F86B, 5019, 1 },
+  { 0x2F86C, 5020, 1 },
+  { 0x2F86D, 5021, 1 },
+  { 0x2F86E, 5022, 1 },
+  { 0x2F86F, 3624, 1 },
+  { 0x2F870, 5023, 1 },
+  { 0x2F871, 5024, 1 },
+  { 0x2F872, 5025, 1 },
+  { 0x2F873, 5026, 1 },
+  { 0x2F874, 5027, 1 },
+  { 0x2F875, 1990, 1 },
+  { 0x2F876, 5028, 1 },
+  { 0x2F877, 5029, 1 },
+  { 0x2F878, 1992, 1 },
+  { 0x2F879, 5030, 1 },
+  { 0x2F87A, 5031, 1 },
+  { 0x2F87B, 5032, 1 },
+  { 0x2F87C, 5033, 1 },
+  { 0x2F87D, 5034, 1 },
+  { 0x2F87E, 5035, 1 },
+  { 0x2F87F, 5036, 1 },
+  { 0x2F880, 5037, 1 },
+  { 0x2F881, 5038, 1 },
+  { 0x2F882, 5039, 1 },
+  { 0x2F883, 5040, 1 },
+  { 0x2F884, 5041, 1 },
+  { 0x2F885, 5042, 1 },
+  { 0x2F886, 5043, 1 },
+  { 0x2F887, 5044, 1 },
+  { 0x2F888, 5045, 1 },
+  { 0x2F889, 5046, 1 },
+  { 0x2F88A, 5047, 1 },
+  { 0x2F88B, 5048, 1 },
+  { 0x2F88C, 5049, 1 },
+  { 0x2F88D, 5050, 1 },
+  { 0x2F88E, 3572, 1 },
+  { 0x2F88F, 5051, 1 },
+  { 0x2F890, 2002, 1 },
+  { 0x2F891, 5052, 1 },
+  { 0x2F892, 5052, 1 },
+  { 0x2F893, 5053, 1 },
+  { 0x2F894, 5054, 1 },
+  { 0x2F895, 5054, 1 },
+  { 0x2F896, 5055, 1 },
+  { 0x2F897, 5056, 1 },
+  { 0x2F898, 5057, 1 },
+  { 0x2F899, 5058, 1 },
+  { 0x2F89A, 5059, 1 },
+  { 0x2F89B, 5060, 1 },
+  { 0x2F89C, 5061, 1 },
+  { 0x2F89D, 5062, 1 },
+  { 0x2F89E, 5063, 1 },
+  { 0x2F89F, 5064, 1 },
+  { 0x2F8A0, 5065, 1 },
+  { 0x2F8A1, 5066, 1 },
+  { 0x2F8A2, 5067, 1 },
+  { 0x2F8A3, 3817, 1 },
+  { 0x2F8A4, 5068, 1 },
+  { 0x2F8A5, 5069, 1 },
+  { 0x2F8A6, 5070, 1 },
+  { 0x2F8A7, 5071, 1 },
+  { 0x2F8A8, 5072, 1 },
+  { 0x2F8A9, 5071, 1 },
+  { 0x2F8AA, 5073, 1 },
+  { 0x2F8AB, 3819, 1 },
+  { 0x2F8AC, 5074, 1 },
+  { 0x2F8AD, 5075, 1 },
+  { 0x2F8AE, 5076, 1 },
+  { 0x2F8AF, 5077, 1 },
+  { 0x2F8B0, 3820, 1 },
+  { 0x2F8B1, 3545, 1 },
+  { 0x2F8B2, 5078, 1 },
+  { 0x2F8B3, 5079, 1 },
+  { 0x2F8B4, 5080, 1 },
+  { 0x2F8B5, 5081, 1 },
+  { 0x2F8B6, 5082, 1 },
+  { 0x2F8B7, 5083, 1 },
+  { 0x2F8B8, 5084, 1 },
+  { 0x2F8B9, 5085, 1 },
+  { 0x2F8BA, 5086, 1 },
+  { 0x2F8BB, 5087, 1 },
+  { 0x2F8BC, 5088, 1 },
+  { 0x2F8BD, 5089, 1 },
+  { 0x2F8BE, 5090, 1 },
+  { 0x2F8BF, 5091, 1 },
+  { 0x2F8C0, 5092, 1 },
+  { 0x2F8C1, 5093, 1 },
+  { 0x2F8C2, 5094, 1 },
+  { 0x2F8C3, 5095, 1 },
+  { 0x2F8C4, 5096, 1 },
+  { 0x2F8C5, 5097, 1 },
+  { 0x2F8C6, 5098, 1 },
+  { 0x2F8C7, 5099, 1 },
+  { 0x2F8C8, 3821, 1 },
+  { 0x2F8C9, 5100, 1 },
+  { 0x2F8CA, 5101, 1 },
+  { 0x2F8CB, 5102, 1 },
+  { 0x2F8CC, 5103, 1 },
+  { 0x2F8CD, 5104, 1 },
+  { 0x2F8CE, 5105, 1 },
+  { 0x2F8CF, 3823, 1 },
+  { 0x2F8D0, 5106, 1 },
+  { 0x2F8D1, 5107, 1 },
+  { 0x2F8D2, 5108, 1 },
+  { 0x2F8D3, 5109, 1 },
+  { 0x2F8D4, 5110, 1 },
+  { 0x2F8D5, 5111, 1 },
+  { 0x2F8D6, 5112, 1 },
+  { 0x2F8D7, 5113, 1 },
+  { 0x2F8D8, 3573, 1 },
+  { 0x2F8D9, 5114, 1 },
+  { 0x2F8DA, 5115, 1 },
+  { 0x2F8DB, 5116, 1 },
+  { 0x2F8DC, 5117, 1 },
+  { 0x2F8DD, 5118, 1 },
+  { 0x2F8DE, 5119, 1 },
+  { 0x2F8DF, 5120, 1 },
+  { 0x2F8E0, 5121, 1 },
+  { 0x2F8E1, 5122, 1 },
+  { 0x2F8E2, 3824, 1 },
+  { 0x2F8E3, 5123, 1 },
+  { 0x2F8E4, 5124, 1 },
+  { 0x2F8E5, 5125, 1 },
+  { 0x2F8E6, 5126, 1 },
+  { 0x2F8E7, 5127, 1 },
+  { 0x2F8E8, 5128, 1 },
+  { 0x2F8E9, 5129, 1 },
+  { 0x2F8EA, 5130, 1 },
+  { 0x2F8EB, 5131, 1 },
+  { 0x2F8EC, 5132, 1 },
+  { 0x2F8ED, 5133, 1 },
+  { 0x2F8EE, 5134, 1 },
+  { 0x2F8EF, 5135, 1 },
+  { 0x2F8F0, 5136, 1 },
+  { 0x2F8F1, 5137, 1 },
+  { 0x2F8F2, 5138, 1 },
+  { 0x2F8F3, 5139, 1 },
+  { 0x2F8F4, 5140, 1 },
+  { 0x2F8F5, 3641, 1 },
+  { 0x2F8F6, 5141, 1 },
+  { 0x2F8F7, 5142, 1 },
+  { 0x2F8F8, 5143, 1 },
+  { 0x2F8F9, 5144, 1 },
+  { 0x2F8FA, 5145, 1 },
+  { 0x2F8FB, 5146, 1 },
+  { 0x2F8FC, 5147, 1 },
+  { 0x2F8FD, 5148, 1 },
+  { 0x2F8FE, 5149, 1 },
+  { 0x2F8FF, 5150, 1 },
+  { 0x2F900, 5151, 1 },
+  { 0x2F901, 3825, 1 },
+  { 0x2F902, 3724, 1 },
+  { 0x2F903, 5152, 1 },
+  { 0x2F904, 5153, 1 },
+  { 0x2F905, 5154, 1 },
+  { 0x2F906, 5155, 1 },
+  { 0x2F907, 5156, 1 },
+  { 0x2F908, 5157, 1 },
+  { 0x2F909, 5158, 1 },
+  { 0x2F90A, 5159, 1 },
+  { 0x2F90B, 5160, 1 },
+  { 0x2F90C, 5161, 1 },
+  { 0x2F90D, 5162, 1 },
+  { 0x2F90E, 5163, 1 },
+  { 0x2F90F, 5164, 1 },
+  { 0x2F910, 5165, 1 },
+  { 0x2F911, 5166, 1 },
+  { 0x2F912, 5167, 1 },
+  { 0x2F913, 5168, 1 },
+  { 0x2F914, 5169, 1 },
+  { 0x2F915, 5170, 1 },
+  { 0x2F916, 5171, 1 },
+  { 0x2F917, 5172, 1 },
+  { 0x2F918, 5173, 1 },
+  { 0x2F919, 5174, 1 },
+  { 0x2F91A, 5175, 1 },
+  { 0x2F91B, 5176, 1 },
+  { 0x2F91C, 5177, 1 },
+  { 0x2F91D, 5178, 1 },
+  { 0x2F91E, 5179, 1 },
+  { 0x2F91F, 5180, 1 },
+  { 0x2F920, 5181, 1 },
+  { 0x2F921, 5182, 1 },
+  { 0x2F922, 5183, 1 },
+  { 0x2F923, 5184, 1 },
+  { 0x2F924, 5185, 1 },
+  { 0x2F925, 5186, 1 },
+  { 0x2F926, 5187, 1 },
+  { 0x2F927, 5188, 1 },
+  { 0x2F928, 5189, 1 },
+  { 0x2F929, 5190, 1 },
+  { 0x2F92A, 5191, 1 },
+  { 0x2F92B, 5192, 1 },
+  { 0x2F92C, 5193, 1 },
+  { 0x2F92D, 5193, 1 },
+  { 0x2F92E, 5194, 1 },
+  { 0x2F92F, 5195, 1 },
+  { 0x2F930, 5196, 1 },
+  { 0x2F931, 5197, 1 },
+  { 0x2F932, 5198, 1 },
+  { 0x2F933, 5199, 1 },
+  { 0x2F934, 5200, 1 },
+  { 0x2F935, 5201, 1 },
+  { 0x2F936, 5202, 1 },
+  { 0x2F937, 5203, 1 },
+  { 0x2F938, 3627, 1 },
+  { 0x2F939, 5204, 1 },
+  { 0x2F93A, 5205, 1 },
+  { 0x2F93B, 5206, 1 },
+  { 0x2F93C, 5207, 1 },
+  { 0x2F93D, 5208, 1 },
+  { 0x2F93E, 5209, 1 },
+  { 0x2F93F, 5210, 1 },
+  { 0x2F940, 5211, 1 },
+  { 0x2F941, 5212, 1 },
+  { 0x2F942, 5213, 1 },
+  { 0x2F943, 5214, 1 },
+  { 0x2F944, 5215, 1 },
+  { 0x2F945, 5216, 1 },
+  { 0x2F946, 5217, 1 },
+  { 0x2F947, 5217, 1 },
+  { 0x2F948, 5218, 1 },
+  { 0x2F949, 5219, 1 },
+  { 0x2F94A, 5220, 1 },
+  { 0x2F94B, 5221, 1 },
+  { 0x2F94C, 5222, 1 },
+  { 0x2F94D, 5223, 1 },
+  { 0x2F94E, 5224, 1 },
+  { 0x2F94F, 3590, 1 },
+  { 0x2F950, 5225, 1 },
+  { 0x2F951, 5226, 1 },
+  { 0x2F952, 5227, 1 },
+  { 0x2F953, 3835, 1 },
+  { 0x2F954, 5228, 1 },
+  { 0x2F955, 5229, 1 },
+  { 0x2F956, 3794, 1 },
+  { 0x2F957, 5230, 1 },
+  { 0x2F958, 5231, 1 },
+  { 0x2F959, 3838, 1 },
+  { 0x2F95A, 5232, 1 },
+  { 0x2F95B, 5233, 1 },
+  { 0x2F95C, 5234, 1 },
+  { 0x2F95D, 5235, 1 },
+  { 0x2F95E, 5235, 1 },
+  { 0x2F95F, 5236, 1 },
+  { 0x2F960, 5237, 1 },
+  { 0x2F961, 5238, 1 },
+  { 0x2F962, 5239, 1 },
+  { 0x2F963, 5240, 1 },
+  { 0x2F964, 5241, 1 },
+  { 0x2F965, 5242, 1 },
+  { 0x2F966, 5243, 1 },
+  { 0x2F967, 5244, 1 },
+  { 0x2F968, 5245, 1 },
+  { 0x2F969, 5246, 1 },
+  { 0x2F96A, 5247, 1 },
+  { 0x2F96B, 5248, 1 },
+  { 0x2F96C, 5249, 1 },
+  { 0x2F96D, 5250, 1 },
+  { 0x2F96E, 5251, 1 },
+  { 0x2F96F, 5252, 1 },
+  { 0x2F970, 5253, 1 },
+  { 0x2F971, 5254, 1 },
+  { 0x2F972, 5255, 1 },
+  { 0x2F973, 5256, 1 },
+  { 0x2F974, 5257, 1 },
+  { 0x2F975, 5258, 1 },
+  { 0x2F976, 5259, 1 },
+  { 0x2F977, 5260, 1 },
+  { 0x2F978, 5261, 1 },
+  { 0x2F979, 5262, 1 },
+  { 0x2F97A, 3844, 1 },
+  { 0x2F97B, 5263, 1 },
+  { 0x2F97C, 5264, 1 },
+  { 0x2F97D, 5265, 1 },
+  { 0x2F97E, 5266, 1 },
+  { 0x2F97F, 5267, 1 },
+  { 0x2F980, 5268, 1 },
+  { 0x2F981, 5269, 1 },
+  { 0x2F982, 5270, 1 },
+  { 0x2F983, 5271, 1 },
+  { 0x2F984, 5272, 1 },
+  { 0x2F985, 5273, 1 },
+  { 0x2F986, 5274, 1 },
+  { 0x2F987, 5275, 1 },
+  { 0x2F988, 5276, 1 },
+  { 0x2F989, 5277, 1 },
+  { 0x2F98A, 5278, 1 },
+  { 0x2F98B, 5053, 1 },
+  { 0x2F98C, 5279, 1 },
+  { 0x2F98D, 5280, 1 },
+  { 0x2F98E, 5281, 1 },
+  { 0x2F98F, 5282, 1 },
+  { 0x2F990, 5283, 1 },
+  { 0x2F991, 5284, 1 },
+  { 0x2F992, 5285, 1 },
+  { 0x2F993, 5286, 1 },
+  { 0x2F994, 5287, 1 },
+  { 0x2F995, 5288, 1 },
+  { 0x2F996, 5289, 1 },
+  { 0x2F997, 5290, 1 },
+  { 0x2F998, 3644, 1 },
+  { 0x2F999, 5291, 1 },
+  { 0x2F99A, 5292, 1 },
+  { 0x2F99B, 5293, 1 },
+  { 0x2F99C, 5294, 1 },
+  { 0x2F99D, 5295, 1 },
+  { 0x2F99E, 5296, 1 },
+  { 0x2F99F, 3847, 1 },
+  { 0x2F9A0, 5297, 1 },
+  { 0x2F9A1, 5298, 1 },
+  { 0x2F9A2, 5299, 1 },
+  { 0x2F9A3, 5300, 1 },
+  { 0x2F9A4, 5301, 1 },
+  { 0x2F9A5, 5302, 1 },
+  { 0x2F9A6, 5303, 1 },
+  { 0x2F9A7, 5304, 1 },
+  { 0x2F9A8, 5305, 1 },
+  { 0x2F9A9, 5306, 1 },
+  { 0x2F9AA, 5307, 1 },
+  { 0x2F9AB, 5308, 1 },
+  { 0x2F9AC, 5309, 1 },
+  { 0x2F9AD, 5310, 1 },
+  { 0x2F9AE, 5311, 1 },
+  { 0x2F9AF, 5312, 1 },
+  { 0x2F9B0, 5313, 1 },
+  { 0x2F9B1, 5314, 1 },
+  { 0x2F9B2, 5315, 1 },
+  { 0x2F9B3, 5316, 1 },
+  { 0x2F9B4, 3585, 1 },
+  { 0x2F9B5, 5317, 1 },
+  { 0x2F9B6, 5318, 1 },
+  { 0x2F9B7, 5319, 1 },
+  { 0x2F9B8, 5320, 1 },
+  { 0x2F9B9, 5321, 1 },
+  { 0x2F9BA, 5322, 1 },
+  { 0x2F9BB, 5323, 1 },
+  { 0x2F9BC, 5324, 1 },
+  { 0x2F9BD, 5325, 1 },
+  { 0x2F9BE, 5326, 1 },
+  { 0x2F9BF, 5327, 1 },
+  { 0x2F9C0, 5328, 1 },
+  { 0x2F9C1, 5329, 1 },
+  { 0x2F9C2, 5330, 1 },
+  { 0x2F9C3, 5331, 1 },
+  { 0x2F9C4, 2092, 1 },
+  { 0x2F9C5, 5332, 1 },
+  { 0x2F9C6, 5333, 1 },
+  { 0x2F9C7, 5334, 1 },
+  { 0x2F9C8, 5335, 1 },
+  { 0x2F9C9, 5336, 1 },
+  { 0x2F9CA, 5337, 1 },
+  { 0x2F9CB, 5338, 1 },
+  { 0x2F9CC, 5339, 1 },
+  { 0x2F9CD, 5340, 1 },
+  { 0x2F9CE, 5341, 1 },
+  { 0x2F9CF, 5342, 1 },
+  { 0x2F9D0, 5343, 1 },
+  { 0x2F9D1, 5344, 1 },
+  { 0x2F9D2, 2099, 1 },
+  { 0x2F9D3, 5345, 1 },
+  { 0x2F9D4, 5346, 1 },
+  { 0x2F9D5, 5347, 1 },
+  { 0x2F9D6, 5348, 1 },
+  { 0x2F9D7, 5349, 1 },
+  { 0x2F9D8, 5350, 1 },
+  { 0x2F9D9, 5351, 1 },
+  { 0x2F9DA, 5352, 1 },
+  { 0x2F9DB, 5353, 1 },
+  { 0x2F9DC, 5354, 1 },
+  { 0x2F9DD, 5355, 1 },
+  { 0x2F9DE, 5356, 1 },
+  { 0x2F9DF, 5357, 1 },
+  { 0x2F9E0, 5358, 1 },
+  { 0x2F9E1, 5359, 1 },
+  { 0x2F9E2, 5360, 1 },
+  { 0x2F9E3, 5361, 1 },
+  { 0x2F9E4, 5362, 1 },
+  { 0x2F9E5, 5363, 1 },
+  { 0x2F9E6, 5364, 1 },
+  { 0x2F9E7, 5365, 1 },
+  { 0x2F9E8, 5366, 1 },
+  { 0x2F9E9, 5367, 1 },
+  { 0x2F9EA, 5368, 1 },
+  { 0x2F9EB, 5369, 1 },
+  { 0x2F9EC, 5370, 1 },
+  { 0x2F9ED, 5371, 1 },
+  { 0x2F9EE, 5372, 1 },
+  { 0x2F9EF, 5373, 1 },
+  { 0x2F9F0, 5374, 1 },
+  { 0x2F9F1, 5375, 1 },
+  { 0x2F9F2, 5376, 1 },
+  { 0x2F9F3, 5377, 1 },
+  { 0x2F9F4, 5378, 1 },
+  { 0x2F9F5, 5379, 1 },
+  { 0x2F9F6, 5380, 1 },
+  { 0x2F9F7, 5381, 1 },
+  { 0x2F9F8, 5382, 1 },
+  { 0x2F9F9, 5383, 1 },
+  { 0x2F9FA, 5384, 1 },
+  { 0x2F9FB, 5385, 1 },
+  { 0x2F9FC, 5386, 1 },
+  { 0x2F9FD, 5387, 1 },
+  { 0x2F9FE, 5388, 1 },
+  { 0x2F9FF, 5388, 1 },
+  { 0x2FA00, 5389, 1 },
+  { 0x2FA01, 5390, 1 },
+  { 0x2FA02, 5391, 1 },
+  { 0x2FA03, 5392, 1 },
+  { 0x2FA04, 5393, 1 },
+  { 0x2FA05, 5394, 1 },
+  { 0x2FA06, 5395, 1 },
+  { 0x2FA07, 5396, 1 },
+  { 0x2FA08, 5397, 1 },
+  { 0x2FA09, 5398, 1 },
+  { 0x2FA0A, 5399, 1 },
+  { 0x2FA0B, 5400, 1 },
+  { 0x2FA0C, 5401, 1 },
+  { 0x2FA0D, 5402, 1 },
+  { 0x2FA0E, 5403, 1 },
+  { 0x2FA0F, 5404, 1 },
+  { 0x2FA10, 5405, 1 },
+  { 0x2FA11, 5406, 1 },
+  { 0x2FA12, 5407, 1 },
+  { 0x2FA13, 5408, 1 },
+  { 0x2FA14, 5409, 1 },
+  { 0x2FA15, 2147, 1 },
+  { 0x2FA16, 5410, 1 },
+  { 0x2FA17, 2151, 1 },
+  { 0x2FA18, 5411, 1 },
+  { 0x2FA19, 5412, 1 },
+  { 0x2FA1A, 5413, 1 },
+  { 0x2FA1B, 5414, 1 },
+  { 0x2FA1C, 2156, 1 },
+  { 0x2FA1D, 5415, 1 },
+};
+
+// Canonical combining classes other than 0.
+const IDNACombiningClass kIDNACombiningClasses[] = {
+  { 0x0300, 0x0314, 230 },
+  { 0x0315, 0x0315, 232 },
+  { 0x0316, 0x0319, 220 },
+  { 0x031A, 0x031A, 232 },
+  { 0x031B, 0x031B, 216 },
+  { 0x031C, 0x0320, 220 },
+  { 0x0321, 0x0322, 202 },
+  { 0x0323, 0x0326, 220 },
+  { 0x0327, 0x0328, 202 },
+  { 0x0329, 0x0333, 220 },
+  { 0x0334, 0x0338, 1 },
+  { 0x0339, 0x033C, 220 },
+  { 0x033D, 0x0344, 230 },
+  { 0x0345, 0x0345, 240 },
+  { 0x0346, 0x0346, 230 },
+  { 0x0347, 0x0349, 220 },
+  { 0x034A, 0x034C, 230 },
+  { 0x034D, 0x034E, 220 },
+  { 0x0360, 0x0361, 234 },
+  { 0x0362, 0x0362, 233 },
+  { 0x0363, 0x036F, 230 },
+  { 0x0483, 0x0486, 230 },
+  { 0x0591, 0x0591, 220 },
+  { 0x0592, 0x0595, 230 },
+  { 0x0596, 0x0596, 220 },
+  { 0x0597, 0x0599, 230 },
+  { 0x059A, 0x059A, 222 },
+  { 0x059B, 0x059B, 220 },
+  { 0x059C, 0x05A1, 230 },
+  { 0x05A3, 0x05A7, 220 },
+  { 0x05A8, 0x05A9, 230 },
+  { 0x05AA, 0x05AA, 220 },
+  { 0x05AB, 0x05AC, 230 },
+  { 0x05AD, 0x05AD, 222 },
+  { 0x05AE, 0x05AE, 228 },
+  { 0x05AF, 0x05AF, 230 },
+  { 0x05B0, 0x05B0, 10 },
+  { 0x05B1, 0x05B1, 11 },
+  { 0x05B2, 0x05B2, 12 },
+  { 0x05B3, 0x05B3, 13 },
+  { 0x05B4, 0x05B4, 14 },
+  { 0x05B5, 0x05B5, 15 },
+  { 0x05B6, 0x05B6, 16 },
+  { 0x05B7, 0x05B7, 17 },
+  { 0x05B8, 0x05B8, 18 },
+  { 0x05B9, 0x05B9, 19 },
+  { 0x05BB, 0x05BB, 20 },
+  { 0x05BC, 0x05BC, 21 },
+  { 0x05BD, 0x05BD, 22 },
+  { 0x05BF, 0x05BF, 23 },
+  { 0x05C1, 0x05C1, 24 },
+  { 0x05C2, 0x05C2, 25 },
+  { 0x05C4, 0x05C4, 230 },
+  { 0x064B, 0x064B, 27 },
+  { 0x064C, 0x064C, 28 },
+  { 0x064D, 0x064D, 29 },
+  { 0x064E, 0x064E, 30 },
+  { 0x064F, 0x064F, 31 },
+  { 0x0650, 0x0650, 32 },
+  { 0x0651, 0x0651, 33 },
+  { 0x0652, 0x0652, 34 },
+  { 0x0653, 0x0654, 230 },
+  { 0x0655, 0x0655, 220 },
+  { 0x0670, 0x0670, 35 },
+  { 0x06D6, 0x06DC, 230 },
+  { 0x06DF, 0x06E2, 230 },
+  { 0x06E3, 0x06E3, 220 },
+  { 0x06E4, 0x06E4, 230 },
+  { 0x06E7, 0x06E8, 230 },
+  { 0x06EA, 0x06EA, 220 },
+  { 0x06EB, 0x06EC, 230 },
+  { 0x06ED, 0x06ED, 220 },
+  { 0x0711, 0x0711, 36 },
+  { 0x0730, 0x0730, 230 },
+  { 0x0731, 0x0731, 220 },
+  { 0x0732, 0x0733, 230 },
+  { 0x0734, 0x0734, 220 },
+  { 0x0735, 0x0736, 230 },
+  { 0x0737, 0x0739, 220 },
+  { 0x073A, 0x073A, 230 },
+  { 0x073B, 0x073C, 220 },
+  { 0x073D, 0x073D, 230 },
+  { 0x073E, 0x073E, 220 },
+  { 0x073F, 0x0741, 230 },
+  { 0x0742, 0x0742, 220 },
+  { 0x0743, 0x0743, 230 },
+  { 0x0744, 0x0744, 220 },
+  { 0x0745, 0x0745, 230 },
+  { 0x0746, 0x0746, 220 },
+  { 0x0747, 0x0747, 230 },
+  { 0x0748, 0x0748, 220 },
+  { 0x0749, 0x074A, 230 },
+  { 0x093C, 0x093C, 7 },
+  { 0x094D, 0x094D, 9 },
+  { 0x0951, 0x0951, 230 },
+  { 0x0952, 0x0952, 220 },
+  { 0x0953, 0x0954, 230 },
+  { 0x09BC, 0x09BC, 7 },
+  { 0x09CD, 0x09CD, 9 },
+  { 0x0A3C, 0x0A3C, 7 },
+  { 0x0A4D, 0x0A4D, 9 },
+  { 0x0ABC, 0x0ABC, 7 },
+  { 0x0ACD, 0x0ACD, 9 },
+  { 0x0B3C, 0x0B3C, 7 },
+  { 0x0B4D, 0x0B4D, 9 },
+  { 0x0BCD, 0x0BCD, 9 },
+  { 0x0C4D, 0x0C4D, 9 },
+  { 0x0C55, 0x0C55, 84 },
+  { 0x0C56, 0x0C56, 91 },
+  { 0x0CCD, 0x0CCD, 9 },
+  { 0x0D4D, 0x0D4D, 9 },
+  { 0x0DCA, 0x0DCA, 9 },
+  { 0x0E38, 0x0E39, 103 },
+  { 0x0E3A, 0x0E3A, 9 },
+  { 0x0E48, 0x0E4B, 107 },
+  { 0x0EB8, 0x0EB9, 118 },
+  { 0x0EC8, 0x0ECB, 122 },
+  { 0x0F18, 0x0F19, 220 },
+  { 0x0F35, 0x0F35, 220 },
+  { 0x0F37, 0x0F37, 220 },
+  { 0x0F39, 0x0F39, 216 },
+  { 0x0F71, 0x0F71, 129 },
+  { 0x0F72, 0x0F72, 130 },
+  { 0x0F74, 0x0F74, 132 },
+  { 0x0F7A, 0x0F7D, 130 },
+  { 0x0F80, 0x0F80, 130 },
+  { 0x0F82, 0x0F83, 230 },
+  { 0x0F84, 0x0F84, 9 },
+  { 0x0F86, 0x0F87, 230 },
+  { 0x0FC6, 0x0FC6, 220 },
+  { 0x1037, 0x1037, 7 },
+  { 0x1039, 0x1039, 9 },
+  { 0x1714, 0x1714, 9 },
+  { 0x1734, 0x1734, 9 },
+  { 0x17D2, 0x17D2, 9 },
+  { 0x18A9, 0x18A9, 228 },
+  { 0x20D0, 0x20D1, 230 },
+  { 0x20D2, 0x20D3, 1 },
+  { 0x20D4, 0x20D7, 230 },
+  { 0x20D8, 0x20DA, 1 },
+  { 0x20DB, 0x20DC, 230 },
+  { 0x20E1, 0x20E1, 230 },
+  { 0x20E5, 0x20E6, 1 },
+  { 0x20E7, 0x20E7, 230 },
+  { 0x20E8, 0x20E8, 220 },
+  { 0x20E9, 0x20E9, 230 },
+  { 0x20EA, 0x20EA, 1 },
+  { 0x302A, 0x302A, 218 },
+  { 0x302B, 0x302B, 228 },
+  { 0x302C, 0x302C, 232 },
+  { 0x302D, 0x302D, 222 },
+  { 0x302E, 0x302F, 224 },
+  { 0x3099, 0x309A, 8 },
+  { 0xFB1E, 0xFB1E, 26 },
+  { 0xFE20, 0xFE23, 230 },
+  { 0x1D165, 0x1D166, 216 },
+  { 0x1D167, 0x1D169, 1 },
+  { 0x1D16D, 0x1D16D, 226 },
+  { 0x1D16E, 0x1D172, 216 },
+  { 0x1D17B, 0x1D182, 220 },
+  { 0x1D185, 0x1D189, 230 },
+  { 0x1D18A, 0x1D18B, 220 },
+  { 0x1D1AA, 0x1D1AD, 230 },
+};
+
+// Canonical compositions, sorted by the pair they compose.
+const IDNAComposition kIDNACompositions[] = {
+  { 0x003C, 0x0338, 0x226E },
+  { 0x003D, 0x0338, 0x2260 },
+  { 0x003E, 0x0338, 0x226F },
+  { 0x0041, 0x0300, 0x00C0 },
+  { 0x0041, 0x0301, 0x00C1 },
+  { 0x0041, 0x0302, 0x00C2 },
+  { 0x0041, 0x0303, 0x00C3 },
+  { 0x0041, 0x0304, 0x0100 },
+  { 0x0041, 0x0306, 0x0102 },
+  { 0x0041, 0x0307, 0x0226 },
+  { 0x0041, 0x0308, 0x00C4 },
+  { 0x0041, 0x0309, 0x1EA2 },
+  { 0x0041, 0x030A, 0x00C5 },
+  { 0x0041, 0x030C, 0x01CD },
+  { 0x0041, 0x030F, 0x0200 },
+  { 0x0041, 0x0311, 0x0202 },
+  { 0x0041, 0x0323, 0x1EA0 },
+  { 0x0041, 0x0325, 0x1E00 },
+  { 0x0041, 0x0328, 0x0104 },
+  { 0x0042, 0x0307, 0x1E02 },
+  { 0x0042, 0x0323, 0x1E04 },
+  { 0x0042, 0x0331, 0x1E06 },
+  { 0x0043, 0x0301, 0x0106 },
+  { 0x0043, 0x0302, 0x0108 },
+  { 0x0043, 0x0307, 0x010A },
+  { 0x0043, 0x030C, 0x010C },
+  { 0x0043, 0x0327, 0x00C7 },
+  { 0x0044, 0x0307, 0x1E0A },
+  { 0x0044, 0x030C, 0x010E },
+  { 0x0044, 0x0323, 0x1E0C },
+  { 0x0044, 0x0327, 0x1E10 },
+  { 0x0044, 0x032D, 0x1E12 },
+  { 0x0044, 0x0331, 0x1E0E },
+  { 0x0045, 0x0300, 0x00C8 },
+  { 0x0045, 0x0301, 0x00C9 },
+  { 0x0045, 0x0302, 0x00CA },
+  { 0x0045, 0x0303, 0x1EBC },
+  { 0x0045, 0x0304, 0x0112 },
+  { 0x0045, 0x0306, 0x0114 },
+  { 0x0045, 0x0307, 0x0116 },
+  { 0x0045, 0x0308, 0x00CB },
+  { 0x0045, 0x0309, 0x1EBA },
+  { 0x0045, 0x030C, 0x011A },
+  { 0x0045, 0x030F, 0x0204 },
+  { 0x0045, 0x0311, 0x0206 },
+  { 0x0045, 0x0323, 0x1EB8 },
+  { 0x0045, 0x0327, 0x0228 },
+  { 0x0045, 0x0328, 0x0118 },
+  { 0x0045, 0x032D, 0x1E18 },
+  { 0x0045, 0x0330, 0x1E1A },
+  { 0x0046, 0x0307, 0x1E1E },
+  { 0x0047, 0x0301, 0x01F4 },
+  { 0x0047, 0x0302, 0x011C },
+  { 0x0047, 0x0304, 0x1E20 },
+  { 0x0047, 0x0306, 0x011E },
+  { 0x0047, 0x0307, 0x0120 },
+  { 0x0047, 0x030C, 0x01E6 },
+  { 0x0047, 0x0327, 0x0122 },
+  { 0x0048, 0x0302, 0x0124 },
+  { 0x0048, 0x0307, 0x1E22 },
+  { 0x0048, 0x0308, 0x1E26 },
+  { 0x0048, 0x030C, 0x021E },
+  { 0x0048, 0x0323, 0x1E24 },
+  { 0x0048, 0x0327, 0x1E28 },
+  { 0x0048, 0x032E, 0x1E2A },
+  { 0x0049, 0x0300, 0x00CC },
+  { 0x0049, 0x0301, 0x00CD },
+  { 0x0049, 0x0302, 0x00CE },
+  { 0x0049, 0x0303, 0x0128 },
+  { 0x0049, 0x0304, 0x012A },
+  { 0x0049, 0x0306, 0x012C },
+  { 0x0049, 0x0307, 0x0130 },
+  { 0x0049, 0x0308, 0x00CF },
+  { 0x0049, 0x0309, 0x1EC8 },
+  { 0x0049, 0x030C, 0x01CF },
+  { 0x0049, 0x030F, 0x0208 },
+  { 0x0049, 0x0311, 0x020A },
+  { 0x0049, 0x0323, 0x1ECA },
+  { 0x0049, 0x0328, 0x012E },
+  { 0x0049, 0x0330, 0x1E2C },
+  { 0x004A, 0x0302, 0x0134 },
+  { 0x004B, 0x0301, 0x1E30 },
+  { 0x004B, 0x030C, 0x01E8 },
+  { 0x004B, 0x0323, 0x1E32 },
+  { 0x004B, 0x0327, 0x0136 },
+  { 0x004B, 0x0331, 0x1E34 },
+  { 0x004C, 0x0301, 0x0139 },
+  { 0x004C, 0x030C, 0x013D },
+  { 0x004C, 0x0323, 0x1E36 },
+  { 0x004C, 0x0327, 0x013B },
+  { 0x004C, 0x032D, 0x1E3C },
+  { 0x004C, 0x0331, 0x1E3A },
+  { 0x004D, 0x0301, 0x1E3E },
+  { 0x004D, 0x0307, 0x1E40 },
+  { 0x004D, 0x0323, 0x1E42 },
+  { 0x004E, 0x0300, 0x01F8 },
+  { 0x004E, 0x0301, 0x0143 },
+  { 0x004E, 0x0303, 0x00D1 },
+  { 0x004E, 0x0307, 0x1E44 },
+  { 0x004E, 0x030C, 0x0147 },
+  { 0x004E, 0x0323, 0x1E46 },
+  { 0x004E, 0x0327, 0x0145 },
+  { 0x004E, 0x032D, 0x1E4A },
+  { 0x004E, 0x0331, 0x1E48 },
+  { 0x004F, 0x0300, 0x00D2 },
+  { 0x004F, 0x0301, 0x00D3 },
+  { 0x004F, 0x0302, 0x00D4 },
+  { 0x004F, 0x0303, 0x00D5 },
+  { 0x004F, 0x0304, 0x014C },
+  { 0x004F, 0x0306, 0x014E },
+  { 0x004F, 0x0307, 0x022E },
+  { 0x004F, 0x0308, 0x00D6 },
+  { 0x004F, 0x0309, 0x1ECE },
+  { 0x004F, 0x030B, 0x0150 },
+  { 0x004F, 0x030C, 0x01D1 },
+  { 0x004F, 0x030F, 0x020C },
+  { 0x004F, 0x0311, 0x020E },
+  { 0x004F, 0x031B, 0x01A0 },
+  { 0x004F, 0x0323, 0x1ECC },
+  { 0x004F, 0x0328, 0x01EA },
+  { 0x0050, 0x0301, 0x1E54 },
+  { 0x0050, 0x0307, 0x1E56 },
+  { 0x0052, 0x0301, 0x0154 },
+  { 0x0052, 0x0307, 0x1E58 },
+  { 0x0052, 0x030C, 0x0158 },
+  { 0x0052, 0x030F, 0x0210 },
+  { 0x0052, 0x0311, 0x0212 },
+  { 0x0052, 0x0323, 0x1E5A },
+  { 0x0052, 0x0327, 0x0156 },
+  { 0x0052, 0x0331, 0x1E5E },
+  { 0x0053, 0x0301, 0x015A },
+  { 0x0053, 0x0302, 0x015C },
+  { 0x0053, 0x0307, 0x1E60 },
+  { 0x0053, 0x030C, 0x0160 },
+  { 0x0053, 0x0323, 0x1E62 },
+  { 0x0053, 0x0326, 0x0218 },
+  { 0x0053, 0x0327, 0x015E },
+  { 0x0054, 0x0307, 0x1E6A },
+  { 0x0054, 0x030C, 0x0164 },
+  { 0x0054, 0x0323, 0x1E6C },
+  { 0x0054, 0x0326, 0x021A },
+  { 0x0054, 0x0327, 0x0162 },
+  { 0x0054, 0x032D, 0x1E70 },
+  { 0x0054, 0x0331, 0x1E6E },
+  { 0x0055, 0x0300, 0x00D9 },
+  { 0x0055, 0x0301, 0x00DA },
+  { 0x0055, 0x0302, 0x00DB },
+  { 0x0055, 0x0303, 0x0168 },
+  { 0x0055, 0x0304, 0x016A },
+  { 0x0055, 0x0306, 0x016C },
+  { 0x0055, 0x0308, 0x00DC },
+  { 0x0055, 0x0309, 0x1EE6 },
+  { 0x0055, 0x030A, 0x016E },
+  { 0x0055, 0x030B, 0x0170 },
+  { 0x0055, 0x030C, 0x01D3 },
+  { 0x0055, 0x030F, 0x0214 },
+  { 0x0055, 0x0311, 0x0216 },
+  { 0x0055, 0x031B, 0x01AF },
+  { 0x0055, 0x0323, 0x1EE4 },
+  { 0x0055, 0x0324, 0x1E72 },
+  { 0x0055, 0x0328, 0x0172 },
+  { 0x0055, 0x032D, 0x1E76 },
+  { 0x0055, 0x0330, 0x1E74 },
+  { 0x0056, 0x0303, 0x1E7C },
+  { 0x0056, 0x0323, 0x1E7E },
+  { 0x0057, 0x0300, 0x1E80 },
+  { 0x0057, 0x0301, 0x1E82 },
+  { 0x0057, 0x0302, 0x0174 },
+  { 0x0057, 0x0307, 0x1E86 },
+  { 0x0057, 0x0308, 0x1E84 },
+  { 0x0057, 0x0323, 0x1E88 },
+  { 0x0058, 0x0307, 0x1E8A },
+  { 0x0058, 0x0308, 0x1E8C },
+  { 0x0059, 0x0300, 0x1EF2 },
+  { 0x0059, 0x0301, 0x00DD },
+  { 0x0059, 0x0302, 0x0176 },
+  { 0x0059, 0x0303, 0x1EF8 },
+  { 0x0059, 0x0304, 0x0232 },
+  { 0x0059, 0x0307, 0x1E8E },
+  { 0x0059, 0x0308, 0x0178 },
+  { 0x0059, 0x0309, 0x1EF6 },
+  { 0x0059, 0x0323, 0x1EF4 },
+  { 0x005A, 0x0301, 0x0179 },
+  { 0x005A, 0x0302, 0x1E90 },
+  { 0x005A, 0x0307, 0x017B },
+  { 0x005A, 0x030C, 0x017D },
+  { 0x005A, 0x0323, 0x1E92 },
+  { 0x005A, 0x0331, 0x1E94 },
+  { 0x0061, 0x0300, 0x00E0 },
+  { 0x0061, 0x0301, 0x00E1 },
+  { 0x0061, 0x0302, 0x00E2 },
+  { 0x0061, 0x0303, 0x00E3 },
+  { 0x0061, 0x0304, 0x0101 },
+  { 0x0061, 0x0306, 0x0103 },
+  { 0x0061, 0x0307, 0x0227 },
+  { 0x0061, 0x0308, 0x00E4 },
+  { 0x0061, 0x0309, 0x1EA3 },
+  { 0x0061, 0x030A, 0x00E5 },
+  { 0x0061, 0x030C, 0x01CE },
+  { 0x0061, 0x030F, 0x0201 },
+  { 0x0061, 0x0311, 0x0203 },
+  { 0x0061, 0x0323, 0x1EA1 },
+  { 0x0061, 0x0325, 0x1E01 },
+  { 0x0061, 0x0328, 0x0105 },
+  { 0x0062, 0x0307, 0x1E03 },
+  { 0x0062, 0x0323, 0x1E05 },
+  { 0x0062, 0x0331, 0x1E07 },
+  { 0x0063, 0x0301, 0x0107 },
+  { 0x0063, 0x0302, 0x0109 },
+  { 0x0063, 0x0307, 0x010B },
+  { 0x0063, 0x030C, 0x010D },
+  { 0x0063, 0x0327, 0x00E7 },
+  { 0x0064, 0x0307, 0x1E0B },
+  { 0x0064, 0x030C, 0x010F },
+  { 0x0064, 0x0323, 0x1E0D },
+  { 0x0064, 0x0327, 0x1E11 },
+  { 0x0064, 0x032D, 0x1E13 },
+  { 0x0064, 0x0331, 0x1E0F },
+  { 0x0065, 0x0300, 0x00E8 },
+  { 0x0065, 0x0301, 0x00E9 },
+  { 0x0065, 0x0302, 0x00EA },
+  { 0x0065, 0x0303, 0x1EBD },
+  { 0x0065, 0x0304, 0x0113 },
+  { 0x0065, 0x0306, 0x0115 },
+  { 0x0065, 0x0307, 0x0117 },
+  { 0x0065, 0x0308, 0x00EB },
+  { 0x0065, 0x0309, 0x1EBB },
+  { 0x0065, 0x030C, 0x011B },
+  { 0x0065, 0x030F, 0x0205 },
+  { 0x0065, 0x0311, 0x0207 },
+  { 0x0065, 0x0323, 0x1EB9 },
+  { 0x0065, 0x0327, 0x0229 },
+  { 0x0065, 0x0328, 0x0119 },
+  { 0x0065, 0x032D, 0x1E19 },
+  { 0x0065, 0x0330, 0x1E1B },
+  { 0x0066, 0x0307, 0x1E1F },
+  { 0x0067, 0x0301, 0x01F5 },
+  { 0x0067, 0x0302, 0x011D },
+  { 0x0067, 0x0304, 0x1E21 },
+  { 0x0067, 0x0306, 0x011F },
+  { 0x0067, 0x0307, 0x0121 },
+  { 0x0067, 0x030C, 0x01E7 },
+  { 0x0067, 0x0327, 0x0123 },
+  { 0x0068, 0x0302, 0x0125 },
+  { 0x0068, 0x0307, 0x1E23 },
+  { 0x0068, 0x0308, 0x1E27 },
+  { 0x0068, 0x030C, 0x021F },
+  { 0x0068, 0x0323, 0x1E25 },
+  { 0x0068, 0x0327, 0x1E29 },
+  { 0x0068, 0x032E, 0x1E2B },
+  { 0x0068, 0x0331, 0x1E96 },
+  { 0x0069, 0x0300, 0x00EC },
+  { 0x0069, 0x0301, 0x00ED },
+  { 0x0069, 0x0302, 0x00EE },
+  { 0x0069, 0x0303, 0x0129 },
+  { 0x0069, 0x0304, 0x012B },
+  { 0x0069, 0x0306, 0x012D },
+  { 0x0069, 0x0308, 0x00EF },
+  { 0x0069, 0x0309, 0x1EC9 },
+  { 0x0069, 0x030C, 0x01D0 },
+  { 0x0069, 0x030F, 0x0209 },
+  { 0x0069, 0x0311, 0x020B },
+  { 0x0069, 0x0323, 0x1ECB },
+  { 0x0069, 0x0328, 0x012F },
+  { 0x0069, 0x0330, 0x1E2D },
+  { 0x006A, 0x0302, 0x0135 },
+  { 0x006A, 0x030C, 0x01F0 },
+  { 0x006B, 0x0301, 0x1E31 },
+  { 0x006B, 0x030C, 0x01E9 },
+  { 0x006B, 0x0323, 0x1E33 },
+  { 0x006B, 0x0327, 0x0137 },
+  { 0x006B, 0x0331, 0x1E35 },
+  { 0x006C, 0x0301, 0x013A },
+  { 0x006C, 0x030C, 0x013E },
+  { 0x006C, 0x0323, 0x1E37 },
+  { 0x006C, 0x0327, 0x013C },
+  { 0x006C, 0x032D, 0x1E3D },
+  { 0x006C, 0x0331, 0x1E3B },
+  { 0x006D, 0x0301, 0x1E3F },
+  { 0x006D, 0x0307, 0x1E41 },
+  { 0x006D, 0x0323, 0x1E43 },
+  { 0x006E, 0x0300, 0x01F9 },
+  { 0x006E, 0x0301, 0x0144 },
+  { 0x006E, 0x0303, 0x00F1 },
+  { 0x006E, 0x0307, 0x1E45 },
+  { 0x006E, 0x030C, 0x0148 },
+  { 0x006E, 0x0323, 0x1E47 },
+  { 0x006E, 0x0327, 0x0146 },
+  { 0x006E, 0x032D, 0x1E4B },
+  { 0x006E, 0x0331, 0x1E49 },
+  { 0x006F, 0x0300, 0x00F2 },
+  { 0x006F, 0x0301, 0x00F3 },
+  { 0x006F, 0x0302, 0x00F4 },
+  { 0x006F, 0x0303, 0x00F5 },
+  { 0x006F, 0x0304, 0x014D },
+  { 0x006F, 0x0306, 0x014F },
+  { 0x006F, 0x0307, 0x022F },
+  { 0x006F, 0x0308, 0x00F6 },
+  { 0x006F, 0x0309, 0x1ECF },
+  { 0x006F, 0x030B, 0x0151 },
+  { 0x006F, 0x030C, 0x01D2 },
+  { 0x006F, 0x030F, 0x020D },
+  { 0x006F, 0x0311, 0x020F },
+  { 0x006F, 0x031B, 0x01A1 },
+  { 0x006F, 0x0323, 0x1ECD },
+  { 0x006F, 0x0328, 0x01EB },
+  { 0x0070, 0x0301, 0x1E55 },
+  { 0x0070, 0x0307, 0x1E57 },
+  { 0x0072, 0x0301, 0x0155 },
+  { 0x0072, 0x0307, 0x1E59 },
+  { 0x0072, 0x030C, 0x0159 },
+  { 0x0072, 0x030F, 0x0211 },
+  { 0x0072, 0x0311, 0x0213 },
+  { 0x0072, 0x0323, 0x1E5B },
+  { 0x0072, 0x0327, 0x0157 },
+  { 0x0072, 0x0331, 0x1E5F },
+  { 0x0073, 0x0301, 0x015B },
+  { 0x0073, 0x0302, 0x015D },
+  { 0x0073, 0x0307, 0x1E61 },
+  { 0x0073, 0x030C, 0x0161 },
+  { 0x0073, 0x0323, 0x1E63 },
+  { 0x0073, 0x0326, 0x0219 },
+  { 0x0073, 0x0327, 0x015F },
+  { 0x0074, 0x0307, 0x1E6B },
+  { 0x0074, 0x0308, 0x1E97 },
+  { 0x0074, 0x030C, 0x0165 },
+  { 0x0074, 0x0323, 0x1E6D },
+  { 0x0074, 0x0326, 0x021B },
+  { 0x0074, 0x0327, 0x0163 },
+  { 0x0074, 0x032D, 0x1E71 },
+  { 0x0074, 0x0331, 0x1E6F },
+  { 0x0075, 0x0300, 0x00F9 },
+  { 0x0075, 0x0301, 0x00FA },
+  { 0x0075, 0x0302, 0x00FB },
+  { 0x0075, 0x0303, 0x0169 },
+  { 0x0075, 0x0304, 0x016B },
+  { 0x0075, 0x0306, 0x016D },
+  { 0x0075, 0x0308, 0x00FC },
+  { 0x0075, 0x0309, 0x1EE7 },
+  { 0x0075, 0x030A, 0x016F },
+  { 0x0075, 0x030B, 0x0171 },
+  { 0x0075, 0x030C, 0x01D4 },
+  { 0x0075, 0x030F, 0x0215 },
+  { 0x0075, 0x0311, 0x0217 },
+  { 0x0075, 0x031B, 0x01B0 },
+  { 0x0075, 0x0323, 0x1EE5 },
+  { 0x0075, 0x0324, 0x1E73 },
+  { 0x0075, 0x0328, 0x0173 },
+  { 0x0075, 0x032D, 0x1E77 },
+  { 0x0075, 0x0330, 0x1E75 },
+  { 0x0076, 0x0303, 0x1E7D },
+  { 0x0076, 0x0323, 0x1E7F },
+  { 0x0077, 0x0300, 0x1E81 },
+  { 0x0077, 0x0301, 0x1E83 },
+  { 0x0077, 0x0302, 0x0175 },
+  { 0x0077, 0x0307, 0x1E87 },
+  { 0x0077, 0x0308, 0x1E85 },
+  { 0x0077, 0x030A, 0x1E98 },
+  { 0x0077, 0x0323, 0x1E89 },
+  { 0x0078, 0x0307, 0x1E8B },
+  { 0x0078, 0x0308, 0x1E8D },
+  { 0x0079, 0x0300, 0x1EF3 },
+  { 0x0079, 0x0301, 0x00FD },
+  { 0x0079, 0x0302, 0x0177 },
+  { 0x0079, 0x0303, 0x1EF9 },
+  { 0x0079, 0x0304, 0x0233 },
+  { 0x0079, 0x0307, 0x1E8F },
+  { 0x0079, 0x0308, 0x00FF },
+  { 0x0079, 0x0309, 0x1EF7 },
+  { 0x0079, 0x030A, 0x1E99 },
+  { 0x0079, 0x0323, 0x1EF5 },
+  { 0x007A, 0x0301, 0x017A },
+  { 0x007A, 0x0302, 0x1E91 },
+  { 0x007A, 0x0307, 0x017C },
+  { 0x007A, 0x030C, 0x017E },
+  { 0x007A, 0x0323, 0x1E93 },
+  { 0x007A, 0x0331, 0x1E95 },
+  { 0x00A8, 0x0300, 0x1FED },
+  { 0x00A8, 0x0301, 0x0385 },
+  { 0x00A8, 0x0342, 0x1FC1 },
+  { 0x00C2, 0x0300, 0x1EA6 },
+  { 0x00C2, 0x0301, 0x1EA4 },
+  { 0x00C2, 0x0303, 0x1EAA },
+  { 0x00C2, 0x0309, 0x1EA8 },
+  { 0x00C4, 0x0304, 0x01DE },
+  { 0x00C5, 0x0301, 0x01FA },
+  { 0x00C6, 0x0301, 0x01FC },
+  { 0x00C6, 0x0304, 0x01E2 },
+  { 0x00C7, 0x0301, 0x1E08 },
+  { 0x00CA, 0x0300, 0x1EC0 },
+  { 0x00CA, 0x0301, 0x1EBE },
+  { 0x00CA, 0x0303, 0x1EC4 },
+  { 0x00CA, 0x0309, 0x1EC2 },
+  { 0x00CF, 0x0301, 0x1E2E },
+  { 0x00D4, 0x0300, 0x1ED2 },
+  { 0x00D4, 0x0301, 0x1ED0 },
+  { 0x00D4, 0x0303, 0x1ED6 },
+  { 0x00D4, 0x0309, 0x1ED4 },
+  { 0x00D5, 0x0301, 0x1E4C },
+  { 0x00D5, 0x0304, 0x022C },
+  { 0x00D5, 0x0308, 0x1E4E },
+  { 0x00D6, 0x0304, 0x022A },
+  { 0x00D8, 0x0301, 0x01FE },
+  { 0x00DC, 0x0300, 0x01DB },
+  { 0x00DC, 0x0301, 0x01D7 },
+  { 0x00DC, 0x0304, 0x01D5 },
+  { 0x00DC, 0x030C, 0x01D9 },
+  { 0x00E2, 0x0300, 0x1EA7 },
+  { 0x00E2, 0x0301, 0x1EA5 },
+  { 0x00E2, 0x0303, 0x1EAB },
+  { 0x00E2, 0x0309, 0x1EA9 },
+  { 0x00E4, 0x0304, 0x01DF },
+  { 0x00E5, 0x0301, 0x01FB },
+  { 0x00E6, 0x0301, 0x01FD },
+  { 0x00E6, 0x0304, 0x01E3 },
+  { 0x00E7, 0x0301, 0x1E09 },
+  { 0x00EA, 0x0300, 0x1EC1 },
+  { 0x00EA, 0x0301, 0x1EBF },
+  { 0x00EA, 0x0303, 0x1EC5 },
+  { 0x00EA, 0x0309, 0x1EC3 },
+  { 0x00EF, 0x0301, 0x1E2F },
+  { 0x00F4, 0x0300, 0x1ED3 },
+  { 0x00F4, 0x0301, 0x1ED1 },
+  { 0x00F4, 0x0303, 0x1ED7 },
+  { 0x00F4, 0x0309, 0x1ED5 },
+  { 0x00F5, 0x0301, 0x1E4D },
+  { 0x00F5, 0x0304, 0x022D },
+  { 0x00F5, 0x0308, 0x1E4F },
+  { 0x00F6, 0x0304, 0x022B },
+  { 0x00F8, 0x0301, 0x01FF },
+  { 0x00FC, 0x0300, 0x01DC },
+  { 0x00FC, 0x0301, 0x01D8 },
+  { 0x00FC, 0x0304, 0x01D6 },
+  { 0x00FC, 0x030C, 0x01DA },
+  { 0x0102, 0x0300, 0x1EB0 },
+  { 0x0102, 0x0301, 0x1EAE },
+  { 0x0102, 0x0303, 0x1EB4 },
+  { 0x0102, 0x0309, 0x1EB2 },
+  { 0x0103, 0x0300, 0x1EB1 },
+  { 0x0103, 0x0301, 0x1EAF },
+  { 0x0103, 0x0303, 0x1EB5 },
+  { 0x0103, 0x0309, 0x1EB3 },
+  { 0x0112, 0x0300, 0x1E14 },
+  { 0x0112, 0x0301, 0x1E16 },
+  { 0x0113, 0x0300, 0x1E15 },
+  { 0x0113, 0x0301, 0x1E17 },
+  { 0x014C, 0x0300, 0x1E50 },
+  { 0x014C, 0x0301, 0x1E52 },
+  { 0x014D, 0x0300, 0x1E51 },
+  { 0x014D, 0x0301, 0x1E53 },
+  { 0x015A, 0x0307, 0x1E64 },
+  { 0x015B, 0x0307, 0x1E65 },
+  { 0x0160, 0x0307, 0x1E66 },
+  { 0x0161, 0x0307, 0x1E67 },
+  { 0x0168, 0x0301, 0x1E78 },
+  { 0x0169, 0x0301, 0x1E79 },
+  { 0x016A, 0x0308, 0x1E7A },
+  { 0x016B, 0x0308, 0x1E7B },
+  { 0x017F, 0x0307, 0x1E9B },
+  { 0x01A0, 0x0300, 0x1EDC },
+  { 0x01A0, 0x0301, 0x1EDA },
+  { 0x01A0, 0x0303, 0x1EE0 },
+  { 0x01A0, 0x0309, 0x1EDE },
+  { 0x01A0, 0x0323, 0x1EE2 },
+  { 0x01A1, 0x0300, 0x1EDD },
+  { 0x01A1, 0x0301, 0x1EDB },
+  { 0x01A1, 0x0303, 0x1EE1 },
+  { 0x01A1, 0x0309, 0x1EDF },
+  { 0x01A1, 0x0323, 0x1EE3 },
+  { 0x01AF, 0x0300, 0x1EEA },
+  { 0x01AF, 0x0301, 0x1EE8 },
+  { 0x01AF, 0x0303, 0x1EEE },
+  { 0x01AF, 0x0309, 0x1EEC },
+  { 0x01AF, 0x0323, 0x1EF0 },
+  { 0x01B0, 0x0300, 0x1EEB },
+  { 0x01B0, 0x0301, 0x1EE9 },
+  { 0x01B0, 0x0303, 0x1EEF },
+  { 0x01B0, 0x0309, 0x1EED },
+  { 0x01B0, 0x0323, 0x1EF1 },
+  { 0x01B7, 0x030C, 0x01EE },
+  { 0x01EA, 0x0304, 0x01EC },
+  { 0x01EB, 0x0304, 0x01ED },
+  { 0x0226, 0x0304, 0x01E0 },
+  { 0x0227, 0x0304, 0x01E1 },
+  { 0x0228, 0x0306, 0x1E1C },
+  { 0x0229, 0x0306, 0x1E1D },
+  { 0x022E, 0x0304, 0x0230 },
+  { 0x022F, 0x0304, 0x0231 },
+  { 0x0292, 0x030C, 0x01EF },
+  { 0x0391, 0x0300, 0x1FBA },
+  { 0x0391, 0x0301, 0x0386 },
+  { 0x0391, 0x0304, 0x1FB9 },
+  { 0x0391, 0x0306, 0x1FB8 },
+  { 0x0391, 0x0313, 0x1F08 },
+  { 0x0391, 0x0314, 0x1F09 },
+  { 0x0391, 0x0345, 0x1FBC },
+  { 0x0395, 0x0300, 0x1FC8 },
+  { 0x0395, 0x0301, 0x0388 },
+  { 0x0395, 0x0313, 0x1F18 },
+  { 0x0395, 0x0314, 0x1F19 },
+  { 0x0397, 0x0300, 0x1FCA },
+  { 0x0397, 0x0301, 0x0389 },
+  { 0x0397, 0x0313, 0x1F28 },
+  { 0x0397, 0x0314, 0x1F29 },
+  { 0x0397, 0x0345, 0x1FCC },
+  { 0x0399, 0x0300, 0x1FDA },
+  { 0x0399, 0x0301, 0x038A },
+  { 0x0399, 0x0304, 0x1FD9 },
+  { 0x0399, 0x0306, 0x1FD8 },
+  { 0x0399, 0x0308, 0x03AA },
+  { 0x0399, 0x0313, 0x1F38 },
+  { 0x0399, 0x0314, 0x1F39 },
+  { 0x039F, 0x0300, 0x1FF8 },
+  { 0x039F, 0x0301, 0x038C },
+  { 0x039F, 0x0313, 0x1F48 },
+  { 0x039F, 0x0314, 0x1F49 },
+  { 0x03A1, 0x0314, 0x1FEC },
+  { 0x03A5, 0x0300, 0x1FEA },
+  { 0x03A5, 0x0301, 0x038E },
+  { 0x03A5, 0x0304, 0x1FE9 },
+  { 0x03A5, 0x0306, 0x1FE8 },
+  { 0x03A5, 0x0308, 0x03AB },
+  { 0x03A5, 0x0314, 0x1F59 },
+  { 0x03A9, 0x0300, 0x1FFA },
+  { 0x03A9, 0x0301, 0x038F },
+  { 0x03A9, 0x0313, 0x1F68 },
+  { 0x03A9, 0x0314, 0x1F69 },
+  { 0x03A9, 0x0345, 0x1FFC },
+  { 0x03AC, 0x0345, 0x1FB4 },
+  { 0x03AE, 0x0345, 0x1FC4 },
+  { 0x03B1, 0x0300, 0x1F70 },
+  { 0x03B1, 0x0301, 0x03AC },
+  { 0x03B1, 0x0304, 0x1FB1 },
+  { 0x03B1, 0x0306, 0x1FB0 },
+  { 0x03B1, 0x0313, 0x1F00 },
+  { 0x03B1, 0x0314, 0x1F01 },
+  { 0x03B1, 0x0342, 0x1FB6 },
+  { 0x03B1, 0x0345, 0x1FB3 },
+  { 0x03B5, 0x0300, 0x1F72 },
+  { 0x03B5, 0x0301, 0x03AD },
+  { 0x03B5, 0x0313, 0x1F10 },
+  { 0x03B5, 0x0314, 0x1F11 },
+  { 0x03B7, 0x0300, 0x1F74 },
+  { 0x03B7, 0x0301, 0x03AE },
+  { 0x03B7, 0x0313, 0x1F20 },
+  { 0x03B7, 0x0314, 0x1F21 },
+  { 0x03B7, 0x0342, 0x1FC6 },
+  { 0x03B7, 0x0345, 0x1FC3 },
+  { 0x03B9, 0x0300, 0x1F76 },
+  { 0x03B9, 0x0301, 0x03AF },
+  { 0x03B9, 0x0304, 0x1FD1 },
+  { 0x03B9, 0x0306, 0x1FD0 },
+  { 0x03B9, 0x0308, 0x03CA },
+  { 0x03B9, 0x0313, 0x1F30 },
+  { 0x03B9, 0x0314, 0x1F31 },
+  { 0x03B9, 0x0342, 0x1FD6 },
+  { 0x03BF, 0x0300, 0x1F78 },
+  { 0x03BF, 0x0301, 0x03CC },
+  { 0x03BF, 0x0313, 0x1F40 },
+  { 0x03BF, 0x0314, 0x1F41 },
+  { 0x03C1, 0x0313, 0x1FE4 },
+  { 0x03C1, 0x0314, 0x1FE5 },
+  { 0x03C5, 0x0300, 0x1F7A },
+  { 0x03C5, 0x0301, 0x03CD },
+  { 0x03C5, 0x0304, 0x1FE1 },
+  { 0x03C5, 0x0306, 0x1FE0 },
+  { 0x03C5, 0x0308, 0x03CB },
+  { 0x03C5, 0x0313, 0x1F50 },
+  { 0x03C5, 0x0314, 0x1F51 },
+  { 0x03C5, 0x0342, 0x1FE6 },
+  { 0x03C9, 0x0300, 0x1F7C },
+  { 0x03C9, 0x0301, 0x03CE },
+  { 0x03C9, 0x0313, 0x1F60 },
+  { 0x03C9, 0x0314, 0x1F61 },
+  { 0x03C9, 0x0342, 0x1FF6 },
+  { 0x03C9, 0x0345, 0x1FF3 },
+  { 0x03CA, 0x0300, 0x1FD2 },
+  { 0x03CA, 0x0301, 0x0390 },
+  { 0x03CA, 0x0342, 0x1FD7 },
+  { 0x03CB, 0x0300, 0x1FE2 },
+  { 0x03CB, 0x0301, 0x03B0 },
+  { 0x03CB, 0x0342, 0x1FE7 },
+  { 0x03CE, 0x0345, 0x1FF4 },
+  { 0x03D2, 0x0301, 0x03D3 },
+  { 0x03D2, 0x0308, 0x03D4 },
+  { 0x0406, 0x0308, 0x0407 },
+  { 0x0410, 0x0306, 0x04D0 },
+  { 0x0410, 0x0308, 0x04D2 },
+  { 0x0413, 0x0301, 0x0403 },
+  { 0x0415, 0x0300, 0x0400 },
+  { 0x0415, 0x0306, 0x04D6 },
+  { 0x0415, 0x0308, 0x0401 },
+  { 0x0416, 0x0306, 0x04C1 },
+  { 0x0416, 0x0308, 0x04DC },
+  { 0x0417, 0x0308, 0x04DE },
+  { 0x0418, 0x0300, 0x040D },
+  { 0x0418, 0x0304, 0x04E2 },
+  { 0x0418, 0x0306, 0x0419 },
+  { 0x0418, 0x0308, 0x04E4 },
+  { 0x041A, 0x0301, 0x040C },
+  { 0x041E, 0x0308, 0x04E6 },
+  { 0x0423, 0x0304, 0x04EE },
+  { 0x0423, 0x0306, 0x040E },
+  { 0x0423, 0x0308, 0x04F0 },
+  { 0x0423, 0x030B, 0x04F2 },
+  { 0x0427, 0x0308, 0x04F4 },
+  { 0x042B, 0x0308, 0x04F8 },
+  { 0x042D, 0x0308, 0x04EC },
+  { 0x0430, 0x0306, 0x04D1 },
+  { 0x0430, 0x0308, 0x04D3 },
+  { 0x0433, 0x0301, 0x0453 },
+  { 0x0435, 0x0300, 0x0450 },
+  { 0x0435, 0x0306, 0x04D7 },
+  { 0x0435, 0x0308, 0x0451 },
+  { 0x0436, 0x0306, 0x04C2 },
+  { 0x0436, 0x0308, 0x04DD },
+  { 0x0437, 0x0308, 0x04DF },
+  { 0x0438, 0x0300, 0x045D },
+  { 0x0438, 0x0304, 0x04E3 },
+  { 0x0438, 0x0306, 0x0439 },
+  { 0x0438, 0x0308, 0x04E5 },
+  { 0x043A, 0x0301, 0x045C },
+  { 0x043E, 0x0308, 0x04E7 },
+  { 0x0443, 0x0304, 0x04EF },
+  { 0x0443, 0x0306, 0x045E },
+  { 0x0443, 0x0308, 0x04F1 },
+  { 0x0443, 0x030B, 0x04F3 },
+  { 0x0447, 0x0308, 0x04F5 },
+  { 0x044B, 0x0308, 0x04F9 },
+  { 0x044D, 0x0308, 0x04ED },
+  { 0x0456, 0x0308, 0x0457 },
+  { 0x0474, 0x030F, 0x0476 },
+  { 0x0475, 0x030F, 0x0477 },
+  { 0x04D8, 0x0308, 0x04DA },
+  { 0x04D9, 0x0308, 0x04DB },
+  { 0x04E8, 0x0308, 0x04EA },
+  { 0x04E9, 0x0308, 0x04EB },
+  { 0x0627, 0x0653, 0x0622 },
+  { 0x0627, 0x0654, 0x0623 },
+  { 0x0627, 0x0655, 0x0625 },
+  { 0x0648, 0x0654, 0x0624 },
+  { 0x064A, 0x0654, 0x0626 },
+  { 0x06C1, 0x0654, 0x06C2 },
+  { 0x06D2, 0x0654, 0x06D3 },
+  { 0x06D5, 0x0654, 0x06C0 },
+  { 0x0928, 0x093C, 0x0929 },
+  { 0x0930, 0x093C, 0x0931 },
+  { 0x0933, 0x093C, 0x0934 },
+  { 0x09C7, 0x09BE, 0x09CB },
+  { 0x09C7, 0x09D7, 0x09CC },
+  { 0x0B47, 0x0B3E, 0x0B4B },
+  { 0x0B47, 0x0B56, 0x0B48 },
+  { 0x0B47, 0x0B57, 0x0B4C },
+  { 0x0B92, 0x0BD7, 0x0B94 },
+  { 0x0BC6, 0x0BBE, 0x0BCA },
+  { 0x0BC6, 0x0BD7, 0x0BCC },
+  { 0x0BC7, 0x0BBE, 0x0BCB },
+  { 0x0C46, 0x0C56, 0x0C48 },
+  { 0x0CBF, 0x0CD5, 0x0CC0 },
+  { 0x0CC6, 0x0CC2, 0x0CCA },
+  { 0x0CC6, 0x0CD5, 0x0CC7 },
+  { 0x0CC6, 0x0CD6, 0x0CC8 },
+  { 0x0CCA, 0x0CD5, 0x0CCB },
+  { 0x0D46, 0x0D3E, 0x0D4A },
+  { 0x0D46, 0x0D57, 0x0D4C },
+  { 0x0D47, 0x0D3E, 0x0D4B },
+  { 0x0DD9, 0x0DCA, 0x0DDA },
+  { 0x0DD9, 0x0DCF, 0x0DDC },
+  { 0x0DD9, 0x0DDF, 0x0DDE },
+  { 0x0DDC, 0x0DCA, 0x0DDD },
+  { 0x1025, 0x102E, 0x1026 },
+  { 0x1E36, 0x0304, 0x1E38 },
+  { 0x1E37, 0x0304, 0x1E39 },
+  { 0x1E5A, 0x0304, 0x1E5C },
+  { 0x1E5B, 0x0304, 0x1E5D },
+  { 0x1E62, 0x0307, 0x1E68 },
+  { 0x1E63, 0x0307, 0x1E69 },
+  { 0x1EA0, 0x0302, 0x1EAC },
+  { 0x1EA0, 0x0306, 0x1EB6 },
+  { 0x1EA1, 0x0302, 0x1EAD },
+  { 0x1EA1, 0x0306, 0x1EB7 },
+  { 0x1EB8, 0x0302, 0x1EC6 },
+  { 0x1EB9, 0x0302, 0x1EC7 },
+  { 0x1ECC, 0x0302, 0x1ED8 },
+  { 0x1ECD, 0x0302, 0x1ED9 },
+  { 0x1F00, 0x0300, 0x1F02 },
+  { 0x1F00, 0x0301, 0x1F04 },
+  { 0x1F00, 0x0342, 0x1F06 },
+  { 0x1F00, 0x0345, 0x1F80 },
+  { 0x1F01, 0x0300, 0x1F03 },
+  { 0x1F01, 0x0301, 0x1F05 },
+  { 0x1F01, 0x0342, 0x1F07 },
+  { 0x1F01, 0x0345, 0x1F81 },
+  { 0x1F02, 0x0345, 0x1F82 },
+  { 0x1F03, 0x0345, 0x1F83 },
+  { 0x1F04, 0x0345, 0x1F84 },
+  { 0x1F05, 0x0345, 0x1F85 },
+  { 0x1F06, 0x0345, 0x1F86 },
+  { 0x1F07, 0x0345, 0x1F87 },
+  { 0x1F08, 0x0300, 0x1F0A },
+  { 0x1F08, 0x0301, 0x1F0C },
+  { 0x1F08, 0x0342, 0x1F0E },
+  { 0x1F08, 0x0345, 0x1F88 },
+  { 0x1F09, 0x0300, 0x1F0B },
+  { 0x1F09, 0x0301, 0x1F0D },
+  { 0x1F09, 0x0342, 0x1F0F },
+  { 0x1F09, 0x0345, 0x1F89 },
+  { 0x1F0A, 0x0345, 0x1F8A },
+  { 0x1F0B, 0x0345, 0x1F8B },
+  { 0x1F0C, 0x0345, 0x1F8C },
+  { 0x1F0D, 0x0345, 0x1F8D },
+  { 0x1F0E, 0x0345, 0x1F8E },
+  { 0x1F0F, 0x0345, 0x1F8F },
+  { 0x1F10, 0x0300, 0x1F12 },
+  { 0x1F10, 0x0301, 0x1F14 },
+  { 0x1F11, 0x0300, 0x1F13 },
+  { 0x1F11, 0x0301, 0x1F15 },
+  { 0x1F18, 0x0300, 0x1F1A },
+  { 0x1F18, 0x0301, 0x1F1C },
+  { 0x1F19, 0x0300, 0x1F1B },
+  { 0x1F19, 0x0301, 0x1F1D },
+  { 0x1F20, 0x0300, 0x1F22 },
+  { 0x1F20, 0x0301, 0x1F24 },
+  { 0x1F20, 0x0342, 0x1F26 },
+  { 0x1F20, 0x0345, 0x1F90 },
+  { 0x1F21, 0x0300, 0x1F23 },
+  { 0x1F21, 0x0301, 0x1F25 },
+  { 0x1F21, 0x0342, 0x1F27 },
+  { 0x1F21, 0x0345, 0x1F91 },
+  { 0x1F22, 0x0345, 0x1F92 },
+  { 0x1F23, 0x0345, 0x1F93 },
+  { 0x1F24, 0x0345, 0x1F94 },
+  { 0x1F25, 0x0345, 0x1F95 },
+  { 0x1F26, 0x0345, 0x1F96 },
+  { 0x1F27, 0x0345, 0x1F97 },
+  { 0x1F28, 0x0300, 0x1F2A },
+  { 0x1F28, 0x0301, 0x1F2C },
+  { 0x1F28, 0x0342, 0x1F2E },
+  { 0x1F28, 0x0345, 0x1F98 },
+  { 0x1F29, 0x0300, 0x1F2B },
+  { 0x1F29, 0x0301, 0x1F2D },
+  { 0x1F29, 0x0342, 0x1F2F },
+  { 0x1F29, 0x0345, 0x1F99 },
+  { 0x1F2A, 0x0345, 0x1F9A },
+  { 0x1F2B, 0x0345, 0x1F9B },
+  { 0x1F2C, 0x0345, 0x1F9C },
+  { 0x1F2D, 0x0345, 0x1F9D },
+  { 0x1F2E, 0x0345, 0x1F9E },
+  { 0x1F2F, 0x0345, 0x1F9F },
+  { 0x1F30, 0x0300, 0x1F32 },
+  { 0x1F30, 0x0301, 0x1F34 },
+  { 0x1F30, 0x0342, 0x1F36 },
+  { 0x1F31, 0x0300, 0x1F33 },
+  { 0x1F31, 0x0301, 0x1F35 },
+  { 0x1F31, 0x0342, 0x1F37 },
+  { 0x1F38, 0x0300, 0x1F3A },
+  { 0x1F38, 0x0301, 0x1F3C },
+  { 0x1F38, 0x0342, 0x1F3E },
+  { 0x1F39, 0x0300, 0x1F3B },
+  { 0x1F39, 0x0301, 0x1F3D },
+  { 0x1F39, 0x0342, 0x1F3F },
+  { 0x1F40, 0x0300, 0x1F42 },
+  { 0x1F40, 0x0301, 0x1F44 },
+  { 0x1F41, 0x0300, 0x1F43 },
+  { 0x1F41, 0x0301, 0x1F45 },
+  { 0x1F48, 0x0300, 0x1F4A },
+  { 0x1F48, 0x0301, 0x1F4C },
+  { 0x1F49, 0x0300, 0x1F4B },
+  { 0x1F49, 0x0301, 0x1F4D },
+  { 0x1F50, 0x0300, 0x1F52 },
+  { 0x1F50, 0x0301, 0x1F54 },
+  { 0x1F50, 0x0342, 0x1F56 },
+  { 0x1F51, 0x0300, 0x1F53 },
+  { 0x1F51, 0x0301, 0x1F55 },
+  { 0x1F51, 0x0342, 0x1F57 },
+  { 0x1F59, 0x0300, 0x1F5B },
+  { 0x1F59, 0x0301, 0x1F5D },
+  { 0x1F59, 0x0342, 0x1F5F },
+  { 0x1F60, 0x0300, 0x1F62 },
+  { 0x1F60, 0x0301, 0x1F64 },
+  { 0x1F60, 0x0342, 0x1F66 },
+  { 0x1F60, 0x0345, 0x1FA0 },
+  { 0x1F61, 0x0300, 0x1F63 },
+  { 0x1F61, 0x0301, 0x1F65 },
+  { 0x1F61, 0x0342, 0x1F67 },
+  { 0x1F61, 0x0345, 0x1FA1 },
+  { 0x1F62, 0x0345, 0x1FA2 },
+  { 0x1F63, 0x0345, 0x1FA3 },
+  { 0x1F64, 0x0345, 0x1FA4 },
+  { 0x1F65, 0x0345, 0x1FA5 },
+  { 0x1F66, 0x0345, 0x1FA6 },
+  { 0x1F67, 0x0345, 0x1FA7 },
+  { 0x1F68, 0x0300, 0x1F6A },
+  { 0x1F68, 0x0301, 0x1F6C },
+  { 0x1F68, 0x0342, 0x1F6E },
+  { 0x1F68, 0x0345, 0x1FA8 },
+  { 0x1F69, 0x0300, 0x1F6B },
+  { 0x1F69, 0x0301, 0x1F6D },
+  { 0x1F69, 0x0342, 0x1F6F },
+  { 0x1F69, 0x0345, 0x1FA9 },
+  { 0x1F6A, 0x0345, 0x1FAA },
+  { 0x1F6B, 0x0345, 0x1FAB },
+  { 0x1F6C, 0x0345, 0x1FAC },
+  { 0x1F6D, 0x0345, 0x1FAD },
+  { 0x1F6E, 0x0345, 0x1FAE },
+  { 0x1F6F, 0x0345, 0x1FAF },
+  { 0x1F70, 0x0345, 0x1FB2 },
+  { 0x1F74, 0x0345, 0x1FC2 },
+  { 0x1F7C, 0x0345, 0x1FF2 },
+  { 0x1FB6, 0x0345, 0x1FB7 },
+  { 0x1FBF, 0x0300, 0x1FCD },
+  { 0x1FBF, 0x0301, 0x1FCE },
+  { 0x1FBF, 0x0342, 0x1FCF },
+  { 0x1FC6, 0x0345, 0x1FC7 },
+  { 0x1FF6, 0x0345, 0x1FF7 },
+  { 0x1FFE, 0x0300, 0x1FDD },
+  { 0x1FFE, 0x0301, 0x1FDE },
+  { 0x1FFE, 0x0342, 0x1FDF },
+  { 0x2190, 0x0338, 0x219A },
+  { 0x2192, 0x0338, 0x219B },
+  { 0x2194, 0x0338, 0x21AE },
+  { 0x21D0, 0x0338, 0x21CD },
+  { 0x21D2, 0x0338, 0x21CF },
+  { 0x21D4, 0x0338, 0x21CE },
+  { 0x2203, 0x0338, 0x2204 },
+  { 0x2208, 0x0338, 0x2209 },
+  { 0x220B, 0x0338, 0x220C },
+  { 0x2223, 0x0338, 0x2224 },
+  { 0x2225, 0x0338, 0x2226 },
+  { 0x223C, 0x0338, 0x2241 },
+  { 0x2243, 0x0338, 0x2244 },
+  { 0x2245, 0x0338, 0x2247 },
+  { 0x2248, 0x0338, 0x2249 },
+  { 0x224D, 0x0338, 0x226D },
+  { 0x2261, 0x0338, 0x2262 },
+  { 0x2264, 0x0338, 0x2270 },
+  { 0x2265, 0x0338, 0x2271 },
+  { 0x2272, 0x0338, 0x2274 },
+  { 0x2273, 0x0338, 0x2275 },
+  { 0x2276, 0x0338, 0x2278 },
+  { 0x2277, 0x0338, 0x2279 },
+  { 0x227A, 0x0338, 0x2280 },
+  { 0x227B, 0x0338, 0x2281 },
+  { 0x227C, 0x0338, 0x22E0 },
+  { 0x227D, 0x0338, 0x22E1 },
+  { 0x2282, 0x0338, 0x2284 },
+  { 0x2283, 0x0338, 0x2285 },
+  { 0x2286, 0x0338, 0x2288 },
+  { 0x2287, 0x0338, 0x2289 },
+  { 0x2291, 0x0338, 0x22E2 },
+  { 0x2292, 0x0338, 0x22E3 },
+  { 0x22A2, 0x0338, 0x22AC },
+  { 0x22A8, 0x0338, 0x22AD },
+  { 0x22A9, 0x0338, 0x22AE },
+  { 0x22AB, 0x0338, 0x22AF },
+  { 0x22B2, 0x0338, 0x22EA },
+  { 0x22B3, 0x0338, 0x22EB },
+  { 0x22B4, 0x0338, 0x22EC },
+  { 0x22B5, 0x0338, 0x22ED },
+  { 0x3046, 0x3099, 0x3094 },
+  { 0x304B, 0x3099, 0x304C },
+  { 0x304D, 0x3099, 0x304E },
+  { 0x304F, 0x3099, 0x3050 },
+  { 0x3051, 0x3099, 0x3052 },
+  { 0x3053, 0x3099, 0x3054 },
+  { 0x3055, 0x3099, 0x3056 },
+  { 0x3057, 0x3099, 0x3058 },
+  { 0x3059, 0x3099, 0x305A },
+  { 0x305B, 0x3099, 0x305C },
+  { 0x305D, 0x3099, 0x305E },
+  { 0x305F, 0x3099, 0x3060 },
+  { 0x3061, 0x3099, 0x3062 },
+  { 0x3064, 0x3099, 0x3065 },
+  { 0x3066, 0x3099, 0x3067 },
+  { 0x3068, 0x3099, 0x3069 },
+  { 0x306F, 0x3099, 0x3070 },
+  { 0x306F, 0x309A, 0x3071 },
+  { 0x3072, 0x3099, 0x3073 },
+  { 0x3072, 0x309A, 0x3074 },
+  { 0x3075, 0x3099, 0x3076 },
+  { 0x3075, 0x309A, 0x3077 },
+  { 0x3078, 0x3099, 0x3079 },
+  { 0x3078, 0x309A, 0x307A },
+  { 0x307B, 0x3099, 0x307C },
+  { 0x307B, 0x309A, 0x307D },
+  { 0x309D, 0x3099, 0x309E },
+  { 0x30A6, 0x3099, 0x30F4 },
+  { 0x30AB, 0x3099, 0x30AC },
+  { 0x30AD, 0x3099, 0x30AE },
+  { 0x30AF, 0x3099, 0x30B0 },
+  { 0x30B1, 0x3099, 0x30B2 },
+  { 0x30B3, 0x3099, 0x30B4 },
+  { 0x30B5, 0x3099, 0x30B6 },
+  { 0x30B7, 0x3099, 0x30B8 },
+  { 0x30B9, 0x3099, 0x30BA },
+  { 0x30BB, 0x3099, 0x30BC },
+  { 0x30BD, 0x3099, 0x30BE },
+  { 0x30BF, 0x3099, 0x30C0 },
+  { 0x30C1, 0x3099, 0x30C2 },
+  { 0x30C4, 0x3099, 0x30C5 },
+  { 0x30C6, 0x3099, 0x30C7 },
+  { 0x30C8, 0x3099, 0x30C9 },
+  { 0x30CF, 0x3099, 0x30D0 },
+  { 0x30CF, 0x309A, 0x30D1 },
+  { 0x30D2, 0x3099, 0x30D3 },
+  { 0x30D2, 0x309A, 0x30D4 },
+  { 0x30D5, 0x3099, 0x30D6 },
+  { 0x30D5, 0x309A, 0x30D7 },
+  { 0x30D8, 0x3099, 0x30D9 },
+  { 0x30D8, 0x309A, 0x30DA },
+  { 0x30DB, 0x3099, 0x30DC },
+  { 0x30DB, 0x309A, 0x30DD },
+  { 0x30EF, 0x3099, 0x30F7 },
+  { 0x30F0, 0x3099, 0x30F8 },
+  { 0x30F1, 0x3099, 0x30F9 },
+  { 0x30F2, 0x3099, 0x30FA },
+  { 0x30FD, 0x3099, 0x30FE },
+};
+
+// Characters of combining class 0 that compose with the one
+// before them, apart from Hangul jamo.
+const uint32 kIDNAComposingStarters[] = {
+  0x09BE, 0x09D7, 0x0B3E, 0x0B56, 0x0B57, 0x0BBE, 0x0BD7, 0x0CC2,
+  0x0CD5, 0x0CD6, 0x0D3E, 0x0D57, 0x0DCF, 0x0DDF, 0x102E,
+};
+
+// Nameprep prohibited output: tables C.1.2, C.2.2 and C.3-C.9.
+const IDNARange kIDNAProhibited[] = {
+  { 0x0080, 0x00A0 },
+  { 0x0340, 0x0341 },
+  { 0x06DD, 0x06DD },
+  { 0x070F, 0x070F },
+  { 0x1680, 0x1680 },
+  { 0x180E, 0x180E },
+  { 0x2000, 0x200F },
+  { 0x2028, 0x202F },
+  { 0x205F, 0x2063 },
+  { 0x206A, 0x206F },
+  { 0x2FF0, 0x2FFB },
+  { 0x3000, 0x3000 },
+  { 0xE000, 0xF8FF },
+  { 0xFDD0, 0xFDEF },
+  { 0xFEFF, 0xFEFF },
+  { 0xFFF9, 0xFFFF },
+  { 0x1D173, 0x1D17A },
+  { 0x1FFFE, 0x1FFFF },
+  { 0x2FFFE, 0x2FFFF },
+  { 0x3FFFE, 0x3FFFF },
+  { 0x4FFFE, 0x4FFFF },
+  { 0x5FFFE, 0x5FFFF },
+  { 0x6FFFE, 0x6FFFF },
+  { 0x7FFFE, 0x7FFFF },
+  { 0x8FFFE, 0x8FFFF },
+  { 0x9FFFE, 0x9FFFF },
+  { 0xAFFFE, 0xAFFFF },
+  { 0xBFFFE, 0xBFFFF },
+  { 0xCFFFE, 0xCFFFF },
+  { 0xDFFFE, 0xDFFFF },
+  { 0xE0001, 0xE0001 },
+  { 0xE0020, 0xE007F },
+  { 0xEFFFE, 0x10FFFF },
+};
+
+// Bidi tables D.1 (RandALCat) and D.2 (LCat), extended to code
+// points that Unicode 3.2 leaves unassigned.
+const IDNARange kIDNARandAL[] = {
+  { 0x0590, 0x0590 },
+  { 0x05BE, 0x05BE },
+  { 0x05C0, 0x05C0 },
+  { 0x05C3, 0x05C3 },
+  { 0x05C6, 0x05C6 },
+  { 0x05C8, 0x05FF },
+  { 0x0608, 0x0608 },
+  { 0x060B, 0x060B },
+  { 0x060D, 0x060D },
+  { 0x061B, 0x064A },
+  { 0x066D, 0x066F },
+  { 0x0671, 0x06D5 },
+  { 0x06DD, 0x06DD },
+  { 0x06E5, 0x06E6 },
+  { 0x06EE, 0x06EF },
+  { 0x06FA, 0x070E },
+  { 0x0710, 0x0710 },
+  { 0x0712, 0x072F },
+  { 0x074B, 0x07A5 },
+  { 0x07B1, 0x07EA },
+  { 0x07F4, 0x07F5 },
+  { 0x07FA, 0x07FC },
+  { 0x07FE, 0x0815 },
+  { 0x081A, 0x081A },
+  { 0x0824, 0x0824 },
+  { 0x0828, 0x0828 },
+  { 0x082E, 0x0858 },
+  { 0x085C, 0x088F },
+  { 0x0892, 0x0897 },
+  { 0x08A0, 0x08C9 },
+  { 0x200F, 0x200F },
+  { 0xFB1D, 0xFB1D },
+  { 0xFB1F, 0xFB28 },
+  { 0xFB2A, 0xFD3D },
+  { 0xFD50, 0xFDCE },
+  { 0xFDF0, 0xFDFC },
+  { 0xFE70, 0xFEFE },
+  { 0x10800, 0x1091E },
+  { 0x10920, 0x10A00 },
+  { 0x10A04, 0x10A04 },
+  { 0x10A07, 0x10A0B },
+  { 0x10A10, 0x10A37 },
+  { 0x10A3B, 0x10A3E },
+  { 0x10A40, 0x10AE4 },
+  { 0x10AE7, 0x10B38 },
+  { 0x10B40, 0x10D23 },
+  { 0x10D28, 0x10D2F },
+  { 0x10D3A, 0x10E5F },
+  { 0x10E7F, 0x10EAA },
+  { 0x10EAD, 0x10F45 },
+  { 0x10F51, 0x10F81 },
+  { 0x10F86, 0x10FFF },
+  { 0x1E800, 0x1E8CF },
+  { 0x1E8D7, 0x1E943 },
+  { 0x1E94B, 0x1EEEF },
+  { 0x1EEF2, 0x1EFFF },
+};
+
+const IDNARange kIDNAL[] = {
+  { 0x0041, 0x005A },
+  { 0x0061, 0x007A },
+  { 0x00AA, 0x00AA },
+  { 0x00B5, 0x00B5 },
+  { 0x00BA, 0x00BA },
+  { 0x00C0, 0x00D6 },
+  { 0x00D8, 0x00F6 },
+  { 0x00F8, 0x02B8 },
+  { 0x02BB, 0x02C1 },
+  { 0x02D0, 0x02D1 },
+  { 0x02E0, 0x02E4 },
+  { 0x02EE, 0x02EE },
+  { 0x0370, 0x0373 },
+  { 0x0376, 0x037D },
+  { 0x037F, 0x0383 },
+  { 0x0386, 0x0386 },
+  { 0x0388, 0x03F5 },
+  { 0x03F7, 0x0482 },
+  { 0x048A, 0x0589 },
+  { 0x058B, 0x058C },
+  { 0x0903, 0x0939 },
+  { 0x093B, 0x093B },
+  { 0x093D, 0x0940 },
+  { 0x0949, 0x094C },
+  { 0x094E, 0x0950 },
+  { 0x0958, 0x0961 },
+  { 0x0964, 0x0980 },
+  { 0x0982, 0x09BB },
+  { 0x09BD, 0x09C0 },
+  { 0x09C5, 0x09CC },
+  { 0x09CE, 0x09E1 },
+  { 0x09E4, 0x09F1 },
+  { 0x09F4, 0x09FA },
+  { 0x09FC, 0x09FD },
+  { 0x09FF, 0x0A00 },
+  { 0x0A03, 0x0A3B },
+  { 0x0A3D, 0x0A40 },
+  { 0x0A43, 0x0A46 },
+  { 0x0A49, 0x0A4A },
+  { 0x0A4E, 0x0A50 },
+  { 0x0A52, 0x0A6F },
+  { 0x0A72, 0x0A74 },
+  { 0x0A76, 0x0A80 },
+  { 0x0A83, 0x0ABB },
+  { 0x0ABD, 0x0AC0 },
+  { 0x0AC6, 0x0AC6 },
+  { 0x0AC9, 0x0ACC },
+  { 0x0ACE, 0x0AE1 },
+  { 0x0AE4, 0x0AF0 },
+  { 0x0AF2, 0x0AF9 },
+  { 0x0B00, 0x0B00 },
+  { 0x0B02, 0x0B3B },
+  { 0x0B3D, 0x0B3E },
+  { 0x0B40, 0x0B40 },
+  { 0x0B45, 0x0B4C },
+  { 0x0B4E, 0x0B54 },
+  { 0x0B57, 0x0B61 },
+  { 0x0B64, 0x0B81 },
+  { 0x0B83, 0x0BBF },
+  { 0x0BC1, 0x0BCC },
+  { 0x0BCE, 0x0BF2 },
+  { 0x0BFB, 0x0BFF },
+  { 0x0C01, 0x0C03 },
+  { 0x0C05, 0x0C3B },
+  { 0x0C3D, 0x0C3D },
+  { 0x0C41, 0x0C45 },
+  { 0x0C49, 0x0C49 },
+  { 0x0C4E, 0x0C54 },
+  { 0x0C57, 0x0C61 },
+  { 0x0C64, 0x0C77 },
+  { 0x0C7F, 0x0C80 },
+  { 0x0C82, 0x0CBB },
+  { 0x0CBD, 0x0CBE },
+  { 0x0CC0, 0x0CC5 },
+  { 0x0CC7, 0x0CCB },
+  { 0x0CCE, 0x0CE1 },
+  { 0x0CE4, 0x0CFF },
+  { 0x0D02, 0x0D3A },
+  { 0x0D3D, 0x0D40 },
+  { 0x0D45, 0x0D4C },
+  { 0x0D4E, 0x0D61 },
+  { 0x0D64, 0x0D80 },
+  { 0x0D82, 0x0DC9 },
+  { 0x0DCB, 0x0DD1 },
+  { 0x0DD5, 0x0DD5 },
+  { 0x0DD7, 0x0E30 },
+  { 0x0E32, 0x0E33 },
+  { 0x0E3B, 0x0E3E },
+  { 0x0E40, 0x0E46 },
+  { 0x0E4F, 0x0EB0 },
+  { 0x0EB2, 0x0EB3 },
+  { 0x0EBD, 0x0EC7 },
+  { 0x0ECE, 0x0F17 },
+  { 0x0F1A, 0x0F34 },
+  { 0x0F36, 0x0F36 },
+  { 0x0F38, 0x0F38 },
+  { 0x0F3E, 0x0F70 },
+  { 0x0F7F, 0x0F7F },
+  { 0x0F85, 0x0F85 },
+  { 0x0F88, 0x0F8C },
+  { 0x0F98, 0x0F98 },
+  { 0x0FBD, 0x0FC5 },
+  { 0x0FC7, 0x102C },
+  { 0x1031, 0x1031 },
+  { 0x1038, 0x1038 },
+  { 0x103B, 0x103C },
+  { 0x103F, 0x1057 },
+  { 0x105A, 0x105D },
+  { 0x1061, 0x1070 },
+  { 0x1075, 0x1081 },
+  { 0x1083, 0x1084 },
+  { 0x1087, 0x108C },
+  { 0x108E, 0x109C },
+  { 0x109E, 0x135C },
+  { 0x1360, 0x138F },
+  { 0x139A, 0x13FF },
+  { 0x1401, 0x167F },
+  { 0x1681, 0x169A },
+  { 0x169D, 0x1711 },
+  { 0x1715, 0x1731 },
+  { 0x1735, 0x1751 },
+  { 0x1754, 0x1771 },
+  { 0x1774, 0x17B6 },
+  { 0x17BE, 0x17C5 },
+  { 0x17C7, 0x17C8 },
+  { 0x17D4, 0x17DA },
+  { 0x17DC, 0x17DC },
+  { 0x17DE, 0x17EF },
+  { 0x17FA, 0x17FF },
+  { 0x1810, 0x18A8 },
+  { 0x18AA, 0x191F },
+  { 0x1923, 0x1926 },
+  { 0x1929, 0x1931 },
+  { 0x1933, 0x1938 },
+  { 0x193C, 0x193F },
+  { 0x1941, 0x1943 },
+  { 0x1946, 0x19DD },
+  { 0x1A00, 0x1A16 },
+  { 0x1A19, 0x1A1A },
+  { 0x1A1C, 0x1A55 },
+  { 0x1A57, 0x1A57 },
+  { 0x1A5F, 0x1A5F },
+  { 0x1A61, 0x1A61 },
+  { 0x1A63, 0x1A64 },
+  { 0x1A6D, 0x1A72 },
+  { 0x1A7D, 0x1A7E },
+  { 0x1A80, 0x1AAF },
+  { 0x1ACF, 0x1AFF },
+  { 0x1B04, 0x1B33 },
+  { 0x1B35, 0x1B35 },
+  { 0x1B3B, 0x1B3B },
+  { 0x1B3D, 0x1B41 },
+  { 0x1B43, 0x1B6A },
+  { 0x1B74, 0x1B7F },
+  { 0x1B82, 0x1BA1 },
+  { 0x1BA6, 0x1BA7 },
+  { 0x1BAA, 0x1BAA },
+  { 0x1BAE, 0x1BE5 },
+  { 0x1BE7, 0x1BE7 },
+  { 0x1BEA, 0x1BEC },
+  { 0x1BEE, 0x1BEE },
+  { 0x1BF2, 0x1C2B },
+  { 0x1C34, 0x1C35 },
+  { 0x1C38, 0x1CCF },
+  { 0x1CD3, 0x1CD3 },
+  { 0x1CE1, 0x1CE1 },
+  { 0x1CE9, 0x1CEC },
+  { 0x1CEE, 0x1CF3 },
+  { 0x1CF5, 0x1CF7 },
+  { 0x1CFA, 0x1DBF },
+  { 0x1E00, 0x1FBC },
+  { 0x1FBE, 0x1FBE },
+  { 0x1FC2, 0x1FCC },
+  { 0x1FD0, 0x1FDC },
+  { 0x1FE0, 0x1FEC },
+  { 0x1FF0, 0x1FFC },
+  { 0x1FFF, 0x1FFF },
+  { 0x200E, 0x200E },
+  { 0x2071, 0x2073 },
+  { 0x207F, 0x207F },
+  { 0x208F, 0x209F },
+  { 0x20F1, 0x20FF },
+  { 0x2102, 0x2102 },
+  { 0x2107, 0x2107 },
+  { 0x210A, 0x2113 },
+  { 0x2115, 0x2115 },
+  { 0x2119, 0x211D },
+  { 0x2124, 0x2124 },
+  { 0x2126, 0x2126 },
+  { 0x2128, 0x2128 },
+  { 0x212A, 0x212D },
+  { 0x212F, 0x2131 },
+  { 0x2133, 0x2139 },
+  { 0x213C, 0x213F },
+  { 0x2145, 0x2149 },
+  { 0x214E, 0x214F },
+  { 0x2160, 0x2188 },
+  { 0x218C, 0x218F },
+  { 0x2336, 0x237A },
+  { 0x2395, 0x2395 },
+  { 0x2427, 0x243F },
+  { 0x244B, 0x245F },
+  { 0x249C, 0x24E9 },
+  { 0x26AC, 0x26AC },
+  { 0x2B74, 0x2B75 },
+  { 0x2B96, 0x2B96 },
+  { 0x2C00, 0x2CE4 },
+  { 0x2CEB, 0x2CEE },
+  { 0x2CF2, 0x2CF8 },
+  { 0x2D00, 0x2D7E },
+  { 0x2D80, 0x2DDF },
+  { 0x2E5E, 0x2E7F },
+  { 0x2E9A, 0x2E9A },
+  { 0x2EF4, 0x2EFF },
+  { 0x2FD6, 0x2FEF },
+  { 0x2FFC, 0x2FFF },
+  { 0x3005, 0x3007 },
+  { 0x3021, 0x3029 },
+  { 0x3031, 0x3035 },
+  { 0x3038, 0x303C },
+  { 0x3040, 0x3098 },
+  { 0x309D, 0x309F },
+  { 0x30A1, 0x30FA },
+  { 0x30FC, 0x31BF },
+  { 0x31E4, 0x321C },
+  { 0x321F, 0x324F },
+  { 0x3260, 0x327B },
+  { 0x327F, 0x32B0 },
+  { 0x32C0, 0x32CB },
+  { 0x32D0, 0x3376 },
+  { 0x337B, 0x33DD },
+  { 0x33E0, 0x33FE },
+  { 0x3400, 0x4DBF },
+  { 0x4E00, 0xA48F },
+  { 0xA4C7, 0xA60C },
+  { 0xA610, 0xA66E },
+  { 0xA680, 0xA69D },
+  { 0xA6A0, 0xA6EF },
+  { 0xA6F2, 0xA6FF },
+  { 0xA722, 0xA787 },
+  { 0xA789, 0xA801 },
+  { 0xA803, 0xA805 },
+  { 0xA807, 0xA80A },
+  { 0xA80C, 0xA824 },
+  { 0xA827, 0xA827 },
+  { 0xA82D, 0xA837 },
+  { 0xA83A, 0xA873 },
+  { 0xA878, 0xA8C3 },
+  { 0xA8C6, 0xA8DF },
+  { 0xA8F2, 0xA8FE },
+  { 0xA900, 0xA925 },
+  { 0xA92E, 0xA946 },
+  { 0xA952, 0xA97F },
+  { 0xA983, 0xA9B2 },
+  { 0xA9B4, 0xA9B5 },
+  { 0xA9BA, 0xA9BB },
+  { 0xA9BE, 0xA9E4 },
+  { 0xA9E6, 0xAA28 },
+  { 0xAA2F, 0xAA30 },
+  { 0xAA33, 0xAA34 },
+  { 0xAA37, 0xAA42 },
+  { 0xAA44, 0xAA4B },
+  { 0xAA4D, 0xAA7B },
+  { 0xAA7D, 0xAAAF },
+  { 0xAAB1, 0xAAB1 },
+  { 0xAAB5, 0xAAB6 },
+  { 0xAAB9, 0xAABD },
+  { 0xAAC0, 0xAAC0 },
+  { 0xAAC2, 0xAAEB },
+  { 0xAAEE, 0xAAF5 },
+  { 0xAAF7, 0xAB69 },
+  { 0xAB6C, 0xABE4 },
+  { 0xABE6, 0xABE7 },
+  { 0xABE9, 0xABEC },
+  { 0xABEE, 0xFB1C },
+  { 0xFE1A, 0xFE1F },
+  { 0xFE53, 0xFE53 },
+  { 0xFE67, 0xFE67 },
+  { 0xFE6C, 0xFE6F },
+  { 0xFF00, 0xFF00 },
+  { 0xFF21, 0xFF3A },
+  { 0xFF41, 0xFF5A },
+  { 0xFF66, 0xFFDF },
+  { 0xFFE7, 0xFFE7 },
+  { 0xFFEF, 0xFFEF },
+  { 0x10000, 0x10100 },
+  { 0x10102, 0x1013F },
+  { 0x1018D, 0x1018F },
+  { 0x1019D, 0x1019F },
+  { 0x101A1, 0x101FC },
+  { 0x101FE, 0x102DF },
+  { 0x102FC, 0x10375 },
+  { 0x1037B, 0x107FF },
+  { 0x11000, 0x11000 },
+  { 0x11002, 0x11037 },
+  { 0x11047, 0x11051 },
+  { 0x11066, 0x1106F },
+  { 0x11071, 0x11072 },
+  { 0x11075, 0x1107E },
+  { 0x11082, 0x110B2 },
+  { 0x110B7, 0x110B8 },
+  { 0x110BB, 0x110C1 },
+  { 0x110C3, 0x110FF },
+  { 0x11103, 0x11126 },
+  { 0x1112C, 0x1112C },
+  { 0x11135, 0x11172 },
+  { 0x11174, 0x1117F },
+  { 0x11182, 0x111B5 },
+  { 0x111BF, 0x111C8 },
+  { 0x111CD, 0x111CE },
+  { 0x111D0, 0x1122E },
+  { 0x11232, 0x11233 },
+  { 0x11235, 0x11235 },
+  { 0x11238, 0x1123D },
+  { 0x1123F, 0x112DE },
+  { 0x112E0, 0x112E2 },
+  { 0x112EB, 0x112FF },
+  { 0x11302, 0x1133A },
+  { 0x1133D, 0x1133F },
+  { 0x11341, 0x11365 },
+  { 0x1136D, 0x1136F },
+  { 0x11375, 0x11437 },
+  { 0x11440, 0x11441 },
+  { 0x11445, 0x11445 },
+  { 0x11447, 0x1145D },
+  { 0x1145F, 0x114B2 },
+  { 0x114B9, 0x114B9 },
+  { 0x114BB, 0x114BE },
+  { 0x114C1, 0x114C1 },
+  { 0x114C4, 0x115B1 },
+  { 0x115B6, 0x115BB },
+  { 0x115BE, 0x115BE },
+  { 0x115C1, 0x115DB },
+  { 0x115DE, 0x11632 },
+  { 0x1163B, 0x1163C },
+  { 0x1163E, 0x1163E },
+  { 0x11641, 0x1165F },
+  { 0x1166D, 0x116AA },
+  { 0x116AC, 0x116AC },
+  { 0x116AE, 0x116AF },
+  { 0x116B6, 0x116B6 },
+  { 0x116B8, 0x1171C },
+  { 0x11720, 0x11721 },
+  { 0x11726, 0x11726 },
+  { 0x1172C, 0x1182E },
+  { 0x11838, 0x11838 },
+  { 0x1183B, 0x1193A },
+  { 0x1193D, 0x1193D },
+  { 0x1193F, 0x11942 },
+  { 0x11944, 0x119D3 },
+  { 0x119D8, 0x119D9 },
+  { 0x119DC, 0x119DF },
+  { 0x119E1, 0x11A00 },
+  { 0x11A07, 0x11A08 },
+  { 0x11A0B, 0x11A32 },
+  { 0x11A39, 0x11A3A },
+  { 0x11A3F, 0x11A46 },
+  { 0x11A48, 0x11A50 },
+  { 0x11A57, 0x11A58 },
+  { 0x11A5C, 0x11A89 },
+  { 0x11A97, 0x11A97 },
+  { 0x11A9A, 0x11C2F },
+  { 0x11C37, 0x11C37 },
+  { 0x11C3E, 0x11C91 },
+  { 0x11CA8, 0x11CA9 },
+  { 0x11CB1, 0x11CB1 },
+  { 0x11CB4, 0x11CB4 },
+  { 0x11CB7, 0x11D30 },
+  { 0x11D37, 0x11D39 },
+  { 0x11D3B, 0x11D3B },
+  { 0x11D3E, 0x11D3E },
+  { 0x11D46, 0x11D46 },
+  { 0x11D48, 0x11D8F },
+  { 0x11D92, 0x11D94 },
+  { 0x11D96, 0x11D96 },
+  { 0x11D98, 0x11EF2 },
+  { 0x11EF5, 0x11FD4 },
+  { 0x11FF2, 0x16AEF },
+  { 0x16AF5, 0x16B2F },
+  { 0x16B37, 0x16F4E },
+  { 0x16F50, 0x16F8E },
+  { 0x16F93, 0x16FE1 },
+  { 0x16FE3, 0x16FE3 },
+  { 0x16FE5, 0x1BC9C },
+  { 0x1BC9F, 0x1BC9F },
+  { 0x1BCA4, 0x1CEFF },
+  { 0x1CF2E, 0x1CF2F },
+  { 0x1CF47, 0x1D166 },
+  { 0x1D16A, 0x1D172 },
+  { 0x1D183, 0x1D184 },
+  { 0x1D18C, 0x1D1A9 },
+  { 0x1D1AE, 0x1D1E8 },
+  { 0x1D1EB, 0x1D1FF },
+  { 0x1D246, 0x1D2FF },
+  { 0x1D357, 0x1D7CD },
+  { 0x1D800, 0x1D9FF },
+  { 0x1DA37, 0x1DA3A },
+  { 0x1DA6D, 0x1DA74 },
+  { 0x1DA76, 0x1DA83 },
+  { 0x1DA85, 0x1DA9A },
+  { 0x1DAA0, 0x1DAA0 },
+  { 0x1DAB0, 0x1DFFF },
+  { 0x1E007, 0x1E007 },
+  { 0x1E019, 0x1E01A },
+  { 0x1E022, 0x1E022 },
+  { 0x1E025, 0x1E025 },
+  { 0x1E02B, 0x1E12F },
+  { 0x1E137, 0x1E2AD },
+  { 0x1E2AF, 0x1E2EB },
+  { 0x1E2F0, 0x1E2FE },
+  { 0x1E300, 0x1E7FF },
+  { 0x1F02C, 0x1F02F },
+  { 0x1F094, 0x1F09F },
+  { 0x1F0AF, 0x1F0B0 },
+  { 0x1F0C0, 0x1F0C0 },
+  { 0x1F0D0, 0x1F0D0 },
+  { 0x1F0F6, 0x1F0FF },
+  { 0x1F110, 0x1F12E },
+  { 0x1F130, 0x1F169 },
+  { 0x1F170, 0x1F1AC },
+  { 0x1F1AE, 0x1F25F },
+  { 0x1F266, 0x1F2FF },
+  { 0x1F6D8, 0x1F6DC },
+  { 0x1F6ED, 0x1F6EF },
+  { 0x1F6FD, 0x1F6FF },
+  { 0x1F774, 0x1F77F },
+  { 0x1F7D9, 0x1F7DF },
+  { 0x1F7EC, 0x1F7EF },
+  { 0x1F7F1, 0x1F7FF },
+  { 0x1F80C, 0x1F80F },
+  { 0x1F848, 0x1F84F },
+  { 0x1F85A, 0x1F85F },
+  { 0x1F888, 0x1F88F },
+  { 0x1F8AE, 0x1F8AF },
+  { 0x1F8B2, 0x1F8FF },
+  { 0x1FA54, 0x1FA5F },
+  { 0x1FA6E, 0x1FA6F },
+  { 0x1FA75, 0x1FA77 },
+  { 0x1FA7D, 0x1FA7F },
+  { 0x1FA87, 0x1FA8F },
+  { 0x1FAAD, 0x1FAAF },
+  { 0x1FABB, 0x1FABF },
+  { 0x1FAC6, 0x1FACF },
+  { 0x1FADA, 0x1FADF },
+  { 0x1FAE8, 0x1FAEF },
+  { 0x1FAF7, 0x1FAFF },
+  { 0x1FB93, 0x1FB93 },
+  { 0x1FBCB, 0x1FBEF },
+  { 0x1FBFA, 0x1FFFD },
+  { 0x20000, 0x2FFFD },
+  { 0x30000, 0x3FFFD },
+  { 0x40000, 0x4FFFD },
+  { 0x50000, 0x5FFFD },
+  { 0x60000, 0x6FFFD },
+  { 0x70000, 0x7FFFD },
+  { 0x80000, 0x8FFFD },
+  { 0x90000, 0x9FFFD },
+  { 0xA0000, 0xAFFFD },
+  { 0xB0000, 0xBFFFD },
+  { 0xC0000, 0xCFFFD },
+  { 0xD0000, 0xDFFFD },
+  { 0xE1000, 0xEFFFD },
+  { 0xF0000, 0xFFFFD },
+  { 0x100000, 0x10FFFD },
+};
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_IDNA_TABLES_H__
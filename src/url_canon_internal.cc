@@ -32,30 +32,58 @@
 #include <stdlib.h>
 #include <string>
 
+#include "googleurl/src/url_canon_char_class.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
+
+// Defines kCharClassTable.
+#include "googleurl/src/url_canon_char_class_tables.h"
 
 namespace url_canon {
 
 namespace {
 
+// Returns the vector-scannable form of the given character type, or NULL if
+// it has too many holes to be worth scanning that way. Only the query type is
+// large enough to matter; user info and components are short or rare.
+const CopyableCharSet* CopyableCharSetForType(SharedCharTypes type) {
+  if (type == CHAR_QUERY)
+    return &kQueryCopyableChars;
+  return NULL;
+}
+
 template<typename CHAR, typename UCHAR>
 void DoAppendStringOfType(const CHAR* source, int length,
                           SharedCharTypes type,
                           CanonOutput* output) {
+  const CopyableCharSet* copyable = CopyableCharSetForType(type);
   for (int i = 0; i < length; i++) {
+    if (copyable) {
+      // Copy the run of characters that don't need escaping in one shot.
+      int run = CountCopyableChars(&source[i], length - i, *copyable);
+      AppendCopyableRun(&source[i], run, output);
+      i += run;
+      if (i == length)
+        break;
+    }
+
     if (static_cast<UCHAR>(source[i]) >= 0x80) {
       // ReadChar will fill the code point with kUnicodeReplacementCharacter
       // when the input is invalid, which is what we want.
       unsigned code_point;
       ReadUTFChar(source, &i, length, &code_point);
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendUTF8EscapedValue(code_point, output);
     } else {
       // Just append the 7-bit character, possibly escaping it.
       unsigned char uch = static_cast<unsigned char>(source[i]);
-      if (!IsCharOfType(uch, type))
+      if (!IsCharOfType(uch, type)) {
+        GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
         AppendEscapedChar(uch, output);
-      else
+      } else {
         output->push_back(uch);
+      }
     }
   }
 }
@@ -70,11 +98,13 @@ void DoAppendInvalidNarrowString(const CHAR* spec, int begin, int end,
     if (uch >= 0x80) {
       // Handle UTF-8/16 encodings. This call will correctly handle the error
       // case by appending the invalid character.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendUTF8EscapedChar(spec, &i, end, output);
     } else if (uch <= ' ' || uch == 0x7f) {
       // This function is for error handling, so we escape all control
       // characters and spaces, but not anything else since we lack
       // context to do something more specific.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendEscapedChar(static_cast<unsigned char>(uch), output);
     } else {
       output->push_back(static_cast<char>(uch));
@@ -127,6 +157,14 @@ bool PrepareUTF16OverrideComponent(
   return success;
 }
 
+// Returns true if |c| is a Unicode scalar value that is not a noncharacter.
+// This is the same test as ICU's U_IS_UNICODE_CHAR.
+inline bool IsUnicodeChar(unsigned c) {
+  return c < 0xD800 ||
+         (c > 0xDFFF && c <= 0x10FFFF && !(c >= 0xFDD0 && c <= 0xFDEF) &&
+          (c & 0xFFFE) != 0xFFFE);
+}
+
 }  // namespace
 
 // See the header file for this array's declaration.
@@ -239,6 +277,9 @@ const unsigned char kSharedCharTypeTable[0x100] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xf0 - 0xff
 };
 
+// This must match the CHAR_QUERY entries in the table above.
+const CopyableCharSet kQueryCopyableChars = { 0x21, 0x7e, "\"#<>" };
+
 const char kHexCharLookup[0x10] = {
     '0', '1', '2', '3', '4', '5', '6', '7',
     '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
@@ -257,6 +298,96 @@ const char kCharToHexLookup[8] = {
 
 const char16 kUnicodeReplacementCharacter = 0xfffd;
 
+bool ReadUTFChar(const char* str, int* begin, int length,
+                 unsigned* code_point_out) {
+  // Decodes one character, consuming the maximal valid prefix of an
+  // ill-formed sequence the same way ICU's U8_NEXT does. |*begin| is left on
+  // the last byte consumed.
+  unsigned char lead = static_cast<unsigned char>(str[*begin]);
+  if (lead < 0x80) {
+    *code_point_out = lead;
+    return true;
+  }
+
+  int trail_count;
+  unsigned code_point;
+  unsigned char trail_min = 0x80;
+  unsigned char trail_max = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    trail_count = 1;
+    code_point = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    trail_count = 2;
+    code_point = lead & 0x0F;
+    if (lead == 0xE0)
+      trail_min = 0xA0;  // Overlong.
+    else if (lead == 0xED)
+      trail_max = 0x9F;  // Surrogates.
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    trail_count = 3;
+    code_point = lead & 0x07;
+    if (lead == 0xF0)
+      trail_min = 0x90;  // Overlong.
+    else if (lead == 0xF4)
+      trail_max = 0x8F;  // Above U+10FFFF.
+  } else {
+    // Stray trail byte, overlong two-byte lead, or out-of-range lead.
+    *code_point_out = kUnicodeReplacementCharacter;
+    return false;
+  }
+
+  for (int i = 0; i < trail_count; i++) {
+    if (*begin + 1 >= length) {
+      *code_point_out = kUnicodeReplacementCharacter;
+      return false;
+    }
+    unsigned char trail = static_cast<unsigned char>(str[*begin + 1]);
+    if (trail < trail_min || trail > trail_max) {
+      *code_point_out = kUnicodeReplacementCharacter;
+      return false;
+    }
+    trail_min = 0x80;
+    trail_max = 0xBF;
+    code_point = (code_point << 6) | (trail & 0x3F);
+    (*begin)++;
+  }
+
+  if (IsUnicodeChar(code_point)) {
+    *code_point_out = code_point;
+    return true;
+  }
+  *code_point_out = kUnicodeReplacementCharacter;
+  return false;
+}
+
+bool ReadUTFChar(const char16* str, int* begin, int length,
+                 unsigned* code_point) {
+  char16 c = str[*begin];
+  if ((c & 0xF800) == 0xD800) {
+    if ((c & 0x400) != 0 || *begin + 1 >= length ||
+        (str[*begin + 1] & 0xFC00) != 0xDC00) {
+      // Invalid surrogate pair.
+      *code_point = kUnicodeReplacementCharacter;
+      return false;
+    } else {
+      // Valid surrogate pair.
+      *code_point = (static_cast<unsigned>(c) << 10) + str[*begin + 1] -
+                    ((0xD800 << 10) + 0xDC00 - 0x10000);
+      (*begin)++;
+    }
+  } else {
+    // Not a surrogate, just one 16-bit word.
+    *code_point = c;
+  }
+
+  if (IsUnicodeChar(*code_point))
+    return true;
+
+  // Invalid code point.
+  *code_point = kUnicodeReplacementCharacter;
+  return false;
+}
+
 void AppendStringOfType(const char* source, int length,
                         SharedCharTypes type,
                         CanonOutput* output) {
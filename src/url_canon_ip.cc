@@ -33,6 +33,7 @@
 
 #include "base/basictypes.h"
 #include "base/logging.h"
+#include "googleurl/src/url_canon_host_classify.h"
 #include "googleurl/src/url_canon_internal.h"
 
 namespace url_canon {
@@ -181,12 +182,55 @@ CanonHostInfo::Family IPv4ComponentToNumber(
   return CanonHostInfo::IPV4;
 }
 
+// Parses the canonical form of an IPv4 address, four decimal components from
+// 0 to 255 with no leading zeros, in a single pass. This is how nearly every
+// IPv4 host is written. Returns false for anything else, including valid
+// addresses in other forms, which the general parser below handles.
+template<typename CHAR>
+bool DoParseDottedQuad(const CHAR* spec,
+                       const url_parse::Component& host,
+                       unsigned char address[4]) {
+  // "0.0.0.0" to "255.255.255.255".
+  if (host.len < 7 || host.len > 15)
+    return false;
+
+  int component = 0;
+  int digits = 0;
+  unsigned value = 0;
+  for (int i = host.begin; i < host.end(); i++) {
+    unsigned digit = static_cast<unsigned>(spec[i]) - '0';
+    if (digit <= 9) {
+      if (digits == 1 && value == 0)
+        return false;  // A leading zero means octal.
+      value = value * 10 + digit;
+      if (++digits > 3)
+        return false;
+    } else if (spec[i] == '.' && digits > 0 && value <= 255 &&
+               component < 3) {
+      address[component++] = static_cast<unsigned char>(value);
+      digits = 0;
+      value = 0;
+    } else {
+      return false;
+    }
+  }
+  if (component != 3 || digits == 0 || value > 255)
+    return false;
+  address[3] = static_cast<unsigned char>(value);
+  return true;
+}
+
 // See declaration of IPv4AddressToNumber for documentation.
 template<typename CHAR>
 CanonHostInfo::Family DoIPv4AddressToNumber(const CHAR* spec,
                                             const url_parse::Component& host,
                                             unsigned char address[4],
                                             int* num_ipv4_components) {
+  if (DoParseDottedQuad(spec, host, address)) {
+    *num_ipv4_components = 4;
+    return CanonHostInfo::IPV4;
+  }
+
   // The identified components. Not all may exist.
   url_parse::Component components[4];
   if (!FindIPv4Components(spec, host, components))
@@ -613,15 +657,50 @@ bool DoCanonicalizeIPv6Address(const CHAR* spec,
   return true;
 }
 
+template<typename CHAR, typename UCHAR>
+bool DoClassifyHost(const CHAR* spec,
+                    const url_parse::Component& host,
+                    CanonHostInfo* host_info) {
+  if (!host.is_nonempty())
+    return false;
+
+  // Only the characters of an IP literal may appear. Everything else needs
+  // the host canonicalized first, and only IPv6 literals have the rest.
+  bool has_ipv6_chars = false;
+  for (int i = host.begin; i < host.end(); i++) {
+    UCHAR ch = static_cast<UCHAR>(spec[i]);
+    if (ch == '[' || ch == ']' || ch == ':')
+      has_ipv6_chars = true;
+    else if (ch >= 0x80 || !IsIPv4Char(static_cast<unsigned char>(ch)))
+      return false;
+  }
+
+  if (!has_ipv6_chars) {
+    host_info->family = DoIPv4AddressToNumber<CHAR>(
+        spec, host, host_info->address, &host_info->num_ipv4_components);
+    return true;
+  }
+
+  // Same as DoCanonicalizeIPv6Address: anything with these characters that
+  // isn't an IPv6 address is broken.
+  if (DoIPv6AddressToNumber<CHAR, UCHAR>(spec, host, host_info->address))
+    host_info->family = CanonHostInfo::IPV6;
+  else
+    host_info->family = CanonHostInfo::BROKEN;
+  return true;
+}
+
 }  // namespace
 
 void AppendIPv4Address(const unsigned char address[4], CanonOutput* output) {
   for (int i = 0; i < 4; i++) {
-    char str[16];
-    _itoa_s(address[i], str, 10);
-
-    for (int ch = 0; str[ch] != 0; ch++)
-      output->push_back(str[ch]);
+    // At most three digits, so there's no need for _itoa_s.
+    int value = address[i];
+    if (value >= 100)
+      output->push_back(static_cast<char>('0' + value / 100));
+    if (value >= 10)
+      output->push_back(static_cast<char>('0' + value / 10 % 10));
+    output->push_back(static_cast<char>('0' + value % 10));
 
     if (i != 3)
       output->push_back('.');
@@ -700,6 +779,18 @@ void CanonicalizeIPAddress(const char16* spec,
     return;
 }
 
+bool ClassifyHost(const char* spec,
+                  const url_parse::Component& host,
+                  CanonHostInfo* host_info) {
+  return DoClassifyHost<char, unsigned char>(spec, host, host_info);
+}
+
+bool ClassifyHost(const char16* spec,
+                  const url_parse::Component& host,
+                  CanonHostInfo* host_info) {
+  return DoClassifyHost<char16, char16>(spec, host, host_info);
+}
+
 CanonHostInfo::Family IPv4AddressToNumber(const char* spec,
                                           const url_parse::Component& host,
                                           unsigned char address[4],
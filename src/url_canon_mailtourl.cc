@@ -31,6 +31,7 @@
 
 #include "googleurl/src/url_canon.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_stats.h"
 #include "googleurl/src/url_file.h"
 #include "googleurl/src/url_parse_internal.h"
 
@@ -70,10 +71,12 @@ bool DoCanonicalizeMailtoURL(const URLComponentSource<CHAR>& source,
     int end = parsed.path.end();
     for (int i = parsed.path.begin; i < end; ++i) {
       UCHAR uch = static_cast<UCHAR>(source.path[i]);
-      if (uch < 0x20 || uch >= 0x80)
+      if (uch < 0x20 || uch >= 0x80) {
+        GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
         success &= AppendUTF8EscapedChar(source.path, &i, end, output);
-      else
+      } else {
         output->push_back(static_cast<char>(uch));
+      }
     }
 
     new_parsed->path.len = output->length() - new_parsed->path.begin;
@@ -31,6 +31,8 @@
 #include "base/logging.h"
 #include "googleurl/src/url_canon.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 #include "googleurl/src/url_parse_internal.h"
 
 namespace url_canon {
@@ -101,6 +103,49 @@ const unsigned char kPathCharLookup[0x100] = {
      ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,
      ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE};
 
+// The characters in kPathCharLookup without the SPECIAL bit. These are copied
+// unchanged by DoPartialPath and can be handled a run at a time.
+const CopyableCharSet kPathCopyableChars = { 0x21, 0x7e, "\"#%.<>?\\^`{|}" };
+
+// kPathCopyableChars plus the dot, which is only special at the beginning of
+// a path segment.
+const CopyableCharSet kPathCopyableCharsAndDot =
+    { 0x21, 0x7e, "\"#%<>?\\^`{|}" };
+
+// Returns the index of the first dot in the first |len| characters of
+// |input|, or |len| if there is none.
+inline int FindDot(const char* input, int len) {
+  return FindChar(input, len, '.');
+}
+inline int FindDot(const char16* input, int len) {
+  for (int i = 0; i < len; i++) {
+    if (input[i] == '.')
+      return i;
+  }
+  return len;
+}
+
+// Returns true if DoPartialPath would copy the |len| characters of |path| to
+// the output unchanged: they're all copyable, and none of the dots make a
+// "." or ".." segment. A dot at the very beginning is treated as a segment
+// since it depends on what was already written.
+template<typename CHAR>
+bool IsCopyablePath(const CHAR* path, int len) {
+  if (CountCopyableChars(path, len, kPathCopyableCharsAndDot) != len)
+    return false;
+  for (int i = FindDot(path, len); i < len;
+       i += 1 + FindDot(&path[i + 1], len - i - 1)) {
+    if (i > 0 && path[i - 1] != '/')
+      continue;  // Part of a file name.
+    int after = i + 1;
+    if (after < len && path[after] == '.')
+      after++;
+    if (after == len || path[after] == '/')
+      return false;
+  }
+  return true;
+}
+
 enum DotDisposition {
   // The given dot is just part of a filename and is not special.
   NOT_A_DIRECTORY,
@@ -206,10 +251,24 @@ bool DoPartialPath(const CHAR* spec,
                    const url_parse::Component& path,
                    int path_begin_in_output,
                    CanonOutput* output) {
+  // Most paths have nothing to resolve, escape or unescape, and are copied in
+  // one go.
+  if (IsCopyablePath(&spec[path.begin], path.len)) {
+    AppendCopyableRun(&spec[path.begin], path.len, output);
+    return true;
+  }
+
   int end = path.end();
 
   bool success = true;
   for (int i = path.begin; i < end; i++) {
+    // Copy the run of characters that need no special handling in one shot.
+    int run = CountCopyableChars(&spec[i], end - i, kPathCopyableChars);
+    AppendCopyableRun(&spec[i], run, output);
+    i += run;
+    if (i == end)
+      break;
+
     UCHAR uch = static_cast<UCHAR>(spec[i]);
     if (sizeof(CHAR) > sizeof(char) && uch >= 0x80) {
       // We only need to test wide input for having non-ASCII characters. For
@@ -217,6 +276,7 @@ bool DoPartialPath(const CHAR* spec,
       // do anything tricky with decoding/validating UTF-8. This function will
       // read one or two UTF-16 characters and append the output as UTF-8. This
       // call will be removed in 8-bit mode.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       success &= AppendUTF8EscapedChar(spec, &i, end, output);
     } else {
       // Normal ASCII character or 8-bit input, use the lookup table.
@@ -248,9 +308,11 @@ bool DoPartialPath(const CHAR* spec,
                 i += dotlen - 1;
                 break;
               case DIRECTORY_CUR:  // Current directory, just skip the input.
+                GURL_CANON_STAT(CANON_STAT_DOT_SEGMENTS);
                 i += dotlen + consumed_len - 1;
                 break;
               case DIRECTORY_UP:
+                GURL_CANON_STAT(CANON_STAT_DOT_SEGMENTS);
                 BackUpToPreviousSlash(path_begin_in_output, output);
                 i += dotlen + consumed_len - 1;
                 break;
@@ -303,11 +365,13 @@ bool DoPartialPath(const CHAR* spec,
 
         } else if (flags & INVALID_BIT) {
           // For NULLs, etc. fail.
+          GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
           AppendEscapedChar(out_ch, output);
           success = false;
 
         } else if (flags & ESCAPE_BIT) {
           // This character should be escaped.
+          GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
           AppendEscapedChar(out_ch, output);
         }
       } else {
@@ -33,11 +33,16 @@
 
 #include "googleurl/src/url_canon.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 
 namespace url_canon {
 
 namespace {
 
+// The characters path URLs keep as they are: all of printable ASCII.
+const CopyableCharSet kPathURLCopyableChars = { 0x20, 0x7f, "" };
+
 template<typename CHAR, typename UCHAR>
 bool DoCanonicalizePathURL(const URLComponentSource<CHAR>& source,
                            const url_parse::Parsed& parsed,
@@ -61,11 +66,17 @@ bool DoCanonicalizePathURL(const URLComponentSource<CHAR>& source,
     new_parsed->path.begin = output->length();
     int end = parsed.path.end();
     for (int i = parsed.path.begin; i < end; i++) {
-      UCHAR uch = static_cast<UCHAR>(source.path[i]);
-      if (uch < 0x20 || uch >= 0x80)
-        success &= AppendUTF8EscapedChar(source.path, &i, end, output);
-      else
-        output->push_back(static_cast<char>(uch));
+      // Inline data: URLs can be megabytes of copyable text; take it in runs.
+      int run = CountCopyableChars(&source.path[i], end - i,
+                                   kPathURLCopyableChars);
+      AppendCopyableRun(&source.path[i], run, output);
+      i += run;
+      if (i == end)
+        break;
+
+      // Anything after the run is a control or non-ASCII character.
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
+      success &= AppendUTF8EscapedChar(source.path, &i, end, output);
     }
     new_parsed->path.len = output->length() - new_parsed->path.begin;
   } else {
@@ -27,8 +27,19 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#ifdef WIN32
+#include <windows.h>
+#endif
+#include <string.h>
+
+#include <algorithm>
+
 #include "googleurl/src/url_canon.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_query_converter.h"
+#include "googleurl/src/url_canon_query_policy.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 
 // Query canonicalization in IE
 // ----------------------------
@@ -64,16 +75,37 @@ namespace url_canon {
 
 namespace {
 
+// See SetUTF8QueryConverter. It's only ever one function or NULL, so reading
+// a stale value on another thread is harmless, but the reads and writes
+// still have to be atomic. Use LoadUTF8QueryConverter and
+// StoreUTF8QueryConverter.
+UTF8QueryConverter utf8_query_converter = NULL;
+
+#ifdef WIN32
+// On Windows, reads of volatile variables have acquire semantics and the
+// Interlocked functions are full barriers.
+inline UTF8QueryConverter LoadUTF8QueryConverter() {
+  return *static_cast<UTF8QueryConverter volatile*>(&utf8_query_converter);
+}
+inline void StoreUTF8QueryConverter(UTF8QueryConverter converter) {
+  InterlockedExchangePointer(
+      reinterpret_cast<PVOID volatile*>(&utf8_query_converter),
+      reinterpret_cast<PVOID>(converter));
+}
+#else
+inline UTF8QueryConverter LoadUTF8QueryConverter() {
+  return __atomic_load_n(&utf8_query_converter, __ATOMIC_ACQUIRE);
+}
+inline void StoreUTF8QueryConverter(UTF8QueryConverter converter) {
+  __atomic_store_n(&utf8_query_converter, converter, __ATOMIC_RELEASE);
+}
+#endif
+
 // Returns true if the characters starting at |begin| and going until |end|
 // (non-inclusive) are all representable in 7-bits.
 template<typename CHAR, typename UCHAR>
 bool IsAllASCII(const CHAR* spec, const url_parse::Component& query) {
-  int end = query.end();
-  for (int i = query.begin; i < end; i++) {
-    if (static_cast<UCHAR>(spec[i]) >= 0x80)
-      return false;
-  }
-  return true;
+  return CountASCIIChars(&spec[query.begin], query.len) == query.len;
 }
 
 // Appends the given string to the output, escaping characters that do not
@@ -84,19 +116,34 @@ template<typename CHAR>
 void AppendRaw8BitQueryString(const CHAR* source, int length,
                               CanonOutput* output) {
   for (int i = 0; i < length; i++) {
-    if (!IsQueryChar(static_cast<unsigned char>(source[i])))
+    // Copy the run of characters that don't need escaping in one shot.
+    int run = CountCopyableChars(&source[i], length - i, kQueryCopyableChars);
+    AppendCopyableRun(&source[i], run, output);
+    i += run;
+    if (i == length)
+      break;
+
+    if (!IsQueryChar(static_cast<unsigned char>(source[i]))) {
+      GURL_CANON_STAT(CANON_STAT_ESCAPED_CHARS);
       AppendEscapedChar(static_cast<unsigned char>(source[i]), output);
-    else  // Doesn't need escaping.
+    } else {  // Doesn't need escaping.
       output->push_back(static_cast<char>(source[i]));
+    }
   }
 }
 
 // Runs the converter on the given UTF-8 input. Since the converter expects
-// UTF-16, we have to convert first. The converter must be non-NULL.
+// UTF-16, we have to convert first, unless the installed UTF-8 hook takes
+// it. The converter must be non-NULL.
 void RunConverter(const char* spec,
                   const url_parse::Component& query,
                   CharsetConverter* converter,
                   CanonOutput* output) {
+  UTF8QueryConverter utf8_converter = LoadUTF8QueryConverter();
+  if (utf8_converter &&
+      utf8_converter(converter, &spec[query.begin], query.len, output))
+    return;
+
   // This function will replace any misencoded values with the invalid
   // character. This is what we want so we don't have to check for error.
   RawCanonOutputW<1024> utf16;
@@ -128,6 +175,7 @@ void DoConvertToQueryEncoding(const CHAR* spec,
     if (converter) {
       // Run the converter to get an 8-bit string, then append it, escaping
       // necessary values.
+      GURL_CANON_STAT(CANON_STAT_CHARSET_CONVERSIONS);
       RawCanonOutput<1024> eight_bit;
       RunConverter(spec, query, converter, &eight_bit);
       AppendRaw8BitQueryString(eight_bit.data(), eight_bit.length(), output);
@@ -139,10 +187,116 @@ void DoConvertToQueryEncoding(const CHAR* spec,
   }
 }
 
+// One key/value pair of a canonical query, as offsets into it.
+struct QueryPair {
+  int begin;
+  int key_len;
+  int len;  // The whole pair, including any '=' and value.
+};
+
+// Orders pairs by key, byte for byte.
+class QueryPairKeyLess {
+ public:
+  explicit QueryPairKeyLess(const char* query) : query_(query) {}
+
+  bool operator()(const QueryPair& a, const QueryPair& b) const {
+    int common = std::min(a.key_len, b.key_len);
+    int cmp = memcmp(&query_[a.begin], &query_[b.begin], common);
+    if (cmp != 0)
+      return cmp < 0;
+    return a.key_len < b.key_len;
+  }
+
+ private:
+  const char* query_;
+};
+
+// Sorts |pairs| by key, keeping pairs with equal keys in order. Queries
+// rarely have more than a handful of pairs, so an insertion sort does the
+// common case without the temporary buffer std::stable_sort allocates.
+void SortQueryPairs(const char* query, QueryPair* pairs, int num_pairs) {
+  QueryPairKeyLess less(query);
+  const int kMaxInsertionSort = 16;
+  if (num_pairs > kMaxInsertionSort) {
+    std::stable_sort(pairs, pairs + num_pairs, less);
+    return;
+  }
+  for (int i = 1; i < num_pairs; i++) {
+    QueryPair pair = pairs[i];
+    int j = i;
+    for (; j > 0 && less(pair, pairs[j - 1]); j--)
+      pairs[j] = pairs[j - 1];
+    pairs[j] = pair;
+  }
+}
+
+bool HasEqualPair(const char* query, const QueryPair* pairs, int num_pairs,
+                  const QueryPair& pair) {
+  for (int i = 0; i < num_pairs; i++) {
+    if (pairs[i].len == pair.len &&
+        memcmp(&query[pairs[i].begin], &query[pair.begin], pair.len) == 0)
+      return true;
+  }
+  return false;
+}
+
+// Writes the canonical |query| to |output| rewritten according to |policy|,
+// preceded by a '?' unless no pairs are left.
+void AppendNormalizedQuery(const char* query, int query_len,
+                           const QueryNormalizationPolicy& policy,
+                           CanonOutput* output,
+                           url_parse::Component* out_query) {
+  RawCanonOutputT<QueryPair, 32> pairs;
+  int begin = 0;
+  while (begin < query_len) {
+    // Pairs are short, so one scalar pass for both separators beats
+    // starting a vector scan for each.
+    QueryPair pair;
+    pair.begin = begin;
+    pair.key_len = -1;
+    int cur = begin;
+    for (; cur < query_len && query[cur] != '&'; cur++) {
+      if (query[cur] == '=' && pair.key_len < 0)
+        pair.key_len = cur - begin;
+    }
+    pair.len = cur - begin;
+    if (pair.key_len < 0)
+      pair.key_len = pair.len;
+    begin = cur + 1;
+
+    if (policy.collapse_empty_values() && pair.key_len == pair.len - 1)
+      pair.len = pair.key_len;
+    if (pair.len == 0 ||
+        policy.IsRemovedKey(&query[pair.begin], pair.key_len))
+      continue;
+    if (policy.remove_duplicates() &&
+        HasEqualPair(query, pairs.data(), pairs.length(), pair))
+      continue;
+    pairs.push_back(pair);
+  }
+
+  if (pairs.length() == 0) {
+    *out_query = url_parse::Component();
+    return;
+  }
+  if (policy.sort_keys())
+    SortQueryPairs(query, pairs.data(), pairs.length());
+
+  output->push_back('?');
+  out_query->begin = output->length();
+  for (int i = 0; i < pairs.length(); i++) {
+    if (i > 0)
+      output->push_back('&');
+    output->Append(&query[pairs.at(i).begin], pairs.at(i).len);
+  }
+  out_query->len = output->length() - out_query->begin;
+}
+
 template<typename CHAR, typename UCHAR>
 void DoCanonicalizeQuery(const CHAR* spec,
                          const url_parse::Component& query,
                          CharsetConverter* converter,
+                         const QueryNormalizationPolicy* policy,
                          CanonOutput* output,
                          url_parse::Component* out_query) {
   if (query.len < 0) {
@@ -150,6 +304,17 @@ void DoCanonicalizeQuery(const CHAR* spec,
     return;
   }
 
+  if (policy) {
+    // The pairs can only be compared once they are canonical, so the query
+    // is canonicalized to the side and then copied out pair by pair.
+    RawCanonOutput<1024> canon_query;
+    DoConvertToQueryEncoding<CHAR, UCHAR>(spec, query, converter,
+                                          &canon_query);
+    AppendNormalizedQuery(canon_query.data(), canon_query.length(), *policy,
+                          output, out_query);
+    return;
+  }
+
   output->push_back('?');
   out_query->begin = output->length();
 
@@ -160,12 +325,47 @@ void DoCanonicalizeQuery(const CHAR* spec,
 
 }  // namespace
 
+QueryNormalizationPolicy::QueryNormalizationPolicy()
+    : sort_keys_(false),
+      collapse_empty_values_(false),
+      remove_duplicates_(false) {
+}
+
+QueryNormalizationPolicy::~QueryNormalizationPolicy() {
+}
+
+void QueryNormalizationPolicy::AddRemovedKey(const std::string& key) {
+  removed_keys_.push_back(key);
+}
+
+void QueryNormalizationPolicy::AddRemovedKeyPrefix(
+    const std::string& prefix) {
+  removed_key_prefixes_.push_back(prefix);
+}
+
+bool QueryNormalizationPolicy::IsRemovedKey(const char* key,
+                                            int key_len) const {
+  for (size_t i = 0; i < removed_keys_.size(); i++) {
+    const std::string& removed = removed_keys_[i];
+    if (static_cast<int>(removed.size()) == key_len &&
+        memcmp(removed.data(), key, key_len) == 0)
+      return true;
+  }
+  for (size_t i = 0; i < removed_key_prefixes_.size(); i++) {
+    const std::string& prefix = removed_key_prefixes_[i];
+    if (static_cast<int>(prefix.size()) <= key_len &&
+        memcmp(prefix.data(), key, prefix.size()) == 0)
+      return true;
+  }
+  return false;
+}
+
 void CanonicalizeQuery(const char* spec,
                        const url_parse::Component& query,
                        CharsetConverter* converter,
                        CanonOutput* output,
                        url_parse::Component* out_query) {
-  DoCanonicalizeQuery<char, unsigned char>(spec, query, converter,
+  DoCanonicalizeQuery<char, unsigned char>(spec, query, converter, NULL,
                                            output, out_query);
 }
 
@@ -174,7 +374,27 @@ void CanonicalizeQuery(const char16* spec,
                        CharsetConverter* converter,
                        CanonOutput* output,
                        url_parse::Component* out_query) {
-  DoCanonicalizeQuery<char16, char16>(spec, query, converter,
+  DoCanonicalizeQuery<char16, char16>(spec, query, converter, NULL,
+                                      output, out_query);
+}
+
+void CanonicalizeQueryWithPolicy(const char* spec,
+                                 const url_parse::Component& query,
+                                 CharsetConverter* converter,
+                                 const QueryNormalizationPolicy& policy,
+                                 CanonOutput* output,
+                                 url_parse::Component* out_query) {
+  DoCanonicalizeQuery<char, unsigned char>(spec, query, converter, &policy,
+                                           output, out_query);
+}
+
+void CanonicalizeQueryWithPolicy(const char16* spec,
+                                 const url_parse::Component& query,
+                                 CharsetConverter* converter,
+                                 const QueryNormalizationPolicy& policy,
+                                 CanonOutput* output,
+                                 url_parse::Component* out_query) {
+  DoCanonicalizeQuery<char16, char16>(spec, query, converter, &policy,
                                       output, out_query);
 }
 
@@ -186,4 +406,13 @@ void ConvertUTF16ToQueryEncoding(const char16* input,
                                            converter, output);
 }
 
+void SetUTF8QueryConverter(UTF8QueryConverter converter) {
+  UTF8QueryConverter current = LoadUTF8QueryConverter();
+  DCHECK(!converter || !current || current == converter);
+  // The pool installs it every time it hands out a single-byte converter,
+  // so don't write the shared variable when nothing changes.
+  if (current != converter)
+    StoreUTF8QueryConverter(converter);
+}
+
 }  // namespace url_canon
@@ -0,0 +1,59 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A hook that lets a charset converter take UTF-8 query input directly.
+// CharsetConverter only takes UTF-16, so the query canonicalizer converts
+// 8-bit input to UTF-16 before running it. Converters that can do better,
+// like the single-byte ones from the ICU converter pool, install a hook here
+// and the canonicalizer offers them the UTF-8 first. Without a hook the
+// canonicalizer doesn't depend on any particular converter.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_QUERY_CONVERTER_H__
+#define GOOGLEURL_SRC_URL_CANON_QUERY_CONVERTER_H__
+
+#include "googleurl/src/url_canon.h"
+
+namespace url_canon {
+
+// Converts the UTF-8 |input| with |converter| for the query encoding,
+// appending the result to |output| and returning true, when it knows how.
+// Otherwise it writes nothing and returns false, and the input goes through
+// UTF-16 as usual. It must give the same output as ConvertFromUTF16 would.
+typedef bool (*UTF8QueryConverter)(CharsetConverter* converter,
+                                   const char* input,
+                                   int input_len,
+                                   CanonOutput* output);
+
+// Sets the hook for every thread. There's only one, so installing it again
+// has to install the same function; NULL removes it.
+void SetUTF8QueryConverter(UTF8QueryConverter converter);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_QUERY_CONVERTER_H__
@@ -0,0 +1,130 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Optional normalization of query strings while they are canonicalized. Cache
+// keys and duplicate detection often want "?b=2&a=1&utm_source=x" and
+// "?a=1&b=2" to be the same URL. Doing that after the fact means splitting
+// GURL::query(), rebuilding it and canonicalizing the whole URL a second
+// time. A QueryNormalizationPolicy passed to the canonicalizer does it as the
+// query is written.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_QUERY_POLICY_H__
+#define GOOGLEURL_SRC_URL_CANON_QUERY_POLICY_H__
+
+#include <string>
+#include <vector>
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_canon {
+
+// Says how to rewrite the key/value pairs of a query. Pairs are separated by
+// '&' and a key ends at the first '='. Keys and values are compared in their
+// canonical, escaped form, byte for byte, so "a%62" and "ab" are different
+// keys. Whatever the settings, empty pairs ("a&&b") are dropped, and a query
+// left with no pairs is removed along with its '?'.
+class GURL_API QueryNormalizationPolicy {
+ public:
+  // The default policy changes nothing except for dropping empty pairs.
+  QueryNormalizationPolicy();
+  ~QueryNormalizationPolicy();
+
+  // Sorts the pairs by key. The sort is stable, so pairs with the same key
+  // keep their order, which can be significant to the server.
+  bool sort_keys() const { return sort_keys_; }
+  void set_sort_keys(bool sort_keys) { sort_keys_ = sort_keys; }
+
+  // Writes "a=" as "a".
+  bool collapse_empty_values() const { return collapse_empty_values_; }
+  void set_collapse_empty_values(bool collapse) {
+    collapse_empty_values_ = collapse;
+  }
+
+  // Drops pairs that are identical to an earlier one (after collapsing).
+  bool remove_duplicates() const { return remove_duplicates_; }
+  void set_remove_duplicates(bool remove) { remove_duplicates_ = remove; }
+
+  // Drops every pair whose key is |key|, or starts with |prefix|, like
+  // "utm_" for analytics tracking parameters.
+  void AddRemovedKey(const std::string& key);
+  void AddRemovedKeyPrefix(const std::string& prefix);
+
+  // Returns true if pairs with the given canonical key are dropped.
+  bool IsRemovedKey(const char* key, int key_len) const;
+
+ private:
+  bool sort_keys_;
+  bool collapse_empty_values_;
+  bool remove_duplicates_;
+  std::vector<std::string> removed_keys_;
+  std::vector<std::string> removed_key_prefixes_;
+};
+
+// CanonicalizeQuery, followed by normalizing the result with |policy|. When
+// the query is removed |*out_query| is reset, as for a missing query.
+GURL_API void CanonicalizeQueryWithPolicy(
+    const char* spec,
+    const url_parse::Component& query,
+    CharsetConverter* converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Component* out_query);
+GURL_API void CanonicalizeQueryWithPolicy(
+    const char16* spec,
+    const url_parse::Component& query,
+    CharsetConverter* converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Component* out_query);
+
+// CanonicalizeStandardURL with the query normalized by |policy|. A
+// canonical GURL can be made from the output without canonicalizing again.
+GURL_API bool CanonicalizeStandardURLWithQueryPolicy(
+    const char* spec,
+    int spec_len,
+    const url_parse::Parsed& parsed,
+    CharsetConverter* query_converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Parsed* new_parsed);
+GURL_API bool CanonicalizeStandardURLWithQueryPolicy(
+    const char16* spec,
+    int spec_len,
+    const url_parse::Parsed& parsed,
+    CharsetConverter* query_converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Parsed* new_parsed);
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_QUERY_POLICY_H__
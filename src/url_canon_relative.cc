@@ -202,9 +202,8 @@ void CopyToLastSlash(const char* spec,
   if (last_slash < 0)
     return;  // No slash.
 
-  // Copy.
-  for (int i = begin; i <= last_slash; i++)
-    output->push_back(spec[i]);
+  // Copy. The base is trusted, so this is one block.
+  output->Append(&spec[begin], last_slash + 1 - begin);
 }
 
 // Copies a single component from the source to the output. This is used
@@ -222,10 +221,8 @@ void CopyOneComponent(const char* source,
   }
 
   output_component->begin = output->length();
-  int source_end = source_component.end();
-  for (int i = source_component.begin; i < source_end; i++)
-    output->push_back(source[i]);
-  output_component->len = output->length() - output_component->begin;
+  output->Append(&source[source_component.begin], source_component.len);
+  output_component->len = source_component.len;
 }
 
 #ifdef WIN32
@@ -401,8 +398,43 @@ bool DoResolveRelativeHost(const char* base_url,
                               relative_component.len, relative_component.begin,
                               &relative_parsed);
 
-  // Now we can just use the replacement function to replace all the necessary
-  // parts of the old URL with the new one.
+  // The scheme is all that's kept of the base, and the base is canonical, so
+  // when the relative URL has a host the scheme is copied as it is and only
+  // the rest goes through the canonicalizers.
+  if (base_parsed.scheme.is_nonempty() && relative_parsed.host.is_nonempty()) {
+    output->Append(base_url, base_parsed.scheme.end() + 1);  // With the colon.
+    out_parsed->scheme = base_parsed.scheme;
+    output->push_back('/');
+    output->push_back('/');
+
+    bool success = CanonicalizeUserInfo(relative_url, relative_parsed.username,
+                                        relative_url, relative_parsed.password,
+                                        output,
+                                        &out_parsed->username,
+                                        &out_parsed->password);
+    success &= CanonicalizeHost(relative_url, relative_parsed.host,
+                                output, &out_parsed->host);
+    int default_port = DefaultPortForScheme(&base_url[base_parsed.scheme.begin],
+                                            base_parsed.scheme.len);
+    success &= CanonicalizePort(relative_url, relative_parsed.port,
+                                default_port, output, &out_parsed->port);
+
+    if (relative_parsed.path.is_valid()) {
+      success &= CanonicalizePath(relative_url, relative_parsed.path,
+                                  output, &out_parsed->path);
+    } else {
+      out_parsed->path = url_parse::Component(output->length(), 1);
+      output->push_back('/');
+    }
+    CanonicalizeQuery(relative_url, relative_parsed.query, query_converter,
+                      output, &out_parsed->query);
+    CanonicalizeRef(relative_url, relative_parsed.ref,
+                    output, &out_parsed->ref);
+    return success;
+  }
+
+  // Otherwise, such as for "//" alone, the replacement function gives the
+  // same (invalid) result as replacing the authority of the base would.
   Replacements<CHAR> replacements;
   replacements.SetUsername(relative_url, relative_parsed.username);
   replacements.SetPassword(relative_url, relative_parsed.password);
@@ -416,6 +448,24 @@ bool DoResolveRelativeHost(const char* base_url,
                             query_converter, output, out_parsed);
 }
 
+// 16-bit input is converted to UTF-8 first, like ReplaceStandardURL does
+// for its replacements, so that invalid characters such as unpaired
+// surrogates become U+FFFD the same way on either route.
+bool DoResolveRelativeHost(const char* base_url,
+                           const url_parse::Parsed& base_parsed,
+                           const char16* relative_url,
+                           const url_parse::Component& relative_component,
+                           CharsetConverter* query_converter,
+                           CanonOutput* output,
+                           url_parse::Parsed* out_parsed) {
+  RawCanonOutput<1024> utf8;
+  ConvertUTF16ToUTF8(&relative_url[relative_component.begin],
+                     relative_component.len, &utf8);
+  return DoResolveRelativeHost<char>(base_url, base_parsed, utf8.data(),
+                                     url_parse::Component(0, utf8.length()),
+                                     query_converter, output, out_parsed);
+}
+
 // Resolves a relative URL that happens to be an absolute file path.  Examples
 // include: "//hostname/path", "/c:/foo", and "//hostname/c:/foo".
 template<typename CHAR>
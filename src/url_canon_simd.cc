@@ -0,0 +1,435 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_canon_simd.h"
+
+#include <algorithm>
+
+#include "base/basictypes.h"
+#include "base/logging.h"
+#include "googleurl/src/url_canon_char_class.h"
+
+#if defined(URL_CANON_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(URL_CANON_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace url_canon {
+
+namespace {
+
+// Scalar search used for the tail of the input that doesn't fill a vector,
+// and for the whole input when no vector unit is available.
+template<typename CHAR>
+inline int ScalarFindRemovableURLWhitespace(const CHAR* input,
+                                            int begin, int len) {
+  return FindCharOfClass<CHAR_CLASS_WHITESPACE>(input, begin, len);
+}
+
+inline int ScalarFindChar(const char* input, int begin, int len, char ch) {
+  for (int i = begin; i < len; i++) {
+    if (input[i] == ch)
+      return i;
+  }
+  return len;
+}
+
+// A CopyableCharSet as a bitmap of the 7-bit characters, so the scalar scan
+// costs a shift per character instead of a pass over the excluded list.
+class CopyableCharBitmap {
+ public:
+  explicit CopyableCharBitmap(const CopyableCharSet& set) {
+    for (int word = 0; word < 2; word++)
+      bits_[word] = RangeBits(set.first, set.last, word);
+    for (const char* excluded = set.excluded; *excluded; excluded++) {
+      unsigned char ch = static_cast<unsigned char>(*excluded);
+      bits_[ch >> 6] &= ~(static_cast<uint64>(1) << (ch & 63));
+    }
+  }
+
+  template<typename UCHAR>
+  bool Contains(UCHAR ch) const {
+    return ch < 0x80 && ((bits_[ch >> 6] >> (ch & 63)) & 1);
+  }
+
+ private:
+  // Returns the bits of word |word| (characters 64 * |word| and up) for the
+  // characters from |first| to |last|.
+  static uint64 RangeBits(int first, int last, int word) {
+    int low = std::max(first, 64 * word);
+    int high = std::min(last, 64 * word + 63);
+    if (low > high)
+      return 0;
+    int count = high - low + 1;
+    uint64 bits = count == 64 ? ~static_cast<uint64>(0)
+                              : (static_cast<uint64>(1) << count) - 1;
+    return bits << (low - 64 * word);
+  }
+
+  uint64 bits_[2];
+};
+
+template<typename UCHAR, typename CHAR>
+inline int ScalarCountCopyableChars(const CHAR* input, int begin, int len,
+                                    const CopyableCharBitmap& bitmap) {
+  for (int i = begin; i < len; i++) {
+    if (!bitmap.Contains(static_cast<UCHAR>(input[i])))
+      return i;
+  }
+  return len;
+}
+
+template<typename UCHAR, typename CHAR>
+inline int ScalarCountASCIIChars(const CHAR* input, int begin, int len) {
+  for (int i = begin; i < len; i++) {
+    if (static_cast<UCHAR>(input[i]) >= 0x80)
+      return i;
+  }
+  return len;
+}
+
+// The most excluded characters any CopyableCharSet may list. The vector
+// scanners keep one comparison register per excluded character.
+const int kMaxExcludedChars = 16;
+
+}  // namespace
+
+#if defined(URL_CANON_SIMD_SSE2)
+
+int FindRemovableURLWhitespace(const char* input, int len) {
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    __m128i hits = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, lf)),
+        _mm_cmpeq_epi8(chunk, cr));
+    if (_mm_movemask_epi8(hits))
+      return ScalarFindRemovableURLWhitespace(input, i, i + 16);
+  }
+  return ScalarFindRemovableURLWhitespace(input, i, len);
+}
+
+int FindRemovableURLWhitespace(const char16* input, int len) {
+  const __m128i tab = _mm_set1_epi16('\t');
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i cr = _mm_set1_epi16('\r');
+
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    __m128i hits = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chunk, tab), _mm_cmpeq_epi16(chunk, lf)),
+        _mm_cmpeq_epi16(chunk, cr));
+    if (_mm_movemask_epi8(hits))
+      return ScalarFindRemovableURLWhitespace(input, i, i + 8);
+  }
+  return ScalarFindRemovableURLWhitespace(input, i, len);
+}
+
+int FindChar(const char* input, int len, char ch) {
+  const __m128i wanted = _mm_set1_epi8(ch);
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    int hits = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, wanted));
+    if (hits)
+      return ScalarFindChar(input, i, i + 16, ch);
+  }
+  return ScalarFindChar(input, i, len, ch);
+}
+
+namespace {
+
+// Returns a mask with the high bit of each byte set for the characters in
+// |chunk| that are not copyable. |first| and |last| are the bounds of the set
+// broadcast to every lane; since SSE2 only has signed comparisons, the 7-bit
+// restriction on |last| is what makes non-ASCII input compare as out of
+// range.
+inline int NonCopyableMask8(__m128i chunk, __m128i first, __m128i last,
+                            const __m128i* excluded, int num_excluded) {
+  __m128i bad = _mm_or_si128(_mm_cmplt_epi8(chunk, first),
+                             _mm_cmpgt_epi8(chunk, last));
+  for (int i = 0; i < num_excluded; i++)
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi8(chunk, excluded[i]));
+  return _mm_movemask_epi8(bad);
+}
+
+inline int NonCopyableMask16(__m128i chunk, __m128i first, __m128i last,
+                             const __m128i* excluded, int num_excluded) {
+  __m128i bad = _mm_or_si128(_mm_cmplt_epi16(chunk, first),
+                             _mm_cmpgt_epi16(chunk, last));
+  for (int i = 0; i < num_excluded; i++)
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi16(chunk, excluded[i]));
+  return _mm_movemask_epi8(bad);
+}
+
+}  // namespace
+
+int CountCopyableChars(const char* input, int len,
+                       const CopyableCharSet& set) {
+  const __m128i first = _mm_set1_epi8(static_cast<char>(set.first));
+  const __m128i last = _mm_set1_epi8(static_cast<char>(set.last));
+  __m128i excluded[kMaxExcludedChars];
+  int num_excluded = 0;
+  for (; set.excluded[num_excluded]; num_excluded++) {
+    DCHECK(num_excluded < kMaxExcludedChars);
+    excluded[num_excluded] = _mm_set1_epi8(set.excluded[num_excluded]);
+  }
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    if (NonCopyableMask8(chunk, first, last, excluded, num_excluded))
+      return ScalarCountCopyableChars<unsigned char>(input, i, i + 16,
+                                                     CopyableCharBitmap(set));
+  }
+  return ScalarCountCopyableChars<unsigned char>(input, i, len,
+                                                 CopyableCharBitmap(set));
+}
+
+int CountCopyableChars(const char16* input, int len,
+                       const CopyableCharSet& set) {
+  const __m128i first = _mm_set1_epi16(set.first);
+  const __m128i last = _mm_set1_epi16(set.last);
+  __m128i excluded[kMaxExcludedChars];
+  int num_excluded = 0;
+  for (; set.excluded[num_excluded]; num_excluded++) {
+    DCHECK(num_excluded < kMaxExcludedChars);
+    excluded[num_excluded] = _mm_set1_epi16(
+        static_cast<unsigned char>(set.excluded[num_excluded]));
+  }
+
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    if (NonCopyableMask16(chunk, first, last, excluded, num_excluded))
+      return ScalarCountCopyableChars<char16>(input, i, i + 8,
+                                              CopyableCharBitmap(set));
+  }
+  return ScalarCountCopyableChars<char16>(input, i, len,
+                                          CopyableCharBitmap(set));
+}
+
+int CountASCIIChars(const char* input, int len) {
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    if (_mm_movemask_epi8(chunk))
+      return ScalarCountASCIIChars<unsigned char>(input, i, i + 16);
+  }
+  return ScalarCountASCIIChars<unsigned char>(input, i, len);
+}
+
+int CountASCIIChars(const char16* input, int len) {
+  const __m128i high_bits = _mm_set1_epi16(static_cast<short>(0xff80));
+  const __m128i zero = _mm_setzero_si128();
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    __m128i non_ascii = _mm_and_si128(chunk, high_bits);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, zero)) != 0xffff)
+      return ScalarCountASCIIChars<char16>(input, i, i + 8);
+  }
+  return ScalarCountASCIIChars<char16>(input, i, len);
+}
+
+#elif defined(URL_CANON_SIMD_NEON)
+
+int FindRemovableURLWhitespace(const char* input, int len) {
+  const uint8x16_t tab = vdupq_n_u8('\t');
+  const uint8x16_t lf = vdupq_n_u8('\n');
+  const uint8x16_t cr = vdupq_n_u8('\r');
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&input[i]));
+    uint8x16_t hits = vorrq_u8(
+        vorrq_u8(vceqq_u8(chunk, tab), vceqq_u8(chunk, lf)),
+        vceqq_u8(chunk, cr));
+    if (vmaxvq_u8(hits))
+      return ScalarFindRemovableURLWhitespace(input, i, i + 16);
+  }
+  return ScalarFindRemovableURLWhitespace(input, i, len);
+}
+
+int FindRemovableURLWhitespace(const char16* input, int len) {
+  const uint16x8_t tab = vdupq_n_u16('\t');
+  const uint16x8_t lf = vdupq_n_u16('\n');
+  const uint16x8_t cr = vdupq_n_u16('\r');
+
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t chunk =
+        vld1q_u16(reinterpret_cast<const uint16_t*>(&input[i]));
+    uint16x8_t hits = vorrq_u16(
+        vorrq_u16(vceqq_u16(chunk, tab), vceqq_u16(chunk, lf)),
+        vceqq_u16(chunk, cr));
+    if (vmaxvq_u16(hits))
+      return ScalarFindRemovableURLWhitespace(input, i, i + 8);
+  }
+  return ScalarFindRemovableURLWhitespace(input, i, len);
+}
+
+int FindChar(const char* input, int len, char ch) {
+  const uint8x16_t wanted = vdupq_n_u8(static_cast<unsigned char>(ch));
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&input[i]));
+    if (vmaxvq_u8(vceqq_u8(chunk, wanted)))
+      return ScalarFindChar(input, i, i + 16, ch);
+  }
+  return ScalarFindChar(input, i, len, ch);
+}
+
+int CountCopyableChars(const char* input, int len,
+                       const CopyableCharSet& set) {
+  const uint8x16_t first = vdupq_n_u8(set.first);
+  const uint8x16_t last = vdupq_n_u8(set.last);
+  uint8x16_t excluded[kMaxExcludedChars];
+  int num_excluded = 0;
+  for (; set.excluded[num_excluded]; num_excluded++) {
+    DCHECK(num_excluded < kMaxExcludedChars);
+    excluded[num_excluded] = vdupq_n_u8(
+        static_cast<unsigned char>(set.excluded[num_excluded]));
+  }
+
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&input[i]));
+    uint8x16_t bad = vorrq_u8(vcltq_u8(chunk, first), vcgtq_u8(chunk, last));
+    for (int e = 0; e < num_excluded; e++)
+      bad = vorrq_u8(bad, vceqq_u8(chunk, excluded[e]));
+    if (vmaxvq_u8(bad))
+      return ScalarCountCopyableChars<unsigned char>(input, i, i + 16,
+                                                     CopyableCharBitmap(set));
+  }
+  return ScalarCountCopyableChars<unsigned char>(input, i, len,
+                                                 CopyableCharBitmap(set));
+}
+
+int CountCopyableChars(const char16* input, int len,
+                       const CopyableCharSet& set) {
+  const uint16x8_t first = vdupq_n_u16(set.first);
+  const uint16x8_t last = vdupq_n_u16(set.last);
+  uint16x8_t excluded[kMaxExcludedChars];
+  int num_excluded = 0;
+  for (; set.excluded[num_excluded]; num_excluded++) {
+    DCHECK(num_excluded < kMaxExcludedChars);
+    excluded[num_excluded] = vdupq_n_u16(
+        static_cast<unsigned char>(set.excluded[num_excluded]));
+  }
+
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t chunk =
+        vld1q_u16(reinterpret_cast<const uint16_t*>(&input[i]));
+    uint16x8_t bad = vorrq_u16(vcltq_u16(chunk, first),
+                               vcgtq_u16(chunk, last));
+    for (int e = 0; e < num_excluded; e++)
+      bad = vorrq_u16(bad, vceqq_u16(chunk, excluded[e]));
+    if (vmaxvq_u16(bad))
+      return ScalarCountCopyableChars<char16>(input, i, i + 8,
+                                              CopyableCharBitmap(set));
+  }
+  return ScalarCountCopyableChars<char16>(input, i, len,
+                                          CopyableCharBitmap(set));
+}
+
+int CountASCIIChars(const char* input, int len) {
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(&input[i]));
+    if (vmaxvq_u8(chunk) >= 0x80)
+      return ScalarCountASCIIChars<unsigned char>(input, i, i + 16);
+  }
+  return ScalarCountASCIIChars<unsigned char>(input, i, len);
+}
+
+int CountASCIIChars(const char16* input, int len) {
+  int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t chunk =
+        vld1q_u16(reinterpret_cast<const uint16_t*>(&input[i]));
+    if (vmaxvq_u16(chunk) >= 0x80)
+      return ScalarCountASCIIChars<char16>(input, i, i + 8);
+  }
+  return ScalarCountASCIIChars<char16>(input, i, len);
+}
+
+#else  // No vector unit.
+
+int FindRemovableURLWhitespace(const char* input, int len) {
+  return ScalarFindRemovableURLWhitespace(input, 0, len);
+}
+
+int FindRemovableURLWhitespace(const char16* input, int len) {
+  return ScalarFindRemovableURLWhitespace(input, 0, len);
+}
+
+int FindChar(const char* input, int len, char ch) {
+  return ScalarFindChar(input, 0, len, ch);
+}
+
+int CountCopyableChars(const char* input, int len,
+                       const CopyableCharSet& set) {
+  return ScalarCountCopyableChars<unsigned char>(input, 0, len,
+                                                 CopyableCharBitmap(set));
+}
+
+int CountCopyableChars(const char16* input, int len,
+                       const CopyableCharSet& set) {
+  return ScalarCountCopyableChars<char16>(input, 0, len,
+                                          CopyableCharBitmap(set));
+}
+
+int CountASCIIChars(const char* input, int len) {
+  return ScalarCountASCIIChars<unsigned char>(input, 0, len);
+}
+
+int CountASCIIChars(const char16* input, int len) {
+  return ScalarCountASCIIChars<char16>(input, 0, len);
+}
+
+#endif
+
+}  // namespace url_canon
@@ -0,0 +1,101 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Vectorized scanning primitives used by the canonicalizers. These only
+// locate the interesting characters in a run of input; the callers keep the
+// per-character logic for whatever they find. Each function has an SSE2 and a
+// NEON implementation plus a portable scalar fallback, selected at compile
+// time, and all of them return the same results.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_SIMD_H__
+#define GOOGLEURL_SRC_URL_CANON_SIMD_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define URL_CANON_SIMD_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define URL_CANON_SIMD_NEON 1
+#endif
+
+namespace url_canon {
+
+// Returns the index of the first tab, CR or LF character in the first |len|
+// characters of |input|, or |len| if there is none.
+int FindRemovableURLWhitespace(const char* input, int len);
+int FindRemovableURLWhitespace(const char16* input, int len);
+
+// Returns the index of the first |ch| in the first |len| characters of
+// |input|, or |len| if there is none. The unescapers use this to jump from one
+// '%' to the next.
+int FindChar(const char* input, int len, char ch);
+
+// Describes the characters that a canonicalizer copies to the output
+// unchanged, in a form the vector scanners can test cheaply: every character
+// from |first| to |last| inclusive except those in the NULL-terminated
+// |excluded| list. |first| must be nonzero and |last| must be 7-bit, so
+// non-ASCII input is never considered copyable.
+struct CopyableCharSet {
+  unsigned char first;
+  unsigned char last;
+  const char* excluded;
+};
+
+// The characters in the CHAR_QUERY class of kSharedCharTypeTable. Defined
+// next to that table in url_canon_internal.cc.
+extern const CopyableCharSet kQueryCopyableChars;
+
+// Returns the number of characters at the beginning of |input| (up to |len|)
+// that are in |set|. Canonicalizers use this to find the run of input they
+// can copy in bulk before falling back to per-character handling.
+int CountCopyableChars(const char* input, int len, const CopyableCharSet& set);
+int CountCopyableChars(const char16* input, int len,
+                       const CopyableCharSet& set);
+
+// Returns the number of 7-bit characters at the beginning of |input|.
+int CountASCIIChars(const char* input, int len);
+int CountASCIIChars(const char16* input, int len);
+
+// Appends a run of characters already known to be copyable (and therefore
+// 7-bit) to the output. The 8-bit version is a single block copy.
+inline void AppendCopyableRun(const char* input, int len,
+                              CanonOutput* output) {
+  output->Append(input, len);
+}
+inline void AppendCopyableRun(const char16* input, int len,
+                              CanonOutput* output) {
+  for (int i = 0; i < len; i++)
+    output->push_back(static_cast<char>(input[i]));
+}
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_SIMD_H__
@@ -0,0 +1,93 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_canon_stats.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+
+namespace url_canon {
+
+namespace {
+
+const char* const kCanonStatNames[CANON_STAT_COUNT] = {
+  "whitespace_removed",
+  "idn_conversions",
+  "icu_overflow_retries",
+  "output_growths",
+  "ipv4_hosts",
+  "ipv6_hosts",
+  "dot_segments",
+  "escaped_chars",
+  "charset_conversions",
+};
+
+}  // namespace
+
+#if defined(GURL_ENABLE_CANON_STATS)
+#if defined(_MSC_VER)
+__declspec(thread) int64 thread_canon_stats[CANON_STAT_COUNT];
+#else
+__thread int64 thread_canon_stats[CANON_STAT_COUNT];
+#endif
+#endif  // GURL_ENABLE_CANON_STATS
+
+CanonStats::CanonStats() {
+  memset(counts, 0, sizeof(counts));
+}
+
+bool CanonStatsEnabled() {
+#if defined(GURL_ENABLE_CANON_STATS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void GetThreadCanonStats(CanonStats* stats) {
+#if defined(GURL_ENABLE_CANON_STATS)
+  memcpy(stats->counts, thread_canon_stats, sizeof(stats->counts));
+#else
+  *stats = CanonStats();
+#endif
+}
+
+void ResetThreadCanonStats() {
+#if defined(GURL_ENABLE_CANON_STATS)
+  memset(thread_canon_stats, 0, sizeof(thread_canon_stats));
+#endif
+}
+
+const char* CanonStatName(CanonStat stat) {
+  DCHECK(stat >= 0 && stat < CANON_STAT_COUNT);
+  return kCanonStatNames[stat];
+}
+
+}  // namespace url_canon
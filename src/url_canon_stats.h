@@ -0,0 +1,147 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Counters for the slow paths of canonicalization, to find out why some mixes
+// of URLs are much slower than others: how often whitespace had to be
+// removed, hosts went through IDN, output buffers grew and so on.
+//
+// The counters are compiled out unless the library is built with
+// GURL_ENABLE_CANON_STATS defined (googleurl_enable_canon_stats=1 in gyp).
+// When they're in, each thread has its own, so counting is just an
+// increment, and a thread reads a snapshot of its own counters.
+
+#ifndef GOOGLEURL_SRC_URL_CANON_STATS_H__
+#define GOOGLEURL_SRC_URL_CANON_STATS_H__
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_canon {
+
+enum CanonStat {
+  // URLs that had tabs or newlines in them, and were copied to remove them.
+  CANON_STAT_WHITESPACE_REMOVED,
+
+  // Hosts converted with IDN, with the built-in engine or ICU.
+  CANON_STAT_IDN_CONVERSIONS,
+
+  // Calls into ICU (IDNToASCII, ICUCharsetConverter) that ran out of output
+  // buffer and had to be repeated.
+  CANON_STAT_ICU_OVERFLOW_RETRIES,
+
+  // Canonicalize, ResolveRelative and ReplaceComponents calls whose output
+  // had to grow, such as a RawCanonOutput going past its stack buffer.
+  CANON_STAT_OUTPUT_GROWTHS,
+
+  // Hosts that turned out to be IP addresses.
+  CANON_STAT_IPV4_HOSTS,
+  CANON_STAT_IPV6_HOSTS,
+
+  // "." and ".." path segments that were removed.
+  CANON_STAT_DOT_SEGMENTS,
+
+  // Input characters written as escape sequences, in any component.
+  CANON_STAT_ESCAPED_CHARS,
+
+  // Queries converted with a CharsetConverter instead of being UTF-8.
+  CANON_STAT_CHARSET_CONVERSIONS,
+
+  CANON_STAT_COUNT,
+};
+
+struct GURL_API CanonStats {
+  CanonStats();
+
+  int64 counts[CANON_STAT_COUNT];
+};
+
+// Returns true if the library was built with the counters in. Otherwise they
+// always read 0.
+GURL_API bool CanonStatsEnabled();
+
+// Copies the calling thread's counters to |*stats|.
+GURL_API void GetThreadCanonStats(CanonStats* stats);
+
+// Sets the calling thread's counters back to 0.
+GURL_API void ResetThreadCanonStats();
+
+// A short name for |stat|, like "whitespace_removed", for printing.
+GURL_API const char* CanonStatName(CanonStat stat);
+
+#if defined(GURL_ENABLE_CANON_STATS)
+
+#if defined(_MSC_VER)
+extern __declspec(thread) int64 thread_canon_stats[CANON_STAT_COUNT];
+#else
+extern __thread int64 thread_canon_stats[CANON_STAT_COUNT];
+#endif
+
+#define GURL_CANON_STAT_ADD(stat, n) \
+    (url_canon::thread_canon_stats[url_canon::stat] += (n))
+
+// Counts CANON_STAT_OUTPUT_GROWTHS if |output| grew by the time this goes out
+// of scope.
+class ScopedOutputGrowthStat {
+ public:
+  explicit ScopedOutputGrowthStat(const CanonOutput* output)
+      : output_(output),
+        capacity_(output->capacity()) {
+  }
+  ~ScopedOutputGrowthStat() {
+    if (output_->capacity() > capacity_)
+      GURL_CANON_STAT_ADD(CANON_STAT_OUTPUT_GROWTHS, 1);
+  }
+
+ private:
+  const CanonOutput* output_;
+  int capacity_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedOutputGrowthStat);
+};
+
+#else
+
+#define GURL_CANON_STAT_ADD(stat, n) ((void)(n))
+
+class ScopedOutputGrowthStat {
+ public:
+  explicit ScopedOutputGrowthStat(const CanonOutput*) {}
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ScopedOutputGrowthStat);
+};
+
+#endif  // GURL_ENABLE_CANON_STATS
+
+#define GURL_CANON_STAT(stat) GURL_CANON_STAT_ADD(stat, 1)
+
+}  // namespace url_canon
+
+#endif  // GOOGLEURL_SRC_URL_CANON_STATS_H__
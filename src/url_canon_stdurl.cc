@@ -32,6 +32,8 @@
 
 #include "googleurl/src/url_canon.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_query_policy.h"
+#include "googleurl/src/url_scheme_registry.h"
 
 namespace url_canon {
 
@@ -41,6 +43,7 @@ template<typename CHAR, typename UCHAR>
 bool DoCanonicalizeStandardURL(const URLComponentSource<CHAR>& source,
                                const url_parse::Parsed& parsed,
                                CharsetConverter* query_converter,
+                               const QueryNormalizationPolicy* query_policy,
                                CanonOutput* output,
                                url_parse::Parsed* new_parsed) {
   // Scheme: this will append the colon.
@@ -105,8 +108,13 @@ bool DoCanonicalizeStandardURL(const URLComponentSource<CHAR>& source,
   }
 
   // Query
-  CanonicalizeQuery(source.query, parsed.query, query_converter,
-                    output, &new_parsed->query);
+  if (query_policy) {
+    CanonicalizeQueryWithPolicy(source.query, parsed.query, query_converter,
+                                *query_policy, output, &new_parsed->query);
+  } else {
+    CanonicalizeQuery(source.query, parsed.query, query_converter,
+                      output, &new_parsed->query);
+  }
 
   // Ref: ignore failure for this, since the page can probably still be loaded.
   CanonicalizeRef(source.ref, parsed.ref, output, &new_parsed->ref);
@@ -118,34 +126,12 @@ bool DoCanonicalizeStandardURL(const URLComponentSource<CHAR>& source,
 
 
 // Returns the default port for the given canonical scheme, or PORT_UNSPECIFIED
-// if the scheme is unknown.
+// if the scheme is unknown. The ports themselves live in the scheme registry
+// so that schemes added with AddStandardSchemeWithPort get one too.
 int DefaultPortForScheme(const char* scheme, int scheme_len) {
-  int default_port = url_parse::PORT_UNSPECIFIED;
-  switch (scheme_len) {
-    case 4:
-      if (!strncmp(scheme, "http", scheme_len))
-        default_port = 80;
-      break;
-    case 5:
-      if (!strncmp(scheme, "https", scheme_len))
-        default_port = 443;
-      break;
-    case 3:
-      if (!strncmp(scheme, "ftp", scheme_len))
-        default_port = 21;
-      else if (!strncmp(scheme, "wss", scheme_len))
-        default_port = 443;
-      break;
-    case 6:
-      if (!strncmp(scheme, "gopher", scheme_len))
-        default_port = 70;
-      break;
-    case 2:
-      if (!strncmp(scheme, "ws", scheme_len))
-        default_port = 80;
-      break;
-  }
-  return default_port;
+  const url_util::SchemeInfo* info =
+      url_util::FindSchemeInfo(scheme, url_parse::Component(0, scheme_len));
+  return info ? info->default_port : url_parse::PORT_UNSPECIFIED;
 }
 
 bool CanonicalizeStandardURL(const char* spec,
@@ -156,7 +142,7 @@ bool CanonicalizeStandardURL(const char* spec,
                              url_parse::Parsed* new_parsed) {
   return DoCanonicalizeStandardURL<char, unsigned char>(
       URLComponentSource<char>(spec), parsed, query_converter,
-      output, new_parsed);
+      NULL, output, new_parsed);
 }
 
 bool CanonicalizeStandardURL(const char16* spec,
@@ -167,7 +153,33 @@ bool CanonicalizeStandardURL(const char16* spec,
                              url_parse::Parsed* new_parsed) {
   return DoCanonicalizeStandardURL<char16, char16>(
       URLComponentSource<char16>(spec), parsed, query_converter,
-      output, new_parsed);
+      NULL, output, new_parsed);
+}
+
+bool CanonicalizeStandardURLWithQueryPolicy(
+    const char* spec,
+    int spec_len,
+    const url_parse::Parsed& parsed,
+    CharsetConverter* query_converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Parsed* new_parsed) {
+  return DoCanonicalizeStandardURL<char, unsigned char>(
+      URLComponentSource<char>(spec), parsed, query_converter,
+      &policy, output, new_parsed);
+}
+
+bool CanonicalizeStandardURLWithQueryPolicy(
+    const char16* spec,
+    int spec_len,
+    const url_parse::Parsed& parsed,
+    CharsetConverter* query_converter,
+    const QueryNormalizationPolicy& policy,
+    CanonOutput* output,
+    url_parse::Parsed* new_parsed) {
+  return DoCanonicalizeStandardURL<char16, char16>(
+      URLComponentSource<char16>(spec), parsed, query_converter,
+      &policy, output, new_parsed);
 }
 
 // It might be nice in the future to optimize this so unchanged components don't
@@ -189,7 +201,7 @@ bool ReplaceStandardURL(const char* base,
   url_parse::Parsed parsed(base_parsed);
   SetupOverrideComponents(base, replacements, &source, &parsed);
   return DoCanonicalizeStandardURL<char, unsigned char>(
-      source, parsed, query_converter, output, new_parsed);
+      source, parsed, query_converter, NULL, output, new_parsed);
 }
 
 // For 16-bit replacements, we turn all the replacements into UTF-8 so the
@@ -205,7 +217,7 @@ bool ReplaceStandardURL(const char* base,
   url_parse::Parsed parsed(base_parsed);
   SetupUTF16OverrideComponents(base, replacements, &utf8, &source, &parsed);
   return DoCanonicalizeStandardURL<char, unsigned char>(
-      source, parsed, query_converter, output, new_parsed);
+      source, parsed, query_converter, NULL, output, new_parsed);
 }
 
 }  // namespace url_canon
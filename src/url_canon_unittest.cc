@@ -31,8 +31,18 @@
 #include <unicode/ucnv.h>
 
 #include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_canon_arena.h"
+#include "googleurl/src/url_canon_char_class.h"
+#include "googleurl/src/url_canon_fused.h"
+#include "googleurl/src/url_canon_host_cache.h"
+#include "googleurl/src/url_canon_host_classify.h"
 #include "googleurl/src/url_canon_icu.h"
+#include "googleurl/src/url_canon_icu_pool.h"
+#include "googleurl/src/url_canon_idna.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_query_policy.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 #include "googleurl/src/url_canon_stdstring.h"
 #include "googleurl/src/url_parse.h"
 #include "googleurl/src/url_test_utils.h"
@@ -321,6 +331,90 @@ TEST(URLCanonTest, ICUCharsetConverter) {
   }
 }
 
+// The pooled converters must give what a plain ICUCharsetConverter gives,
+// whether they go through ICU or, for single-byte charsets, a table.
+TEST(URLCanonTest, ThreadCharsetConverter) {
+  EXPECT_TRUE(url_canon::GetThreadCharsetConverter("no-such-charset") == NULL);
+  url_canon::CharsetConverter* big5 =
+      url_canon::GetThreadCharsetConverter("big5");
+  ASSERT_TRUE(big5 != NULL);
+  EXPECT_EQ(big5, url_canon::GetThreadCharsetConverter("Big5"));
+
+  // Every BMP character, some outside it, and then a lone surrogate, which
+  // must come last since ICU stops converting there.
+  string16 all;
+  for (int ch = 1; ch < 0x10000; ch++) {
+    if (!U16_IS_SURROGATE(ch))
+      all.push_back(static_cast<char16>(ch));
+  }
+  all.append(WStringToUTF16(L"\xd800\xdf00\xdbff\xdfff"));
+  string16 lone_surrogate(WStringToUTF16(L"a\xe9\xd800b"));
+
+  const char* charsets[] = {
+    "windows-1252", "iso-8859-1", "iso-8859-2", "iso-8859-7", "iso-8859-15",
+    "koi8-r", "us-ascii", "big5", "shift_jis", "gb2312",
+  };
+  for (size_t i = 0; i < ARRAYSIZE(charsets); i++) {
+    UConvScoper conv(charsets[i]);
+    ASSERT_TRUE(conv.converter() != NULL);
+    url_canon::ICUCharsetConverter icu(conv.converter());
+    url_canon::CharsetConverter* pooled =
+        url_canon::GetThreadCharsetConverter(charsets[i]);
+    ASSERT_TRUE(pooled != NULL);
+
+    std::string expected, out;
+    url_canon::StdStringCanonOutput expected_output(&expected);
+    url_canon::StdStringCanonOutput output(&out);
+    icu.ConvertFromUTF16(all.data(), static_cast<int>(all.length()),
+                         &expected_output);
+    pooled->ConvertFromUTF16(all.data(), static_cast<int>(all.length()),
+                             &output);
+    expected_output.Complete();
+    output.Complete();
+    EXPECT_TRUE(expected == out) << charsets[i];
+
+    expected.clear();
+    out.clear();
+    url_canon::StdStringCanonOutput expected_output2(&expected);
+    url_canon::StdStringCanonOutput output2(&out);
+    icu.ConvertFromUTF16(lone_surrogate.data(),
+                         static_cast<int>(lone_surrogate.length()),
+                         &expected_output2);
+    pooled->ConvertFromUTF16(lone_surrogate.data(),
+                             static_cast<int>(lone_surrogate.length()),
+                             &output2);
+    expected_output2.Complete();
+    output2.Complete();
+    EXPECT_EQ(expected, out) << charsets[i];
+
+    // 8-bit queries, including invalid UTF-8, which single-byte converters
+    // take without going through UTF-16.
+    const char* queries[] = {
+      "q=caf\xc3\xa9&x=\xe2\x82\xac", "\xe4\xbd\xa0\xed\xa0\x80\xff",
+      "a\xef\xbf\xbfz\xf0\x9f\x98\x80",
+    };
+    for (size_t j = 0; j < ARRAYSIZE(queries); j++) {
+      url_parse::Component in(0, static_cast<int>(strlen(queries[j])));
+      url_parse::Component out_comp;
+      expected.clear();
+      out.clear();
+      url_canon::StdStringCanonOutput expected_query(&expected);
+      url_canon::StdStringCanonOutput query(&out);
+      url_canon::CanonicalizeQuery(queries[j], in, &icu, &expected_query,
+                                   &out_comp);
+      url_canon::CanonicalizeQuery(queries[j], in, pooled, &query,
+                                   &out_comp);
+      expected_query.Complete();
+      query.Complete();
+      EXPECT_EQ(expected, out) << charsets[i] << " " << queries[j];
+    }
+  }
+
+  // Converters can be opened again after being released.
+  url_canon::ReleaseThreadCharsetConverters();
+  EXPECT_TRUE(url_canon::GetThreadCharsetConverter("windows-1252") != NULL);
+  url_canon::ReleaseThreadCharsetConverters();
+}
 TEST(URLCanonTest, Scheme) {
   // Here, we're mostly testing that unusual characters are handled properly.
   // The canonicalizer doesn't do any parsing or whitespace detection. It will
@@ -563,6 +657,163 @@ TEST(URLCanonTest, Host) {
   }
 }
 
+TEST(URLCanonTest, HostCache) {
+  const char* hosts[] = {
+    "\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xbd\xa0\xe5\xa5\xbd",
+    "%E4%BD%A0%E5%A5%BD\xe4\xbd\xa0\xe5\xa5\xbd",
+    "\xef\xbc\xa7\xef\xbd\x8f.com",
+    "%ef%b7%90zyx.com",
+    "%31%39%32.168.0.1",
+    "GoOgLe.CoM",  // Doesn't need the cache.
+  };
+  const int num_hosts = static_cast<int>(ARRAYSIZE(hosts));
+
+  // What each host canonicalizes to without the cache. The output starts
+  // with some junk to check that |out_host| is right on cache hits.
+  std::string expected[ARRAYSIZE(hosts)];
+  CanonHostInfo expected_info[ARRAYSIZE(hosts)];
+  for (int i = 0; i < num_hosts; i++) {
+    url_parse::Component host(0, static_cast<int>(strlen(hosts[i])));
+    expected[i] = "junk";
+    url_canon::StdStringCanonOutput output(&expected[i]);
+    url_canon::CanonicalizeHostVerbose(hosts[i], host, &output,
+                                       &expected_info[i]);
+    output.Complete();
+  }
+
+  // Room for every host, then only one host per shard.
+  int sizes[] = { 1000, 1 };
+  for (size_t size = 0; size < ARRAYSIZE(sizes); size++) {
+    url_canon::SetHostCacheSize(sizes[size]);
+    for (int pass = 0; pass < 3; pass++) {
+      for (int i = 0; i < num_hosts; i++) {
+        url_parse::Component host(0, static_cast<int>(strlen(hosts[i])));
+        std::string out_str("junk");
+        url_canon::StdStringCanonOutput output(&out_str);
+        CanonHostInfo host_info;
+        url_canon::CanonicalizeHostVerbose(hosts[i], host, &output,
+                                           &host_info);
+        output.Complete();
+
+        EXPECT_EQ(expected[i], out_str) << hosts[i];
+        EXPECT_EQ(expected_info[i].family, host_info.family) << hosts[i];
+        EXPECT_TRUE(expected_info[i].out_host == host_info.out_host)
+            << hosts[i];
+        if (host_info.IsIPAddress()) {
+          EXPECT_EQ(expected_info[i].num_ipv4_components,
+                    host_info.num_ipv4_components) << hosts[i];
+          EXPECT_EQ(0, memcmp(expected_info[i].address, host_info.address,
+                              host_info.AddressLength())) << hosts[i];
+        }
+
+        // Wide input is cached separately and gives the same answer.
+        string16 wide_host = ConvertUTF8ToUTF16(hosts[i]);
+        if (wide_host.empty())
+          continue;  // Not valid UTF-8.
+        std::string wide_str("junk");
+        url_canon::StdStringCanonOutput wide_output(&wide_str);
+        url_parse::Component wide_component(
+            0, static_cast<int>(wide_host.length()));
+        url_canon::CanonicalizeHost(wide_host.data(), wide_component,
+                                    &wide_output, &host_info.out_host);
+        wide_output.Complete();
+        EXPECT_EQ(expected[i], wide_str) << hosts[i];
+      }
+    }
+  }
+
+  url_canon::HostCacheStats stats;
+  url_canon::GetHostCacheStats(&stats);
+  EXPECT_GT(stats.misses, 0);
+  EXPECT_LE(stats.entries, 16);
+
+  url_canon::SetHostCacheSize(1000);
+  std::string out_str;
+  url_canon::StdStringCanonOutput output(&out_str);
+  url_parse::Component out_host;
+  url_canon::CanonicalizeHost(hosts[0], url_parse::Component(0, 12),
+                              &output, &out_host);
+  url_canon::CanonicalizeHost(hosts[0], url_parse::Component(0, 12),
+                              &output, &out_host);
+  url_canon::CanonicalizeHost(hosts[5], url_parse::Component(0, 10),
+                              &output, &out_host);
+  url_canon::GetHostCacheStats(&stats);
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(1, stats.misses);
+  EXPECT_EQ(1, stats.entries);
+
+  url_canon::SetHostCacheSize(0);
+  url_canon::GetHostCacheStats(&stats);
+  EXPECT_EQ(0, stats.hits);
+  EXPECT_EQ(0, stats.entries);
+}
+
+TEST(URLCanonTest, IDNToASCII) {
+  struct IDNCase {
+    const char* input;
+    const char* expected;  // NULL means the conversion should fail.
+  } idn_cases[] = {
+    {"b\xc3\xbc" "cher", "xn--bcher-kva"},
+      // Nameprep lower-cases the ASCII in a label that needs it.
+    {"B\xc3\xbc" "cher", "xn--bcher-kva"},
+      // Decomposed input is composed, e + combining acute is U+00E9.
+    {"e\xcc\x81", "xn--9ca"},
+      // Mappings that leave only ASCII don't get the ACE prefix.
+    {"stra\xc3\x9f" "e", "strasse"},
+    {"\xef\xbd\x87\xef\xbd\x8f", "go"},
+    {"\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xbd\xa0\xe5\xa5\xbd", "xn--6qqa088eba"},
+      // Hangul, precomposed and as conjoining jamo.
+    {"\xed\x95\x9c\xea\xb8\x80", "xn--bj0bj06e"},
+    {"\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab\xe1\x84\x80\xe1\x85\xb3"
+     "\xe1\x86\xaf", "xn--bj0bj06e"},
+      // Any of the four dots separates labels, an empty last one is the root.
+    {"a\xe3\x80\x82\xc3\xa9", "a.xn--9ca"},
+    {"\xc3\xa9.", "xn--9ca."},
+    {"\xc3\xa9..a", NULL},
+      // Something that maps to nothing leaves an empty label.
+    {"\xc2\xad", NULL},
+      // Bidi rules: right-to-left labels can't have left-to-right characters
+      // and must start and end with a right-to-left one.
+    {"\xd7\x90\xd7\x91", "xn--4dbc"},
+    {"\xd7\x90" "b", NULL},
+    {"\xd8\xa7" "1", NULL},
+      // Prohibited characters (left-to-right mark).
+    {"\xc3\xa9\xe2\x80\x8e", NULL},
+    {"xn--\xc3\xa9", NULL},
+    {"\xc3\xa9" "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+     NULL},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(idn_cases); i++) {
+    const IDNCase& idn_case = idn_cases[i];
+    int input_len = static_cast<int>(strlen(idn_case.input));
+    url_canon::RawCanonOutput<256> output;
+    bool success =
+        url_canon::BuiltInIDNToASCII(idn_case.input, input_len, &output);
+    EXPECT_EQ(idn_case.expected != NULL, success) << idn_case.input;
+    if (idn_case.expected && success) {
+      EXPECT_EQ(std::string(idn_case.expected),
+                std::string(output.data(), output.length()));
+    }
+
+    string16 wide_input = ConvertUTF8ToUTF16(idn_case.input);
+    url_canon::RawCanonOutputW<256> wide_output;
+    success = url_canon::IDNToASCII(wide_input.data(),
+                                    static_cast<int>(wide_input.length()),
+                                    &wide_output);
+    EXPECT_EQ(idn_case.expected != NULL, success) << idn_case.input;
+    if (idn_case.expected && success) {
+      EXPECT_EQ(std::string(idn_case.expected),
+                ConvertUTF16ToUTF8(string16(wide_output.data(),
+                                            wide_output.length())));
+    }
+  }
+
+  // Invalid UTF-8 fails rather than being converted.
+  url_canon::RawCanonOutput<256> output;
+  EXPECT_FALSE(url_canon::BuiltInIDNToASCII("a\xc3", 2, &output));
+}
+
 TEST(URLCanonTest, IPv4) {
   IPAddressCase cases[] = {
       // Empty is not an IP address.
@@ -572,6 +823,12 @@ TEST(URLCanonTest, IPv4) {
     {"192.168.0.1", L"192.168.0.1", "192.168.0.1", url_parse::Component(0, 11), CanonHostInfo::IPV4, 4, "C0A80001"},
     {"0300.0250.00.01", L"0300.0250.00.01", "192.168.0.1", url_parse::Component(0, 11), CanonHostInfo::IPV4, 4, "C0A80001"},
     {"0xC0.0Xa8.0x0.0x1", L"0xC0.0Xa8.0x0.0x1", "192.168.0.1", url_parse::Component(0, 11), CanonHostInfo::IPV4, 4, "C0A80001"},
+      // The edges of the canonical dotted-quad form.
+    {"0.0.0.0", L"0.0.0.0", "0.0.0.0", url_parse::Component(0, 7), CanonHostInfo::IPV4, 4, "00000000"},
+    {"255.255.255.255", L"255.255.255.255", "255.255.255.255", url_parse::Component(0, 15), CanonHostInfo::IPV4, 4, "FFFFFFFF"},
+    {"10.0.0.010", L"10.0.0.010", "10.0.0.8", url_parse::Component(0, 8), CanonHostInfo::IPV4, 4, "0A000008"},
+    {"256.0.0.1", L"256.0.0.1", "", url_parse::Component(), CanonHostInfo::BROKEN, -1, ""},
+    {"1.2.3.1000", L"1.2.3.1000", "", url_parse::Component(), CanonHostInfo::BROKEN, -1, ""},
       // Non-IP addresses due to invalid characters.
     {"192.168.9.com", L"192.168.9.com", "", url_parse::Component(), CanonHostInfo::NEUTRAL, -1, ""},
       // Invalid characters for the base should be rejected.
@@ -851,6 +1108,58 @@ TEST(URLCanonTest, IPEmpty) {
   EXPECT_FALSE(host_info.IsIPAddress());
 }
 
+TEST(URLCanonTest, ClassifyHost) {
+  struct ClassifyCase {
+    const char* input;
+    bool classified;
+    CanonHostInfo::Family expected_family;
+  } cases[] = {
+    {"192.168.0.1", true, CanonHostInfo::IPV4},
+    {"0X7F.1", true, CanonHostInfo::IPV4},
+    {"4294967296", true, CanonHostInfo::BROKEN},
+    {"[2001:DB8::1]", true, CanonHostInfo::IPV6},
+    {"[::ffff:192.168.0.1]", true, CanonHostInfo::IPV6},
+    {"[1:2]", true, CanonHostInfo::BROKEN},
+    {"2001:db8::1", true, CanonHostInfo::BROKEN},
+      // Only IP characters, but a host name.
+    {"cafe.be", true, CanonHostInfo::NEUTRAL},
+      // These need canonicalizing before anyone can tell.
+    {"www.google.com", false, CanonHostInfo::NEUTRAL},
+    {"%31%39%32.168.0.1", false, CanonHostInfo::NEUTRAL},
+    {"\xef\xbc\x91\xef\xbc\x99\xef\xbc\x92.168.0.1", false,
+     CanonHostInfo::NEUTRAL},
+    {"", false, CanonHostInfo::NEUTRAL},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    url_parse::Component host(0, static_cast<int>(strlen(cases[i].input)));
+    CanonHostInfo host_info;
+    EXPECT_EQ(cases[i].classified,
+              url_canon::ClassifyHost(cases[i].input, host, &host_info))
+        << cases[i].input;
+    if (!cases[i].classified)
+      continue;
+    EXPECT_EQ(cases[i].expected_family, host_info.family) << cases[i].input;
+
+    // Whatever it says has to agree with canonicalizing the host.
+    std::string out_str;
+    url_canon::StdStringCanonOutput output(&out_str);
+    CanonHostInfo canon_info;
+    url_canon::CanonicalizeHostVerbose(cases[i].input, host, &output,
+                                       &canon_info);
+    EXPECT_EQ(canon_info.family, host_info.family) << cases[i].input;
+    if (host_info.IsIPAddress()) {
+      EXPECT_EQ(0, memcmp(canon_info.address, host_info.address,
+                          host_info.AddressLength())) << cases[i].input;
+    }
+
+    string16 wide_input(ConvertUTF8ToUTF16(cases[i].input));
+    CanonHostInfo wide_info;
+    EXPECT_TRUE(url_canon::ClassifyHost(wide_input.data(), host, &wide_info));
+    EXPECT_EQ(host_info.family, wide_info.family) << cases[i].input;
+  }
+}
+
 TEST(URLCanonTest, UserInfo) {
   // Note that the canonicalizer should escape and treat empty components as
   // not being there.
@@ -1000,6 +1309,9 @@ TEST(URLCanonTest, Path) {
       // Multiple slashes in a row should be preserved and treated like empty
       // directory names.
     {"////../..", L"////../..", "//", url_parse::Component(0, 2), true},
+      // Dots that don't make a segment of their own are part of the name.
+    {"/a.b/c..d/.e/..f/f./g../h...", L"/a.b/c..d/.e/..f/f./g../h...", "/a.b/c..d/.e/..f/f./g../h...", url_parse::Component(0, 28), true},
+    {"/a.b/c/..", L"/a.b/c/..", "/a.b/", url_parse::Component(0, 5), true},
 
     // ----- escaping tests -----
     {"/foo", L"/foo", "/foo", url_parse::Component(0, 4), true},
@@ -1184,6 +1496,105 @@ TEST(URLCanonTest, Query) {
   EXPECT_EQ("?a%20%00z%01", out_str);
 }
 
+TEST(URLCanonTest, QueryWithPolicy) {
+  url_canon::QueryNormalizationPolicy sorted;
+  sorted.set_sort_keys(true);
+
+  url_canon::QueryNormalizationPolicy tidy;
+  tidy.set_collapse_empty_values(true);
+  tidy.set_remove_duplicates(true);
+  tidy.AddRemovedKey("sid");
+  tidy.AddRemovedKeyPrefix("utm_");
+
+  url_canon::QueryNormalizationPolicy all(tidy);
+  all.set_sort_keys(true);
+
+  struct PolicyCase {
+    const char* input;
+    const url_canon::QueryNormalizationPolicy* policy;
+    const char* expected;  // NULL when the query is removed.
+  } cases[] = {
+    {"b=2&a=1&c=3", &sorted, "?a=1&b=2&c=3"},
+      // Equal keys keep their order; a key sorts before its extensions.
+    {"a=2&ab=0&a=1&=x", &sorted, "?=x&a=2&a=1&ab=0"},
+    {"a&&b=&&", &sorted, "?a&b="},
+    {"", &sorted, NULL},
+    {"&", &sorted, NULL},
+      // Canonicalization happens first: escapes are compared as written.
+    {"b=\xc3\xa9&a b=1", &sorted, "?a%20b=1&b=%C3%A9"},
+    {"a=&b=1&a=&sid=7&utm_source=x&utm_=&utm=1", &tidy, "?a&b=1&utm=1"},
+    {"sid=1&sidx=2&SID=3", &tidy, "?sidx=2&SID=3"},
+    {"utm_medium=email&utm_source=news", &tidy, NULL},
+    {"z=1&utm_a=b&y=&z=1&x=0", &all, "?x=0&y&z=1"},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    int len = static_cast<int>(strlen(cases[i].input));
+    url_parse::Component in_comp(0, len), out_comp;
+
+    std::string out_str;
+    url_canon::StdStringCanonOutput output(&out_str);
+    url_canon::CanonicalizeQueryWithPolicy(cases[i].input, in_comp, NULL,
+                                           *cases[i].policy, &output,
+                                           &out_comp);
+    output.Complete();
+    if (cases[i].expected) {
+      EXPECT_EQ(cases[i].expected, out_str) << i;
+      EXPECT_EQ(1, out_comp.begin) << i;
+      EXPECT_EQ(static_cast<int>(out_str.size()) - 1, out_comp.len) << i;
+    } else {
+      EXPECT_EQ("", out_str) << i;
+      EXPECT_FALSE(out_comp.is_valid()) << i;
+    }
+
+    string16 input16(ConvertUTF8ToUTF16(cases[i].input));
+    out_str.clear();
+    url_canon::StdStringCanonOutput output16(&out_str);
+    url_canon::CanonicalizeQueryWithPolicy(
+        input16.c_str(),
+        url_parse::Component(0, static_cast<int>(input16.length())), NULL,
+        *cases[i].policy, &output16, &out_comp);
+    output16.Complete();
+    EXPECT_EQ(cases[i].expected ? cases[i].expected : "", out_str) << i;
+  }
+
+  // A missing query stays missing.
+  std::string out_str;
+  url_canon::StdStringCanonOutput output(&out_str);
+  url_parse::Component out_comp;
+  url_canon::CanonicalizeQueryWithPolicy("", url_parse::Component(), NULL,
+                                         all, &output, &out_comp);
+  output.Complete();
+  EXPECT_EQ("", out_str);
+  EXPECT_FALSE(out_comp.is_valid());
+
+  // Through the standard URL canonicalizer.
+  const char url[] = "HTTP://Example.COM/p?utm_source=a&q=x&b=#ref";
+  url_parse::Parsed parsed;
+  url_parse::ParseStandardURL(url, arraysize(url) - 1, &parsed);
+  url_parse::Parsed new_parsed;
+  out_str.clear();
+  url_canon::StdStringCanonOutput url_output(&out_str);
+  EXPECT_TRUE(url_canon::CanonicalizeStandardURLWithQueryPolicy(
+      url, arraysize(url) - 1, parsed, NULL, all, &url_output, &new_parsed));
+  url_output.Complete();
+  EXPECT_EQ("http://example.com/p?b&q=x#ref", out_str);
+  EXPECT_EQ("b&q=x", out_str.substr(new_parsed.query.begin,
+                                    new_parsed.query.len));
+  EXPECT_EQ("ref", out_str.substr(new_parsed.ref.begin, new_parsed.ref.len));
+
+  const char no_pairs[] = "http://example.com/?utm_source=a";
+  url_parse::ParseStandardURL(no_pairs, arraysize(no_pairs) - 1, &parsed);
+  out_str.clear();
+  url_canon::StdStringCanonOutput no_pairs_output(&out_str);
+  EXPECT_TRUE(url_canon::CanonicalizeStandardURLWithQueryPolicy(
+      no_pairs, arraysize(no_pairs) - 1, parsed, NULL, all, &no_pairs_output,
+      &new_parsed));
+  no_pairs_output.Complete();
+  EXPECT_EQ("http://example.com/", out_str);
+  EXPECT_FALSE(new_parsed.query.is_valid());
+}
+
 TEST(URLCanonTest, Ref) {
   // Refs are trivial, it just checks the encoding.
   DualComponentCase ref_cases[] = {
@@ -1321,6 +1732,182 @@ TEST(URLCanonTest, CanonicalizeStandardURL) {
   }
 }
 
+// The fused canonicalizer must give exactly the two-phase result for the
+// URLs it takes, and leave the output alone for the ones it doesn't.
+TEST(URLCanonTest, FusedStandardURL) {
+  struct FusedCase {
+    const char* input;
+    bool handled;
+  } cases[] = {
+    {"http://www.google.com/", true},
+    {"HTTP://WWW.Google.COM/Foo/Bar.HTML", true},
+    {"http://www.google.com", true},
+    {"http://www.google.com?q", true},
+    {"http://www.google.com#ref", true},
+    {"https://foo:443/", true},
+    {"https://foo:0443/a", true},
+    {"https://foo:/a", true},
+    {"ws://host:81/chat", true},
+    {"wss://my_host-1.example/", true},
+    {"ftp://ftp.example.net:21/pub/README", true},
+    {"http://ex.org/foo%20bar/baz qux.html", true},
+    {"http://ex.org/%7e%zz%2f<>\"^`{|}", false},
+    {"http://ex.org/%2f%zz<>\"^`{|}\x7f", true},
+    {"http://ex.org/\xe4\xbd\xa0", true},
+    {"http://ex.org/.x/..y/...", true},
+    {"http://ex.org/a?b=c&d=#e", true},
+    {"http://ex.org/a?q=\"<x>\x01\x7f", true},
+    {"http://ex.org/a#\xe4\xbd\xa0 \x01x", true},
+    {"http://ex.org/a?%E4%BD%A0#%zz", true},
+      // Everything below needs the full parser.
+    {"", false},
+    {" http://ex.org/", false},
+    {"http://ex.org/ ", false},
+    {"http://ex.org/\tc", false},
+    {"http://ex.org/c?\n", false},
+    {"http://ex.org/c#\r", false},
+    {"http:a.b/", false},
+    {"http:///a.b/", false},
+    {"http:\\\\a.b\\c", false},
+    {"http://ex.org\\c", false},
+    {"http://user@a.b/", false},
+    {"http://192.168.0.1/", false},
+    {"http://cafe.be/", false},
+    {"http://[::1]/", false},
+    {"http://%41.com/", false},
+    {"http://\xe4\xbd\xa0.com/", false},
+    {"http://ex.org:99999/", false},
+    {"http://ex.org:8o/", false},
+    {"http://:80/", false},
+    {"http://ex.org/./c", false},
+    {"http://ex.org/c/..", false},
+    {"http://ex.org/c/..?q", false},
+    {"http://ex.org/c/.%2e/", false},
+    {"http://ex.org/%41", false},
+    {"http://ex.org/%00", false},
+    {"http://ex.org/?\xe4\xbd\xa0", false},
+    {"mailto:a@b.com", false},
+    {"file:///foo", false},
+    {"filesystem:http://ex.org/temporary/", false},
+    {"data:text/plain,x", false},
+    {"c://ex.org/", false},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    const FusedCase& cur = cases[i];
+    int url_len = static_cast<int>(strlen(cur.input));
+    std::string out_str("prefix");
+    url_canon::StdStringCanonOutput output(&out_str);
+    url_parse::Parsed out_parsed;
+    bool handled = url_canon::FusedCanonicalizeStandardURL(
+        cur.input, url_len, &output, &out_parsed);
+    output.Complete();
+    EXPECT_EQ(cur.handled, handled) << cur.input;
+    if (!handled) {
+      EXPECT_EQ("prefix", out_str);
+      continue;
+    }
+
+    url_parse::Parsed parsed;
+    url_parse::ParseStandardURL(cur.input, url_len, &parsed);
+    std::string expected_str("prefix");
+    url_canon::StdStringCanonOutput expected_output(&expected_str);
+    url_parse::Parsed expected_parsed;
+    EXPECT_TRUE(url_canon::CanonicalizeStandardURL(
+        cur.input, url_len, parsed, NULL, &expected_output, &expected_parsed));
+    expected_output.Complete();
+    EXPECT_EQ(expected_str, out_str);
+    EXPECT_TRUE(expected_parsed.scheme == out_parsed.scheme);
+    EXPECT_TRUE(expected_parsed.username == out_parsed.username);
+    EXPECT_TRUE(expected_parsed.password == out_parsed.password);
+    EXPECT_TRUE(expected_parsed.host == out_parsed.host);
+    EXPECT_TRUE(expected_parsed.port == out_parsed.port);
+    EXPECT_TRUE(expected_parsed.path == out_parsed.path);
+    EXPECT_TRUE(expected_parsed.query == out_parsed.query);
+    EXPECT_TRUE(expected_parsed.ref == out_parsed.ref);
+
+    // 16-bit input takes the same URLs, except for non-ASCII paths, and the
+    // non-ASCII refs come out as UTF-8.
+    string16 input16(ConvertUTF8ToUTF16(cur.input));
+    std::string out_str16;
+    url_canon::StdStringCanonOutput output16(&out_str16);
+    url_parse::Parsed out_parsed16;
+    if (url_canon::FusedCanonicalizeStandardURL(
+            input16.data(), static_cast<int>(input16.length()), &output16,
+            &out_parsed16)) {
+      output16.Complete();
+      EXPECT_EQ(expected_str.substr(6), out_str16);
+    } else {
+      EXPECT_TRUE(strstr(cur.input, "\xe4\xbd\xa0") != NULL) << cur.input;
+    }
+  }
+}
+
+TEST(URLCanonTest, FusedFileURL) {
+  struct FusedCase {
+    const char* input;
+    bool handled;
+  } cases[] = {
+    {"file:///", true},
+    {"file:///usr/local/share/doc/index.html", true},
+    {"FILE:///C:/foo/bar.txt", true},
+    {"file:///foo bar/%2f?q=\"x\"#ref", true},
+    {"file:///foo/\xe4\xbd\xa0.txt", true},
+      // Everything below needs the full parser.
+    {"file:", false},
+    {"file:/foo", false},
+    {"file://host/foo", false},
+    {"file:////host/foo", false},
+    {"file:///\\host\\foo", false},
+    {"file:///foo\\bar", false},
+    {"file:///foo/%7e", false},
+    {"file:///foo/../bar", false},
+    {"file:///foo/%2e%2e/bar", false},
+    {"file:///foo\tbar", false},
+    {"file:///foo ", false},
+    {" file:///foo", false},
+    {"files:///foo", false},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    const FusedCase& cur = cases[i];
+    int url_len = static_cast<int>(strlen(cur.input));
+    std::string out_str("prefix");
+    url_canon::StdStringCanonOutput output(&out_str);
+    url_parse::Parsed out_parsed;
+    bool handled = url_canon::FusedCanonicalizeFileURL(
+        cur.input, url_len, &output, &out_parsed);
+    output.Complete();
+#ifdef WIN32
+    EXPECT_FALSE(handled);
+    continue;
+#endif
+    EXPECT_EQ(cur.handled, handled) << cur.input;
+    if (!handled) {
+      EXPECT_EQ("prefix", out_str);
+      continue;
+    }
+
+    url_parse::Parsed parsed;
+    url_parse::ParseFileURL(cur.input, url_len, &parsed);
+    std::string expected_str("prefix");
+    url_canon::StdStringCanonOutput expected_output(&expected_str);
+    url_parse::Parsed expected_parsed;
+    EXPECT_TRUE(url_canon::CanonicalizeFileURL(
+        cur.input, url_len, parsed, NULL, &expected_output, &expected_parsed));
+    expected_output.Complete();
+    EXPECT_EQ(expected_str, out_str);
+    EXPECT_TRUE(expected_parsed.scheme == out_parsed.scheme);
+    EXPECT_TRUE(expected_parsed.username == out_parsed.username);
+    EXPECT_TRUE(expected_parsed.password == out_parsed.password);
+    EXPECT_TRUE(expected_parsed.host == out_parsed.host);
+    EXPECT_TRUE(expected_parsed.port == out_parsed.port);
+    EXPECT_TRUE(expected_parsed.path == out_parsed.path);
+    EXPECT_TRUE(expected_parsed.query == out_parsed.query);
+    EXPECT_TRUE(expected_parsed.ref == out_parsed.ref);
+  }
+}
+
 // The codepath here is the same as for regular canonicalization, so we just
 // need to test that things are replaced or not correctly.
 TEST(URLCanonTest, ReplaceStandardURL) {
@@ -1984,6 +2571,9 @@ TEST(URLCanonTest, ResolveRelativeURL) {
     {"http://host/a", true, false, "///another/path", true, true, true, "http://another/path"},
     {"http://host/a", true, false, "//Another\\path", true, true, true, "http://another/path"},
     {"http://host/a", true, false, "//", true, true, false, "http:"},
+    {"http://host/a", true, false, "//u:p@Another:80/b/../c", true, true, true, "http://u:p@another/c"},
+    {"https://host/a", true, false, "//another:80/%7e?q r#s t", true, true, true, "https://another:80/~?q%20r#s t"},
+    {"http://host/a", true, false, "//another:x/", true, true, false, "http://another:x/"},
       // IE will also allow one or the other to be a backslash to get the same
       // behavior.
     {"http://host/a", true, false, "\\/another/path", true, true, true, "http://another/path"},
@@ -2094,6 +2684,63 @@ TEST(URLCanonTest, ResolveRelativeURL) {
   }
 }
 
+// Relative URLs with a host are canonicalized from the 16-bit input rather
+// than converted to UTF-8 first, which must not make a difference.
+TEST(URLCanonTest, ResolveRelativeHost16) {
+  const char kBase[] = "http://host/a";
+  const char* cases[] = {
+    "//another/path?query#ref",
+    "//User:Pass@ANOTHER:8080/b/./c/../d?q=\xc3\xa9",
+    "//\xe4\xbd\xa0\xe5\xa5\xbd.com/x",
+    "//another/\xef\xbf\xbd#\xc3\xa9",
+    "//another:99999/",
+    "//a%20b/",
+    "//",
+  };
+
+  url_parse::Parsed base_parsed;
+  url_parse::ParseStandardURL(kBase, static_cast<int>(strlen(kBase)),
+                              &base_parsed);
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    int len = static_cast<int>(strlen(cases[i]));
+    std::string expected;
+    url_canon::StdStringCanonOutput expected_output(&expected);
+    url_parse::Parsed expected_parsed;
+    bool expected_valid = url_canon::ResolveRelativeURL(
+        kBase, base_parsed, false, cases[i], url_parse::Component(0, len),
+        NULL, &expected_output, &expected_parsed);
+    expected_output.Complete();
+
+    string16 input16(ConvertUTF8ToUTF16(cases[i]));
+    std::string resolved;
+    url_canon::StdStringCanonOutput output(&resolved);
+    url_parse::Parsed resolved_parsed;
+    bool valid = url_canon::ResolveRelativeURL(
+        kBase, base_parsed, false, input16.data(),
+        url_parse::Component(0, static_cast<int>(input16.length())),
+        NULL, &output, &resolved_parsed);
+    output.Complete();
+
+    EXPECT_EQ(expected_valid, valid) << cases[i];
+    EXPECT_EQ(expected, resolved) << cases[i];
+    EXPECT_TRUE(ParsedIsEqual(expected_parsed, resolved_parsed)) << cases[i];
+  }
+
+  // An unpaired surrogate has no UTF-8 spelling, so it can't be in the table
+  // above. It becomes U+FFFD like any other invalid input character.
+  string16 surrogate(ConvertUTF8ToUTF16("//another/"));
+  surrogate.push_back(0xD800);
+  std::string resolved;
+  url_canon::StdStringCanonOutput output(&resolved);
+  url_parse::Parsed resolved_parsed;
+  EXPECT_TRUE(url_canon::ResolveRelativeURL(
+      kBase, base_parsed, false, surrogate.data(),
+      url_parse::Component(0, static_cast<int>(surrogate.length())),
+      NULL, &output, &resolved_parsed));
+  output.Complete();
+  EXPECT_EQ("http://another/%EF%BF%BD", resolved);
+}
+
 // It used to be when we did a replacement with a long buffer of UTF-16
 // characters, we would get invalid data in the URL. This is because the buffer
 // it used to hold the UTF-8 data was resized, while some pointers were still
@@ -2131,3 +2778,286 @@ TEST(URLCanonTest, ReplacementOverflow) {
     expected.push_back('a');
   EXPECT_TRUE(expected == repl_str);
 }
+
+TEST(URLCanonTest, RemoveURLWhitespace) {
+  struct WhitespaceCase {
+    const char* input;
+    const char* expected;
+  } cases[] = {
+    {"", ""},
+    {"http://www.google.com/", "http://www.google.com/"},
+    {"\thttp://www.google.com/", "http://www.google.com/"},
+    {"http://www.google.com/\n", "http://www.google.com/"},
+    {"ht\ttp://www.go\rogle.co\nm/", "http://www.google.com/"},
+    {"\r\n\t", ""},
+    // Whitespace on both sides of the 8, 16 and 32 character boundaries
+    // where the vectorized scan switches blocks.
+    {"0123456\t789abcde\tfghijklmnopqrstu\nvwxyz",
+     "0123456789abcdefghijklmnopqrstuvwxyz"},
+    {"01234567\t89abcdef\tghijklmnopqrstuv\nwxyz",
+     "0123456789abcdefghijklmnopqrstuvwxyz"},
+    {"0123456789abcdefghijklmnopqrstuvwxyz\r",
+     "0123456789abcdefghijklmnopqrstuvwxyz"},
+    {"a\tb", "ab"},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    int input_len = static_cast<int>(strlen(cases[i].input));
+    url_canon::RawCanonOutputT<char> buffer;
+    int output_len;
+    const char* output = url_canon::RemoveURLWhitespace(
+        cases[i].input, input_len, &buffer, &output_len);
+    EXPECT_EQ(std::string(cases[i].expected), std::string(output, output_len));
+    // When nothing is removed, the input buffer should be returned as-is.
+    if (strlen(cases[i].expected) == strlen(cases[i].input))
+      EXPECT_EQ(cases[i].input, output);
+
+    string16 input16(ConvertUTF8ToUTF16(cases[i].input));
+    url_canon::RawCanonOutputT<char16> buffer16;
+    const char16* output16 = url_canon::RemoveURLWhitespace(
+        input16.data(), input_len, &buffer16, &output_len);
+    EXPECT_EQ(std::string(cases[i].expected),
+              ConvertUTF16ToUTF8(string16(output16, output_len)));
+  }
+}
+
+// The vectorized run scanners must agree with the per-character tables they
+// shortcut, at every offset within and across vector blocks.
+TEST(URLCanonTest, CountCopyableChars) {
+  for (int ch = 0; ch < 0x100; ch++) {
+    for (int pos = 0; pos < 40; pos += 7) {
+      std::string input(40, 'a');
+      input[pos] = static_cast<char>(ch);
+      string16 input16(input.begin(), input.end());
+      input16[pos] = static_cast<char16>(ch);
+
+      int expected_query = url_canon::IsQueryChar(ch) ? 40 : pos;
+      EXPECT_EQ(expected_query, url_canon::CountCopyableChars(
+          input.data(), 40, url_canon::kQueryCopyableChars)) << ch;
+      EXPECT_EQ(expected_query, url_canon::CountCopyableChars(
+          input16.data(), 40, url_canon::kQueryCopyableChars)) << ch;
+
+      int expected_find = ch == '%' ? pos : 40;
+      EXPECT_EQ(expected_find, url_canon::FindChar(input.data(), 40, '%'));
+
+      int expected_ascii = ch < 0x80 ? 40 : pos;
+      EXPECT_EQ(expected_ascii, url_canon::CountASCIIChars(input.data(), 40));
+      EXPECT_EQ(expected_ascii,
+                url_canon::CountASCIIChars(input16.data(), 40));
+    }
+  }
+
+  // Wide characters whose low byte is copyable are still not copyable.
+  string16 wide(20, 'a');
+  wide[17] = 0x161;
+  EXPECT_EQ(17, url_canon::CountCopyableChars(
+      wide.data(), 20, url_canon::kQueryCopyableChars));
+  EXPECT_EQ(17, url_canon::CountASCIIChars(wide.data(), 20));
+}
+
+// Paths, queries and refs long enough to exercise the bulk copies, with
+// characters needing escaping or special handling on block boundaries.
+TEST(URLCanonTest, LongComponents) {
+  struct LongCase {
+    const char* input;
+    const char* expected;
+  } cases[] = {
+    {"http://a/0123456789abcdef0123456789abcdef/index.html",
+     "http://a/0123456789abcdef0123456789abcdef/index.html"},
+    {"http://a/0123456789abcd/./ef0123456789abc/../def/x y",
+     "http://a/0123456789abcd/def/x%20y"},
+    {"http://a/?0123456789abcdefghijklm\"no<pqrstuvwxyz 0123",
+     "http://a/?0123456789abcdefghijklm%22no%3Cpqrstuvwxyz%200123"},
+    {"http://a/#0123456789abcdefghijklmno pqrstu\x01vwxyz",
+     "http://a/#0123456789abcdefghijklmno pqrstu%01vwxyz"},
+  };
+
+  for (size_t i = 0; i < ARRAYSIZE(cases); i++) {
+    int url_len = static_cast<int>(strlen(cases[i].input));
+    url_parse::Parsed parsed;
+    url_parse::ParseStandardURL(cases[i].input, url_len, &parsed);
+
+    url_parse::Parsed out_parsed;
+    std::string out_str;
+    url_canon::StdStringCanonOutput output(&out_str);
+    EXPECT_TRUE(url_canon::CanonicalizeStandardURL(
+        cases[i].input, url_len, parsed, NULL, &output, &out_parsed));
+    output.Complete();
+    EXPECT_EQ(cases[i].expected, out_str);
+
+    string16 wide_input(ConvertUTF8ToUTF16(cases[i].input));
+    url_parse::ParseStandardURL(wide_input.data(), url_len, &parsed);
+    out_str.clear();
+    url_canon::StdStringCanonOutput output16(&out_str);
+    EXPECT_TRUE(url_canon::CanonicalizeStandardURL(
+        wide_input.data(), url_len, parsed, NULL, &output16, &out_parsed));
+    output16.Complete();
+    EXPECT_EQ(cases[i].expected, out_str);
+  }
+}
+
+TEST(URLCanonTest, ArenaCanonOutput) {
+  url_canon::URLArena arena(128);
+
+  // Outputs grow in place and keep only what they wrote.
+  url_canon::ArenaCanonOutput output(&arena);
+  EXPECT_EQ(NULL, output.Finish());
+  output.Resize(16);
+  EXPECT_EQ(NULL, output.Finish());
+  EXPECT_EQ(0, arena.bytes_allocated());
+  std::string expected;
+  for (int i = 0; i < 40; i++) {
+    output.push_back(static_cast<char>('a' + i % 26));
+    expected.push_back(static_cast<char>('a' + i % 26));
+  }
+  const char* first = output.Finish();
+  EXPECT_EQ(expected, std::string(first, 40));
+  EXPECT_EQ(0, output.length());
+  EXPECT_EQ(40, arena.bytes_allocated());
+
+  // The next output starts right after, in the same block, and the first
+  // one is untouched when it outgrows it.
+  url_parse::Component out_comp;
+  url_canon::CanonicalizePath("/a/./b/../c", url_parse::Component(0, 11),
+                              &output, &out_comp);
+  const char* second = output.Finish();
+  EXPECT_EQ(first + 40, second);
+  EXPECT_EQ("/a/c", std::string(second, 4));
+  const std::string long_path = "/" + std::string(199, 'x');
+  url_canon::CanonicalizePath(long_path.data(),
+                              url_parse::Component(0, 200),
+                              &output, &out_comp);
+  const char* third = output.Finish();
+  EXPECT_EQ(long_path, std::string(third, 200));
+  EXPECT_EQ(expected, std::string(first, 40));
+  EXPECT_EQ("/a/c", std::string(second, 4));
+
+  // An allocation made while an output is open isn't overwritten when the
+  // output grows.
+  output.push_back('1');
+  char* other = static_cast<char*>(arena.Allocate(4));
+  memcpy(other, "keep", 4);
+  for (int i = 0; i < 100; i++)
+    output.push_back('2');
+  EXPECT_EQ("keep", std::string(other, 4));
+  EXPECT_EQ('1', output.Finish()[0]);
+
+  // Reset starts over in the first block.
+  arena.Reset();
+  EXPECT_EQ(0, arena.bytes_allocated());
+  output.push_back('z');
+  EXPECT_EQ(first, output.Finish());
+}
+
+TEST(URLCanonTest, CanonStats) {
+  EXPECT_STREQ("whitespace_removed", url_canon::CanonStatName(
+      url_canon::CANON_STAT_WHITESPACE_REMOVED));
+  EXPECT_STREQ("charset_conversions", url_canon::CanonStatName(
+      url_canon::CANON_STAT_CHARSET_CONVERSIONS));
+
+  url_canon::ResetThreadCanonStats();
+  std::string out_str;
+  url_canon::StdStringCanonOutput output(&out_str);
+  url_parse::Component out_comp;
+
+  // Two dot segments and one escape.
+  url_canon::CanonicalizePath("/a/./b/../c d", url_parse::Component(0, 13),
+                              &output, &out_comp);
+
+  // An IPv4 and an IPv6 host, and one that needs IDN.
+  url_canon::CanonicalizeHost("192.168.0.1", url_parse::Component(0, 11),
+                              &output, &out_comp);
+  url_canon::CanonicalizeHost("[::1]", url_parse::Component(0, 5),
+                              &output, &out_comp);
+  const char kIDNHost[] = "stats-\xe4\xbd\xa0\xe5\xa5\xbd.test";
+  url_canon::CanonicalizeHost(kIDNHost,
+                              url_parse::Component(0, strlen(kIDNHost)),
+                              &output, &out_comp);
+
+  // Whitespace only counts when there is some.
+  url_canon::RawCanonOutputT<char> whitespace_buffer;
+  int out_len;
+  url_canon::RemoveURLWhitespace("http://a/", 9, &whitespace_buffer, &out_len);
+  url_canon::RemoveURLWhitespace("http://a/\n", 10, &whitespace_buffer,
+                                 &out_len);
+
+  // An output that outgrows its stack buffer.
+  url_canon::RawCanonOutput<8> small;
+  {
+    url_canon::ScopedOutputGrowthStat growth_stat(&small);
+    small.Append("a fairly long string", 20);
+  }
+  output.Complete();
+
+  url_canon::CanonStats stats;
+  url_canon::GetThreadCanonStats(&stats);
+  if (!url_canon::CanonStatsEnabled()) {
+    // Compiled out, everything stays at 0.
+    for (int i = 0; i < url_canon::CANON_STAT_COUNT; i++)
+      EXPECT_EQ(0, stats.counts[i]) << url_canon::CanonStatName(
+          static_cast<url_canon::CanonStat>(i));
+    return;
+  }
+  EXPECT_EQ(2, stats.counts[url_canon::CANON_STAT_DOT_SEGMENTS]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_ESCAPED_CHARS]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_IPV4_HOSTS]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_IPV6_HOSTS]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_IDN_CONVERSIONS]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_WHITESPACE_REMOVED]);
+  EXPECT_EQ(1, stats.counts[url_canon::CANON_STAT_OUTPUT_GROWTHS]);
+  EXPECT_EQ(0, stats.counts[url_canon::CANON_STAT_CHARSET_CONVERSIONS]);
+
+  url_canon::ResetThreadCanonStats();
+  url_canon::GetThreadCanonStats(&stats);
+  for (int i = 0; i < url_canon::CANON_STAT_COUNT; i++)
+    EXPECT_EQ(0, stats.counts[i]);
+}
+
+TEST(URLCanonTest, CharClassTable) {
+  for (int i = 0; i < 0x100; i++) {
+    unsigned char ch = static_cast<unsigned char>(i);
+    uint32 char_class = url_canon::LookupCharClass(ch);
+
+    // The shared classes are the same as kSharedCharTypeTable's.
+    EXPECT_EQ(url_canon::kSharedCharTypeTable[i], (char_class >> 8) & 0x7f)
+        << "ch = " << i;
+
+    bool is_alpha = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+    bool is_digit = ch >= '0' && ch <= '9';
+    EXPECT_EQ(is_alpha,
+              url_canon::IsCharOfClass<url_canon::CHAR_CLASS_SCHEME_FIRST>(ch));
+    EXPECT_EQ(is_alpha || is_digit || ch == '+' || ch == '-' || ch == '.',
+              url_canon::IsCharOfClass<url_canon::CHAR_CLASS_SCHEME>(ch));
+    EXPECT_EQ(ch == '\t' || ch == '\n' || ch == '\r',
+              url_canon::IsCharOfClass<url_canon::CHAR_CLASS_WHITESPACE>(ch));
+    EXPECT_EQ(ch == '/' || ch == '\\' || ch == '?' || ch == '#',
+              url_canon::IsCharOfClass<
+                  url_canon::CHAR_CLASS_AUTHORITY_TERMINATOR>(ch));
+    EXPECT_EQ(ch >= 0x80,
+              url_canon::IsCharOfClass<url_canon::CHAR_CLASS_NON_ASCII>(ch));
+    EXPECT_FALSE(
+        url_canon::IsCharOfClass<url_canon::CHAR_CLASS_HOST>(ch) &&
+        url_canon::IsCharOfClass<url_canon::CHAR_CLASS_HOST_ESCAPE>(ch));
+    if (ch < 0x80) {
+      EXPECT_EQ(ch >= 'A' && ch <= 'Z' ? ch + ('a' - 'A') : ch,
+                static_cast<unsigned char>(
+                    url_canon::CanonicalCharOfClass(char_class)));
+    }
+  }
+
+  // UTF-16 code units past ASCII are all alike.
+  const char16 kWide[] = { 0x80, 0xff, 0x100, 0x2f, 0xd800, 0xffff };
+  for (size_t i = 0; i < ARRAYSIZE(kWide); i++) {
+    EXPECT_EQ(kWide[i] >= 0x80,
+              url_canon::IsCharOfClass<url_canon::CHAR_CLASS_NON_ASCII>(
+                  kWide[i]));
+    EXPECT_EQ(kWide[i] == '/',
+              url_canon::IsCharOfClass<
+                  url_canon::CHAR_CLASS_AUTHORITY_TERMINATOR>(kWide[i]));
+  }
+  const char16 kWideSpec[] = { 'a', 0x12f, 'b', '/', 'c' };
+  EXPECT_EQ(3, (url_canon::FindCharOfClass<
+                url_canon::CHAR_CLASS_AUTHORITY_TERMINATOR>(kWideSpec, 0, 5)));
+  EXPECT_EQ(2, (url_canon::FindCharOfClass<url_canon::CHAR_CLASS_SCHEME>(
+                kWideSpec, 1, 5)));
+}
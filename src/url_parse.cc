@@ -39,6 +39,7 @@
 #include <stdlib.h>
 
 #include "base/logging.h"
+#include "googleurl/src/url_canon_char_class.h"
 #include "googleurl/src/url_parse_internal.h"
 #include "googleurl/src/url_util.h"
 #include "googleurl/src/url_util_internal.h"
@@ -48,8 +49,9 @@ namespace url_parse {
 namespace {
 
 // Returns true if the given character is a valid digit to use in a port.
-inline bool IsPortDigit(char16 ch) {
-  return ch >= '0' && ch <= '9';
+template<typename CHAR>
+inline bool IsPortDigit(CHAR ch) {
+  return url_canon::IsCharOfClass<url_canon::CHAR_CLASS_DEC>(ch);
 }
 
 // Returns the offset of the next authority terminator in the input starting
@@ -59,11 +61,9 @@ template<typename CHAR>
 int FindNextAuthorityTerminator(const CHAR* spec,
                                 int start_offset,
                                 int spec_len) {
-  for (int i = start_offset; i < spec_len; i++) {
-    if (IsAuthorityTerminator(spec[i]))
-      return i;
-  }
-  return spec_len;  // Not found.
+  return url_canon::FindCharOfClass<
+      url_canon::CHAR_CLASS_AUTHORITY_TERMINATOR>(spec, start_offset,
+                                                  spec_len);
 }
 
 template<typename CHAR>
@@ -803,7 +803,8 @@ bool ExtractScheme(const char16* url, int url_len, Component* scheme) {
 // This handles everything that may be an authority terminator, including
 // backslash. For special backslash handling see DoParseAfterScheme.
 bool IsAuthorityTerminator(char16 ch) {
-  return IsURLSlash(ch) || ch == '?' || ch == '#';
+  return url_canon::IsCharOfClass<url_canon::CHAR_CLASS_AUTHORITY_TERMINATOR>(
+      ch);
 }
 
 void ExtractFileName(const char* url,
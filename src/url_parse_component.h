@@ -0,0 +1,61 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Looks up the components of a url_parse::Parsed by ComponentType, for code
+// that loops over all of them or stores them in ComponentType order.
+
+#ifndef GOOGLEURL_SRC_URL_PARSE_COMPONENT_H__
+#define GOOGLEURL_SRC_URL_PARSE_COMPONENT_H__
+
+#include "googleurl/src/url_parse.h"
+
+namespace url_parse {
+
+// The component of |parsed| for |type|, a Parsed::ComponentType. Anything
+// past QUERY is the ref.
+inline Component* MutableComponent(Parsed* parsed, int type) {
+  switch (type) {
+    case Parsed::SCHEME: return &parsed->scheme;
+    case Parsed::USERNAME: return &parsed->username;
+    case Parsed::PASSWORD: return &parsed->password;
+    case Parsed::HOST: return &parsed->host;
+    case Parsed::PORT: return &parsed->port;
+    case Parsed::PATH: return &parsed->path;
+    case Parsed::QUERY: return &parsed->query;
+    default: return &parsed->ref;
+  }
+}
+
+inline const Component& ComponentOfType(const Parsed& parsed, int type) {
+  return *MutableComponent(const_cast<Parsed*>(&parsed), type);
+}
+
+}  // namespace url_parse
+
+#endif  // GOOGLEURL_SRC_URL_PARSE_COMPONENT_H__
@@ -0,0 +1,121 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_parse_data.h"
+
+namespace url_parse {
+
+namespace {
+
+// Returns true if the |len| characters at |str| are |lower_ascii| in any
+// case.
+template<typename CHAR>
+bool EqualsLowerASCII(const CHAR* str, int len, const char* lower_ascii) {
+  for (int i = 0; i < len; i++, lower_ascii++) {
+    CHAR ch = str[i];
+    if (ch >= 'A' && ch <= 'Z')
+      ch += 'a' - 'A';
+    if (!*lower_ascii || ch != *lower_ascii)
+      return false;
+  }
+  return !*lower_ascii;
+}
+
+template<typename CHAR>
+bool DoExtractDataURLComponents(const CHAR* spec,
+                                const Component& path,
+                                DataURLComponents* data) {
+  *data = DataURLComponents();
+  if (!path.is_valid())
+    return false;
+
+  int end = path.end();
+  int comma = path.begin;
+  while (comma < end && spec[comma] != ',')
+    comma++;
+
+  int type_end = path.begin;
+  while (type_end < comma && spec[type_end] != ';')
+    type_end++;
+  data->mime_type = MakeRange(path.begin, type_end);
+  if (type_end < comma) {
+    data->parameters = MakeRange(type_end, comma);
+
+    // The last parameter starts after the last semicolon.
+    int last = comma;
+    while (spec[last - 1] != ';')
+      last--;
+    data->is_base64 = EqualsLowerASCII(&spec[last], comma - last, "base64");
+  }
+
+  if (comma == end)
+    return false;
+  data->body = MakeRange(comma + 1, end);
+  return true;
+}
+
+template<typename CHAR>
+bool DoParseDataURL(const CHAR* spec, int spec_len, Parsed* parsed,
+                    DataURLComponents* data) {
+  ParsePathURL(spec, spec_len, parsed);
+  if (!parsed->scheme.is_valid() ||
+      !EqualsLowerASCII(&spec[parsed->scheme.begin], parsed->scheme.len,
+                        "data"))
+    return false;
+  return DoExtractDataURLComponents(spec, parsed->path, data);
+}
+
+}  // namespace
+
+DataURLComponents::DataURLComponents() : is_base64(false) {
+}
+
+bool ExtractDataURLComponents(const char* spec,
+                              const Component& path,
+                              DataURLComponents* data) {
+  return DoExtractDataURLComponents(spec, path, data);
+}
+
+bool ExtractDataURLComponents(const char16* spec,
+                              const Component& path,
+                              DataURLComponents* data) {
+  return DoExtractDataURLComponents(spec, path, data);
+}
+
+bool ParseDataURL(const char* spec, int spec_len, Parsed* parsed,
+                  DataURLComponents* data) {
+  return DoParseDataURL(spec, spec_len, parsed, data);
+}
+
+bool ParseDataURL(const char16* spec, int spec_len, Parsed* parsed,
+                  DataURLComponents* data) {
+  return DoParseDataURL(spec, spec_len, parsed, data);
+}
+
+}  // namespace url_parse
@@ -0,0 +1,86 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Splits "data:" URLs into their media type, parameters and body. Only the
+// part before the comma is looked at, so finding out what a megabyte-long
+// inline image is takes as long as for any short URL, and the body doesn't
+// have to be canonicalized or even copied first.
+
+#ifndef GOOGLEURL_SRC_URL_PARSE_DATA_H__
+#define GOOGLEURL_SRC_URL_PARSE_DATA_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_parse {
+
+// The parts of a data: URL's path, "text/html;charset=utf-8;base64,PGI+".
+// All of them are offsets into the same spec as the path.
+struct GURL_API DataURLComponents {
+  // Every component invalid, not base64.
+  DataURLComponents();
+
+  // The media type as written, "text/html". Valid but empty when the URL
+  // leaves it out, which means "text/plain;charset=US-ASCII".
+  Component mime_type;
+
+  // The parameters after the media type, with their leading semicolon:
+  // ";charset=utf-8;base64". Invalid when there are none.
+  Component parameters;
+
+  // True when the last parameter is "base64", in any case.
+  bool is_base64;
+
+  // Everything after the comma. Invalid when there's no comma; a URL like
+  // that is malformed, but the other components are still filled in.
+  Component body;
+};
+
+// Splits the |path| of a data: URL within |spec|. The spec can be raw input
+// that went through ParsePathURL or the spec of a canonical URL. Returns
+// true when there's a comma, so the URL is well formed.
+GURL_API bool ExtractDataURLComponents(const char* spec,
+                                       const Component& path,
+                                       DataURLComponents* data);
+GURL_API bool ExtractDataURLComponents(const char16* spec,
+                                       const Component& path,
+                                       DataURLComponents* data);
+
+// Parses |spec| like ParsePathURL into |*parsed| and then splits its path
+// into |*data|. Returns false when the scheme isn't "data" (with |*data|
+// left alone) or when there's no comma.
+GURL_API bool ParseDataURL(const char* spec, int spec_len, Parsed* parsed,
+                           DataURLComponents* data);
+GURL_API bool ParseDataURL(const char16* spec, int spec_len, Parsed* parsed,
+                           DataURLComponents* data);
+
+}  // namespace url_parse
+
+#endif  // GOOGLEURL_SRC_URL_PARSE_DATA_H__
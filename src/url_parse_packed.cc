@@ -0,0 +1,107 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_parse_packed.h"
+
+#include <string.h>
+
+#include "googleurl/src/url_parse_component.h"
+
+namespace url_parse {
+
+namespace {
+
+bool FitsIn16Bits(const Component& component) {
+  return component.begin >= 0 && component.begin <= kuint16max &&
+      component.len <= kuint16max;
+}
+
+}  // namespace
+
+PackedParsed::PackedParsed() : valid_mask_(0) {
+  memset(components_, 0, sizeof(components_));
+  memset(inner_components_, 0, sizeof(inner_components_));
+}
+
+// static
+bool PackedParsed::Pack(const Parsed& parsed, PackedParsed* packed) {
+  const Parsed* inner_parsed = parsed.inner_parsed();
+  if (inner_parsed && (inner_parsed->query.is_valid() ||
+                       inner_parsed->ref.is_valid() ||
+                       inner_parsed->inner_parsed()))
+    return false;
+
+  PackedParsed result;
+  for (int i = 0; i <= Parsed::REF; i++) {
+    const Component& outer = ComponentOfType(parsed, i);
+    if (!FitsIn16Bits(outer))
+      return false;
+    result.components_[i].begin = static_cast<uint16>(outer.begin);
+    if (outer.is_valid()) {
+      result.components_[i].len = static_cast<uint16>(outer.len);
+      result.valid_mask_ |= 1 << i;
+    }
+  }
+  if (inner_parsed) {
+    result.valid_mask_ |= kHasInnerBit;
+    for (int i = 0; i < kNumInnerComponents; i++) {
+      const Component& inner = ComponentOfType(*inner_parsed, i);
+      if (!FitsIn16Bits(inner))
+        return false;
+      result.inner_components_[i].begin = static_cast<uint16>(inner.begin);
+      if (inner.is_valid()) {
+        result.inner_components_[i].len = static_cast<uint16>(inner.len);
+        result.valid_mask_ |= 1 << (kInnerFirstBit + i);
+      }
+    }
+  }
+
+  *packed = result;
+  return true;
+}
+
+void PackedParsed::Unpack(Parsed* parsed) const {
+  for (int i = 0; i <= Parsed::REF; i++) {
+    *MutableComponent(parsed, i) =
+        GetComponent(static_cast<Parsed::ComponentType>(i));
+  }
+
+  if (!has_inner_parsed()) {
+    parsed->clear_inner_parsed();
+    return;
+  }
+  Parsed inner;
+  for (int i = 0; i < kNumInnerComponents; i++) {
+    *MutableComponent(&inner, i) =
+        GetInnerComponent(static_cast<Parsed::ComponentType>(i));
+  }
+  parsed->set_inner_parsed(inner);
+}
+
+}  // namespace url_parse
@@ -0,0 +1,103 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A compact form of url_parse::Parsed for keeping large numbers of parsed
+// URLs in memory. Parsed is eight pairs of ints plus a pointer to a
+// heap-allocated inner Parsed for filesystem: URLs, which every copy
+// duplicates. For URLs shorter than 64K, PackedParsed stores the same
+// offsets as 16-bit values, keeps the inner parse inline and has a trivial
+// copy constructor, so an array of them can be copied with memcpy.
+
+#ifndef GOOGLEURL_SRC_URL_PARSE_PACKED_H__
+#define GOOGLEURL_SRC_URL_PARSE_PACKED_H__
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_parse {
+
+class GURL_API PackedParsed {
+ public:
+  // Every component is invalid and there is no inner parse, like a
+  // default-constructed Parsed.
+  PackedParsed();
+
+  // Packs |parsed| into |*packed| and returns true, unless some offset or
+  // length doesn't fit in 16 bits, or there is an inner parse that has a
+  // query, a ref or an inner parse of its own. The canonicalizer never
+  // produces those for inner URLs. |*packed| is unchanged on failure.
+  static bool Pack(const Parsed& parsed, PackedParsed* packed);
+
+  // Writes the components, and the inner parse if there is one, into
+  // |*parsed|. The result is the same as the Parsed that was packed.
+  void Unpack(Parsed* parsed) const;
+
+  Component GetComponent(Parsed::ComponentType type) const {
+    return MakeComponent(components_[type], type);
+  }
+
+  // The inner parse of a filesystem: URL. Its query and ref are always
+  // invalid and aren't stored.
+  bool has_inner_parsed() const {
+    return (valid_mask_ & kHasInnerBit) != 0;
+  }
+  Component GetInnerComponent(Parsed::ComponentType type) const {
+    if (type > Parsed::PATH)
+      return Component();
+    return MakeComponent(inner_components_[type], type + kInnerFirstBit);
+  }
+
+ private:
+  struct PackedComponent {
+    uint16 begin;
+    uint16 len;
+  };
+
+  // Bits of |valid_mask_|: one per outer component, one per stored inner
+  // component starting at kInnerFirstBit, and kHasInnerBit.
+  static const int kInnerFirstBit = Parsed::REF + 1;
+  static const int kNumInnerComponents = Parsed::PATH + 1;
+  static const uint16 kHasInnerBit = 0x8000;
+
+  Component MakeComponent(const PackedComponent& packed, int bit) const {
+    // Invalid components keep their begin, so a round trip gives back
+    // exactly what was packed.
+    return Component(packed.begin,
+                     (valid_mask_ & (1 << bit)) ? packed.len : -1);
+  }
+
+  PackedComponent components_[Parsed::REF + 1];
+  PackedComponent inner_components_[kNumInnerComponents];
+  uint16 valid_mask_;
+};
+
+}  // namespace url_parse
+
+#endif  // GOOGLEURL_SRC_URL_PARSE_PACKED_H__
@@ -0,0 +1,101 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Per-scheme metadata for the registered schemes. This is the same registry
+// that backs url_util::IsStandard, so anything added with AddStandardScheme
+// shows up here too.
+//
+// Lookups never take a lock. The registry is an immutable snapshot that is
+// replaced as a whole when a scheme is added, so readers on any thread see
+// either the old or the new set of schemes and never a partial update.
+
+#ifndef GOOGLEURL_SRC_URL_SCHEME_REGISTRY_H__
+#define GOOGLEURL_SRC_URL_SCHEME_REGISTRY_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+// How URLs with a given scheme are parsed and canonicalized. Schemes that
+// aren't registered at all are treated as path URLs ("data:", "javascript:").
+enum SchemeType {
+  // Authority-based URLs like "http://host:port/path".
+  SCHEME_STANDARD,
+
+  // "file:" URLs. These are standard but the host is optional.
+  SCHEME_FILE,
+
+  // "filesystem:" URLs, which wrap an inner standard URL.
+  SCHEME_FILESYSTEM,
+
+  // "mailto:" URLs: a scheme, a path of addresses and a query. Not standard.
+  SCHEME_MAILTO,
+};
+
+struct SchemeInfo {
+  // The lower-case scheme name, not including the colon. This is not
+  // necessarily NULL-terminated at |scheme_len|, use the length.
+  const char* scheme;
+  int scheme_len;
+
+  SchemeType type;
+
+  // The port that is omitted from canonical URLs of this scheme, or
+  // url_parse::PORT_UNSPECIFIED if there isn't one.
+  int default_port;
+};
+
+// Returns true for the scheme types that IsStandard() reports as standard.
+inline bool IsStandardSchemeType(SchemeType type) {
+  return type != SCHEME_MAILTO;
+}
+
+// Looks up the scheme identified by |scheme| within |spec|, ignoring ASCII
+// case. Returns NULL for empty or unregistered schemes. The returned pointer
+// stays valid until Shutdown().
+GURL_API const SchemeInfo* FindSchemeInfo(const char* spec,
+                                          const url_parse::Component& scheme);
+GURL_API const SchemeInfo* FindSchemeInfo(const char16* spec,
+                                          const url_parse::Component& scheme);
+
+// Like AddStandardScheme, but also records the port canonical URLs of the
+// scheme should omit. Pass url_parse::PORT_UNSPECIFIED for none. The same
+// init-time rules as AddStandardScheme apply.
+//
+// Both do nothing for a scheme that is already registered, ignoring case.
+// That includes the built-in ones, so AddStandardScheme("mailto") leaves
+// mailto: a SCHEME_MAILTO scheme, which isn't standard.
+GURL_API void AddStandardSchemeWithPort(const char* new_scheme,
+                                        int default_port);
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_SCHEME_REGISTRY_H__
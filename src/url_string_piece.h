@@ -0,0 +1,92 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A pointer and length naming characters owned by someone else, for
+// accessors that return part of a spec without copying it into a new
+// std::string. The characters must outlive the piece.
+
+#ifndef GOOGLEURL_SRC_URL_STRING_PIECE_H__
+#define GOOGLEURL_SRC_URL_STRING_PIECE_H__
+
+#include <string.h>
+
+#include <string>
+
+#include "googleurl/src/url_parse.h"
+
+namespace url_parse {
+
+class StringPiece {
+ public:
+  StringPiece() : data_(NULL), length_(0) {}
+  StringPiece(const char* data, int length) : data_(data), length_(length) {}
+  StringPiece(const char* str)
+      : data_(str), length_(str ? static_cast<int>(strlen(str)) : 0) {}
+  StringPiece(const std::string& str)
+      : data_(str.data()), length_(static_cast<int>(str.length())) {}
+
+  // The part of |spec| named by |component|, which is empty if the
+  // component is invalid.
+  StringPiece(const char* spec, const Component& component)
+      : data_(spec + component.begin),
+        length_(component.len > 0 ? component.len : 0) {}
+
+  const char* data() const { return data_; }
+  int length() const { return length_; }
+  int size() const { return length_; }
+  bool empty() const { return length_ == 0; }
+
+  const char* begin() const { return data_; }
+  const char* end() const { return data_ + length_; }
+  char operator[](int i) const { return data_[i]; }
+
+  std::string as_string() const {
+    return empty() ? std::string() : std::string(data_, length_);
+  }
+  void AppendToString(std::string* output) const {
+    if (!empty())
+      output->append(data_, length_);
+  }
+
+  bool operator==(const StringPiece& other) const {
+    return length_ == other.length_ &&
+        (length_ == 0 || memcmp(data_, other.data_, length_) == 0);
+  }
+  bool operator!=(const StringPiece& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  const char* data_;
+  int length_;
+};
+
+}  // namespace url_parse
+
+#endif  // GOOGLEURL_SRC_URL_STRING_PIECE_H__
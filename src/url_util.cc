@@ -27,14 +27,24 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#ifdef WIN32
+#include <windows.h>
+#endif
 #include <string.h>
+#include <algorithm>
 #include <vector>
 
 #include "googleurl/src/url_util.h"
+#include "googleurl/src/url_util_canonical.h"
+#include "googleurl/src/url_util_decode.h"
 
 #include "base/logging.h"
+#include "googleurl/src/url_canon_fused.h"
 #include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_canon_simd.h"
+#include "googleurl/src/url_canon_stats.h"
 #include "googleurl/src/url_file.h"
+#include "googleurl/src/url_scheme_registry.h"
 #include "googleurl/src/url_util_internal.h"
 
 namespace url_util {
@@ -61,34 +71,159 @@ inline bool DoLowerCaseEqualsASCII(Iter a_begin, Iter a_end, const char* b) {
   return *b == 0;
 }
 
-const int kNumStandardURLSchemes = 8;
-const char* kStandardURLSchemes[kNumStandardURLSchemes] = {
-  "http",
-  "https",
-  kFileScheme,  // Yes, file urls can have a hostname!
-  "ftp",
-  "gopher",
-  "ws",  // WebSocket.
-  "wss",  // WebSocket secure.
-  kFileSystemScheme,
+// The schemes that are registered before anybody calls AddStandardScheme.
+// Everything except mailto is standard.
+const SchemeInfo kBuiltInSchemes[] = {
+  { "http", 4, SCHEME_STANDARD, 80 },
+  { "https", 5, SCHEME_STANDARD, 443 },
+  // Yes, file urls can have a hostname!
+  { kFileScheme, 4, SCHEME_FILE, url_parse::PORT_UNSPECIFIED },
+  { "ftp", 3, SCHEME_STANDARD, 21 },
+  { "gopher", 6, SCHEME_STANDARD, 70 },
+  { "ws", 2, SCHEME_STANDARD, 80 },  // WebSocket.
+  { "wss", 3, SCHEME_STANDARD, 443 },  // WebSocket secure.
+  { kFileSystemScheme, 10, SCHEME_FILESYSTEM, url_parse::PORT_UNSPECIFIED },
+  { kMailtoScheme, 6, SCHEME_MAILTO, url_parse::PORT_UNSPECIFIED },
+};
+
+// An immutable set of registered schemes, indexed by an open-addressed hash
+// table with linear probing so that a lookup costs one hash and one compare
+// no matter how many schemes there are. The table size is a power of two at
+// least twice the number of schemes so that probe sequences stay short.
+//
+// Lookups read the current registry without locking. AddStandardScheme
+// builds a new registry and publishes it with a release store, and the one it
+// replaces is leaked since another thread may still be reading it. Schemes
+// are only added during startup, so this is a handful of small allocations.
+//
+// This is a plain aggregate so the built-in registry can be constant
+// initialized: lookups work before anything has run, and Initialize() has
+// nothing left to do.
+struct SchemeRegistry {
+  const SchemeInfo* schemes;
+  int num_schemes;
+
+  // Indices into |schemes|, -1 for an empty slot. There are mask + 1.
+  const int* table;
+  int mask;
+
+  // Length of the longest registered scheme. Anything longer is rejected
+  // without hashing.
+  int longest;
+};
+
+// A registry made by AddStandardScheme, with the storage it points to.
+struct AddedSchemeRegistry : public SchemeRegistry {
+  std::vector<SchemeInfo> scheme_list;
+  std::vector<int> slots;
+};
+
+// The hash table for kBuiltInSchemes, as BuildSchemeTable would make it.
+// Keep it in sync with that list. Initialize() rebuilds it in debug builds
+// and checks that it matches.
+const int kBuiltInSchemeTable[32] = {
+  -1, -1,  1,  2,  6,  0,  3, -1,  4, -1,  7, -1, -1, -1, -1, -1,
+  -1, -1, -1,  8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  5,
+};
+
+const SchemeRegistry kBuiltInSchemeRegistry = {
+  kBuiltInSchemes,
+  arraysize(kBuiltInSchemes),
+  kBuiltInSchemeTable,
+  arraysize(kBuiltInSchemeTable) - 1,
+  10,  // "filesystem"
 };
 
-// List of the currently installed standard schemes. This list is lazily
-// initialized by InitStandardSchemes and is leaked on shutdown to prevent
-// any destructors from being called that will slow us down or cause problems.
-std::vector<const char*>* standard_schemes = NULL;
+// The current registry. Other than in Shutdown, only access this through
+// LoadSchemeRegistry and CompareAndSwapSchemeRegistry.
+const SchemeRegistry* current_scheme_registry = &kBuiltInSchemeRegistry;
 
 // See the LockStandardSchemes declaration in the header.
 bool standard_schemes_locked = false;
 
-// Ensures that the standard_schemes list is initialized, does nothing if it
-// already has values.
-void InitStandardSchemes() {
-  if (standard_schemes)
-    return;
-  standard_schemes = new std::vector<const char*>;
-  for (int i = 0; i < kNumStandardURLSchemes; i++)
-    standard_schemes->push_back(kStandardURLSchemes[i]);
+#ifdef WIN32
+// On Windows, reads of volatile variables have acquire semantics and the
+// Interlocked functions are full barriers.
+inline const SchemeRegistry* LoadSchemeRegistry() {
+  return *static_cast<const SchemeRegistry* volatile*>(
+      &current_scheme_registry);
+}
+// Replaces the current registry with |registry| if it is still |expected|.
+// Returns the registry that was current before the call, so the swap
+// happened if that is |expected|.
+inline const SchemeRegistry* CompareAndSwapSchemeRegistry(
+    const SchemeRegistry* expected,
+    const SchemeRegistry* registry) {
+  return static_cast<const SchemeRegistry*>(InterlockedCompareExchangePointer(
+      reinterpret_cast<PVOID*>(&current_scheme_registry),
+      const_cast<SchemeRegistry*>(registry),
+      const_cast<SchemeRegistry*>(expected)));
+}
+#else
+inline const SchemeRegistry* LoadSchemeRegistry() {
+  return __atomic_load_n(&current_scheme_registry, __ATOMIC_ACQUIRE);
+}
+// Replaces the current registry with |registry| if it is still |expected|.
+// Returns the registry that was current before the call, so the swap
+// happened if that is |expected|.
+inline const SchemeRegistry* CompareAndSwapSchemeRegistry(
+    const SchemeRegistry* expected,
+    const SchemeRegistry* registry) {
+  return __sync_val_compare_and_swap(&current_scheme_registry,
+                                     expected, registry);
+}
+#endif
+
+// FNV-1a over the lower-cased scheme. Registered schemes are hashed as given
+// and, like LowerCaseEqualsASCII, compared as given, so a registered scheme
+// with upper-case letters never matches anything.
+template<typename CHAR>
+inline unsigned HashScheme(const CHAR* scheme, int length) {
+  unsigned hash = 2166136261u;
+  for (int i = 0; i < length; i++) {
+    hash ^= static_cast<unsigned>(ToLowerASCII(scheme[i])) & 0xffff;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+inline unsigned HashScheme(const char* scheme, int length) {
+  return HashScheme(reinterpret_cast<const unsigned char*>(scheme), length);
+}
+
+// Builds the hash table of |registry| from its list of schemes, and points
+// the SchemeRegistry fields at them. Schemes that are registered twice keep
+// their first entry.
+void BuildSchemeTable(AddedSchemeRegistry* registry) {
+  const std::vector<SchemeInfo>& schemes = registry->scheme_list;
+  int table_size = 1;
+  while (table_size < static_cast<int>(schemes.size()) * 2)
+    table_size *= 2;
+  registry->slots.assign(table_size, -1);
+  registry->mask = table_size - 1;
+  registry->longest = 0;
+
+  for (size_t i = 0; i < schemes.size(); i++) {
+    const SchemeInfo& info = schemes[i];
+    int slot = HashScheme(info.scheme, info.scheme_len) & registry->mask;
+    bool duplicate = false;
+    while (registry->slots[slot] >= 0) {
+      const SchemeInfo& other = schemes[registry->slots[slot]];
+      if (other.scheme_len == info.scheme_len &&
+          memcmp(other.scheme, info.scheme, info.scheme_len) == 0) {
+        duplicate = true;
+        break;
+      }
+      slot = (slot + 1) & registry->mask;
+    }
+    if (!duplicate)
+      registry->slots[slot] = static_cast<int>(i);
+    registry->longest = std::max(registry->longest, info.scheme_len);
+  }
+
+  registry->schemes = &schemes[0];
+  registry->num_schemes = static_cast<int>(schemes.size());
+  registry->table = &registry->slots[0];
 }
 
 // Given a string and a range inside the string, compares it to the given
@@ -104,20 +239,35 @@ inline bool DoCompareSchemeComponent(const CHAR* spec,
                               compare_to);
 }
 
+template<typename CHAR>
+const SchemeInfo* DoFindSchemeInfo(const CHAR* spec,
+                                   const url_parse::Component& scheme) {
+  if (!scheme.is_nonempty())
+    return NULL;  // Empty or invalid schemes are never registered.
+
+  const SchemeRegistry* registry = LoadSchemeRegistry();
+  if (scheme.len > registry->longest)
+    return NULL;
+
+  const CHAR* begin = &spec[scheme.begin];
+  const CHAR* end = &spec[scheme.end()];
+  int slot = HashScheme(begin, scheme.len) & registry->mask;
+  while (registry->table[slot] >= 0) {
+    const SchemeInfo& info = registry->schemes[registry->table[slot]];
+    if (info.scheme_len == scheme.len &&
+        DoLowerCaseEqualsASCII(begin, end, info.scheme))
+      return &info;
+    slot = (slot + 1) & registry->mask;
+  }
+  return NULL;
+}
+
 // Returns true if the given scheme identified by |scheme| within |spec| is one
 // of the registered "standard" schemes.
 template<typename CHAR>
 bool DoIsStandard(const CHAR* spec, const url_parse::Component& scheme) {
-  if (!scheme.is_nonempty())
-    return false;  // Empty or invalid schemes are non-standard.
-
-  InitStandardSchemes();
-  for (size_t i = 0; i < standard_schemes->size(); i++) {
-    if (LowerCaseEqualsASCII(&spec[scheme.begin], &spec[scheme.end()],
-                             standard_schemes->at(i)))
-      return true;
-  }
-  return false;
+  const SchemeInfo* info = DoFindSchemeInfo(spec, scheme);
+  return info && IsStandardSchemeType(info->type);
 }
 
 template<typename CHAR>
@@ -149,6 +299,14 @@ bool DoCanonicalize(const CHAR* in_spec, int in_spec_len,
                     url_canon::CharsetConverter* charset_converter,
                     url_canon::CanonOutput* output,
                     url_parse::Parsed* output_parsed) {
+  // Most URLs are plain standard or local file ones that can be canonicalized
+  // in a single pass over the input. Everything else goes through the parser.
+  if (url_canon::FusedCanonicalizeStandardURL(in_spec, in_spec_len, output,
+                                              output_parsed) ||
+      url_canon::FusedCanonicalizeFileURL(in_spec, in_spec_len, output,
+                                          output_parsed))
+    return true;
+
   // Remove any whitespace from the middle of the relative URL, possibly
   // copying to the new buffer.
   url_canon::RawCanonOutputT<CHAR> whitespace_buffer;
@@ -183,39 +341,48 @@ bool DoCanonicalize(const CHAR* in_spec, int in_spec_len,
 
   // This is the parsed version of the input URL, we have to canonicalize it
   // before storing it in our object.
+  const SchemeInfo* scheme_info = DoFindSchemeInfo(spec, scheme);
+  if (!scheme_info) {
+    // "Weird" URLs like data: and javascript:
+    url_parse::ParsePathURL(spec, spec_len, &parsed_input);
+    return url_canon::CanonicalizePathURL(spec, spec_len, parsed_input,
+                                          output, output_parsed);
+  }
+
   bool success;
-  if (DoCompareSchemeComponent(spec, scheme, kFileScheme)) {
-    // File URLs are special.
-    url_parse::ParseFileURL(spec, spec_len, &parsed_input);
-    success = url_canon::CanonicalizeFileURL(spec, spec_len, parsed_input,
-                                             charset_converter, output,
-                                             output_parsed);
-  } else if (DoCompareSchemeComponent(spec, scheme, kFileSystemScheme)) {
-    // Filesystem URLs are special.
-    url_parse::ParseFileSystemURL(spec, spec_len, &parsed_input);
-    success = url_canon::CanonicalizeFileSystemURL(spec, spec_len,
+  switch (scheme_info->type) {
+    case SCHEME_FILE:
+      // File URLs are special.
+      url_parse::ParseFileURL(spec, spec_len, &parsed_input);
+      success = url_canon::CanonicalizeFileURL(spec, spec_len, parsed_input,
+                                               charset_converter, output,
+                                               output_parsed);
+      break;
+
+    case SCHEME_FILESYSTEM:
+      // Filesystem URLs are special.
+      url_parse::ParseFileSystemURL(spec, spec_len, &parsed_input);
+      success = url_canon::CanonicalizeFileSystemURL(spec, spec_len,
+                                                     parsed_input,
+                                                     charset_converter,
+                                                     output, output_parsed);
+      break;
+
+    case SCHEME_MAILTO:
+      // Mailto are treated like a standard url with only a scheme, path, query
+      url_parse::ParseMailtoURL(spec, spec_len, &parsed_input);
+      success = url_canon::CanonicalizeMailtoURL(spec, spec_len, parsed_input,
+                                                 output, output_parsed);
+      break;
+
+    default:
+      // All "normal" URLs.
+      url_parse::ParseStandardURL(spec, spec_len, &parsed_input);
+      success = url_canon::CanonicalizeStandardURL(spec, spec_len,
                                                    parsed_input,
                                                    charset_converter,
                                                    output, output_parsed);
-
-  } else if (DoIsStandard(spec, scheme)) {
-    // All "normal" URLs.
-    url_parse::ParseStandardURL(spec, spec_len, &parsed_input);
-    success = url_canon::CanonicalizeStandardURL(spec, spec_len, parsed_input,
-                                                 charset_converter,
-                                                 output, output_parsed);
-
-  } else if (DoCompareSchemeComponent(spec, scheme, kMailtoScheme)) {
-    // Mailto are treated like a standard url with only a scheme, path, query
-    url_parse::ParseMailtoURL(spec, spec_len, &parsed_input);
-    success = url_canon::CanonicalizeMailtoURL(spec, spec_len, parsed_input,
-                                               output, output_parsed);
-
-  } else {
-    // "Weird" URLs like data: and javascript:
-    url_parse::ParsePathURL(spec, spec_len, &parsed_input);
-    success = url_canon::CanonicalizePathURL(spec, spec_len, parsed_input,
-                                             output, output_parsed);
+      break;
   }
   return success;
 }
@@ -365,22 +532,25 @@ bool DoReplaceComponents(const char* spec,
 
   // If we get here, then we know the scheme doesn't need to be replaced, so can
   // just key off the scheme in the spec to know how to do the replacements.
-  if (DoCompareSchemeComponent(spec, parsed.scheme, kFileScheme)) {
-    return url_canon::ReplaceFileURL(spec, parsed, replacements,
-                                     charset_converter, output, out_parsed);
-  }
-  if (DoCompareSchemeComponent(spec, parsed.scheme, kFileSystemScheme)) {
-    return url_canon::ReplaceFileSystemURL(spec, parsed, replacements,
-                                           charset_converter, output,
-                                           out_parsed);
-  }
-  if (DoIsStandard(spec, parsed.scheme)) {
-    return url_canon::ReplaceStandardURL(spec, parsed, replacements,
-                                         charset_converter, output, out_parsed);
-  }
-  if (DoCompareSchemeComponent(spec, parsed.scheme, kMailtoScheme)) {
-     return url_canon::ReplaceMailtoURL(spec, parsed, replacements,
-                                        output, out_parsed);
+  const SchemeInfo* scheme_info = DoFindSchemeInfo(spec, parsed.scheme);
+  if (scheme_info) {
+    switch (scheme_info->type) {
+      case SCHEME_FILE:
+        return url_canon::ReplaceFileURL(spec, parsed, replacements,
+                                         charset_converter, output,
+                                         out_parsed);
+      case SCHEME_FILESYSTEM:
+        return url_canon::ReplaceFileSystemURL(spec, parsed, replacements,
+                                               charset_converter, output,
+                                               out_parsed);
+      case SCHEME_MAILTO:
+        return url_canon::ReplaceMailtoURL(spec, parsed, replacements,
+                                           output, out_parsed);
+      default:
+        return url_canon::ReplaceStandardURL(spec, parsed, replacements,
+                                             charset_converter, output,
+                                             out_parsed);
+    }
   }
 
   // Default is a path URL.
@@ -388,20 +558,67 @@ bool DoReplaceComponents(const char* spec,
                                    output, out_parsed);
 }
 
+// Unescapes |input| into |output|, which has room for |length| characters
+// and may be |input| itself, and returns the number of characters written.
+// The write position never passes the read position, so the runs between
+// escapes can be moved forward in place.
+int DoDecodeURLEscapeSequences(const char* input, int length, char* output) {
+  int out_len = 0;
+  int i = 0;
+  while (i < length) {
+    int percent = i + url_canon::FindChar(&input[i], length - i, '%');
+    if (output + out_len != input + i)
+      memmove(&output[out_len], &input[i], percent - i);
+    out_len += percent - i;
+    if (percent == length)
+      break;
+
+    i = percent;
+    unsigned char ch;
+    if (url_canon::DecodeEscaped(input, &i, length, &ch)) {
+      output[out_len++] = static_cast<char>(ch);
+    } else {
+      // Invalid escape sequence, copy the percent literal.
+      output[out_len++] = '%';
+    }
+    i++;
+  }
+  return out_len;
+}
+
 }  // namespace
 
 void Initialize() {
-  InitStandardSchemes();
+  // The built-in schemes are constant initialized, so calling this is
+  // optional. It stays for callers that pair it with Shutdown().
+#ifndef NDEBUG
+  // kBuiltInSchemeTable is written out by hand; check that it is the table
+  // BuildSchemeTable makes from kBuiltInSchemes.
+  AddedSchemeRegistry built;
+  built.scheme_list.assign(kBuiltInSchemes,
+                           kBuiltInSchemes + arraysize(kBuiltInSchemes));
+  BuildSchemeTable(&built);
+  DCHECK(built.mask == kBuiltInSchemeRegistry.mask &&
+         built.longest == kBuiltInSchemeRegistry.longest &&
+         std::equal(built.slots.begin(), built.slots.end(),
+                    kBuiltInSchemeTable))
+      << "kBuiltInSchemeTable is out of date with kBuiltInSchemes";
+#endif
 }
 
 void Shutdown() {
-  if (standard_schemes) {
-    delete standard_schemes;
-    standard_schemes = NULL;
+  if (current_scheme_registry != &kBuiltInSchemeRegistry) {
+    delete static_cast<const AddedSchemeRegistry*>(current_scheme_registry);
+    current_scheme_registry = &kBuiltInSchemeRegistry;
   }
+  standard_schemes_locked = false;
 }
 
 void AddStandardScheme(const char* new_scheme) {
+  AddStandardSchemeWithPort(new_scheme, url_parse::PORT_UNSPECIFIED);
+}
+
+void AddStandardSchemeWithPort(const char* new_scheme, int default_port) {
   // If this assert triggers, it means you've called AddStandardScheme after
   // LockStandardSchemes have been called (see the header file for
   // LockStandardSchemes for more).
@@ -417,19 +634,56 @@ void AddStandardScheme(const char* new_scheme) {
   if (scheme_len == 0)
     return;
 
+  // A scheme keeps the type and port it was first registered with.
+  if (FindSchemeInfo(new_scheme,
+                     url_parse::Component(0, static_cast<int>(scheme_len))))
+    return;
+
   // Dulicate the scheme into a new buffer and add it to the list of standard
   // schemes. This pointer will be leaked on shutdown.
   char* dup_scheme = new char[scheme_len + 1];
   memcpy(dup_scheme, new_scheme, scheme_len + 1);
 
-  InitStandardSchemes();
-  standard_schemes->push_back(dup_scheme);
+  SchemeInfo info;
+  info.scheme = dup_scheme;
+  info.scheme_len = static_cast<int>(scheme_len);
+  info.type = SCHEME_STANDARD;
+  info.default_port = default_port;
+
+  // Copy the current registry with the new scheme added and swap it in. If
+  // another thread added a scheme in the meantime, start over from its copy.
+  const SchemeRegistry* old_registry = LoadSchemeRegistry();
+  for (;;) {
+    AddedSchemeRegistry* new_registry = new AddedSchemeRegistry;
+    new_registry->scheme_list.assign(
+        old_registry->schemes,
+        old_registry->schemes + old_registry->num_schemes);
+    new_registry->scheme_list.push_back(info);
+    BuildSchemeTable(new_registry);
+
+    const SchemeRegistry* current =
+        CompareAndSwapSchemeRegistry(old_registry, new_registry);
+    if (current == old_registry)
+      return;  // |old_registry| is leaked, see SchemeRegistry.
+    delete new_registry;
+    old_registry = current;
+  }
 }
 
 void LockStandardSchemes() {
   standard_schemes_locked = true;
 }
 
+const SchemeInfo* FindSchemeInfo(const char* spec,
+                                 const url_parse::Component& scheme) {
+  return DoFindSchemeInfo(spec, scheme);
+}
+
+const SchemeInfo* FindSchemeInfo(const char16* spec,
+                                 const url_parse::Component& scheme) {
+  return DoFindSchemeInfo(spec, scheme);
+}
+
 bool IsStandard(const char* spec, const url_parse::Component& scheme) {
   return DoIsStandard(spec, scheme);
 }
@@ -457,6 +711,7 @@ bool Canonicalize(const char* spec,
                   url_canon::CharsetConverter* charset_converter,
                   url_canon::CanonOutput* output,
                   url_parse::Parsed* output_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoCanonicalize(spec, spec_len, charset_converter,
                         output, output_parsed);
 }
@@ -466,10 +721,38 @@ bool Canonicalize(const char16* spec,
                   url_canon::CharsetConverter* charset_converter,
                   url_canon::CanonOutput* output,
                   url_parse::Parsed* output_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoCanonicalize(spec, spec_len, charset_converter,
                         output, output_parsed);
 }
 
+bool CanonicalizeAndCompare(const char* spec,
+                            int spec_len,
+                            url_canon::CharsetConverter* charset_converter,
+                            url_canon::CanonOutput* output,
+                            url_parse::Parsed* output_parsed,
+                            bool* already_canonical) {
+  DCHECK(output->length() == 0);
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
+  bool success = DoCanonicalize(spec, spec_len, charset_converter,
+                                output, output_parsed);
+  *already_canonical = output->length() == spec_len &&
+      memcmp(output->data(), spec, spec_len) == 0;
+  return success;
+}
+
+bool IsCanonical(const char* spec,
+                 int spec_len,
+                 url_parse::Parsed* parsed) {
+  url_canon::RawCanonOutput<1024> output;
+  url_parse::Parsed scratch_parsed;
+  bool already_canonical;
+  bool success = CanonicalizeAndCompare(spec, spec_len, NULL, &output,
+                                        parsed ? parsed : &scratch_parsed,
+                                        &already_canonical);
+  return success && already_canonical;
+}
+
 bool ResolveRelative(const char* base_spec,
                      int base_spec_len,
                      const url_parse::Parsed& base_parsed,
@@ -478,6 +761,7 @@ bool ResolveRelative(const char* base_spec,
                      url_canon::CharsetConverter* charset_converter,
                      url_canon::CanonOutput* output,
                      url_parse::Parsed* output_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoResolveRelative(base_spec, base_spec_len, base_parsed,
                            relative, relative_length,
                            charset_converter, output, output_parsed);
@@ -491,6 +775,7 @@ bool ResolveRelative(const char* base_spec,
                      url_canon::CharsetConverter* charset_converter,
                      url_canon::CanonOutput* output,
                      url_parse::Parsed* output_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoResolveRelative(base_spec, base_spec_len, base_parsed,
                            relative, relative_length,
                            charset_converter, output, output_parsed);
@@ -503,6 +788,7 @@ bool ReplaceComponents(const char* spec,
                        url_canon::CharsetConverter* charset_converter,
                        url_canon::CanonOutput* output,
                        url_parse::Parsed* out_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoReplaceComponents(spec, spec_len, parsed, replacements,
                              charset_converter, output, out_parsed);
 }
@@ -514,6 +800,7 @@ bool ReplaceComponents(const char* spec,
                        url_canon::CharsetConverter* charset_converter,
                        url_canon::CanonOutput* output,
                        url_parse::Parsed* out_parsed) {
+  url_canon::ScopedOutputGrowthStat growth_stat(output);
   return DoReplaceComponents(spec, spec_len, parsed, replacements,
                              charset_converter, output, out_parsed);
 }
@@ -546,20 +833,7 @@ bool LowerCaseEqualsASCII(const char16* a_begin,
 void DecodeURLEscapeSequences(const char* input, int length,
                               url_canon::CanonOutputW* output) {
   url_canon::RawCanonOutputT<char> unescaped_chars;
-  for (int i = 0; i < length; i++) {
-    if (input[i] == '%') {
-      unsigned char ch;
-      if (url_canon::DecodeEscaped(input, &i, length, &ch)) {
-        unescaped_chars.push_back(ch);
-      } else {
-        // Invalid escape sequence, copy the percent literal.
-        unescaped_chars.push_back('%');
-      }
-    } else {
-      // Regular non-escaped 8-bit character.
-      unescaped_chars.push_back(input[i]);
-    }
-  }
+  DecodeURLEscapeSequencesToUTF8(input, length, &unescaped_chars);
 
   // Convert that 8-bit to UTF-16. It's not clear IE does this at all to
   // JavaScript URLs, but Firefox and Safari do.
@@ -592,6 +866,20 @@ void DecodeURLEscapeSequences(const char* input, int length,
   }
 }
 
+void DecodeURLEscapeSequencesToUTF8(const char* input, int length,
+                                    url_canon::CanonOutput* output) {
+  int begin = output->length();
+  if (output->capacity() < begin + length)
+    output->Resize(begin + length);
+  int decoded_len = DoDecodeURLEscapeSequences(input, length,
+                                               output->data() + begin);
+  output->set_length(begin + decoded_len);
+}
+
+int DecodeURLEscapeSequencesInPlace(char* input, int length) {
+  return DoDecodeURLEscapeSequences(input, length, input);
+}
+
 void EncodeURIComponent(const char* input, int length,
                         url_canon::CanonOutput* output) {
   for (int i = 0; i < length; ++i) {
@@ -0,0 +1,105 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_util_batch.h"
+
+#include "googleurl/src/url_util.h"
+
+namespace url_util {
+
+namespace {
+
+inline void OffsetComponent(int offset, url_parse::Component* component) {
+  if (component->is_valid())
+    component->begin += offset;
+}
+
+template<typename CHAR>
+int DoCanonicalizeBatch(const CHAR* const* specs,
+                        const int* spec_lens,
+                        int count,
+                        url_canon::CharsetConverter* charset_converter,
+                        url_canon::CanonOutput* output,
+                        url_parse::Component* out_specs,
+                        url_parse::Parsed* out_parsed,
+                        bool* out_valid) {
+  int num_valid = 0;
+  for (int i = 0; i < count; i++) {
+    int begin = output->length();
+    out_valid[i] = Canonicalize(specs[i], spec_lens[i], charset_converter,
+                                output, &out_parsed[i]);
+    out_specs[i] = url_parse::MakeRange(begin, output->length());
+    if (begin)
+      OffsetParsed(-begin, &out_parsed[i]);
+    if (out_valid[i])
+      num_valid++;
+  }
+  return num_valid;
+}
+
+}  // namespace
+
+int CanonicalizeBatch(const char* const* specs,
+                      const int* spec_lens,
+                      int count,
+                      url_canon::CharsetConverter* charset_converter,
+                      url_canon::CanonOutput* output,
+                      url_parse::Component* out_specs,
+                      url_parse::Parsed* out_parsed,
+                      bool* out_valid) {
+  return DoCanonicalizeBatch(specs, spec_lens, count, charset_converter,
+                             output, out_specs, out_parsed, out_valid);
+}
+
+int CanonicalizeBatch(const char16* const* specs,
+                      const int* spec_lens,
+                      int count,
+                      url_canon::CharsetConverter* charset_converter,
+                      url_canon::CanonOutput* output,
+                      url_parse::Component* out_specs,
+                      url_parse::Parsed* out_parsed,
+                      bool* out_valid) {
+  return DoCanonicalizeBatch(specs, spec_lens, count, charset_converter,
+                             output, out_specs, out_parsed, out_valid);
+}
+
+void OffsetParsed(int offset, url_parse::Parsed* parsed) {
+  OffsetComponent(offset, &parsed->scheme);
+  OffsetComponent(offset, &parsed->username);
+  OffsetComponent(offset, &parsed->password);
+  OffsetComponent(offset, &parsed->host);
+  OffsetComponent(offset, &parsed->port);
+  OffsetComponent(offset, &parsed->path);
+  OffsetComponent(offset, &parsed->query);
+  OffsetComponent(offset, &parsed->ref);
+  if (parsed->inner_parsed())
+    OffsetParsed(offset, parsed->inner_parsed());
+}
+
+}  // namespace url_util
@@ -0,0 +1,82 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Canonicalizes many URLs in one call. All the canonical specs are written
+// back to back into a single output buffer, so a caller that handles
+// thousands of URLs (for example every link on a page) needs only one buffer
+// instead of a std::string per URL.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_BATCH_H__
+#define GOOGLEURL_SRC_URL_UTIL_BATCH_H__
+
+#include "base/string16.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+// Canonicalizes the |count| URLs given by |specs| and |spec_lens| like
+// Canonicalize() does and appends the results to |output| one after
+// another. Any existing contents of |output| are kept.
+//
+// For each input i:
+//  - |out_specs[i]| is where its canonical spec is in |output|.
+//  - |out_parsed[i]| is the parse of that spec, relative to its start, so
+//    it can be used with the substring directly (for example to build a
+//    GURL from it).
+//  - |out_valid[i]| is what Canonicalize() would have returned.
+//
+// Returns the number of valid URLs.
+GURL_API int CanonicalizeBatch(const char* const* specs,
+                               const int* spec_lens,
+                               int count,
+                               url_canon::CharsetConverter* charset_converter,
+                               url_canon::CanonOutput* output,
+                               url_parse::Component* out_specs,
+                               url_parse::Parsed* out_parsed,
+                               bool* out_valid);
+GURL_API int CanonicalizeBatch(const char16* const* specs,
+                               const int* spec_lens,
+                               int count,
+                               url_canon::CharsetConverter* charset_converter,
+                               url_canon::CanonOutput* output,
+                               url_parse::Component* out_specs,
+                               url_parse::Parsed* out_parsed,
+                               bool* out_valid);
+
+// Moves every valid component of |parsed|, and of its inner parsed if there
+// is one, by |offset| characters. The canonicalizers record components as
+// offsets into the whole output buffer; this converts them to be relative to
+// a spec that starts at |-offset|.
+GURL_API void OffsetParsed(int offset, url_parse::Parsed* parsed);
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_BATCH_H__
@@ -0,0 +1,419 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_util_bulk.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <utility>
+#include <vector>
+
+#include "base/logging.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/gurl_hash.h"
+#include "googleurl/src/gurl_resolver.h"
+#include "googleurl/src/url_canon_arena.h"
+#include "googleurl/src/url_parse.h"
+#include "googleurl/src/url_util.h"
+
+namespace url_util {
+
+namespace {
+
+// Chunks in flight per thread. Workers stay ahead of the writer by this
+// much, so a slow chunk holds the others up only once they're that far in.
+const int kChunksPerThread = 4;
+
+// Longer lines aren't URLs anybody can use, and would overflow the int
+// lengths the canonicalizers work with.
+const size_t kMaxLineLength = 1 << 28;
+
+// Where one valid URL is in a chunk's output, for dedup.
+struct BulkLine {
+  int begin;
+  int len;  // Not counting the newline.
+  uint64 hash;
+};
+
+// The output of one chunk: everything is in |arena|, the specs one per line
+// starting at |data|.
+struct BulkSlot {
+  BulkSlot() : data(NULL), len(0), lines(0), valid_urls(0), done(false) {}
+
+  url_canon::URLArena arena;
+  const char* data;
+  int len;
+  std::vector<BulkLine> valid_lines;  // Only filled in for dedup.
+  int64 lines;
+  int64 valid_urls;
+  bool done;
+};
+
+// The canonical specs that have been written, for dedup. Open addressing
+// on the spec hashes, with the specs themselves copied into an arena so
+// that equal hashes can be told apart.
+class SpecSet {
+ public:
+  SpecSet() : size_(0) { entries_.resize(1024); }
+
+  // Adds the spec and returns true, or returns false if it's already in.
+  bool Insert(const char* spec, int len, uint64 hash) {
+    if ((size_ + 1) * 2 > entries_.size())
+      Grow();
+    size_t mask = entries_.size() - 1;
+    for (size_t i = static_cast<size_t>(hash) & mask; ; i = (i + 1) & mask) {
+      Entry& entry = entries_[i];
+      if (!entry.spec) {
+        char* copy = static_cast<char*>(arena_.Allocate(len ? len : 1));
+        memcpy(copy, spec, len);
+        entry.spec = copy;
+        entry.len = len;
+        entry.hash = hash;
+        size_++;
+        return true;
+      }
+      if (entry.hash == hash && entry.len == len &&
+          memcmp(entry.spec, spec, len) == 0)
+        return false;
+    }
+  }
+
+ private:
+  struct Entry {
+    Entry() : spec(NULL), len(0), hash(0) {}
+    const char* spec;
+    int len;
+    uint64 hash;
+  };
+
+  void Grow() {
+    std::vector<Entry> old;
+    old.swap(entries_);
+    entries_.resize(old.size() * 2);
+    size_t mask = entries_.size() - 1;
+    for (size_t i = 0; i < old.size(); i++) {
+      if (!old[i].spec)
+        continue;
+      size_t j = static_cast<size_t>(old[i].hash) & mask;
+      while (entries_[j].spec)
+        j = (j + 1) & mask;
+      entries_[j] = old[i];
+    }
+  }
+
+  std::vector<Entry> entries_;
+  size_t size_;
+  url_canon::URLArena arena_;
+
+  DISALLOW_COPY_AND_ASSIGN(SpecSet);
+};
+
+class BulkPipeline {
+ public:
+  BulkPipeline(const char* input, size_t input_len,
+               const BulkOptions& options, int num_threads)
+      : input_(input),
+        options_(options),
+        resolver_(NULL),
+        num_threads_(num_threads),
+        num_slots_(num_threads * kChunksPerThread),
+        slots_(new BulkSlot[num_slots_]),
+        next_chunk_(0),
+        next_to_write_(0) {
+    int chunk_size = options.chunk_size > 0 ? options.chunk_size : 1;
+    size_t begin = 0;
+    while (begin < input_len) {
+      size_t end = begin + chunk_size;
+      if (end >= input_len) {
+        end = input_len;
+      } else {
+        const void* newline = memchr(&input[end], '\n', input_len - end);
+        end = newline ?
+            static_cast<const char*>(newline) - input + 1 : input_len;
+      }
+      chunks_.push_back(std::make_pair(begin, end));
+      begin = end;
+    }
+
+    if (options.base)
+      resolver_ = new GURLResolver(*options.base);
+    pthread_mutex_init(&lock_, NULL);
+    pthread_cond_init(&chunk_done_, NULL);
+    pthread_cond_init(&slot_free_, NULL);
+  }
+
+  ~BulkPipeline() {
+    pthread_cond_destroy(&slot_free_);
+    pthread_cond_destroy(&chunk_done_);
+    pthread_mutex_destroy(&lock_);
+    delete[] slots_;
+    delete resolver_;
+  }
+
+  bool Run(BulkSink* sink, BulkStats* stats) {
+    // Only the threads that start are joined. If none do, the calling
+    // thread canonicalizes each chunk itself before writing it.
+    std::vector<pthread_t> threads;
+    threads.reserve(num_threads_);
+    for (int i = 0; i < num_threads_; i++) {
+      pthread_t thread;
+      if (pthread_create(&thread, NULL, &BulkPipeline::ThreadMain, this))
+        break;
+      threads.push_back(thread);
+    }
+    int num_started = static_cast<int>(threads.size());
+
+    bool success = WriteChunks(num_started > 0, sink, stats);
+
+    // When the sink fails, the workers are told there's nothing left to
+    // claim so they finish their current chunk and exit.
+    pthread_mutex_lock(&lock_);
+    next_chunk_ = static_cast<int>(chunks_.size());
+    pthread_cond_broadcast(&slot_free_);
+    pthread_mutex_unlock(&lock_);
+    for (int i = 0; i < num_started; i++)
+      pthread_join(threads[i], NULL);
+
+    stats->chunks = static_cast<int>(chunks_.size());
+    stats->threads = num_started;
+    return success;
+  }
+
+ private:
+  static void* ThreadMain(void* pipeline) {
+    static_cast<BulkPipeline*>(pipeline)->Work();
+    return NULL;
+  }
+
+  void Work() {
+    int num_chunks = static_cast<int>(chunks_.size());
+    while (true) {
+      pthread_mutex_lock(&lock_);
+      while (next_chunk_ < num_chunks &&
+             next_chunk_ >= next_to_write_ + num_slots_)
+        pthread_cond_wait(&slot_free_, &lock_);
+      if (next_chunk_ >= num_chunks) {
+        pthread_mutex_unlock(&lock_);
+        return;
+      }
+      int chunk = next_chunk_++;
+      pthread_mutex_unlock(&lock_);
+
+      BulkSlot* slot = &slots_[chunk % num_slots_];
+      CanonicalizeChunk(chunks_[chunk].first, chunks_[chunk].second, slot);
+
+      pthread_mutex_lock(&lock_);
+      slot->done = true;
+      pthread_cond_broadcast(&chunk_done_);
+      pthread_mutex_unlock(&lock_);
+    }
+  }
+
+  void CanonicalizeChunk(size_t begin, size_t end, BulkSlot* slot) {
+    url_canon::ArenaCanonOutput output(&slot->arena);
+    slot->valid_lines.clear();
+    slot->lines = 0;
+    slot->valid_urls = 0;
+
+    while (begin < end) {
+      const char* line = &input_[begin];
+      const void* newline = memchr(line, '\n', end - begin);
+      size_t line_len = newline ?
+          static_cast<const char*>(newline) - line : end - begin;
+      begin += line_len + 1;
+      slot->lines++;
+
+      int spec_begin = output.length();
+      bool valid = false;
+      if (line_len <= kMaxLineLength) {
+        int len = static_cast<int>(line_len);
+        url_parse::Parsed parsed;
+        if (resolver_) {
+          url_parse::Component spec;
+          resolver_->ResolveBatch(&line, &len, 1, &output,
+                                  &spec, &parsed, &valid);
+        } else {
+          valid = Canonicalize(line, len, NULL, &output, &parsed);
+        }
+      }
+
+      if (!valid) {
+        output.set_length(spec_begin);
+        if (options_.dedup)
+          continue;
+      } else {
+        slot->valid_urls++;
+        if (options_.dedup) {
+          BulkLine valid_line;
+          valid_line.begin = spec_begin;
+          valid_line.len = output.length() - spec_begin;
+          valid_line.hash = HashURLBytes(&output.data()[spec_begin],
+                                         valid_line.len, 0);
+          slot->valid_lines.push_back(valid_line);
+        }
+      }
+      output.push_back('\n');
+    }
+
+    slot->len = output.length();
+    slot->data = output.Finish();
+  }
+
+  // Writes the chunks in order as the workers finish them, or, when there
+  // are no |workers|, canonicalizes each one first.
+  bool WriteChunks(bool workers, BulkSink* sink, BulkStats* stats) {
+    SpecSet written;
+    int num_chunks = static_cast<int>(chunks_.size());
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+      BulkSlot* slot = &slots_[chunk % num_slots_];
+      if (workers) {
+        pthread_mutex_lock(&lock_);
+        while (!slot->done)
+          pthread_cond_wait(&chunk_done_, &lock_);
+        pthread_mutex_unlock(&lock_);
+      } else {
+        CanonicalizeChunk(chunks_[chunk].first, chunks_[chunk].second, slot);
+      }
+
+      stats->lines += slot->lines;
+      stats->valid_urls += slot->valid_urls;
+      if (!WriteSlot(*slot, sink, &written, stats))
+        return false;
+
+      slot->arena.Reset();
+      slot->data = NULL;
+      pthread_mutex_lock(&lock_);
+      slot->done = false;
+      next_to_write_ = chunk + 1;
+      pthread_cond_broadcast(&slot_free_);
+      pthread_mutex_unlock(&lock_);
+    }
+    return true;
+  }
+
+  // Writes the output of |slot|, leaving out URLs already in |written| when
+  // deduplicating. Runs of new URLs are written in one go.
+  bool WriteSlot(const BulkSlot& slot, BulkSink* sink, SpecSet* written,
+                 BulkStats* stats) {
+    if (!options_.dedup) {
+      stats->output_bytes += slot.len;
+      return !slot.len || sink->Write(slot.data, slot.len);
+    }
+
+    int run_begin = 0;
+    int run_end = 0;
+    for (size_t i = 0; i < slot.valid_lines.size(); i++) {
+      const BulkLine& line = slot.valid_lines[i];
+      if (written->Insert(&slot.data[line.begin], line.len, line.hash)) {
+        if (line.begin != run_end) {
+          if (!WriteRun(slot, run_begin, run_end, sink, stats))
+            return false;
+          run_begin = line.begin;
+        }
+        run_end = line.begin + line.len + 1;
+      } else {
+        stats->duplicates++;
+      }
+    }
+    return WriteRun(slot, run_begin, run_end, sink, stats);
+  }
+
+  bool WriteRun(const BulkSlot& slot, int begin, int end, BulkSink* sink,
+                BulkStats* stats) {
+    if (begin == end)
+      return true;
+    stats->output_bytes += end - begin;
+    return sink->Write(&slot.data[begin], end - begin);
+  }
+
+  const char* input_;
+  const BulkOptions& options_;
+  GURLResolver* resolver_;
+  int num_threads_;
+
+  // The [begin, end) of each chunk of the input.
+  std::vector<std::pair<size_t, size_t> > chunks_;
+
+  // Chunk i is canonicalized into slot i % num_slots_.
+  int num_slots_;
+  BulkSlot* slots_;
+
+  // Everything below is protected by |lock_|, as is |done| in the slots.
+  pthread_mutex_t lock_;
+  pthread_cond_t chunk_done_;  // Signaled when a slot is done.
+  pthread_cond_t slot_free_;   // Signaled when |next_to_write_| moves.
+  int next_chunk_;             // The next chunk to claim.
+  int next_to_write_;          // Chunks before this one are written.
+
+  DISALLOW_COPY_AND_ASSIGN(BulkPipeline);
+};
+
+}  // namespace
+
+BulkOptions::BulkOptions()
+    : num_threads(0),
+      chunk_size(1 << 20),
+      base(NULL),
+      dedup(false) {
+}
+
+BulkStats::BulkStats()
+    : lines(0),
+      valid_urls(0),
+      duplicates(0),
+      input_bytes(0),
+      output_bytes(0),
+      chunks(0),
+      threads(0) {
+}
+
+bool CanonicalizeLines(const char* input,
+                       size_t input_len,
+                       const BulkOptions& options,
+                       BulkSink* sink,
+                       BulkStats* stats) {
+  BulkStats local_stats;
+  if (!stats)
+    stats = &local_stats;
+  *stats = BulkStats();
+  stats->input_bytes = static_cast<int64>(input_len);
+
+  int num_threads = options.num_threads;
+  if (num_threads <= 0) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = processors > 0 ? static_cast<int>(processors) : 1;
+  }
+
+  BulkPipeline pipeline(input, input_len, options, num_threads);
+  return pipeline.Run(sink, stats);
+}
+
+}  // namespace url_util
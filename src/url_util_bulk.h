@@ -0,0 +1,108 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Canonicalizes newline-separated URLs, such as a dump of crawled links,
+// on several threads. The input is split into chunks at line boundaries and
+// the threads take the next unclaimed chunk as they finish one. Each chunk
+// is canonicalized into an arena of its own, one URL per line, and the
+// calling thread writes the chunks out in input order straight from those
+// arenas. Only a few chunks per thread are in flight at a time, so the
+// memory used doesn't grow with the input.
+//
+// This is POSIX only, since it uses pthreads.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_BULK_H__
+#define GOOGLEURL_SRC_URL_UTIL_BULK_H__
+
+#include <stddef.h>
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_common.h"
+
+class GURL;
+
+namespace url_util {
+
+struct GURL_API BulkOptions {
+  BulkOptions();
+
+  // The number of threads canonicalizing, not counting the calling thread,
+  // which only writes. 0 means one per processor.
+  int num_threads;
+
+  // Roughly how much input goes in each chunk. Chunks end at a newline, so
+  // a line is never split between two.
+  int chunk_size;
+
+  // When not NULL, each line is resolved against this URL instead of being
+  // canonicalized on its own. It must outlive the call.
+  const GURL* base;
+
+  // When set, invalid URLs and URLs that have been written before are left
+  // out. Otherwise every input line gives one output line, which is empty
+  // for an invalid URL.
+  bool dedup;
+};
+
+struct GURL_API BulkStats {
+  BulkStats();
+
+  int64 lines;
+  int64 valid_urls;
+  int64 duplicates;  // Valid URLs left out by |dedup|.
+  int64 input_bytes;
+  int64 output_bytes;
+  int chunks;
+  int threads;  // Workers that started; 0 when the calling thread did it all.
+};
+
+// Where the output goes. Write is only ever called on the thread that
+// called CanonicalizeLines.
+class GURL_API BulkSink {
+ public:
+  virtual ~BulkSink() {}
+
+  // Writes |len| bytes of output. Returning false stops the pipeline.
+  virtual bool Write(const char* data, size_t len) = 0;
+};
+
+// Canonicalizes every line of |input|, as url_util::Canonicalize would with
+// UTF-8 queries, and writes the canonical specs to |sink|, each followed by
+// a newline. A trailing carriage return is trimmed along with the other
+// whitespace around a URL. Returns false if the sink failed. |stats| may be
+// NULL.
+GURL_API bool CanonicalizeLines(const char* input,
+                                size_t input_len,
+                                const BulkOptions& options,
+                                BulkSink* sink,
+                                BulkStats* stats);
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_BULK_H__
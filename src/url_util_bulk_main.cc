@@ -0,0 +1,203 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// googleurl_bulk: canonicalizes a file of newline-separated URLs with
+// url_util::CanonicalizeLines and prints throughput to stderr.
+//
+//   googleurl_bulk [--threads=N] [--chunk-size=BYTES] [--base=URL]
+//                  [--dedup] [--output=FILE] INPUT
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/gurl.h"
+#include "googleurl/src/url_util_bulk.h"
+
+namespace {
+
+// Writes to a file descriptor directly, since the chunks are already large
+// buffers and going through stdio would only copy them again.
+class FileSink : public url_util::BulkSink {
+ public:
+  explicit FileSink(int fd) : fd_(fd) {}
+
+  virtual bool Write(const char* data, size_t len) {
+    while (len) {
+      ssize_t written = write(fd_, data, len);
+      if (written < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      data += written;
+      len -= written;
+    }
+    return true;
+  }
+
+ private:
+  int fd_;
+
+  DISALLOW_COPY_AND_ASSIGN(FileSink);
+};
+
+double NowSeconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// Returns true and sets |*value| if |arg| is "--|name|=value".
+bool GetFlag(const char* arg, const char* name, std::string* value) {
+  size_t name_len = strlen(name);
+  if (strncmp(arg, "--", 2) != 0 || strncmp(arg + 2, name, name_len) != 0 ||
+      arg[2 + name_len] != '=')
+    return false;
+  *value = arg + 3 + name_len;
+  return true;
+}
+
+int Usage() {
+  fprintf(stderr,
+          "usage: googleurl_bulk [--threads=N] [--chunk-size=BYTES] "
+          "[--base=URL]\n"
+          "                      [--dedup] [--output=FILE] INPUT\n");
+  return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  url_util::BulkOptions options;
+  std::string base_spec, output_path, value;
+  const char* input_path = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (GetFlag(argv[i], "threads", &value)) {
+      options.num_threads = atoi(value.c_str());
+    } else if (GetFlag(argv[i], "chunk-size", &value)) {
+      options.chunk_size = atoi(value.c_str());
+      if (options.chunk_size <= 0)
+        return Usage();
+    } else if (GetFlag(argv[i], "base", &value)) {
+      base_spec = value;
+    } else if (GetFlag(argv[i], "output", &value)) {
+      output_path = value;
+    } else if (strcmp(argv[i], "--dedup") == 0) {
+      options.dedup = true;
+    } else if (argv[i][0] == '-' || input_path) {
+      return Usage();
+    } else {
+      input_path = argv[i];
+    }
+  }
+  if (!input_path)
+    return Usage();
+
+  GURL base(base_spec);
+  if (!base_spec.empty()) {
+    if (!base.is_valid()) {
+      fprintf(stderr, "googleurl_bulk: invalid base URL %s\n",
+              base_spec.c_str());
+      return 1;
+    }
+    options.base = &base;
+  }
+
+  int input_fd = open(input_path, O_RDONLY);
+  struct stat input_stat;
+  if (input_fd < 0 || fstat(input_fd, &input_stat) != 0) {
+    fprintf(stderr, "googleurl_bulk: can't read %s: %s\n", input_path,
+            strerror(errno));
+    return 1;
+  }
+  size_t input_len = static_cast<size_t>(input_stat.st_size);
+  const char* input = NULL;
+  if (input_len) {
+    void* mapped = mmap(NULL, input_len, PROT_READ, MAP_PRIVATE, input_fd, 0);
+    if (mapped == MAP_FAILED) {
+      fprintf(stderr, "googleurl_bulk: can't map %s: %s\n", input_path,
+              strerror(errno));
+      return 1;
+    }
+    madvise(mapped, input_len, MADV_SEQUENTIAL);
+    input = static_cast<const char*>(mapped);
+  }
+
+  int output_fd = STDOUT_FILENO;
+  if (!output_path.empty()) {
+    output_fd = open(output_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (output_fd < 0) {
+      fprintf(stderr, "googleurl_bulk: can't write %s: %s\n",
+              output_path.c_str(), strerror(errno));
+      return 1;
+    }
+  }
+
+  FileSink sink(output_fd);
+  url_util::BulkStats stats;
+  double start = NowSeconds();
+  bool success = url_util::CanonicalizeLines(input, input_len, options,
+                                             &sink, &stats);
+  double seconds = NowSeconds() - start;
+  if (!success) {
+    fprintf(stderr, "googleurl_bulk: error writing output: %s\n",
+            strerror(errno));
+  }
+
+  if (seconds <= 0)
+    seconds = 1e-9;
+  fprintf(stderr,
+          "lines: %lld  valid: %lld  duplicates: %lld\n"
+          "input: %lld bytes  output: %lld bytes  chunks: %d  threads: %d\n"
+          "time: %.3f s  %.0f lines/s  %.1f MB/s\n",
+          static_cast<long long>(stats.lines),
+          static_cast<long long>(stats.valid_urls),
+          static_cast<long long>(stats.duplicates),
+          static_cast<long long>(stats.input_bytes),
+          static_cast<long long>(stats.output_bytes),
+          stats.chunks, stats.threads, seconds,
+          stats.lines / seconds, stats.input_bytes / seconds / 1e6);
+
+  if (input)
+    munmap(const_cast<char*>(input), input_len);
+  close(input_fd);
+  if (output_fd != STDOUT_FILENO && close(output_fd) != 0)
+    success = false;
+  return success ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Helpers for callers that often see URLs that are already canonical, for
+// example URLs read back from storage that were canonicalized when they were
+// written. These run the normal canonicalizer and check whether it had
+// anything to do, so the caller can keep the input instead of a copy.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_CANONICAL_H__
+#define GOOGLEURL_SRC_URL_UTIL_CANONICAL_H__
+
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+// Canonicalizes |spec| into the empty |output| exactly like Canonicalize() and
+// returns the same validity. In addition, |*already_canonical| is set when the
+// canonical output is byte-for-byte identical to the input. In that case the
+// input can be used in place of the output, and |*output_parsed| describes
+// both.
+GURL_API bool CanonicalizeAndCompare(
+    const char* spec,
+    int spec_len,
+    url_canon::CharsetConverter* charset_converter,
+    url_canon::CanonOutput* output,
+    url_parse::Parsed* output_parsed,
+    bool* already_canonical);
+
+// Returns true when |spec| is a valid URL that is already canonical. The
+// output of the check goes to a stack buffer and is thrown away, so this
+// doesn't allocate for URLs of normal length. |parsed| may be NULL; otherwise
+// it receives the parse of |spec| (only meaningful on success).
+GURL_API bool IsCanonical(const char* spec,
+                          int spec_len,
+                          url_parse::Parsed* parsed);
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_CANONICAL_H__
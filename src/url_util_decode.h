@@ -0,0 +1,56 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Unescaping that stays in UTF-8. DecodeURLEscapeSequences produces UTF-16,
+// which takes a temporary 8-bit buffer and a second pass over it. These write
+// the unescaped bytes directly, and since unescaping never makes a string
+// longer, can do it in the input buffer itself.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_DECODE_H__
+#define GOOGLEURL_SRC_URL_UTIL_DECODE_H__
+
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+
+namespace url_util {
+
+// Unescapes the |length| characters of |input| like DecodeURLEscapeSequences
+// does and appends the resulting bytes to |output|. Invalid escape sequences
+// are copied as they are. The bytes are not converted or checked, so invalid
+// UTF-8 comes out exactly as it was escaped.
+GURL_API void DecodeURLEscapeSequencesToUTF8(const char* input, int length,
+                                             url_canon::CanonOutput* output);
+
+// The same, but overwrites |input| with the result and returns its length,
+// which is never more than |length|. Input without escapes isn't written to.
+GURL_API int DecodeURLEscapeSequencesInPlace(char* input, int length);
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_DECODE_H__
@@ -0,0 +1,212 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_util_extract.h"
+
+#include <string.h>
+
+#include "googleurl/src/url_canon_internal.h"
+#include "googleurl/src/url_scheme_registry.h"
+#include "googleurl/src/url_util.h"
+
+namespace url_util {
+
+namespace {
+
+// Returns true for the bytes that end a URL in text or markup.
+inline bool IsURLDelimiter(unsigned char c) {
+  return c <= ' ' || c == 0x7f || c == '"' || c == '\'' || c == '<' ||
+      c == '>' || c == '`';
+}
+
+inline bool IsASCIIAlpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Returns the index of the first delimiter in [begin, len) of |data|, or
+// |len| if there isn't one.
+int FindDelimiter(const char* data, int begin, int len) {
+  for (int i = begin; i < len; i++) {
+    if (IsURLDelimiter(static_cast<unsigned char>(data[i])))
+      return i;
+  }
+  return len;
+}
+
+// Returns true if the closing bracket |close| at the end of [begin, end)
+// has no opening |open| to go with it.
+bool IsUnbalanced(const char* data, int begin, int end, char open,
+                  char close) {
+  int depth = 0;
+  for (int i = begin; i < end; i++) {
+    if (data[i] == open)
+      depth++;
+    else if (data[i] == close)
+      depth--;
+  }
+  return depth < 0;
+}
+
+// Returns where the URL in [begin, end) of |data| ends once punctuation
+// that's more likely to end the sentence around it is left out. It won't
+// go below |min_end|.
+int TrimURLEnd(const char* data, int begin, int end, int min_end) {
+  while (end > min_end) {
+    char c = data[end - 1];
+    if (c == '.' || c == ',' || c == ';' || c == ':' || c == '!' ||
+        c == '?') {
+      end--;
+    } else if ((c == ')' && IsUnbalanced(data, begin, end, '(', ')')) ||
+               (c == ']' && IsUnbalanced(data, begin, end, '[', ']'))) {
+      end--;
+    } else {
+      break;
+    }
+  }
+  return end;
+}
+
+}  // namespace
+
+URLExtractor::URLExtractor(URLExtractSink* sink)
+    : sink_(sink),
+      held_back_offset_(0),
+      skipping_(false),
+      offset_(0) {
+}
+
+URLExtractor::~URLExtractor() {
+}
+
+void URLExtractor::Feed(const char* data, int len) {
+  int begin = 0;
+  if (!held_back_.empty() || skipping_) {
+    // The text at the end of the last input goes on to the first delimiter
+    // here.
+    begin = FindDelimiter(data, 0, len);
+    if (!skipping_) {
+      if (static_cast<int>(held_back_.size()) > kMaxHeldBack - begin) {
+        skipping_ = true;
+        held_back_.clear();
+      } else {
+        held_back_.append(data, begin);
+      }
+    }
+    if (begin == len) {
+      offset_ += len;
+      return;
+    }
+    if (!skipping_) {
+      Scan(held_back_.data(), 0, static_cast<int>(held_back_.size()),
+           held_back_offset_);
+    }
+    held_back_.clear();
+    skipping_ = false;
+  }
+
+  // Everything after the last delimiter might be the start of a URL that
+  // goes on in the next input.
+  int end = len;
+  while (end > begin &&
+         !IsURLDelimiter(static_cast<unsigned char>(data[end - 1])))
+    end--;
+  Scan(data, begin, end, offset_);
+  if (end < len) {
+    if (len - end > kMaxHeldBack) {
+      skipping_ = true;
+    } else {
+      held_back_.assign(&data[end], len - end);
+      held_back_offset_ = offset_ + end;
+    }
+  }
+  offset_ += len;
+}
+
+void URLExtractor::Finish() {
+  if (!held_back_.empty()) {
+    Scan(held_back_.data(), 0, static_cast<int>(held_back_.size()),
+         held_back_offset_);
+  }
+  held_back_.clear();
+  held_back_offset_ = 0;
+  skipping_ = false;
+  offset_ = 0;
+}
+
+void URLExtractor::Scan(const char* data, int begin, int end, int64 offset) {
+  int search = begin;
+  while (search < end) {
+    const char* found = static_cast<const char*>(
+        memchr(&data[search], ':', end - search));
+    if (!found)
+      return;
+    int colon = static_cast<int>(found - data);
+    search = colon + 1;
+
+    // There must be "//" and the start of a host after the colon.
+    int host = colon + 3;
+    if (host >= end || data[colon + 1] != '/' || data[colon + 2] != '/' ||
+        IsURLDelimiter(static_cast<unsigned char>(data[host])) ||
+        url_parse::IsAuthorityTerminator(data[host]))
+      continue;
+
+    // The scheme is the run of scheme characters before the colon, from the
+    // first letter.
+    int url_begin = colon;
+    while (url_begin > begin &&
+           url_canon::CanonicalSchemeChar(data[url_begin - 1]))
+      url_begin--;
+    while (url_begin < colon && !IsASCIIAlpha(data[url_begin]))
+      url_begin++;
+    url_parse::Component scheme;
+    if (url_begin == colon ||
+        !url_parse::ExtractScheme(&data[url_begin], colon + 1 - url_begin,
+                                  &scheme) ||
+        url_begin + scheme.end() != colon)
+      continue;
+    scheme.begin += url_begin;
+    const SchemeInfo* info = FindSchemeInfo(data, scheme);
+    if (!info || info->type != SCHEME_STANDARD)
+      continue;
+
+    int url_end = TrimURLEnd(data, url_begin, FindDelimiter(data, host, end),
+                             host + 1);
+    search = url_end;
+
+    output_.set_length(0);
+    url_parse::Parsed parsed;
+    if (Canonicalize(&data[url_begin], url_end - url_begin, NULL, &output_,
+                     &parsed)) {
+      sink_->OnURL(output_.data(), output_.length(), parsed,
+                   offset + url_begin, url_end - url_begin);
+    }
+  }
+}
+
+}  // namespace url_util
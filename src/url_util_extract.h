@@ -0,0 +1,113 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Finds URLs like "http://www.google.com/" in text or markup and
+// canonicalizes them as they're found. The text can come in pieces, for
+// example as it's read from the network, and URLs that span two pieces are
+// still found. Each URL is canonicalized straight from the input into a
+// buffer the extractor reuses, so there's no allocation per URL.
+//
+// A URL is a standard scheme followed by "//" and a host, up to the next
+// whitespace, control character, quote, '<', '>' or '`'. Punctuation at the
+// end that's more likely to belong to the sentence, like a final period or
+// an unbalanced ')', is left out. Entities in markup aren't decoded.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_EXTRACT_H__
+#define GOOGLEURL_SRC_URL_UTIL_EXTRACT_H__
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+class GURL_API URLExtractSink {
+ public:
+  virtual ~URLExtractSink() {}
+
+  // Called for each valid URL, in the order they're in the input. |spec| and
+  // |parsed| are the canonical URL, and are only valid during the call. The
+  // URL was the |len| bytes starting at |offset| in the input, counting from
+  // the first byte passed to the extractor.
+  virtual void OnURL(const char* spec,
+                     int spec_len,
+                     const url_parse::Parsed& parsed,
+                     int64 offset,
+                     int len) = 0;
+};
+
+class GURL_API URLExtractor {
+ public:
+  // The sink must outlive the extractor.
+  explicit URLExtractor(URLExtractSink* sink);
+  ~URLExtractor();
+
+  // Finds the URLs in the next |len| bytes of input. A URL that reaches the
+  // end of |data| is held back, copied, until the input that ends it
+  // arrives. A URL that would need more than kMaxHeldBack bytes held back
+  // is dropped.
+  void Feed(const char* data, int len);
+
+  // Ends the input, passing on a URL that was held back. The extractor can
+  // then be used for new input, with offsets starting over at 0.
+  void Finish();
+
+  static const int kMaxHeldBack = 1 << 20;
+
+ private:
+  // Finds the URLs in [begin, end) of |data|, which starts at |offset| in
+  // the input. Neither end can be in the middle of a URL.
+  void Scan(const char* data, int begin, int end, int64 offset);
+
+  URLExtractSink* sink_;
+
+  // The bytes held back from the end of the last input: the text after its
+  // last delimiter, which a URL might be part of. |held_back_offset_| is
+  // where they start in the input.
+  std::string held_back_;
+  int64 held_back_offset_;
+
+  // Set when too much was held back. Everything up to the next delimiter
+  // is skipped.
+  bool skipping_;
+
+  // How much input there has been since the last Finish().
+  int64 offset_;
+
+  url_canon::RawCanonOutput<1024> output_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLExtractor);
+};
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_EXTRACT_H__
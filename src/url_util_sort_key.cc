@@ -0,0 +1,274 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "googleurl/src/url_util_sort_key.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/logging.h"
+#include "googleurl/src/url_canon_host_classify.h"
+
+namespace url_util {
+
+namespace {
+
+// Separates the reversed host labels, and ends the host and the scheme.
+// Both sort below every character a canonical host or scheme can contain.
+const char kLabelSeparator = '\x01';
+const char kFieldTerminator = '\0';
+
+// Ranges at most this long are insertion sorted instead of bucketed; for
+// them the 257 counters of a radix pass cost more than the comparisons.
+const int kInsertionSortThreshold = 32;
+
+// Writes into a std::string that is kept at its full size. Only the part
+// before cur_len_ holds data, so going through many of these doesn't clear
+// the unused space every time the way StdStringCanonOutput would.
+class KeyBufferOutput : public url_canon::CanonOutput {
+ public:
+  KeyBufferOutput(std::string* str, int used) : str_(str) {
+    buffer_ = str_->empty() ? NULL : &(*str_)[0];
+    buffer_len_ = static_cast<int>(str_->size());
+    cur_len_ = used;
+  }
+
+  virtual void Resize(int sz) {
+    str_->resize(sz);
+    buffer_ = str_->empty() ? NULL : &(*str_)[0];
+    buffer_len_ = sz;
+  }
+
+ private:
+  std::string* str_;
+};
+
+// IP addresses keep their order; reversing "192.168.0.1" would scatter a
+// subnet. Host names can end in a digit too, like "srv.dc1", so the host
+// has to be classified.
+bool IsIPAddressHost(const char* host, int host_len) {
+  url_canon::CanonHostInfo host_info;
+  return url_canon::ClassifyHost(host, url_parse::Component(0, host_len),
+                                 &host_info) &&
+         host_info.IsIPAddress();
+}
+
+void AppendReversedHost(const char* host, int host_len,
+                        url_canon::CanonOutput* output) {
+  if (host_len == 0)
+    return;
+  if (IsIPAddressHost(host, host_len)) {
+    output->Append(host, host_len);
+    return;
+  }
+
+  int label_end = host_len;
+  for (int i = host_len - 1; i >= 0; i--) {
+    if (host[i] != '.')
+      continue;
+    output->Append(&host[i + 1], label_end - i - 1);
+    output->push_back(kLabelSeparator);
+    label_end = i;
+  }
+  output->Append(host, label_end);
+}
+
+// A range of indices still to be sorted, whose keys are known to share
+// their first |depth| bytes.
+struct SortRange {
+  int begin;
+  int end;
+  int depth;
+};
+
+// The byte of |key| at |depth| as a bucket number, with 0 meaning that the
+// key has ended.
+inline int BucketAt(const char* key, int key_len, int depth) {
+  return depth < key_len ?
+      static_cast<unsigned char>(key[depth]) + 1 : 0;
+}
+
+// How many bytes past |range.depth| all the keys in |range| share.
+int CommonPrefixLength(const URLSortKeyTable& table,
+                       const int* indices,
+                       const SortRange& range) {
+  const char* first = table.key(indices[range.begin]) + range.depth;
+  int common = table.key_len(indices[range.begin]) - range.depth;
+  for (int i = range.begin + 1; i < range.end && common > 0; i++) {
+    const char* key = table.key(indices[i]) + range.depth;
+    int len = std::min(common, table.key_len(indices[i]) - range.depth);
+    int same = 0;
+    while (same < len && key[same] == first[same])
+      same++;
+    common = same;
+  }
+  return common;
+}
+
+}  // namespace
+
+void AppendURLSortKey(const char* spec,
+                      const url_parse::Parsed& parsed,
+                      url_canon::CanonOutput* output) {
+  // Filesystem URLs are located by their inner URL.
+  const url_parse::Parsed* authority = &parsed;
+  if (!parsed.host.is_nonempty() && parsed.inner_parsed())
+    authority = parsed.inner_parsed();
+
+  if (authority->host.is_nonempty()) {
+    AppendReversedHost(&spec[authority->host.begin], authority->host.len,
+                       output);
+  }
+  output->push_back(kFieldTerminator);
+
+  int port = url_parse::PORT_UNSPECIFIED;
+  if (authority->port.is_nonempty()) {
+    port = url_parse::ParsePort(spec, authority->port);
+  } else if (authority->scheme.is_nonempty()) {
+    port = url_canon::DefaultPortForScheme(&spec[authority->scheme.begin],
+                                           authority->scheme.len);
+  }
+  if (port < 0)
+    port = 0;
+  output->push_back(static_cast<char>(port >> 8));
+  output->push_back(static_cast<char>(port & 0xff));
+
+  if (parsed.scheme.is_nonempty())
+    output->Append(&spec[parsed.scheme.begin], parsed.scheme.len);
+  output->push_back(kFieldTerminator);
+
+  int rest_begin = parsed.CountCharactersBefore(url_parse::Parsed::PATH,
+                                                false);
+  int spec_len = parsed.Length();
+  if (rest_begin < spec_len)
+    output->Append(&spec[rest_begin], spec_len - rest_begin);
+}
+
+int CompareURLSortKeys(const char* a, int a_len, const char* b, int b_len) {
+  int result = memcmp(a, b, a_len < b_len ? a_len : b_len);
+  if (result)
+    return result;
+  return a_len - b_len;
+}
+
+URLSortKeyTable::URLSortKeyTable() : offsets_(1, 0) {
+}
+
+URLSortKeyTable::~URLSortKeyTable() {
+}
+
+int URLSortKeyTable::Add(const char* spec, const url_parse::Parsed& parsed) {
+  KeyBufferOutput output(&keys_, offsets_.back());
+  AppendURLSortKey(spec, parsed, &output);
+  offsets_.push_back(output.length());
+  return size() - 1;
+}
+
+void URLSortKeyTable::Clear() {
+  offsets_.resize(1);
+}
+
+void URLSortKeyTable::Sort(std::vector<int>* order) const {
+  int count = size();
+  order->resize(count);
+  for (int i = 0; i < count; i++)
+    (*order)[i] = i;
+  if (count < 2)
+    return;
+
+  // Keeping the ranges still to be sorted on a list rather than recursing
+  // bounds the stack no matter how long a shared prefix is.
+  std::vector<SortRange> pending;
+  SortRange all = { 0, count, 0 };
+  pending.push_back(all);
+
+  std::vector<int> scratch(count);
+  int* indices = &(*order)[0];
+  while (!pending.empty()) {
+    SortRange range = pending.back();
+    pending.pop_back();
+
+    if (range.end - range.begin <= kInsertionSortThreshold) {
+      for (int i = range.begin + 1; i < range.end; i++) {
+        int index = indices[i];
+        const char* k = key(index) + range.depth;
+        int k_len = key_len(index) - range.depth;
+        int j = i;
+        for (; j > range.begin; j--) {
+          int other = indices[j - 1];
+          if (CompareURLSortKeys(key(other) + range.depth,
+                                 key_len(other) - range.depth,
+                                 k, k_len) <= 0)
+            break;
+          indices[j] = other;
+        }
+        indices[j] = index;
+      }
+      continue;
+    }
+
+    // URLs of the same site share long prefixes, and a pass that puts them
+    // all in one bucket is wasted, so first skip the bytes they all share.
+    range.depth += CommonPrefixLength(*this, indices, range);
+
+    // One counting sort pass on the byte at |depth|. It's stable, so keys
+    // that have ended (bucket 0) stay in the order they were added.
+    int bucket_begin[258] = { 0 };
+    for (int i = range.begin; i < range.end; i++) {
+      int index = indices[i];
+      bucket_begin[BucketAt(key(index), key_len(index), range.depth) + 1]++;
+    }
+    bucket_begin[0] = range.begin;
+    for (int b = 1; b < 258; b++)
+      bucket_begin[b] += bucket_begin[b - 1];
+
+    int next[257];
+    memcpy(next, bucket_begin, sizeof(next));
+    for (int i = range.begin; i < range.end; i++) {
+      int index = indices[i];
+      scratch[next[BucketAt(key(index), key_len(index), range.depth)]++] =
+          index;
+    }
+    memcpy(&indices[range.begin], &scratch[range.begin],
+           (range.end - range.begin) * sizeof(int));
+
+    // The keys in bucket 0 are all equal, so only the others need more work.
+    for (int b = 1; b < 257; b++) {
+      if (bucket_begin[b + 1] - bucket_begin[b] < 2)
+        continue;
+      SortRange sub = {
+        bucket_begin[b], bucket_begin[b + 1], range.depth + 1
+      };
+      pending.push_back(sub);
+    }
+  }
+}
+
+}  // namespace url_util
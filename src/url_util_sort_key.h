@@ -0,0 +1,118 @@
+// Copyright 2007, Google Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Sort keys that put URLs in host locality order: by host with its labels
+// reversed ("com.example.www"), then port, then path. All the URLs of a site
+// and its subdomains end up next to each other, which is what a crawl
+// frontier or a sharded on-disk index wants.
+//
+// A key is built straight from a canonical spec and its Parsed, and keys
+// compare with memcmp, so they can go into any byte-ordered store as they
+// are. URLSortKeyTable keeps the keys of many URLs in one buffer and sorts
+// them with a radix sort.
+
+#ifndef GOOGLEURL_SRC_URL_UTIL_SORT_KEY_H__
+#define GOOGLEURL_SRC_URL_UTIL_SORT_KEY_H__
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "googleurl/src/url_canon.h"
+#include "googleurl/src/url_common.h"
+#include "googleurl/src/url_parse.h"
+
+namespace url_util {
+
+// Appends the sort key of the canonical URL |spec| with |parsed| to
+// |output|. The key is:
+//
+//  - The host labels in reverse order, separated by 0x01 and followed by
+//    0x00. Canonical hosts never contain those bytes, so "com.example"
+//    sorts right before its subdomains. IP addresses are written as they
+//    are.
+//  - The port, or the scheme's default port, as two big-endian bytes.
+//  - The scheme, followed by 0x00.
+//  - Everything from the path on (path, query and ref) as it is.
+//
+// The username and password are not part of the key. Filesystem URLs use
+// the host and port of their inner URL. URLs without a host, like
+// "mailto:", have an empty host and sort first.
+GURL_API void AppendURLSortKey(const char* spec,
+                               const url_parse::Parsed& parsed,
+                               url_canon::CanonOutput* output);
+
+// Compares two keys from AppendURLSortKey bytewise. Returns a value less
+// than, equal to or greater than 0 like memcmp, with a key that is a prefix
+// of the other one sorting first.
+GURL_API int CompareURLSortKeys(const char* a, int a_len,
+                                const char* b, int b_len);
+
+// The sort keys of many URLs, back to back in a single buffer. URLs are
+// added once, then Sort() orders them without comparing whole keys: it's an
+// MSD radix sort over the key bytes, so most URLs are placed by looking at
+// each byte of their host once.
+class GURL_API URLSortKeyTable {
+ public:
+  URLSortKeyTable();
+  ~URLSortKeyTable();
+
+  // Adds the sort key of |spec| with |parsed| and returns its index, which
+  // is the number of keys added before it.
+  int Add(const char* spec, const url_parse::Parsed& parsed);
+
+  // Removes all keys, keeping the memory for reuse.
+  void Clear();
+
+  int size() const { return static_cast<int>(offsets_.size()) - 1; }
+
+  // The key for the URL at |index|.
+  const char* key(int index) const { return &keys_[0] + offsets_[index]; }
+  int key_len(int index) const {
+    return offsets_[index + 1] - offsets_[index];
+  }
+
+  // Replaces the contents of |order| with the indices of all the keys in
+  // sorted order. The sort is stable, so URLs with equal keys keep the
+  // order they were added in.
+  void Sort(std::vector<int>* order) const;
+
+ private:
+  // The keys, back to back. Only the first offsets_.back() bytes are used.
+  std::string keys_;
+
+  // Where each key starts in |keys_|, followed by where the next one would.
+  std::vector<int> offsets_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLSortKeyTable);
+};
+
+}  // namespace url_util
+
+#endif  // GOOGLEURL_SRC_URL_UTIL_SORT_KEY_H__